@@ -28,9 +28,11 @@
 
 namespace Simd
 {
-#ifdef SIMD_AMXBF16_ENABLE    
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
     namespace AmxBf16
     {
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType);
     }
 #endif
 }
@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdAvx512vnni.h"
+#include "Simd/SimdAmxBf16.h"
+#include "Simd/SimdTile.h"
+
+namespace Simd
+{
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+    namespace AmxBf16
+    {
+        template<bool is32f> SIMD_INLINE void Gemm8u8iSave(const int32_t* src, int32_t zero, float scale, const int32_t* bSum,
+            const float* bScale, const float* bias, uint8_t* dst, __mmask16 tail)
+        {
+            __m512i sum = _mm512_sub_epi32(_mm512_loadu_si512(src), _mm512_mullo_epi32(_mm512_set1_epi32(zero), _mm512_loadu_si512(bSum)));
+            if (is32f)
+            {
+                __m512 val = _mm512_fmadd_ps(_mm512_cvtepi32_ps(sum), _mm512_mul_ps(_mm512_set1_ps(scale), _mm512_loadu_ps(bScale)), _mm512_loadu_ps(bias));
+                _mm512_mask_storeu_ps((float*)dst, tail, val);
+            }
+            else
+                _mm512_mask_storeu_epi32((int32_t*)dst, tail, sum);
+        }
+
+        template<bool is32f> void Gemm8u8iTiles(size_t M, size_t N, size_t KA, const uint8_t* A, const int8_t* B, const int32_t* zero,
+            const float* scale, const int32_t* bSum, const float* bScale, const float* bias, uint8_t* C, size_t ldc)
+        {
+            SIMD_ALIGNED(64) int32_t buf[16][32];
+            int strideA = (int)KA;
+            size_t rows = 0;
+            for (size_t i = 0; i < M; i += 16)
+            {
+                size_t dM = Simd::Min<size_t>(16, M - i);
+                if (dM != rows)
+                {
+                    TileConf conf;
+                    conf.rows[0] = uint8_t(dM);
+                    conf.rows[1] = uint8_t(dM);
+                    conf.rows[4] = uint8_t(dM);
+                    conf.rows[6] = 16;
+                    conf.rows[7] = 16;
+                    conf.colsb[0] = 64;
+                    conf.colsb[1] = 64;
+                    conf.colsb[4] = 64;
+                    conf.colsb[6] = 64;
+                    conf.colsb[7] = 64;
+                    _tile_loadconfig(&conf);
+                    rows = dM;
+                }
+                const uint8_t* A0 = A + i * KA;
+                for (size_t j = 0; j < N; j += 32)
+                {
+                    size_t dN = Simd::Min<size_t>(32, N - j);
+                    const int8_t* B0 = B + j * KA;
+                    const int8_t* B1 = B0 + KA * 16;
+                    _tile_zero(0);
+                    if (dN > 16)
+                        _tile_zero(1);
+                    for (size_t k = 0; k < KA; k += 64)
+                    {
+                        _tile_loadd(4, A0 + k, strideA);
+                        _tile_loadd(6, B0 + k * 16, 64);
+                        _tile_dpbusd(0, 4, 6);
+                        if (dN > 16)
+                        {
+                            _tile_loadd(7, B1 + k * 16, 64);
+                            _tile_dpbusd(1, 4, 7);
+                        }
+                    }
+                    _tile_stored(0, buf[0] + 0, 128);
+                    if (dN > 16)
+                        _tile_stored(1, buf[0] + 16, 128);
+                    __mmask16 tail0 = Avx512bw::TailMask16(dN), tail1 = Avx512bw::TailMask16(dN - 16);
+                    for (size_t r = 0; r < dM; ++r)
+                    {
+                        uint8_t* pC = C + (i + r) * ldc + j * 4;
+                        Gemm8u8iSave<is32f>(buf[r] + 0, zero[i + r], scale[i + r], bSum + j, bScale + j, bias + j, pC, tail0);
+                        if (dN > 16)
+                            Gemm8u8iSave<is32f>(buf[r] + 16, zero[i + r], scale[i + r], bSum + j + 16, bScale + j + 16, bias + j + 16, pC + 64, tail1);
+                    }
+                }
+            }
+            _tile_release();
+        }
+
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType)
+        {
+            if (M < 16)
+            {
+#if defined(SIMD_AMX_EMULATE)
+                Avx512bw::Gemm8u8i(M, N, K, A, lda, transA, B, ldb, transB, aZero, aScale, bScale, bias, C, ldc, cType);
+#else
+                Avx512vnni::Gemm8u8i(M, N, K, A, lda, transA, B, ldb, transB, aZero, aScale, bScale, bias, C, ldc, cType);
+#endif
+                return;
+            }
+            size_t KA = AlignHi(K, 64), NF = AlignHi(N, 16);
+            Array8u bufA(M * KA);
+            Array8i bufB(NF * KA);
+            Array32i bSum(NF), zero(M);
+            Array32f scale(M), colScale(NF), colShift(NF);
+            Base::Gemm8u8iPackA(M, K, A, lda, transA, KA, bufA.data);
+            Base::Gemm8u8iPackB(K, N, B, ldb, transB, 16, KA, bufB.data, bSum.data);
+            Base::Gemm8u8iSetRowParams(M, aZero, aScale, zero.data, scale.data);
+            Base::Gemm8u8iSetColParams(N, NF, bScale, bias, colScale.data, colShift.data);
+            if (cType == SimdTensorData32f)
+                Gemm8u8iTiles<true>(M, N, KA, bufA.data, bufB.data, zero.data, scale.data, bSum.data, colScale.data, colShift.data, (uint8_t*)C, ldc * 4);
+            else
+                Gemm8u8iTiles<false>(M, N, KA, bufA.data, bufB.data, zero.data, scale.data, bSum.data, colScale.data, colShift.data, (uint8_t*)C, ldc * 4);
+        }
+    }
+#endif
+}
@@ -23,6 +23,9 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdSynetDeconvolution8i.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
@@ -71,6 +74,19 @@ namespace Simd
             else
                 return new Base::SynetConvolution8iGemmNN(param);
         }
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            return Simd::SynetInnerProduct8i::Create(param, AmxBf16::SynetConvolution8iInit);
+        }
+
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+        {
+            DeconvParam8i param(batch, conv, compatibility);
+            return Simd::SynetDeconvolution8i::Create(param, AmxBf16::SynetConvolution8iInit, Avx512bw::ConvolutionBiasAndActivation, Avx512bw::SynetConvert32fTo8u);
+        }
     }
 #endif
 }
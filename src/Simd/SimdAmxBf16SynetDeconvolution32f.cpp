@@ -0,0 +1,44 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynet.h"
+
+namespace Simd
+{
+#if (defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))) && defined(SIMD_SYNET_ENABLE)
+    namespace AmxBf16
+    {
+        void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
+        {
+            DeconvParam32f param(batch, conv, compatibility);
+            if (!param.Valid())
+                return NULL;
+            if ((Base::Bf16Soft(compatibility) || Base::Bf16Hard(compatibility)) && Base::SynetDeconvolution32fBf16::Preferable(param))
+                return new Base::SynetDeconvolution32fBf16(param, AmxBf16::SynetConvolution32fInit, Avx512bw::ConvolutionBiasAndActivation);
+            return Avx512bw::SynetDeconvolution32fInit(batch, conv, compatibility);
+        }
+    }
+#endif
+}
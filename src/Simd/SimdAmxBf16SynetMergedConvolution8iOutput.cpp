@@ -426,6 +426,8 @@ namespace Simd
             case SimdConvolutionActivationHswish: SetOutput<SimdConvolutionActivationHswish>(p, output); break;
             case SimdConvolutionActivationMish: SetOutput<SimdConvolutionActivationMish>(p, output); break;
             case SimdConvolutionActivationSwish: SetOutput<SimdConvolutionActivationSwish>(p, output); break;
+            case SimdConvolutionActivationGelu: SetOutput<SimdConvolutionActivationGelu>(p, output); break;
+            case SimdConvolutionActivationGeluTanh: SetOutput<SimdConvolutionActivationGeluTanh>(p, output); break;
             }
         }
     }
@@ -33,28 +33,32 @@ namespace Simd
     {
         T * const data;
         size_t const size;
+        bool const external;
 
         SIMD_INLINE Array(size_t size_ = 0, bool clear = false, size_t align = SIMD_ALIGN)
             : data(0)
             , size(0)
+            , external(false)
         {
             Resize(size_, clear);
         }
 
         SIMD_INLINE ~Array()
         {
-            if (data)
+            if (data && !external)
                 Simd::Free(data);
         }
 
         SIMD_INLINE void Resize(size_t size_, bool clear = false, size_t align = SIMD_ALIGN)
         {
-            if (size_ != size)
+            if (size_ != size || external)
             {
                 if (data)
                 {
-                    Simd::Free(data);
+                    if (!external)
+                        Simd::Free(data);
                     *(T**)&data = 0;
+                    *(bool*)&external = false;
                 }
                 *(size_t*)&size = size_;
                 if (size_)
@@ -71,6 +75,14 @@ namespace Simd
                 memcpy(data, src, RawSize());
         }
 
+        SIMD_INLINE void Attach(const T * src, size_t size_)
+        {
+            Resize(0);
+            *(T**)&data = (T*)src;
+            *(size_t*)&size = src ? size_ : 0;
+            *(bool*)&external = src != NULL;
+        }
+
         SIMD_INLINE void Clear()
         {
             memset(data, 0, RawSize());
@@ -80,6 +92,7 @@ namespace Simd
         {
             Simd::Swap((T*&)data, (T*&)(array.data));
             Simd::Swap((size_t&)size, (size_t&)(array.size));
+            Simd::Swap((bool&)external, (bool&)(array.external));
         }
 
         SIMD_INLINE T & operator[] (size_t i)
@@ -107,6 +120,7 @@ namespace Simd
             uint8_t* released = data;
             *(T**)&data = NULL;
             *(size_t*)&size = 0;
+            *(bool*)&external = false;
             return released;
         }
     };
@@ -119,6 +133,7 @@ namespace Simd
     typedef Array<uint32_t> Array32u;
     typedef Array<float> Array32f;
 
+    typedef Array<const uint8_t*> Array8ucp;
     typedef Array<uint16_t*> Array16up;
     typedef Array<const uint16_t*> Array16ucp;
 
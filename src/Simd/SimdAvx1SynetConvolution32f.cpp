@@ -721,7 +721,9 @@ namespace Simd
                     for (size_t i = 0; i < _count; ++i)
                         dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
+                if (_add)
+                    Sse41::ConvolutionBiasAddActivation(NULL, _count, 1, _param.activation, _params, ::SimdTrue, _add + b * _sizeD, dst);
+                else if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
                 src += _sizeS;
                 dst += _sizeD;
@@ -36,7 +36,9 @@ namespace Simd
          SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
             : Sse41::SynetConvolution32fDirectNchw(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
         }
 
         template <size_t size> SIMD_INLINE void LoadWeight(const float * src, __m256 * dst)
@@ -266,7 +268,7 @@ namespace Simd
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr func = NULL;
@@ -276,15 +278,15 @@ namespace Simd
                 {
                 case 1:
                     if (p.kernelX == 1)
-                        func = Avx::SetConvolutionBiasActivation<1, 1>(p.activation);
+                        func = Avx::SetConvolutionBiasActivation<1, 1>(activation);
                     if (p.kernelX == 2)
-                        func = Avx::SetConvolutionBiasActivation<2, 1>(p.activation);
+                        func = Avx::SetConvolutionBiasActivation<2, 1>(activation);
                     if (p.kernelX == 3)
-                        func = Avx::SetConvolutionBiasActivation<3, 1>(p.activation);
+                        func = Avx::SetConvolutionBiasActivation<3, 1>(activation);
                     break;
                 }
             }
-            return func ? func : Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+            return func ? func : Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
         }
     }
 #endif
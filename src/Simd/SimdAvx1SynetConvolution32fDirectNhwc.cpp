@@ -36,7 +36,9 @@ namespace Simd
         SynetConvolution32fDirectNhwc::SynetConvolution32fDirectNhwc(const ConvParam32f & p)
             : Sse41::SynetConvolution32fDirectNhwc(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
         }
 
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
@@ -1122,13 +1124,13 @@ namespace Simd
             return NULL;
         }
 
-        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr func = NULL;
             if (p.dstC >= F && p.dstH >= p.padY + p.padH && p.dstW >= p.padX + p.padW)
             {
-                switch (p.activation)
+                switch (activation)
                 {
                 case ::SimdConvolutionActivationIdentity: func = GetConvolutionBiasActivation<::SimdConvolutionActivationIdentity>(p); break;
                 case ::SimdConvolutionActivationRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRelu>(p); break;
@@ -1140,7 +1142,7 @@ namespace Simd
                 default: break;
                 }
             }
-            return func ? func : Sse41::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation();
+            return func ? func : Sse41::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(activation);
         };
     }
 #endif
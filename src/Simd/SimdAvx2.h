@@ -146,6 +146,10 @@ namespace Simd
 
         void BgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
 
+        void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
+        void BgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
         void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
         void BgrToYuv422p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -201,6 +205,13 @@ namespace Simd
         void DetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+        void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes);
+
+        size_t DetectionFilterScores32f(const float* scores, size_t count, float threshold, uint32_t* indices);
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores);
+
         void EdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
             uint8_t * background, size_t backgroundStride);
 
@@ -251,6 +262,18 @@ namespace Simd
 
         void CosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
+        void DistancesTopK32f(size_t M, size_t N, size_t K, const float* A, const float* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+
+        void DistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+
+        void DistancesTopK8i(size_t M, size_t N, size_t K, const float* A, const int8_t* B, const float* scales, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance);
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances);
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances);
+
         void GaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
@@ -258,6 +281,9 @@ namespace Simd
 
         void Gemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType);
+
         void GrayToBgr(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgr, size_t bgrStride);
 
         void GrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
@@ -380,12 +406,33 @@ namespace Simd
             size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY,
             void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
         void OperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
 
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void P010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
         void VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
 
         void ReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
@@ -502,6 +549,10 @@ namespace Simd
 
         void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
 
+        void SynetGelu32f(const float* src, size_t size, float* dst);
+
+        void SynetGeluTanh32f(const float* src, size_t size, float* dst);
+
         void SynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
 
         void SynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
@@ -513,6 +564,12 @@ namespace Simd
         void SynetNormalizeLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale,
             const float* eps, SimdBool acrossSpatial, SimdTensorFormatType format, float* buf, float* dst);
 
+        void SynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        void SynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
         void SynetPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW,
             size_t kernelC, size_t kernelY, size_t kernelX, size_t strideC, size_t strideY, size_t strideX,
             size_t padC, size_t padY, size_t padX, float* dst, size_t dstC, size_t dstH, size_t dstW, SimdTensorFormatType format);
@@ -520,6 +577,12 @@ namespace Simd
         void SynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+        void SynetRoiAlign32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        void SynetRoiPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
         void SynetScaleLayerForward(const float* src, const float* scale, const float* bias, size_t channels, size_t height, size_t width, float* dst, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
         void SynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat,
@@ -529,6 +592,12 @@ namespace Simd
 
         void SynetSoftmaxLayerForward(const float * src, size_t outer, size_t size, size_t inner, float * dst);
 
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+
+        void SynetSoftmaxArgMax32f(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob);
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob);
+
         void SynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst);
 
         void SynetSwish32f(const float* src, size_t size, const float* slope, float* dst);
@@ -563,6 +632,24 @@ namespace Simd
         void Yuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             const uint8_t* a, size_t aStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, SimdYuvType yuvType);
 
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Yuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+        void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Yuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
         void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_SHUFFLE_BGRA_TO_PLANAR = SIMD_MM256_SETR_EPI8(
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+
+        const __m256i K32_PERMUTE_BGRA_TO_PLANAR = SIMD_MM256_SETR_EPI32(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7);
+
+        template <bool align, size_t N> SIMD_INLINE void LoadPlanar(const uint8_t* bgr, __m256i& b, __m256i& g, __m256i& r)
+        {
+            if (N == 3)
+            {
+                __m256i _bgr[3] = { Load<align>((__m256i*)bgr + 0), Load<align>((__m256i*)bgr + 1), Load<align>((__m256i*)bgr + 2) };
+                b = BgrToBlue(_bgr);
+                g = BgrToGreen(_bgr);
+                r = BgrToRed(_bgr);
+            }
+            else
+            {
+                __m256i bgra0 = _mm256_shuffle_epi8(Load<align>((__m256i*)bgr + 0), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m256i bgra1 = _mm256_shuffle_epi8(Load<align>((__m256i*)bgr + 1), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m256i bgra2 = _mm256_shuffle_epi8(Load<align>((__m256i*)bgr + 2), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m256i bgra3 = _mm256_shuffle_epi8(Load<align>((__m256i*)bgr + 3), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m256i bbgg0 = _mm256_unpacklo_epi32(bgra0, bgra1);
+                __m256i bbgg1 = _mm256_unpacklo_epi32(bgra2, bgra3);
+                b = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(bbgg0, bbgg1), K32_PERMUTE_BGRA_TO_PLANAR);
+                g = _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(bbgg0, bbgg1), K32_PERMUTE_BGRA_TO_PLANAR);
+                r = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(_mm256_unpackhi_epi32(bgra0, bgra1),
+                    _mm256_unpackhi_epi32(bgra2, bgra3)), K32_PERMUTE_BGRA_TO_PLANAR);
+            }
+        }
+
+        SIMD_INLINE __m256i AveragePairs(__m256i a0, __m256i a1)
+        {
+            return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(_mm256_maddubs_epi16(a0, K8_01), _mm256_maddubs_epi16(a1, K8_01)), K16_0002), 2);
+        }
+
+        template <bool align, class T, size_t N> SIMD_INLINE void BgrToNv12(const uint8_t* bgr, size_t bgrStride, uint8_t* y, size_t yStride, uint8_t* uv)
+        {
+            __m256i b0, g0, r0, b1, g1, r1;
+            LoadPlanar<align, N>(bgr, b0, g0, r0);
+            Store<align>((__m256i*)y, BgrToY8<T>(b0, g0, r0));
+            LoadPlanar<align, N>(bgr + bgrStride, b1, g1, r1);
+            Store<align>((__m256i*)(y + yStride), BgrToY8<T>(b1, g1, r1));
+            __m256i b16 = AveragePairs(b0, b1);
+            __m256i g16 = AveragePairs(g0, g1);
+            __m256i r16 = AveragePairs(r0, r1);
+            __m256i u16 = BgrToU16<T>(b16, g16, r16);
+            __m256i v16 = BgrToV16<T>(b16, g16, r16);
+            Store<align>((__m256i*)uv, _mm256_or_si256(u16, _mm256_slli_epi16(v16, 8)));
+        }
+
+        template <bool align, class T, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    BgrToNv12<align, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    BgrToNv12<false, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col);
+                }
+                bgr += 2 * bgrStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template <bool align, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<align, Base::Bt601, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<align, Base::Bt709, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<align, Base::Bt2020, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12<align, Base::Trect871, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride))
+                BgrToNv12<true, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+            else
+                BgrToNv12<false, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<3>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<4>(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+    }
+#endif
+}
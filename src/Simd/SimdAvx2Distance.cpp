@@ -0,0 +1,247 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 DistanceLoad(const float* p)
+        {
+            return _mm256_loadu_ps(p);
+        }
+
+        SIMD_INLINE __m256 DistanceLoad(const uint16_t* p)
+        {
+            return _mm256_cvtph_ps(_mm_loadu_si128((__m128i*)p));
+        }
+
+        SIMD_INLINE __m256 DistanceLoad(const int8_t* p)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i*)p)));
+        }
+
+        template<class T, int M, int N> SIMD_INLINE void DistanceDots(size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots, size_t ldd)
+        {
+            size_t KF = AlignLo(K, F);
+            const T* b[N];
+            __m256 d[M][N];
+            for (size_t j = 0; j < N; ++j)
+            {
+                b[j] = (const T*)(B + j * ldb);
+                for (size_t i = 0; i < M; ++i)
+                    d[i][j] = _mm256_setzero_ps();
+            }
+            for (size_t k = 0; k < KF; k += F)
+            {
+                __m256 a[M];
+                for (size_t i = 0; i < M; ++i)
+                    a[i] = _mm256_loadu_ps(A + i * K + k);
+                for (size_t j = 0; j < N; ++j)
+                {
+                    __m256 _b = DistanceLoad(b[j] + k);
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm256_fmadd_ps(a[i], _b, d[i][j]);
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+            {
+                float* dst = dots + i * ldd;
+                if (N == 4)
+                    _mm_storeu_ps(dst, Avx::Extract4Sums(d[i]));
+                else
+                {
+                    for (size_t j = 0; j < N; ++j)
+                        dst[j] = Avx::ExtractSum(d[i][j]);
+                }
+                for (size_t k = KF; k < K; ++k)
+                    for (size_t j = 0; j < N; ++j)
+                        dst[j] += A[i * K + k] * Base::DistanceValue(b[j][k]);
+            }
+        }
+
+        template<class T> void DistanceDots(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots)
+        {
+            size_t M3 = AlignLoAny(M, 3), N4 = AlignLo(N, 4), i = 0;
+            for (; i < M3; i += 3)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    DistanceDots<T, 3, 4>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    DistanceDots<T, 3, 1>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+            }
+            for (; i < M; i += 1)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    DistanceDots<T, 1, 4>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    DistanceDots<T, 1, 1>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+            }
+        }
+
+        template<class T> void DistanceSquares(size_t N, size_t K, const uint8_t* B, size_t ldb, float* squares)
+        {
+            size_t KF = AlignLo(K, F);
+            for (size_t j = 0; j < N; ++j)
+            {
+                const T* b = (const T*)(B + j * ldb);
+                __m256 sum = _mm256_setzero_ps();
+                for (size_t k = 0; k < KF; k += F)
+                {
+                    __m256 _b = DistanceLoad(b + k);
+                    sum = _mm256_fmadd_ps(_b, _b, sum);
+                }
+                squares[j] = Avx::ExtractSum(sum);
+                for (size_t k = KF; k < K; ++k)
+                    squares[j] += Simd::Square(Base::DistanceValue(b[k]));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void DistancesTopK32f(size_t M, size_t N, size_t K, const float* A, const float* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Base::DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(float), NULL, type, top, indices, distances, DistanceDots<float>, DistanceSquares<float>);
+        }
+
+        void DistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Array32f a(M * K);
+            Float16ToFloat32(A, M * K, a.data);
+            Base::DistancesTopK(M, N, K, a.data, (const uint8_t*)B, K * sizeof(uint16_t), NULL, type, top, indices, distances, DistanceDots<uint16_t>, DistanceSquares<uint16_t>);
+        }
+
+        void DistancesTopK8i(size_t M, size_t N, size_t K, const float* A, const int8_t* B, const float* scales, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Base::DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(int8_t), scales, type, top, indices, distances, DistanceDots<int8_t>, DistanceSquares<int8_t>);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int M, int N> SIMD_INLINE void Int8QuantizedDots(size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots, size_t ldd)
+        {
+            size_t K16 = AlignLo(K, 16);
+            const uint8_t* a[M], * b[N];
+            __m256i d[M][N], _a[M], _b;
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A[i] + Base::INT8_QUANTIZED_HEADER;
+            for (size_t j = 0; j < N; ++j)
+            {
+                b[j] = B[j] + Base::INT8_QUANTIZED_HEADER;
+                for (size_t i = 0; i < M; ++i)
+                    d[i][j] = _mm256_setzero_si256();
+            }
+            for (size_t k = 0; k < K16; k += 16)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _a[i] = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(a[i] + k)));
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(b[j] + k)));
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm256_add_epi32(d[i][j], _mm256_madd_epi16(_a[i], _b));
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                {
+                    int32_t sum = (int32_t)ExtractSum<uint32_t>(d[i][j]);
+                    for (size_t k = K16; k < K; ++k)
+                        sum += int32_t(a[i][k]) * int32_t(b[j][k]);
+                    dots[i * ldd + j] = sum;
+                }
+            }
+        }
+
+        static void Int8QuantizedDots(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots)
+        {
+            size_t M3 = AlignLoAny(M, 3), N4 = AlignLo(N, 4), i = 0;
+            for (; i < M3; i += 3)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<3, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<3, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+            for (; i < M; i += 1)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<1, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<1, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+        }
+
+        static void Int8QuantizedStats(size_t K, const uint8_t* a, int32_t* sum, int32_t* squares)
+        {
+            size_t K16 = AlignLo(K, 16);
+            __m256i s = _mm256_setzero_si256(), q = _mm256_setzero_si256();
+            for (size_t k = 0; k < K16; k += 16)
+            {
+                __m256i _a = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(a + k)));
+                s = _mm256_add_epi32(s, _mm256_madd_epi16(_a, K16_0001));
+                q = _mm256_add_epi32(q, _mm256_madd_epi16(_a, _a));
+            }
+            *sum = (int32_t)ExtractSum<uint32_t>(s);
+            *squares = (int32_t)ExtractSum<uint32_t>(q);
+            for (size_t k = K16; k < K; ++k)
+            {
+                *sum += a[k];
+                *squares += int32_t(a[k]) * int32_t(a[k]);
+            }
+        }
+
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance)
+        {
+            Base::Int8QuantizedDistances(1, 1, size, &a, &b, type, distance, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances)
+        {
+            Base::Int8QuantizedDistances(M, N, K, A, B, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances)
+        {
+            Array8ucp a(M), b(N);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * (K + Base::INT8_QUANTIZED_HEADER);
+            for (size_t j = 0; j < N; ++j)
+                b[j] = B + j * (K + Base::INT8_QUANTIZED_HEADER);
+            Base::Int8QuantizedDistances(M, N, K, a.data, b.data, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+    }
+#endif
+}
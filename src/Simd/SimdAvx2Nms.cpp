@@ -0,0 +1,188 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<SimdBoxEncodingType encoding> SIMD_INLINE void DecodeBoxes2(const float* delta, const float* anchor, __m256 params, float* box)
+        {
+            __m256 a = _mm256_loadu_ps(anchor);
+            __m256 size = _mm256_shuffle_ps(a, a, 0xEE);
+            __m256 center, exp;
+            if (encoding == SimdBoxEncodingSsd)
+            {
+                __m256 t = _mm256_mul_ps(_mm256_loadu_ps(delta), params);
+                center = _mm256_add_ps(a, _mm256_mul_ps(t, size));
+                exp = Exponent(t);
+            }
+            else
+            {
+                exp = Exponent(_mm256_mul_ps(_mm256_loadu_ps(delta), _mm256_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f)));
+                center = _mm256_add_ps(a, _mm256_div_ps(params, _mm256_add_ps(_mm256_set1_ps(1.0f), exp)));
+            }
+            center = _mm256_shuffle_ps(center, center, 0x44);
+            __m256 half = _mm256_mul_ps(_mm256_mul_ps(size, _mm256_set1_ps(0.5f)), _mm256_shuffle_ps(exp, exp, 0xEE));
+            _mm256_storeu_ps(box, _mm256_add_ps(center, _mm256_mul_ps(half, _mm256_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f))));
+        }
+
+        template<SimdBoxEncodingType encoding> void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, const float* params, float* boxes)
+        {
+            __m256 _params = Avx::Set(_mm_loadu_ps(params));
+            size_t count2 = AlignLo(count, 2), i = 0;
+            for (; i < count2; i += 2)
+                DecodeBoxes2<encoding>(deltas + i * 4, anchors + i * 4, _params, boxes + i * 4);
+            for (; i < count; ++i)
+                Base::DecodeBox(deltas + i * 4, anchors + i * 4, encoding, params, boxes + i * 4);
+        }
+
+        void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes)
+        {
+            if (encoding == SimdBoxEncodingSsd)
+                DetectionDecodeBoxes32f<SimdBoxEncodingSsd>(deltas, anchors, count, params, boxes);
+            else
+                DetectionDecodeBoxes32f<SimdBoxEncodingYolo>(deltas, anchors, count, params, boxes);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t count, float threshold, uint32_t* indices)
+        {
+            size_t count8 = AlignLo(count, 8), i = 0, size = 0;
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            for (; i < count8; i += 8)
+            {
+                uint32_t mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), _threshold, _CMP_GT_OQ));
+                for (; mask; mask &= mask - 1)
+                    indices[size++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            for (; i < count; ++i)
+            {
+                indices[size] = (uint32_t)i;
+                size += scores[i] > threshold ? 1 : 0;
+            }
+            return size;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct NmsBox
+        {
+            __m256 x0, y0, x1, y1, area;
+
+            SIMD_INLINE NmsBox(const float* box)
+            {
+                x0 = _mm256_set1_ps(box[0]);
+                y0 = _mm256_set1_ps(box[1]);
+                x1 = _mm256_set1_ps(box[2]);
+                y1 = _mm256_set1_ps(box[3]);
+                area = _mm256_set1_ps(box[4]);
+            }
+
+            SIMD_INLINE __m256 Intersection(const float* soa, size_t stride, size_t i) const
+            {
+                __m256 w = _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(soa + 2 * stride + i), x1), _mm256_max_ps(_mm256_loadu_ps(soa + 0 * stride + i), x0));
+                __m256 h = _mm256_sub_ps(_mm256_min_ps(_mm256_loadu_ps(soa + 3 * stride + i), y1), _mm256_max_ps(_mm256_loadu_ps(soa + 1 * stride + i), y0));
+                return _mm256_mul_ps(_mm256_max_ps(w, _mm256_setzero_ps()), _mm256_max_ps(h, _mm256_setzero_ps()));
+            }
+        };
+
+        static bool NmsOverlap(const float* soa, size_t stride, size_t size, const float* box, float threshold)
+        {
+            NmsBox _box(box);
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            size_t size8 = AlignLo(size, 8), i = 0;
+            for (; i < size8; i += 8)
+            {
+                __m256 intersection = _box.Intersection(soa, stride, i);
+                __m256 _union = _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(soa + 4 * stride + i), _box.area), intersection);
+                if (_mm256_movemask_ps(_mm256_cmp_ps(intersection, _mm256_mul_ps(_threshold, _union), _CMP_GT_OQ)))
+                    return true;
+            }
+            for (; i < size; ++i)
+                if (Base::NmsBoxOverlap(soa, stride, i, box, threshold))
+                    return true;
+            return false;
+        }
+
+        static size_t NmsDecay(const float* soa, size_t stride, size_t size, const float* box, SimdNmsType type, float threshold, float gamma, float* scores)
+        {
+            NmsBox _box(box);
+            __m256 _threshold = _mm256_set1_ps(threshold), _gamma = _mm256_set1_ps(gamma), _1 = _mm256_set1_ps(1.0f);
+            __m256 maxScore = _mm256_set1_ps(-FLT_MAX);
+            __m256i maxIndex = _mm256_setzero_si256(), index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            size_t size8 = AlignLo(size, 8), i = 0;
+            for (; i < size8; i += 8)
+            {
+                __m256 intersection = _box.Intersection(soa, stride, i);
+                __m256 _union = _mm256_sub_ps(_mm256_add_ps(_mm256_loadu_ps(soa + 4 * stride + i), _box.area), intersection);
+                __m256 iou = _mm256_and_ps(_mm256_div_ps(intersection, _union), _mm256_cmp_ps(_union, _mm256_setzero_ps(), _CMP_GT_OQ));
+                __m256 decay;
+                if (type == SimdNmsSoftLinear)
+                    decay = _mm256_blendv_ps(_1, _mm256_sub_ps(_1, iou), _mm256_cmp_ps(iou, _threshold, _CMP_GT_OQ));
+                else
+                    decay = Exponent(_mm256_mul_ps(_mm256_mul_ps(iou, iou), _gamma));
+                __m256 score = _mm256_mul_ps(_mm256_loadu_ps(scores + i), decay);
+                _mm256_storeu_ps(scores + i, score);
+                __m256 greater = _mm256_cmp_ps(score, maxScore, _CMP_GT_OQ);
+                maxScore = _mm256_blendv_ps(maxScore, score, greater);
+                maxIndex = _mm256_blendv_epi8(maxIndex, index, _mm256_castps_si256(greater));
+                index = _mm256_add_epi32(index, _mm256_set1_epi32(8));
+            }
+            float scoreBuf[8];
+            int32_t indexBuf[8];
+            _mm256_storeu_ps(scoreBuf, maxScore);
+            _mm256_storeu_si256((__m256i*)indexBuf, maxIndex);
+            size_t best = indexBuf[0];
+            float bestScore = scoreBuf[0];
+            for (size_t j = 1; j < 8; ++j)
+            {
+                if (scoreBuf[j] > bestScore || (scoreBuf[j] == bestScore && (size_t)indexBuf[j] < best))
+                    best = indexBuf[j], bestScore = scoreBuf[j];
+            }
+            for (; i < size; ++i)
+            {
+                scores[i] *= Base::NmsBoxDecay(soa, stride, i, box, type, threshold, gamma);
+                if (scores[i] > bestScore)
+                    best = i, bestScore = scores[i];
+            }
+            return best;
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores)
+        {
+            return Base::DetectionNms(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, dstScores, DetectionFilterScores32f, NmsOverlap, NmsDecay);
+        }
+    }
+#endif
+}
@@ -0,0 +1,159 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template <bool align> SIMD_INLINE void StoreBgr(const __m256i& b, const __m256i& g, const __m256i& r, uint8_t* bgr)
+        {
+            Store<align>((__m256i*)bgr + 0, InterleaveBgr<0>(b, g, r));
+            Store<align>((__m256i*)bgr + 1, InterleaveBgr<1>(b, g, r));
+            Store<align>((__m256i*)bgr + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        template <bool align> SIMD_INLINE void StoreBgra(const __m256i& b, const __m256i& g, const __m256i& r, const __m256i& a, uint8_t* bgra)
+        {
+            __m256i bg0 = PermutedUnpackLoU8(b, g);
+            __m256i bg1 = PermutedUnpackHiU8(b, g);
+            __m256i ra0 = PermutedUnpackLoU8(r, a);
+            __m256i ra1 = PermutedUnpackHiU8(r, a);
+            Store<align>((__m256i*)bgra + 0, UnpackU16<0>(bg0, ra0));
+            Store<align>((__m256i*)bgra + 1, UnpackU16<0>(bg1, ra1));
+            Store<align>((__m256i*)bgra + 2, UnpackU16<1>(bg0, ra0));
+            Store<align>((__m256i*)bgra + 3, UnpackU16<1>(bg1, ra1));
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> SIMD_INLINE void YuvToAny(__m256i y, __m256i u, __m256i v, const __m256i& a, uint8_t* dst)
+        {
+            __m256i b = YuvToBlue<T>(y, u);
+            __m256i g = YuvToGreen<T>(y, u, v);
+            __m256i r = YuvToRed<T>(y, v);
+            if (format == SimdPixelFormatBgr24)
+                StoreBgr<align>(b, g, r, dst);
+            else if (format == SimdPixelFormatBgra32)
+                StoreBgra<align>(b, g, r, a, dst);
+            else if (format == SimdPixelFormatRgb24)
+                StoreBgr<align>(r, g, b, dst);
+            else
+                StoreBgra<align>(r, g, b, a, dst);
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> SIMD_INLINE void Nv12ToAny(const uint8_t* y, size_t yStride,
+            const uint8_t* uv, const __m256i& a, uint8_t* dst, size_t dstStride)
+        {
+            const size_t N = (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) ? 3 : 4;
+            __m256i uv0 = Load<align>((__m256i*)uv + 0);
+            __m256i uv1 = Load<align>((__m256i*)uv + 1);
+            __m256i u = _mm256_packus_epi16(_mm256_and_si256(uv0, K16_00FF), _mm256_and_si256(uv1, K16_00FF));
+            __m256i v = _mm256_packus_epi16(_mm256_srli_epi16(uv0, 8), _mm256_srli_epi16(uv1, 8));
+            __m256i u0 = _mm256_unpacklo_epi8(u, u), u1 = _mm256_unpackhi_epi8(u, u);
+            __m256i v0 = _mm256_unpacklo_epi8(v, v), v1 = _mm256_unpackhi_epi8(v, v);
+            YuvToAny<align, T, format>(Load<align>((__m256i*)y + 0), u0, v0, a, dst + 0 * N * A);
+            YuvToAny<align, T, format>(Load<align>((__m256i*)y + 1), u1, v1, a, dst + 1 * N * A);
+            YuvToAny<align, T, format>(Load<align>((__m256i*)(y + yStride) + 0), u0, v0, a, dst + dstStride + 0 * N * A);
+            YuvToAny<align, T, format>(Load<align>((__m256i*)(y + yStride) + 1), u1, v1, a, dst + dstStride + 1 * N * A);
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) ? 3 : 4;
+            __m256i a = _mm256_set1_epi8(alpha);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += DA)
+                    Nv12ToAny<align, T, format>(y + col, yStride, uv + col, a, dst + col * N, dstStride);
+                if (tail)
+                {
+                    size_t col = width - DA;
+                    Nv12ToAny<false, T, format>(y + col, yStride, uv + col, a, dst + col * N, dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<align, Base::Bt601, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<align, Base::Bt709, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<align, Base::Bt2020, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<align, Base::Trect871, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride))
+                Nv12ToAny<true, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                Nv12ToAny<false, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgr24>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgra32>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgb24>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgba32>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+    }
+#endif
+}
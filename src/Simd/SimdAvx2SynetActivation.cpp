@@ -69,6 +69,78 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template<bool align> SIMD_INLINE void SynetGelu32f(const float* src, float* dst, size_t offset)
+        {
+            Avx::Store<align>(dst + offset, Gelu(Avx::Load<align>(src + offset)));
+        }
+
+        template<bool align> void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                SynetGelu32f<align>(src, dst, i + 0 * F);
+                SynetGelu32f<align>(src, dst, i + 1 * F);
+                SynetGelu32f<align>(src, dst, i + 2 * F);
+                SynetGelu32f<align>(src, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                SynetGelu32f<align>(src, dst, i);
+            for (; i < size; ++i)
+                dst[i] = Base::SynetGelu32f(src[i]);
+        }
+
+        void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGelu32f<true>(src, size, dst);
+            else
+                SynetGelu32f<false>(src, size, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool align> SIMD_INLINE void SynetGeluTanh32f(const float* src, float* dst, size_t offset)
+        {
+            Avx::Store<align>(dst + offset, GeluTanh(Avx::Load<align>(src + offset)));
+        }
+
+        template<bool align> void SynetGeluTanh32f(const float* src, size_t size, float* dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                SynetGeluTanh32f<align>(src, dst, i + 0 * F);
+                SynetGeluTanh32f<align>(src, dst, i + 1 * F);
+                SynetGeluTanh32f<align>(src, dst, i + 2 * F);
+                SynetGeluTanh32f<align>(src, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                SynetGeluTanh32f<align>(src, dst, i);
+            for (; i < size; ++i)
+                dst[i] = Base::SynetGeluTanh32f(src[i]);
+        }
+
+        void SynetGeluTanh32f(const float* src, size_t size, float* dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGeluTanh32f<true>(src, size, dst);
+            else
+                SynetGeluTanh32f<false>(src, size, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<bool align> SIMD_INLINE void SynetMish32f(const float* src, __m256 threshold, float* dst, size_t offset)
         {
             Avx::Store<align>(dst + offset, Mish(Avx::Load<align>(src + offset), threshold));
@@ -0,0 +1,181 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration32f.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx2
+    {
+        SynetCalibration32f::SynetCalibration32f(const Base::Calibration32fParam& param)
+            : Sse41::SynetCalibration32f(param)
+        {
+        }
+
+        SIMD_INLINE float ReduceMin(__m256 value)
+        {
+            __m128 _value = _mm_min_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            _value = _mm_min_ps(_value, _mm_movehl_ps(_value, _value));
+            return _mm_cvtss_f32(_mm_min_ss(_value, _mm_shuffle_ps(_value, _value, 1)));
+        }
+
+        SIMD_INLINE float ReduceMax(__m256 value)
+        {
+            __m128 _value = _mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            _value = _mm_max_ps(_value, _mm_movehl_ps(_value, _value));
+            return _mm_cvtss_f32(_mm_max_ss(_value, _mm_shuffle_ps(_value, _value, 1)));
+        }
+
+        void SynetCalibration32f::Range(const float* src, size_t spatial, float* min, float* max)
+        {
+            size_t C = _param.channels;
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m256 _min = _mm256_set1_ps(FLT_MAX), _max = _mm256_set1_ps(-FLT_MAX);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(src + s);
+                        _min = _mm256_min_ps(_min, _src);
+                        _max = _mm256_max_ps(_max, _src);
+                    }
+                    float lo = ReduceMin(_min), hi = ReduceMax(_max);
+                    for (; s < spatial; ++s)
+                    {
+                        lo = Simd::Min(lo, src[s]);
+                        hi = Simd::Max(hi, src[s]);
+                    }
+                    min[c] = lo;
+                    max[c] = hi;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), c;
+                for (c = 0; c < C; ++c)
+                {
+                    min[c] = FLT_MAX;
+                    max[c] = -FLT_MAX;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m256 _src = _mm256_loadu_ps(src + c);
+                        _mm256_storeu_ps(min + c, _mm256_min_ps(_mm256_loadu_ps(min + c), _src));
+                        _mm256_storeu_ps(max + c, _mm256_max_ps(_mm256_loadu_ps(max + c), _src));
+                    }
+                    for (; c < C; ++c)
+                    {
+                        min[c] = Simd::Min(min[c], src[c]);
+                        max[c] = Simd::Max(max[c], src[c]);
+                    }
+                    src += C;
+                }
+            }
+        }
+
+        SIMD_INLINE __m256i HistogramIndex(__m256 value, __m256 scale, __m256i bins, __m256i last)
+        {
+            __m256i index = _mm256_min_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), value), scale)), last);
+            return _mm256_add_epi32(index, _mm256_and_si256(_mm256_castps_si256(_mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ)), bins));
+        }
+
+        SIMD_INLINE void HistogramIncrement(const int32_t* index, uint32_t* histogram)
+        {
+            histogram[index[0]]++;
+            histogram[index[1]]++;
+            histogram[index[2]]++;
+            histogram[index[3]]++;
+            histogram[index[4]]++;
+            histogram[index[5]]++;
+            histogram[index[6]]++;
+            histogram[index[7]]++;
+        }
+
+        void SynetCalibration32f::Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram)
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            __m256i _bins = _mm256_set1_epi32((int)bins), _last = _mm256_set1_epi32((int)bins - 1);
+            SIMD_ALIGNED(32) int32_t index[F];
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m256 _scale = _mm256_set1_ps(scale[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        _mm256_store_si256((__m256i*)index, HistogramIndex(_mm256_loadu_ps(src + s), _scale, _bins, _last));
+                        HistogramIncrement(index, histogram);
+                    }
+                    for (; s < spatial; ++s)
+                        histogram[Base::HistogramIndex(src[s], scale[c], (int)bins)]++;
+                    histogram += bins * 2;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), c;
+                __m256i _step = _mm256_set1_epi32(int(bins * 2 * F));
+                __m256i _start = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(int(bins * 2)));
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    __m256i _offset = _start;
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m256i _index = HistogramIndex(_mm256_loadu_ps(src + c), _mm256_loadu_ps(scale + c), _bins, _last);
+                        _mm256_store_si256((__m256i*)index, _mm256_add_epi32(_index, _offset));
+                        HistogramIncrement(index, histogram);
+                        _offset = _mm256_add_epi32(_offset, _step);
+                    }
+                    for (; c < C; ++c)
+                        histogram[c * bins * 2 + Base::HistogramIndex(src[c], scale[c], (int)bins)]++;
+                    src += C;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format)
+        {
+            Base::Calibration32fParam param(channels, bins ? bins : 2048, format);
+            if (!param.Valid())
+                return NULL;
+            return new Avx2::SynetCalibration32f(param);
+        }
+    }
+#endif
+}
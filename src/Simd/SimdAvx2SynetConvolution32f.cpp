@@ -161,12 +161,154 @@ namespace Simd
                 else
                     SynetSwish32f(dst, size * count, &slope, dst);
             }
+            else if (activation == ::SimdConvolutionActivationGelu)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m256 value = _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(bias + i));
+                                _mm256_storeu_ps(dst + i, Avx2::Gelu(value));
+                            }
+                            for (; i < count; ++i)
+                                dst[i] = Base::SynetGelu32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m256 _bias = _mm256_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m256 value = _mm256_add_ps(_mm256_loadu_ps(dst + j), _bias);
+                                _mm256_storeu_ps(dst + j, Avx2::Gelu(value));
+                            }
+                            for (; j < size; ++j)
+                                dst[j] = Base::SynetGelu32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGelu32f(dst, size * count, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationGeluTanh)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m256 value = _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(bias + i));
+                                _mm256_storeu_ps(dst + i, Avx2::GeluTanh(value));
+                            }
+                            for (; i < count; ++i)
+                                dst[i] = Base::SynetGeluTanh32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m256 _bias = _mm256_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m256 value = _mm256_add_ps(_mm256_loadu_ps(dst + j), _bias);
+                                _mm256_storeu_ps(dst + j, Avx2::GeluTanh(value));
+                            }
+                            for (; j < size; ++j)
+                                dst[j] = Base::SynetGeluTanh32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGeluTanh32f(dst, size * count, dst);
+            }
             else
                 Avx::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
         }
 
         //---------------------------------------------------------------------
 
+        template<::SimdConvolutionActivationType type> void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            if (trans)
+            {
+                size_t countF = AlignLo(count, F);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < countF; i += F)
+                    {
+                        __m256 value = _mm256_add_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(add + i));
+                        if (bias)
+                            value = _mm256_add_ps(value, _mm256_loadu_ps(bias + i));
+                        _mm256_storeu_ps(dst + i, Activate<type>(value, params, i));
+                    }
+                    for (; i < count; ++i)
+                        dst[i] = Base::Activate<type>(dst[i] + add[i] + (bias ? bias[i] : 0.0f), params, i);
+                    add += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                const ::SimdConvolutionActivationType row = type == ::SimdConvolutionActivationPrelu ? ::SimdConvolutionActivationLeakyRelu : type;
+                size_t sizeF = AlignLo(size, F);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const float* ps = type == ::SimdConvolutionActivationPrelu ? params + i : params;
+                    float shift = bias ? bias[i] : 0.0f;
+                    __m256 _shift = _mm256_set1_ps(shift);
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm256_storeu_ps(dst + j, Activate<row>(_mm256_add_ps(_mm256_add_ps(_mm256_loadu_ps(dst + j), _mm256_loadu_ps(add + j)), _shift), ps, 0));
+                    for (; j < size; ++j)
+                        dst[j] = Base::Activate<type>(dst[j] + add[j] + shift, params, i);
+                    add += size;
+                    dst += size;
+                }
+            }
+        }
+
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: ConvolutionBiasAddActivation<::SimdConvolutionActivationIdentity>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationLeakyRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationLeakyRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRestrictRange: ConvolutionBiasAddActivation<::SimdConvolutionActivationRestrictRange>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationPrelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationPrelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationElu: ConvolutionBiasAddActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHswish: ConvolutionBiasAddActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationMish: ConvolutionBiasAddActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHardSigmoid: ConvolutionBiasAddActivation<::SimdConvolutionActivationHardSigmoid>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationSwish: ConvolutionBiasAddActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGeluTanh: ConvolutionBiasAddActivation<::SimdConvolutionActivationGeluTanh>(bias, count, size, params, trans, add, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
 
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : Avx::SynetConvolution32fGemmNN(p)
@@ -206,6 +348,7 @@ namespace Simd
                 _nhwcReorderB = Avx2::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx2::ConvolutionBiasAddActivation;
         }
 
         void SynetConvolution32fGemmNN::ImgToCol(const float * src, float * dst)
@@ -361,6 +504,7 @@ namespace Simd
                 _nhwcReorderB = Avx2::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx2::ConvolutionBiasAddActivation;
         }
 
         //---------------------------------------------------------------------
@@ -38,7 +38,10 @@ namespace Simd
         SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
             : Avx::SynetConvolution32fDirectNchw(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx2::ConvolutionBiasAddActivation;
         }
 
         template <size_t size> SIMD_INLINE void LoadWeight(const float * src, __m256 * dst)
@@ -199,6 +202,16 @@ namespace Simd
             return Avx2::Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const __m256* params)
+        {
+            return Avx2::Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGeluTanh>(__m256 value, const __m256* params)
+        {
+            return Avx2::GeluTanh(value);
+        }
+
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight,
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -338,39 +351,41 @@ namespace Simd
             case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
             case ::SimdConvolutionActivationHardSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHardSigmoid>;
             case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationGeluTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGeluTanh>;
             default:
                 assert(0);
                 return NULL;
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             if (p.dstW < F)
-                return Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             switch (p.strideX)
             {
             case 1:
                 if (p.kernelX == 1)
-                    return Avx2::SetConvolutionBiasActivation<1, 1>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<1, 1>(activation);
                 if (p.kernelX == 2)
-                    return Avx2::SetConvolutionBiasActivation<2, 1>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<2, 1>(activation);
                 if (p.kernelX == 3)
-                    return Avx2::SetConvolutionBiasActivation<3, 1>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<3, 1>(activation);
                 break;
             case 2:
                 if (p.kernelX == 2)
-                    return Avx2::SetConvolutionBiasActivation<2, 2>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<2, 2>(activation);
                 if (p.kernelX == 3)
-                    return Avx2::SetConvolutionBiasActivation<3, 2>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<3, 2>(activation);
                 break;
             case 3:
                 if (p.kernelX == 3)
-                    return Avx2::SetConvolutionBiasActivation<3, 3>(p.activation);
+                    return Avx2::SetConvolutionBiasActivation<3, 3>(activation);
                 break;
             }
-            return Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+            return Sse41::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
         }
     }
 #endif//SIMD_AVX2_ENABLE
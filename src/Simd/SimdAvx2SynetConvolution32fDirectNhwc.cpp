@@ -38,7 +38,10 @@ namespace Simd
         SynetConvolution32fDirectNhwc::SynetConvolution32fDirectNhwc(const ConvParam32f & p)
             : Avx::SynetConvolution32fDirectNhwc(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx2::ConvolutionBiasAddActivation;
         }
 
         SIMD_INLINE void KernelHwcDefaultEdge(const float * src, const ConvParam32f & p, size_t kH, size_t kW, const float * weight, __m256 & sum)
@@ -970,13 +973,13 @@ namespace Simd
             return NULL;
         }
 
-        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr func = NULL;
             if (p.dstC >= F && p.dstH >= p.padY + p.padH && p.dstW >= p.padX + p.padW)
             {
-                switch (p.activation)
+                switch (activation)
                 {
                 case ::SimdConvolutionActivationIdentity: func = GetConvolutionBiasActivation<::SimdConvolutionActivationIdentity>(p); break;
                 case ::SimdConvolutionActivationRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRelu>(p); break;
@@ -988,9 +991,11 @@ namespace Simd
                 case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
                 case ::SimdConvolutionActivationHardSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHardSigmoid>(p); break;
                 case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationGeluTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGeluTanh>(p); break;
                 }
             }
-            return func ? func : Avx::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation();
+            return func ? func : Avx::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(activation);
         };
     }
 #endif//SIMD_AVX2_ENABLE
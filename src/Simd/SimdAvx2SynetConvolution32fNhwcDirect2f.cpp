@@ -308,7 +308,7 @@ namespace Simd
         }
 
         template<SimdConvolutionActivationType type> void ConvolutionNhwcDirect_2(const float* src, const ConvParam32f& p,
-            const SynetConvolution32fNhwcDirect::AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+            const SynetConvolution32fNhwcDirect::AlgParam& a, const float* weight, const float* bias, const float* params, const float* add, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -320,10 +320,12 @@ namespace Simd
                     for (size_t yBeg = 0; yBeg < p.dstH;)
                     {
                         size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        if (add && sc == 0)
+                            CopyResidual(add + yBeg * p.dstW * p.dstC + dc, (yEnd - yBeg) * p.dstW, macroD, p.dstC, dst + yBeg * p.dstW * p.dstC + dc);
                         if (sc + macroC == p.srcC)
-                            ConvolutionNhwcDirect_2<TermLast, type>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            ConvolutionNhwcDirect_2<TermLast, type>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC && !add ? 1 : 0);
                         else
-                            ConvolutionNhwcDirect_2<TermInterim, SimdConvolutionActivationIdentity>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                            ConvolutionNhwcDirect_2<TermInterim, SimdConvolutionActivationIdentity>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 && !add ? 1 : 0);
                         yBeg = yEnd;
                     }
                     weight += AlignHiAny(macroD, a.microD) * macroK;
@@ -505,7 +507,7 @@ namespace Simd
         }
 
         template<SimdConvolutionActivationType type> void ConvolutionNhwcDirect1x1_2(const float* src, const ConvParam32f& p,
-            const SynetConvolution32fNhwcDirect::AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+            const SynetConvolution32fNhwcDirect::AlgParam& a, const float* weight, const float* bias, const float* params, const float* add, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -516,10 +518,12 @@ namespace Simd
                     for (size_t yBeg = 0; yBeg < p.dstH;)
                     {
                         size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        if (add && sc == 0)
+                            CopyResidual(add + yBeg * p.dstW * p.dstC + dc, (yEnd - yBeg) * p.dstW, macroD, p.dstC, dst + yBeg * p.dstW * p.dstC + dc);
                         if (sc + macroC == p.srcC)
-                            ConvolutionNhwcDirect1x1_2<TermLast, type>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            ConvolutionNhwcDirect1x1_2<TermLast, type>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC && !add ? 1 : 0);
                         else
-                            ConvolutionNhwcDirect1x1_2<TermInterim, SimdConvolutionActivationIdentity>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                            ConvolutionNhwcDirect1x1_2<TermInterim, SimdConvolutionActivationIdentity>(src + sc, p, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 && !add ? 1 : 0);
                         yBeg = yEnd;
                     }
                     weight += AlignHiAny(macroD, a.microD) * macroC;
@@ -553,6 +557,8 @@ namespace Simd
             case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(p, convolution); break;
             case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(p, convolution); break;
             case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(p, convolution); break;
+            case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, convolution); break;
+            case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(p, convolution); break;
             default: assert(0);
             }
             return true;
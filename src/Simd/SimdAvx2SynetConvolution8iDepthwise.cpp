@@ -166,6 +166,7 @@ namespace Simd
 						Save<term, activation, nofma>(dst, d00, norm, bias, params, scale, shift, upper, ci);
 					}
 					dst += p.dstC * a.size;
+					bias += a.biasStep;
 				}
 			}
 		}
@@ -357,6 +358,7 @@ namespace Simd
 			__m256i d00, d01, d02, d03, d10, d11, d12, d13, w00;
 			__m256i upper = _mm256_set1_epi32(a.upper);
 			size_t srcC = p.srcC;
+			size_t dstC = p.dstC * a.size;
 			size_t srcCF = AlignLo(srcC, F);
 			size_t srcCDF = AlignLo(srcC, DF);
 			size_t srcCQF = AlignLo(srcC, QF);
@@ -403,10 +405,10 @@ namespace Simd
 				Save<term, activation, nofma>(dst, d01, norm, bias, params, scale, shift, upper, c + F * 1);
 				Save<term, activation, nofma>(dst, d02, norm, bias, params, scale, shift, upper, c + F * 2);
 				Save<term, activation, nofma>(dst, d03, norm, bias, params, scale, shift, upper, c + F * 3);
-				Save<term, activation, nofma>(dst + srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + srcC, d12, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + srcC, d13, norm, bias, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + dstC, d10, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + dstC, d11, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + dstC, d12, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + dstC, d13, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 3);
 			}
 			for (; c < srcCDF; c += DF)
 			{
@@ -433,8 +435,8 @@ namespace Simd
 				}
 				Save<term, activation, nofma>(dst, d00, norm, bias, params, scale, shift, upper, c + F * 0);
 				Save<term, activation, nofma>(dst, d01, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + dstC, d10, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + dstC, d11, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 1);
 			}
 			for (; c < srcC; c += F)
 			{
@@ -453,7 +455,7 @@ namespace Simd
 					}
 				}
 				Save<term, activation, nofma>(dst, d00, norm, bias, params, scale, shift, upper, ct);
-				Save<term, activation, nofma>(dst + srcC, d10, norm, bias, params, scale, shift, upper, ct);
+				Save<term, activation, nofma>(dst + dstC, d10, norm, bias + a.biasStep, params, scale, shift, upper, ct);
 			}
 		}
 
@@ -470,23 +472,23 @@ namespace Simd
 			size_t dy = 0;
 			for (; dy < p.padY; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 			for (; dy < dstH; ++dy)
 			{
 				size_t dx = 0;
 				for (; dx < p.padX; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 				size_t offset = ((dy * p.strideY - p.padY) * p.srcW + dx * p.strideX - p.padX) * p.srcC;
 				for (; dx < dstW2; dx += 2)
-				    ConvolutionNhwcDepthwise3x3Main2<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, offset += srcX * 2;
+				    ConvolutionNhwcDepthwise3x3Main2<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, bias += a.biasStep * 2, offset += srcX * 2;
 				for (; dx < dstW; dx += 1)
-					ConvolutionNhwcDepthwise3x3Main1<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, offset += srcX;
+					ConvolutionNhwcDepthwise3x3Main1<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep, offset += srcX;
 				for (; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 			}
 			for (; dy < p.dstH; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 		}
 
 		//---------------------------------------------------------------------
@@ -529,6 +531,8 @@ namespace Simd
 			case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(p, d); break;
 			case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(p, d); break;
 			case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(p, d); break;
+			case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, d); break;
+			case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(p, d); break;
 			default: assert(0);
 			}
 		}
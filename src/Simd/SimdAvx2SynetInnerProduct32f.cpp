@@ -34,10 +34,94 @@ namespace Simd
 #if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
     namespace Avx2
     {
+        template<int rows> void InnerProduct32fSparse(size_t G, const float* src, size_t K, const float* value, const uint8_t* index, float* dst, size_t N, size_t tail)
+        {
+            __m256 d00 = _mm256_setzero_ps(), d01 = _mm256_setzero_ps(), d10 = _mm256_setzero_ps(), d11 = _mm256_setzero_ps(),
+                d20 = _mm256_setzero_ps(), d21 = _mm256_setzero_ps(), d30 = _mm256_setzero_ps(), d31 = _mm256_setzero_ps(), s, w0, w1;
+            __m256i _3 = _mm256_set1_epi32(3), i0, i1;
+            const float* src0 = src + 0 * K;
+            const float* src1 = src + 1 * K;
+            const float* src2 = src + 2 * K;
+            const float* src3 = src + 3 * K;
+            for (size_t g = 0, o = 0; g < G; g += 1, o += 4)
+            {
+                i0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)index));
+                i1 = _mm256_and_si256(_mm256_srli_epi32(i0, 2), _3);
+                i0 = _mm256_and_si256(i0, _3);
+                w0 = _mm256_loadu_ps(value + 0 * F);
+                w1 = _mm256_loadu_ps(value + 1 * F);
+                if (rows > 0)
+                {
+                    s = _mm256_broadcast_ps((__m128*)(src0 + o));
+                    d00 = _mm256_fmadd_ps(w0, _mm256_permutevar8x32_ps(s, i0), d00);
+                    d01 = _mm256_fmadd_ps(w1, _mm256_permutevar8x32_ps(s, i1), d01);
+                }
+                if (rows > 1)
+                {
+                    s = _mm256_broadcast_ps((__m128*)(src1 + o));
+                    d10 = _mm256_fmadd_ps(w0, _mm256_permutevar8x32_ps(s, i0), d10);
+                    d11 = _mm256_fmadd_ps(w1, _mm256_permutevar8x32_ps(s, i1), d11);
+                }
+                if (rows > 2)
+                {
+                    s = _mm256_broadcast_ps((__m128*)(src2 + o));
+                    d20 = _mm256_fmadd_ps(w0, _mm256_permutevar8x32_ps(s, i0), d20);
+                    d21 = _mm256_fmadd_ps(w1, _mm256_permutevar8x32_ps(s, i1), d21);
+                }
+                if (rows > 3)
+                {
+                    s = _mm256_broadcast_ps((__m128*)(src3 + o));
+                    d30 = _mm256_fmadd_ps(w0, _mm256_permutevar8x32_ps(s, i0), d30);
+                    d31 = _mm256_fmadd_ps(w1, _mm256_permutevar8x32_ps(s, i1), d31);
+                }
+                value += 2 * F;
+                index += F;
+            }
+            if (tail == F)
+            {
+                if (rows > 0) _mm256_storeu_ps(dst + 0 * N, _mm256_add_ps(d00, d01));
+                if (rows > 1) _mm256_storeu_ps(dst + 1 * N, _mm256_add_ps(d10, d11));
+                if (rows > 2) _mm256_storeu_ps(dst + 2 * N, _mm256_add_ps(d20, d21));
+                if (rows > 3) _mm256_storeu_ps(dst + 3 * N, _mm256_add_ps(d30, d31));
+            }
+            else
+            {
+                float buf[F];
+                if (rows > 0) _mm256_storeu_ps(buf, _mm256_add_ps(d00, d01)), memcpy(dst + 0 * N, buf, tail * 4);
+                if (rows > 1) _mm256_storeu_ps(buf, _mm256_add_ps(d10, d11)), memcpy(dst + 1 * N, buf, tail * 4);
+                if (rows > 2) _mm256_storeu_ps(buf, _mm256_add_ps(d20, d21)), memcpy(dst + 2 * N, buf, tail * 4);
+                if (rows > 3) _mm256_storeu_ps(buf, _mm256_add_ps(d30, d31)), memcpy(dst + 3 * N, buf, tail * 4);
+            }
+        }
+
+        static void SynetInnerProduct32fSparse(const float* src, size_t M, size_t N, size_t K, const float* value, const uint8_t* index, float* dst)
+        {
+            size_t G = K / 4, M4 = AlignLo(M, 4);
+            for (size_t n = 0; n < N; n += F)
+            {
+                size_t tail = Simd::Min(F, N - n);
+                size_t m = 0;
+                for (; m < M4; m += 4)
+                    InnerProduct32fSparse<4>(G, src + m * K, K, value, index, dst + m * N + n, N, tail);
+                switch (M - M4)
+                {
+                case 1: InnerProduct32fSparse<1>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                case 2: InnerProduct32fSparse<2>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                case 3: InnerProduct32fSparse<3>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                }
+                value += G * 2 * F;
+                index += G * F;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         SynetInnerProduct32fGemm::SynetInnerProduct32fGemm(const InnerProductParam32f& p)
             : Avx::SynetInnerProduct32fGemm(p)
         {
             _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _spF = F;
+            _sparse = SynetInnerProduct32fSparse;
             if (_param.transpose)
             {
                 if (_param.input > Sse41::F)
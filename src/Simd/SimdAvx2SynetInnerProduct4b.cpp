@@ -0,0 +1,79 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInnerProduct4b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdExtract.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE) 
+    namespace Avx2
+    {
+        static float Dot4b(const float* src, const uint8_t* weight, const float* scale, const float* shift, const float* sums, size_t input, size_t group)
+        {
+            const __m128i _0F = _mm_set1_epi8(0x0F);
+            __m256 total = _mm256_setzero_ps();
+            float tail = 0.0f;
+            for (size_t g = 0, beg = 0; beg < input; g += 1, beg += group)
+            {
+                size_t end = Simd::Min(beg + group, input), endA = beg + AlignLo(end - beg, 32), i = beg;
+                __m256 d0 = _mm256_setzero_ps(), d1 = _mm256_setzero_ps();
+                for (; i < endA; i += 32)
+                {
+                    __m128i w = _mm_loadu_si128((__m128i*)(weight + i / 2));
+                    __m128i lo = _mm_and_si128(w, _0F), hi = _mm_and_si128(_mm_srli_epi16(w, 4), _0F);
+                    __m128i u0 = _mm_unpacklo_epi8(lo, hi), u1 = _mm_unpackhi_epi8(lo, hi);
+                    d0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(u0)), _mm256_loadu_ps(src + i + 0), d0);
+                    d1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(u0, 8))), _mm256_loadu_ps(src + i + 8), d1);
+                    d0 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(u1)), _mm256_loadu_ps(src + i + 16), d0);
+                    d1 = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(u1, 8))), _mm256_loadu_ps(src + i + 24), d1);
+                }
+                float dot = 0.0f;
+                for (; i < end; ++i)
+                    dot += float((weight[i / 2] >> ((i & 1) * 4)) & 0xF) * src[i];
+                total = _mm256_fmadd_ps(_mm256_add_ps(d0, d1), _mm256_set1_ps(scale[g]), total);
+                tail += dot * scale[g] + shift[g] * sums[g];
+            }
+            return Avx::ExtractSum(total) + tail;
+        }
+
+        SynetInnerProduct4b::SynetInnerProduct4b(const InnerProductParam4b& p)
+            : Sse41::SynetInnerProduct4b(p)
+        {
+            _dot = Dot4b;
+            _biasAndActivation = Avx::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation)
+        {
+            InnerProductParam4b param(batch, input, output, group, transpose, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInnerProduct4b(param);
+        }
+    }
+#endif
+}
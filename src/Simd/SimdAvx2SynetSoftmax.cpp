@@ -345,6 +345,279 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE float SoftmaxRowMax(const float* src, size_t count)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            float max = src[0];
+            if (countF)
+            {
+                __m256 _max = _mm256_loadu_ps(src);
+                for (c = F; c < countF; c += F)
+                    _max = _mm256_max_ps(_max, _mm256_loadu_ps(src + c));
+                __m128 max128 = _mm_max_ps(_mm256_castps256_ps128(_max), _mm256_extractf128_ps(_max, 1));
+                max128 = _mm_max_ps(max128, _mm_movehl_ps(max128, max128));
+                max = _mm_cvtss_f32(_mm_max_ss(max128, _mm_shuffle_ps(max128, max128, 1)));
+            }
+            for (; c < count; ++c)
+                max = Simd::Max(max, src[c]);
+            return max;
+        }
+
+        SIMD_INLINE float SoftmaxRowSum(const Exp& exp, const float* src, size_t count, float max)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            __m256 _max = _mm256_set1_ps(max), _sum = _mm256_setzero_ps();
+            for (; c < countF; c += F)
+                _sum = _mm256_add_ps(_sum, exp.Exponent(_mm256_sub_ps(_mm256_loadu_ps(src + c), _max)));
+            float sum = Avx::ExtractSum(_sum);
+            for (; c < count; ++c)
+                sum += ::exp(src[c] - max);
+            return sum;
+        }
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                size_t countF = AlignLo(count, F);
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max = SoftmaxRowMax(src, count);
+                    float shift = max + ::log(SoftmaxRowSum(exp, src, count, max));
+                    __m256 _shift = _mm256_set1_ps(shift);
+                    size_t c = 0;
+                    for (; c < countF; c += F)
+                        _mm256_storeu_ps(dst + c, _mm256_sub_ps(_mm256_loadu_ps(src + c), _shift));
+                    for (; c < count; ++c)
+                        dst[c] = src[c] - shift;
+                    src += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                size_t aligned = Simd::AlignLo(inner, F);
+                Array32f tmp(inner * 2);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner, * d;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    memcpy(max, src, inner * sizeof(float));
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm256_storeu_ps(max + i, _mm256_max_ps(_mm256_loadu_ps(s + i), _mm256_loadu_ps(max + i)));
+                        for (; i < inner; ++i)
+                            max[i] = Simd::Max(max[i], s[i]);
+                        s += inner;
+                    }
+
+                    s = src;
+                    memset(sum, 0, inner * sizeof(float));
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm256_storeu_ps(sum + i, _mm256_add_ps(_mm256_loadu_ps(sum + i), exp.Exponent(_mm256_sub_ps(_mm256_loadu_ps(s + i), _mm256_loadu_ps(max + i)))));
+                        for (; i < inner; ++i)
+                            sum[i] += ::exp(s[i] - max[i]);
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        max[i] += ::log(sum[i]);
+
+                    s = src;
+                    d = dst;
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm256_storeu_ps(d + i, _mm256_sub_ps(_mm256_loadu_ps(s + i), _mm256_loadu_ps(max + i)));
+                        for (; i < inner; ++i)
+                            d[i] = s[i] - max[i];
+                        s += inner;
+                        d += inner;
+                    }
+                    src += count * inner;
+                    dst += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t SoftmaxRowArgMax(const float* src, size_t count, float& max)
+        {
+            size_t countF = AlignLo(count, F), c = 0, index = 0;
+            max = src[0];
+            if (countF)
+            {
+                __m256 _max = _mm256_loadu_ps(src);
+                __m256i _idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _cur = _idx, _step = _mm256_set1_epi32(F);
+                for (c = F; c < countF; c += F)
+                {
+                    _cur = _mm256_add_epi32(_cur, _step);
+                    __m256 _src = _mm256_loadu_ps(src + c);
+                    __m256 greater = _mm256_cmp_ps(_src, _max, _CMP_GT_OQ);
+                    _max = _mm256_blendv_ps(_max, _src, greater);
+                    _idx = _mm256_blendv_epi8(_idx, _cur, _mm256_castps_si256(greater));
+                }
+                SIMD_ALIGNED(32) float maxs[F];
+                SIMD_ALIGNED(32) int32_t idxs[F];
+                _mm256_store_ps(maxs, _max);
+                _mm256_store_si256((__m256i*)idxs, _idx);
+                max = maxs[0], index = idxs[0];
+                for (size_t i = 1; i < F; ++i)
+                {
+                    if (maxs[i] > max || (maxs[i] == max && size_t(idxs[i]) < index))
+                    {
+                        max = maxs[i];
+                        index = idxs[i];
+                    }
+                }
+            }
+            for (; c < count; ++c)
+            {
+                if (src[c] > max)
+                {
+                    max = src[c];
+                    index = c;
+                }
+            }
+            return index;
+        }
+
+        void SynetSoftmaxArgMax32f(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max;
+                    Base::SynetSoftmaxArgMaxStore(SoftmaxRowArgMax(src, count, max), indexType, index, o);
+                    if (prob)
+                        prob[o] = 1.0f / SoftmaxRowSum(exp, src, count, max);
+                    src += count;
+                }
+            }
+            else
+            {
+                size_t aligned = Simd::AlignLo(inner, F);
+                Array32f tmp(inner * 2);
+                Array32i idx(inner);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    memcpy(max, src, inner * sizeof(float));
+                    memset(idx.data, 0, inner * sizeof(int32_t));
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        __m256i _c = _mm256_set1_epi32((int)c);
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                        {
+                            __m256 _src = _mm256_loadu_ps(s + i), _max = _mm256_loadu_ps(max + i);
+                            __m256 greater = _mm256_cmp_ps(_src, _max, _CMP_GT_OQ);
+                            _mm256_storeu_ps(max + i, _mm256_blendv_ps(_max, _src, greater));
+                            _mm256_storeu_si256((__m256i*)(idx.data + i), _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(idx.data + i)), _c, _mm256_castps_si256(greater)));
+                        }
+                        for (; i < inner; ++i)
+                        {
+                            if (s[i] > max[i])
+                            {
+                                max[i] = s[i];
+                                idx[i] = (int32_t)c;
+                            }
+                        }
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        Base::SynetSoftmaxArgMaxStore(idx[i], indexType, index, o * inner + i);
+                    if (prob)
+                    {
+                        s = src;
+                        memset(sum, 0, inner * sizeof(float));
+                        for (size_t c = 0; c < count; ++c)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                                _mm256_storeu_ps(sum + i, _mm256_add_ps(_mm256_loadu_ps(sum + i), exp.Exponent(_mm256_sub_ps(_mm256_loadu_ps(s + i), _mm256_loadu_ps(max + i)))));
+                            for (; i < inner; ++i)
+                                sum[i] += ::exp(s[i] - max[i]);
+                            s += inner;
+                        }
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm256_storeu_ps(prob + o * inner + i, _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_loadu_ps(sum + i)));
+                        for (; i < inner; ++i)
+                            prob[o * inner + i] = 1.0f / sum[i];
+                    }
+                    src += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void SoftmaxRowTopK(const float* src, size_t count, size_t k, float* val, uint32_t* idx)
+        {
+            size_t countF = AlignLo(count, F), size = 0, c = 0;
+            for (; c < k; ++c)
+                Base::SynetSoftmaxTopKInsert(src[c], (uint32_t)c, k, size, val, idx);
+            for (; c < countF && c % F; ++c)
+                if (src[c] > val[k - 1])
+                    Base::SynetSoftmaxTopKInsert(src[c], (uint32_t)c, k, size, val, idx);
+            for (; c < countF; c += F)
+            {
+                if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(src + c), _mm256_set1_ps(val[k - 1]), _CMP_GT_OQ)))
+                {
+                    for (size_t j = c, end = c + F; j < end; ++j)
+                        if (src[j] > val[k - 1])
+                            Base::SynetSoftmaxTopKInsert(src[j], (uint32_t)j, k, size, val, idx);
+                }
+            }
+            for (; c < count; ++c)
+                if (src[c] > val[k - 1])
+                    Base::SynetSoftmaxTopKInsert(src[c], (uint32_t)c, k, size, val, idx);
+        }
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob)
+        {
+            Exp exp;
+            Array32f buf(inner > 1 ? count : 0), val(k);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    const float* row = src + i;
+                    if (inner > 1)
+                    {
+                        for (size_t c = 0; c < count; ++c)
+                            buf[c] = row[c * inner];
+                        row = buf.data;
+                    }
+                    SoftmaxRowTopK(row, count, k, val.data, index);
+                    if (prob)
+                    {
+                        float sum = SoftmaxRowSum(exp, row, count, val[0]);
+                        for (size_t j = 0; j < k; ++j)
+                            prob[j] = ::exp(val[j] - val[0]) / sum;
+                        prob += k;
+                    }
+                    index += k;
+                }
+                src += count * inner;
+            }
+        }
     }
 #endif
 }
@@ -0,0 +1,378 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template <bool align> SIMD_INLINE void StoreBgr(const __m256i& b, const __m256i& g, const __m256i& r, uint8_t* bgr)
+        {
+            Store<align>((__m256i*)bgr + 0, InterleaveBgr<0>(b, g, r));
+            Store<align>((__m256i*)bgr + 1, InterleaveBgr<1>(b, g, r));
+            Store<align>((__m256i*)bgr + 2, InterleaveBgr<2>(b, g, r));
+        }
+
+        template <bool align> SIMD_INLINE void StoreBgra(const __m256i& b, const __m256i& g, const __m256i& r, const __m256i& a, uint8_t* bgra)
+        {
+            __m256i bg0 = PermutedUnpackLoU8(b, g);
+            __m256i bg1 = PermutedUnpackHiU8(b, g);
+            __m256i ra0 = PermutedUnpackLoU8(r, a);
+            __m256i ra1 = PermutedUnpackHiU8(r, a);
+            Store<align>((__m256i*)bgra + 0, UnpackU16<0>(bg0, ra0));
+            Store<align>((__m256i*)bgra + 1, UnpackU16<0>(bg1, ra1));
+            Store<align>((__m256i*)bgra + 2, UnpackU16<1>(bg0, ra0));
+            Store<align>((__m256i*)bgra + 3, UnpackU16<1>(bg1, ra1));
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> SIMD_INLINE void YuvToAny(__m256i y, __m256i u, __m256i v, const __m256i& a, uint8_t* dst)
+        {
+            __m256i b = YuvToBlue<T>(y, u);
+            __m256i g = YuvToGreen<T>(y, u, v);
+            __m256i r = YuvToRed<T>(y, v);
+            if (format == SimdPixelFormatBgr24)
+                StoreBgr<align>(b, g, r, dst);
+            else if (format == SimdPixelFormatBgra32)
+                StoreBgra<align>(b, g, r, a, dst);
+            else if (format == SimdPixelFormatRgb24)
+                StoreBgr<align>(r, g, b, dst);
+            else
+                StoreBgra<align>(r, g, b, a, dst);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template <bool align> SIMD_INLINE __m256i LoadYuv16(const uint8_t* src, const __m128i& shift)
+        {
+            return _mm256_min_epu16(_mm256_srl_epi16(Load<align>((__m256i*)src), shift), K16_00FF);
+        }
+
+        template <bool align> SIMD_INLINE __m256i LoadYuv16To8(const uint8_t* src, const __m128i& shift)
+        {
+            return PackI16ToU8(LoadYuv16<align>(src + 0, shift), LoadYuv16<align>(src + A, shift));
+        }
+
+        SIMD_INLINE __m256i Duplicate8(const __m256i& value16)
+        {
+            return _mm256_or_si256(value16, _mm256_slli_epi16(value16, 8));
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> SIMD_INLINE void Yuv420p16ToBgr(const uint8_t* y, size_t yStride,
+            const uint8_t* u, const uint8_t* v, const __m128i& shift, const __m256i& a, uint8_t* dst, size_t dstStride)
+        {
+            __m256i _u = Duplicate8(LoadYuv16<align>(u, shift));
+            __m256i _v = Duplicate8(LoadYuv16<align>(v, shift));
+            YuvToAny<align, T, format>(LoadYuv16To8<align>(y, shift), _u, _v, a, dst);
+            YuvToAny<align, T, format>(LoadYuv16To8<align>(y + yStride, shift), _u, _v, a, dst + dstStride);
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> SIMD_INLINE void P010ToBgr(const uint8_t* y, size_t yStride,
+            const uint8_t* uv, const __m128i& shift, const __m256i& a, uint8_t* dst, size_t dstStride)
+        {
+            __m256i _uv = LoadYuv16To8<align>(uv, shift);
+            __m256i _u = Duplicate8(_mm256_and_si256(_uv, K16_00FF));
+            __m256i _v = Duplicate8(_mm256_srli_epi16(_uv, 8));
+            YuvToAny<align, T, format>(LoadYuv16To8<align>(y, shift), _u, _v, a, dst);
+            YuvToAny<align, T, format>(LoadYuv16To8<align>(y + yStride, shift), _u, _v, a, dst + dstStride);
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = format == SimdPixelFormatBgr24 ? 3 : 4;
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            __m256i a = _mm256_set1_epi8(alpha);
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    Yuv420p16ToBgr<align, T, format>(y + col * 2, yStride, u + col, v + col, _shift, a, dst + col * N, dstStride);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    Yuv420p16ToBgr<false, T, format>(y + col * 2, yStride, u + col, v + col, _shift, a, dst + col * N, dstStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = format == SimdPixelFormatBgr24 ? 3 : 4;
+            __m128i shift = _mm_cvtsi32_si128(8);
+            __m256i a = _mm256_set1_epi8(alpha);
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    P010ToBgr<align, T, format>(y + col * 2, yStride, uv + col * 2, shift, a, dst + col * N, dstStride);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    P010ToBgr<false, T, format>(y + col * 2, yStride, uv + col * 2, shift, a, dst + col * N, dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride,
+            const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = format == SimdPixelFormatBgr24 ? 3 : 4;
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            __m256i a = _mm256_set1_epi8(alpha);
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    YuvToAny<align, T, format>(LoadYuv16To8<align>(y + col * 2, _shift), LoadYuv16To8<align>(u + col * 2, _shift),
+                        LoadYuv16To8<align>(v + col * 2, _shift), a, dst + col * N);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    YuvToAny<false, T, format>(LoadYuv16To8<false>(y + col * 2, _shift), LoadYuv16To8<false>(u + col * 2, _shift),
+                        LoadYuv16To8<false>(v + col * 2, _shift), a, dst + col * N);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                dst += dstStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        enum Yuv16Layout
+        {
+            Yuv16Layout420p,
+            Yuv16LayoutP010,
+            Yuv16Layout444p,
+        };
+
+        template <bool align, Yuv16Layout layout, class T, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride, 
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            if (layout == Yuv16Layout420p)
+                Yuv420p16ToBgr<align, T, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha);
+            else if (layout == Yuv16LayoutP010)
+                P010ToBgr<align, T, format>(y, yStride, u, uStride, width, height, dst, dstStride, alpha);
+            else
+                Yuv444p16ToBgr<align, T, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha);
+        }
+
+        template <bool align, Yuv16Layout layout, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride, 
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, 
+            uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv16ToBgr<align, layout, Base::Bt601, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv16ToBgr<align, layout, Base::Bt709, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv16ToBgr<align, layout, Base::Bt2020, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv16ToBgr<align, layout, Base::Trect871, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <Yuv16Layout layout, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride,
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift,
+            uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(dst) && Aligned(dstStride))
+                Yuv16ToBgr<true, layout, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha, yuvType);
+            else
+                Yuv16ToBgr<false, layout, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha, yuvType);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout420p, SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout420p, SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr<Yuv16LayoutP010, SimdPixelFormatBgr24>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr<Yuv16LayoutP010, SimdPixelFormatBgra32>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout444p, SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout444p, SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Yuv16ToBgr32f(__m128i y, __m128i u, __m128i v, const __m256* p, float* blue, float* green, float* red)
+        {
+            __m256 _y = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(y)), p[0]);
+            __m256 _u = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(u));
+            __m256 _v = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(v));
+            __m256 _0 = _mm256_setzero_ps(), _1 = _mm256_set1_ps(1.0f);
+            _mm256_storeu_ps(blue, _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(_mm256_add_ps(_y, p[5]), _mm256_mul_ps(_u, p[1])), _0), _1));
+            _mm256_storeu_ps(green, _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_y, p[6]), _mm256_mul_ps(_u, p[2])), _mm256_mul_ps(_v, p[3])), _0), _1));
+            _mm256_storeu_ps(red, _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(_mm256_add_ps(_y, p[7]), _mm256_mul_ps(_v, p[4])), _0), _1));
+        }
+
+        const __m128i K8_SHUFFLE_P010_TO_U = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m128i K8_SHUFFLE_P010_TO_V = SIMD_MM_SETR_EPI8(0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template <Yuv16Layout layout> SIMD_INLINE void Yuv16ToBgr32f(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+            const __m256* p, float* blue, float* green, float* red)
+        {
+            __m128i _y = _mm_loadu_si128((__m128i*)y), _u, _v;
+            if (layout == Yuv16Layout420p)
+            {
+                _u = _mm_loadl_epi64((__m128i*)u);
+                _u = _mm_unpacklo_epi16(_u, _u);
+                _v = _mm_loadl_epi64((__m128i*)v);
+                _v = _mm_unpacklo_epi16(_v, _v);
+            }
+            else if (layout == Yuv16LayoutP010)
+            {
+                __m128i uv = _mm_loadu_si128((__m128i*)u);
+                _u = _mm_shuffle_epi8(uv, K8_SHUFFLE_P010_TO_U);
+                _v = _mm_shuffle_epi8(uv, K8_SHUFFLE_P010_TO_V);
+            }
+            else
+            {
+                _u = _mm_loadu_si128((__m128i*)u);
+                _v = _mm_loadu_si128((__m128i*)v);
+            }
+            Yuv16ToBgr32f(_y, _u, _v, p, blue, green, red);
+        }
+
+        template <Yuv16Layout layout> void Yuv16ToBgr32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int shift, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(width >= F);
+            if (layout != Yuv16Layout444p)
+                assert((width % 2 == 0) && (height % 2 == 0));
+
+            Base::Yuv16ToBgr32fParam param(shift, yuvType);
+            __m256 p[8];
+            p[0] = _mm256_set1_ps(param.yA);
+            p[1] = _mm256_set1_ps(param.uB);
+            p[2] = _mm256_set1_ps(param.uG);
+            p[3] = _mm256_set1_ps(param.vG);
+            p[4] = _mm256_set1_ps(param.vR);
+            p[5] = _mm256_set1_ps(param.bB);
+            p[6] = _mm256_set1_ps(param.bG);
+            p[7] = _mm256_set1_ps(param.bR);
+            const size_t uvStep = layout == Yuv16Layout420p ? 1 : 2;
+            size_t bodyWidth = AlignLo(width, F);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < bodyWidth; col += F)
+                    Yuv16ToBgr32f<layout>(y + col * 2, u + col * uvStep, v + col * uvStep, p, blue + col, green + col, red + col);
+                if (tail)
+                {
+                    size_t col = width - F;
+                    Yuv16ToBgr32f<layout>(y + col * 2, u + col * uvStep, v + col * uvStep, p, blue + col, green + col, red + col);
+                }
+                y += yStride;
+                if (layout == Yuv16Layout444p || (row & 1))
+                {
+                    u += uStride;
+                    v += vStride;
+                }
+                blue += dstStride;
+                green += dstStride;
+                red += dstStride;
+            }
+        }
+
+        void Yuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr32f<Yuv16Layout420p>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void P010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr32f<Yuv16LayoutP010>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void Yuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr32f<Yuv16Layout444p>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, blue, green, red, dstStride, yuvType);
+        }
+    }
+#endif
+}
@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdAvx512bf16.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BF16_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bf16
+    {
+        SIMD_INLINE __m512bh LoadBf16(const uint16_t* src, __mmask32 tail = -1)
+        {
+            return (__m512bh)_mm512_maskz_loadu_epi16(tail, src);
+        }
+
+        SIMD_INLINE __m512bh LoadPairs(const uint16_t* src, __mmask16 tail = -1)
+        {
+            return (__m512bh)_mm512_maskz_loadu_epi32(tail, src);
+        }
+
+        static float Score16b(const uint16_t* q, const uint16_t* k, size_t count, size_t depth, float scale, const float* mask, float* dst)
+        {
+            size_t depthDF = AlignLo(depth, DF), count4 = AlignLo(count, 4), j = 0;
+            __mmask32 tail = TailMask32(depth - depthDF);
+            __m128 _scale = _mm_set1_ps(scale), _max = _mm_set1_ps(-FLT_MAX);
+            for (; j < count4; j += 4)
+            {
+                const uint16_t* k0 = k + j * depth, * k1 = k0 + depth, * k2 = k1 + depth, * k3 = k2 + depth;
+                __m512 sums[4] = { _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps() };
+                size_t d = 0;
+                for (; d < depthDF; d += DF)
+                {
+                    __m512bh _q = LoadBf16(q + d);
+                    sums[0] = _mm512_dpbf16_ps(sums[0], _q, LoadBf16(k0 + d));
+                    sums[1] = _mm512_dpbf16_ps(sums[1], _q, LoadBf16(k1 + d));
+                    sums[2] = _mm512_dpbf16_ps(sums[2], _q, LoadBf16(k2 + d));
+                    sums[3] = _mm512_dpbf16_ps(sums[3], _q, LoadBf16(k3 + d));
+                }
+                if (tail)
+                {
+                    __m512bh _q = LoadBf16(q + d, tail);
+                    sums[0] = _mm512_dpbf16_ps(sums[0], _q, LoadBf16(k0 + d, tail));
+                    sums[1] = _mm512_dpbf16_ps(sums[1], _q, LoadBf16(k1 + d, tail));
+                    sums[2] = _mm512_dpbf16_ps(sums[2], _q, LoadBf16(k2 + d, tail));
+                    sums[3] = _mm512_dpbf16_ps(sums[3], _q, LoadBf16(k3 + d, tail));
+                }
+                __m128 sum = _mm_mul_ps(Avx512bw::Extract4Sums(sums), _scale);
+                if (mask)
+                    sum = _mm_add_ps(sum, _mm_loadu_ps(mask + j));
+                _mm_storeu_ps(dst + j, sum);
+                _max = _mm_max_ps(_max, sum);
+            }
+            _max = _mm_max_ps(_max, Sse41::Shuffle32f<0x0E>(_max));
+            _max = _mm_max_ss(_max, Sse41::Shuffle32f<0x01>(_max));
+            float max = _mm_cvtss_f32(_max);
+            for (; j < count; ++j)
+            {
+                const uint16_t* kj = k + j * depth;
+                __m512 _sum = _mm512_setzero_ps();
+                size_t d = 0;
+                for (; d < depthDF; d += DF)
+                    _sum = _mm512_dpbf16_ps(_sum, LoadBf16(q + d), LoadBf16(kj + d));
+                if (tail)
+                    _sum = _mm512_dpbf16_ps(_sum, LoadBf16(q + d, tail), LoadBf16(kj + d, tail));
+                dst[j] = Avx512bw::ExtractSum(_sum) * scale + (mask ? mask[j] : 0.0f);
+                max = Simd::Max(max, dst[j]);
+            }
+            return max;
+        }
+
+        static void Accum16b(const uint16_t* p, const uint16_t* v, size_t count, size_t depth, float alpha, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), depthQF = AlignLo(depth, QF), count2 = AlignLo(count, 2), stride = 2 * depth, d = 0;
+            __mmask16 tail = TailMask16(depth - depthF);
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            for (; d < depthQF; d += QF)
+            {
+                __m512 sum0 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 0 * F), _alpha);
+                __m512 sum1 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 1 * F), _alpha);
+                __m512 sum2 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 2 * F), _alpha);
+                __m512 sum3 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 3 * F), _alpha);
+                const uint16_t* vj = v + 2 * d;
+                for (size_t j = 0; j < count; j += 2, vj += stride)
+                {
+                    __m512bh _p = j < count2 ? Set2(p + j) : (__m512bh)_mm512_set1_epi32(p[j]);
+                    sum0 = _mm512_dpbf16_ps(sum0, _p, LoadPairs(vj + 0 * DF));
+                    sum1 = _mm512_dpbf16_ps(sum1, _p, LoadPairs(vj + 1 * DF));
+                    sum2 = _mm512_dpbf16_ps(sum2, _p, LoadPairs(vj + 2 * DF));
+                    sum3 = _mm512_dpbf16_ps(sum3, _p, LoadPairs(vj + 3 * DF));
+                }
+                _mm512_storeu_ps(dst + d + 0 * F, sum0);
+                _mm512_storeu_ps(dst + d + 1 * F, sum1);
+                _mm512_storeu_ps(dst + d + 2 * F, sum2);
+                _mm512_storeu_ps(dst + d + 3 * F, sum3);
+            }
+            for (; d < depthF; d += F)
+            {
+                __m512 sum = _mm512_mul_ps(_mm512_loadu_ps(dst + d), _alpha);
+                const uint16_t* vj = v + 2 * d;
+                for (size_t j = 0; j < count; j += 2, vj += stride)
+                    sum = _mm512_dpbf16_ps(sum, j < count2 ? Set2(p + j) : (__m512bh)_mm512_set1_epi32(p[j]), LoadPairs(vj));
+                _mm512_storeu_ps(dst + d, sum);
+            }
+            if (tail)
+            {
+                __m512 sum = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + d), _alpha);
+                const uint16_t* vj = v + 2 * d;
+                for (size_t j = 0; j < count; j += 2, vj += stride)
+                    sum = _mm512_dpbf16_ps(sum, j < count2 ? Set2(p + j) : (__m512bh)_mm512_set1_epi32(p[j]), LoadPairs(vj, tail));
+                _mm512_mask_storeu_ps(dst + d, tail, sum);
+            }
+        }
+
+        static void ConvertV(const float* src, size_t count, size_t depth, uint16_t* dst)
+        {
+            size_t depthF = AlignLo(depth, F);
+            __mmask16 tail = TailMask16(depth - depthF);
+            for (size_t j = 0; j < count; j += 2, src += 2 * depth, dst += 2 * depth)
+            {
+                const float* src1 = j + 1 < count ? src + depth : NULL;
+                size_t d = 0;
+                for (; d < depthF; d += F)
+                {
+                    __m512i lo = Avx512bw::Float32ToBFloat16(_mm512_loadu_ps(src + d));
+                    __m512i hi = src1 ? Avx512bw::Float32ToBFloat16(_mm512_loadu_ps(src1 + d)) : _mm512_setzero_si512();
+                    _mm512_storeu_si512(dst + 2 * d, _mm512_or_si512(lo, _mm512_slli_epi32(hi, 16)));
+                }
+                if (tail)
+                {
+                    __m512i lo = Avx512bw::Float32ToBFloat16(_mm512_maskz_loadu_ps(tail, src + d));
+                    __m512i hi = src1 ? Avx512bw::Float32ToBFloat16(_mm512_maskz_loadu_ps(tail, src1 + d)) : _mm512_setzero_si512();
+                    _mm512_mask_storeu_epi32(dst + 2 * d, tail, _mm512_or_si512(lo, _mm512_slli_epi32(hi, 16)));
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetAttention32f::SynetAttention32f(const AttentionParam32f& p)
+            : Avx512bw::SynetAttention32f(p)
+        {
+            _bf16 = Base::Bf16Soft(p.compatibility) || Base::Bf16Hard(p.compatibility);
+            _score16b = Score16b;
+            _accum16b = Accum16b;
+            _convertV = ConvertV;
+            SetBlocks(F);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility)
+        {
+            AttentionParam32f param(batch, heads, seqQ, seqK, depth, scale, compatibility);
+            if (!param.Valid())
+                return NULL;
+            if (Base::Bf16Soft(compatibility) || Base::Bf16Hard(compatibility))
+                return new SynetAttention32f(param);
+            return Avx512bw::SynetAttention32fInit(batch, heads, seqQ, seqK, depth, scale, compatibility);
+        }
+    }
+#endif
+}
@@ -0,0 +1,160 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_SHUFFLE_BGRA_TO_PLANAR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+
+        const __m512i K8_SHUFFLE_BGR_TO_PLANAR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1);
+
+        const __m512i K32_PERMUTE_PLANAR_BG = SIMD_MM512_SETR_EPI32(0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x01, 0x05, 0x09, 0x0D, 0x11, 0x15, 0x19, 0x1D);
+        const __m512i K32_PERMUTE_PLANAR_RA = SIMD_MM512_SETR_EPI32(0x02, 0x06, 0x0A, 0x0E, 0x12, 0x16, 0x1A, 0x1E, 0x03, 0x07, 0x0B, 0x0F, 0x13, 0x17, 0x1B, 0x1F);
+
+        template <bool align, bool mask, size_t N> SIMD_INLINE void LoadPlanar(const uint8_t* bgr, __m512i& b, __m512i& g, __m512i& r, const __mmask64* tails)
+        {
+            __m512i p0, p1, p2, p3;
+            if (N == 3)
+            {
+                __m512i bgr0 = Load<align, mask>(bgr + 0 * A, tails[0]);
+                __m512i bgr1 = Load<align, mask>(bgr + 1 * A, tails[1]);
+                __m512i bgr2 = Load<align, mask>(bgr + 2 * A, tails[2]);
+                p0 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_0, bgr0), K8_SHUFFLE_BGR_TO_PLANAR);
+                p1 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr0, K32_PERMUTE_BGR_TO_BGRA_1, bgr1), K8_SHUFFLE_BGR_TO_PLANAR);
+                p2 = _mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr1, K32_PERMUTE_BGR_TO_BGRA_2, bgr2), K8_SHUFFLE_BGR_TO_PLANAR);
+                p3 = _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRA_3, bgr2), K8_SHUFFLE_BGR_TO_PLANAR);
+            }
+            else
+            {
+                p0 = _mm512_shuffle_epi8(Load<align, mask>(bgr + 0 * A, tails[0]), K8_SHUFFLE_BGRA_TO_PLANAR);
+                p1 = _mm512_shuffle_epi8(Load<align, mask>(bgr + 1 * A, tails[1]), K8_SHUFFLE_BGRA_TO_PLANAR);
+                p2 = _mm512_shuffle_epi8(Load<align, mask>(bgr + 2 * A, tails[2]), K8_SHUFFLE_BGRA_TO_PLANAR);
+                p3 = _mm512_shuffle_epi8(Load<align, mask>(bgr + 3 * A, tails[3]), K8_SHUFFLE_BGRA_TO_PLANAR);
+            }
+            __m512i bg0 = _mm512_permutex2var_epi32(p0, K32_PERMUTE_PLANAR_BG, p1);
+            __m512i bg1 = _mm512_permutex2var_epi32(p2, K32_PERMUTE_PLANAR_BG, p3);
+            __m512i ra0 = _mm512_permutex2var_epi32(p0, K32_PERMUTE_PLANAR_RA, p1);
+            __m512i ra1 = _mm512_permutex2var_epi32(p2, K32_PERMUTE_PLANAR_RA, p3);
+            b = _mm512_shuffle_i64x2(bg0, bg1, 0x44);
+            g = _mm512_shuffle_i64x2(bg0, bg1, 0xEE);
+            r = _mm512_shuffle_i64x2(ra0, ra1, 0x44);
+        }
+
+        SIMD_INLINE __m512i AveragePairs(__m512i a0, __m512i a1)
+        {
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(_mm512_maddubs_epi16(a0, K8_01), _mm512_maddubs_epi16(a1, K8_01)), K16_0002), 2);
+        }
+
+        template <bool align, bool mask, class T, size_t N> SIMD_INLINE void BgrToNv12(const uint8_t* bgr, size_t bgrStride, 
+            uint8_t* y, size_t yStride, uint8_t* uv, const __mmask64* tails)
+        {
+            __m512i b0, g0, r0, b1, g1, r1;
+            LoadPlanar<align, mask, N>(bgr, b0, g0, r0, tails);
+            Store<align, mask>(y, BgrToY8<T>(b0, g0, r0), tails[4]);
+            LoadPlanar<align, mask, N>(bgr + bgrStride, b1, g1, r1, tails);
+            Store<align, mask>(y + yStride, BgrToY8<T>(b1, g1, r1), tails[4]);
+            __m512i b16 = AveragePairs(b0, b1);
+            __m512i g16 = AveragePairs(g0, g1);
+            __m512i r16 = AveragePairs(r0, r1);
+            __m512i u16 = BgrToU16<T>(b16, g16, r16);
+            __m512i v16 = BgrToV16<T>(b16, g16, r16);
+            Store<align, mask>(uv, _mm512_or_si512(u16, _mm512_slli_epi16(v16, 8)), tails[4]);
+        }
+
+        template <bool align, class T, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            size_t tail = width - alignedWidth;
+            __mmask64 tailMasks[5];
+            for (size_t i = 0; i < 4; ++i)
+                tailMasks[i] = TailMask64(tail * N - A * i);
+            tailMasks[4] = TailMask64(tail);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    BgrToNv12<align, false, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col, tailMasks);
+                if (col < width)
+                    BgrToNv12<align, true, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col, tailMasks);
+                bgr += 2 * bgrStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template <bool align, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<align, Base::Bt601, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<align, Base::Bt709, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<align, Base::Bt2020, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12<align, Base::Trect871, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride))
+                BgrToNv12<true, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+            else
+                BgrToNv12<false, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<3>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<4>(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+    }
+#endif
+}
@@ -0,0 +1,265 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 DistanceLoad(const float* p, __mmask16 tail = -1)
+        {
+            return _mm512_maskz_loadu_ps(tail, p);
+        }
+
+        SIMD_INLINE __m512 DistanceLoad(const uint16_t* p, __mmask16 tail = -1)
+        {
+            return _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(tail, p));
+        }
+
+        SIMD_INLINE __m512 DistanceLoad(const int8_t* p, __mmask16 tail = -1)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(tail, p)));
+        }
+
+        template<class T, int M, int N> SIMD_INLINE void DistanceDots(size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots, size_t ldd)
+        {
+            size_t KF = AlignLo(K, F);
+            __mmask16 tail = TailMask16(K - KF);
+            const T* b[N];
+            __m512 d[M][N], a[M], _b;
+            for (size_t j = 0; j < N; ++j)
+            {
+                b[j] = (const T*)(B + j * ldb);
+                for (size_t i = 0; i < M; ++i)
+                    d[i][j] = _mm512_setzero_ps();
+            }
+            for (size_t k = 0; k < KF; k += F)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    a[i] = _mm512_loadu_ps(A + i * K + k);
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = DistanceLoad(b[j] + k);
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_fmadd_ps(a[i], _b, d[i][j]);
+                }
+            }
+            if (KF < K)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    a[i] = _mm512_maskz_loadu_ps(tail, A + i * K + KF);
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = DistanceLoad(b[j] + KF, tail);
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_fmadd_ps(a[i], _b, d[i][j]);
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+            {
+                if (N == 4)
+                    _mm_storeu_ps(dots + i * ldd, Extract4Sums(d[i]));
+                else
+                {
+                    for (size_t j = 0; j < N; ++j)
+                        dots[i * ldd + j] = ExtractSum(d[i][j]);
+                }
+            }
+        }
+
+        template<class T> void DistanceDots(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots)
+        {
+            size_t M4 = AlignLo(M, 4), N4 = AlignLo(N, 4), i = 0;
+            for (; i < M4; i += 4)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    DistanceDots<T, 4, 4>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    DistanceDots<T, 4, 1>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+            }
+            for (; i < M; i += 1)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    DistanceDots<T, 1, 4>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    DistanceDots<T, 1, 1>(K, A + i * K, B + j * ldb, ldb, dots + i * N + j, N);
+            }
+        }
+
+        template<class T> void DistanceSquares(size_t N, size_t K, const uint8_t* B, size_t ldb, float* squares)
+        {
+            size_t KF = AlignLo(K, F);
+            __mmask16 tail = TailMask16(K - KF);
+            for (size_t j = 0; j < N; ++j)
+            {
+                const T* b = (const T*)(B + j * ldb);
+                __m512 sum = _mm512_setzero_ps(), _b;
+                for (size_t k = 0; k < KF; k += F)
+                {
+                    _b = DistanceLoad(b + k);
+                    sum = _mm512_fmadd_ps(_b, _b, sum);
+                }
+                if (KF < K)
+                {
+                    _b = DistanceLoad(b + KF, tail);
+                    sum = _mm512_fmadd_ps(_b, _b, sum);
+                }
+                squares[j] = ExtractSum(sum);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void DistancesTopK32f(size_t M, size_t N, size_t K, const float* A, const float* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Base::DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(float), NULL, type, top, indices, distances, DistanceDots<float>, DistanceSquares<float>);
+        }
+
+        void DistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Array32f a(M * K);
+            Float16ToFloat32(A, M * K, a.data);
+            Base::DistancesTopK(M, N, K, a.data, (const uint8_t*)B, K * sizeof(uint16_t), NULL, type, top, indices, distances, DistanceDots<uint16_t>, DistanceSquares<uint16_t>);
+        }
+
+        void DistancesTopK8i(size_t M, size_t N, size_t K, const float* A, const int8_t* B, const float* scales, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Base::DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(int8_t), scales, type, top, indices, distances, DistanceDots<int8_t>, DistanceSquares<int8_t>);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int M, int N> SIMD_INLINE void Int8QuantizedDots(size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots, size_t ldd)
+        {
+            size_t K32 = AlignLo(K, 32);
+            __mmask32 tail = TailMask32(K - K32);
+            const uint8_t* a[M], * b[N];
+            __m512i d[M][N], _a[M], _b;
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A[i] + Base::INT8_QUANTIZED_HEADER;
+            for (size_t j = 0; j < N; ++j)
+            {
+                b[j] = B[j] + Base::INT8_QUANTIZED_HEADER;
+                for (size_t i = 0; i < M; ++i)
+                    d[i][j] = _mm512_setzero_si512();
+            }
+            for (size_t k = 0; k < K32; k += 32)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _a[i] = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(a[i] + k)));
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(b[j] + k)));
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_add_epi32(d[i][j], _mm512_madd_epi16(_a[i], _b));
+                }
+            }
+            if (K32 < K)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _a[i] = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, a[i] + K32));
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, b[j] + K32));
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_add_epi32(d[i][j], _mm512_madd_epi16(_a[i], _b));
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < N; ++j)
+                    dots[i * ldd + j] = (int32_t)ExtractSum<uint32_t>(d[i][j]);
+        }
+
+        static void Int8QuantizedDots(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots)
+        {
+            size_t M4 = AlignLo(M, 4), N4 = AlignLo(N, 4), i = 0;
+            for (; i < M4; i += 4)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<4, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<4, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+            for (; i < M; i += 1)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<1, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<1, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+        }
+
+        static void Int8QuantizedStats(size_t K, const uint8_t* a, int32_t* sum, int32_t* squares)
+        {
+            size_t K32 = AlignLo(K, 32);
+            __mmask32 tail = TailMask32(K - K32);
+            __m512i s = _mm512_setzero_si512(), q = _mm512_setzero_si512(), _a;
+            for (size_t k = 0; k < K32; k += 32)
+            {
+                _a = _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(a + k)));
+                s = _mm512_add_epi32(s, _mm512_madd_epi16(_a, K16_0001));
+                q = _mm512_add_epi32(q, _mm512_madd_epi16(_a, _a));
+            }
+            if (K32 < K)
+            {
+                _a = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, a + K32));
+                s = _mm512_add_epi32(s, _mm512_madd_epi16(_a, K16_0001));
+                q = _mm512_add_epi32(q, _mm512_madd_epi16(_a, _a));
+            }
+            *sum = (int32_t)ExtractSum<uint32_t>(s);
+            *squares = (int32_t)ExtractSum<uint32_t>(q);
+        }
+
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance)
+        {
+            Base::Int8QuantizedDistances(1, 1, size, &a, &b, type, distance, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances)
+        {
+            Base::Int8QuantizedDistances(M, N, K, A, B, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances)
+        {
+            Array8ucp a(M), b(N);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * (K + Base::INT8_QUANTIZED_HEADER);
+            for (size_t j = 0; j < N; ++j)
+                b[j] = B + j * (K + Base::INT8_QUANTIZED_HEADER);
+            Base::Int8QuantizedDistances(M, N, K, a.data, b.data, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+    }
+#endif
+}
@@ -0,0 +1,194 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template<bool is32f> SIMD_INLINE void Gemm8u8iSave(__m512i sum, int32_t zero, float scale, const int32_t* bSum,
+            const float* bScale, const float* bias, uint8_t* dst, __mmask16 tail)
+        {
+            sum = _mm512_sub_epi32(sum, _mm512_mullo_epi32(_mm512_set1_epi32(zero), _mm512_loadu_si512(bSum)));
+            if (is32f)
+            {
+                __m512 val = _mm512_fmadd_ps(_mm512_cvtepi32_ps(sum), _mm512_mul_ps(_mm512_set1_ps(scale), _mm512_loadu_ps(bScale)), _mm512_loadu_ps(bias));
+                _mm512_mask_storeu_ps((float*)dst, tail, val);
+            }
+            else
+                _mm512_mask_storeu_epi32((int32_t*)dst, tail, sum);
+        }
+
+        template<bool is32f, int rows, bool two> void Gemm8u8iKernel(size_t KA, const uint8_t* A, size_t lda, const int8_t* B,
+            const int32_t* zero, const float* scale, const int32_t* bSum, const float* bScale, const float* bias, uint8_t* C, size_t ldc, size_t N)
+        {
+            __m512i d00 = _mm512_setzero_si512(), d01 = _mm512_setzero_si512(), d10 = _mm512_setzero_si512(), d11 = _mm512_setzero_si512(),
+                d20 = _mm512_setzero_si512(), d21 = _mm512_setzero_si512(), d30 = _mm512_setzero_si512(), d31 = _mm512_setzero_si512(),
+                d40 = _mm512_setzero_si512(), d41 = _mm512_setzero_si512(), d50 = _mm512_setzero_si512(), d51 = _mm512_setzero_si512(), a0, b0, b1;
+            const uint8_t* A0 = A + 0 * lda;
+            const uint8_t* A1 = A + 1 * lda;
+            const uint8_t* A2 = A + 2 * lda;
+            const uint8_t* A3 = A + 3 * lda;
+            const uint8_t* A4 = A + 4 * lda;
+            const uint8_t* A5 = A + 5 * lda;
+            const int8_t* B0 = B;
+            const int8_t* B1 = B + KA * F;
+            for (size_t k = 0; k < KA; k += 4, B0 += F * 4, B1 += F * 4)
+            {
+                b0 = _mm512_loadu_si512(B0);
+                if (two)
+                    b1 = _mm512_loadu_si512(B1);
+                if (rows > 0)
+                {
+                    a0 = Set4(A0 + k);
+                    Madd4<false>(d00, a0, b0);
+                    if (two) Madd4<false>(d01, a0, b1);
+                }
+                if (rows > 1)
+                {
+                    a0 = Set4(A1 + k);
+                    Madd4<false>(d10, a0, b0);
+                    if (two) Madd4<false>(d11, a0, b1);
+                }
+                if (rows > 2)
+                {
+                    a0 = Set4(A2 + k);
+                    Madd4<false>(d20, a0, b0);
+                    if (two) Madd4<false>(d21, a0, b1);
+                }
+                if (rows > 3)
+                {
+                    a0 = Set4(A3 + k);
+                    Madd4<false>(d30, a0, b0);
+                    if (two) Madd4<false>(d31, a0, b1);
+                }
+                if (rows > 4)
+                {
+                    a0 = Set4(A4 + k);
+                    Madd4<false>(d40, a0, b0);
+                    if (two) Madd4<false>(d41, a0, b1);
+                }
+                if (rows > 5)
+                {
+                    a0 = Set4(A5 + k);
+                    Madd4<false>(d50, a0, b0);
+                    if (two) Madd4<false>(d51, a0, b1);
+                }
+            }
+            __mmask16 tail0 = two ? __mmask16(-1) : TailMask16(N), tail1 = two ? TailMask16(N - F) : 0;
+            if (rows > 0)
+            {
+                Gemm8u8iSave<is32f>(d00, zero[0], scale[0], bSum, bScale, bias, C + 0 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d01, zero[0], scale[0], bSum + F, bScale + F, bias + F, C + 0 * ldc + F * 4, tail1);
+            }
+            if (rows > 1)
+            {
+                Gemm8u8iSave<is32f>(d10, zero[1], scale[1], bSum, bScale, bias, C + 1 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d11, zero[1], scale[1], bSum + F, bScale + F, bias + F, C + 1 * ldc + F * 4, tail1);
+            }
+            if (rows > 2)
+            {
+                Gemm8u8iSave<is32f>(d20, zero[2], scale[2], bSum, bScale, bias, C + 2 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d21, zero[2], scale[2], bSum + F, bScale + F, bias + F, C + 2 * ldc + F * 4, tail1);
+            }
+            if (rows > 3)
+            {
+                Gemm8u8iSave<is32f>(d30, zero[3], scale[3], bSum, bScale, bias, C + 3 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d31, zero[3], scale[3], bSum + F, bScale + F, bias + F, C + 3 * ldc + F * 4, tail1);
+            }
+            if (rows > 4)
+            {
+                Gemm8u8iSave<is32f>(d40, zero[4], scale[4], bSum, bScale, bias, C + 4 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d41, zero[4], scale[4], bSum + F, bScale + F, bias + F, C + 4 * ldc + F * 4, tail1);
+            }
+            if (rows > 5)
+            {
+                Gemm8u8iSave<is32f>(d50, zero[5], scale[5], bSum, bScale, bias, C + 5 * ldc, tail0);
+                if (two) Gemm8u8iSave<is32f>(d51, zero[5], scale[5], bSum + F, bScale + F, bias + F, C + 5 * ldc + F * 4, tail1);
+            }
+        }
+
+        typedef void(*Gemm8u8iKernelPtr)(size_t KA, const uint8_t* A, size_t lda, const int8_t* B,
+            const int32_t* zero, const float* scale, const int32_t* bSum, const float* bScale, const float* bias, uint8_t* C, size_t ldc, size_t N);
+
+        template<bool is32f, bool two> Gemm8u8iKernelPtr GetGemm8u8iKernel(size_t rows)
+        {
+            switch (rows)
+            {
+            case 1: return Gemm8u8iKernel<is32f, 1, two>;
+            case 2: return Gemm8u8iKernel<is32f, 2, two>;
+            case 3: return Gemm8u8iKernel<is32f, 3, two>;
+            case 4: return Gemm8u8iKernel<is32f, 4, two>;
+            case 5: return Gemm8u8iKernel<is32f, 5, two>;
+            case 6: return Gemm8u8iKernel<is32f, 6, two>;
+            default:
+                assert(0); return NULL;
+            }
+        }
+
+        template<bool is32f> Gemm8u8iKernelPtr GetGemm8u8iKernel(size_t rows, bool two)
+        {
+            return two ? GetGemm8u8iKernel<is32f, true>(rows) : GetGemm8u8iKernel<is32f, false>(rows);
+        }
+
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType)
+        {
+            const size_t microM = 6, microN = F * 2;
+            size_t KA = AlignHi(K, 4), NF = AlignHi(N, F);
+            Array8u bufA;
+            if (transA || KA != K)
+            {
+                bufA.Resize(M * KA);
+                Base::Gemm8u8iPackA(M, K, A, lda, transA, KA, bufA.data);
+                A = bufA.data, lda = KA;
+            }
+            Array8i bufB(NF * KA);
+            Array32i bSum(NF), zero(M);
+            Array32f scale(M), colScale(NF), colShift(NF);
+            Base::Gemm8u8iPackB(K, N, B, ldb, transB, F, KA, bufB.data, bSum.data);
+            Base::Gemm8u8iSetRowParams(M, aZero, aScale, zero.data, scale.data);
+            Base::Gemm8u8iSetColParams(N, NF, bScale, bias, colScale.data, colShift.data);
+            bool is32f = cType == SimdTensorData32f;
+            size_t MA = AlignLoAny(M, microM), ldC = ldc * 4;
+            for (size_t j = 0; j < N; j += microN)
+            {
+                size_t dN = Simd::Min(microN, N - j);
+                Gemm8u8iKernelPtr body = is32f ? GetGemm8u8iKernel<true>(microM, dN > F) : GetGemm8u8iKernel<false>(microM, dN > F);
+                Gemm8u8iKernelPtr tail = M > MA ? (is32f ? GetGemm8u8iKernel<true>(M - MA, dN > F) : GetGemm8u8iKernel<false>(M - MA, dN > F)) : NULL;
+                const int8_t* pB = bufB.data + j * KA;
+                uint8_t* pC = (uint8_t*)C + j * 4;
+                size_t i = 0;
+                for (; i < MA; i += microM)
+                    body(KA, A + i * lda, lda, pB, zero.data + i, scale.data + i, bSum.data + j, colScale.data + j, colShift.data + j, pC + i * ldC, ldC, dN);
+                if (tail)
+                    tail(KA, A + i * lda, lda, pB, zero.data + i, scale.data + i, bSum.data + j, colScale.data + j, colShift.data + j, pC + i * ldC, ldC, dN);
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
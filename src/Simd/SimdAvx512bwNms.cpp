@@ -0,0 +1,188 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<SimdBoxEncodingType encoding> SIMD_INLINE void DecodeBoxes4(const float* delta, const float* anchor, __m512 params, float* box, __mmask16 tail = -1)
+        {
+            __m512 sign = _mm512_broadcast_f32x4(_mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f));
+            __m512 a = _mm512_maskz_loadu_ps(tail, anchor);
+            __m512 size = _mm512_shuffle_ps(a, a, 0xEE);
+            __m512 center, exp;
+            if (encoding == SimdBoxEncodingSsd)
+            {
+                __m512 t = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, delta), params);
+                center = _mm512_add_ps(a, _mm512_mul_ps(t, size));
+                exp = Exponent(t);
+            }
+            else
+            {
+                exp = Exponent(_mm512_mul_ps(_mm512_maskz_loadu_ps(tail, delta), sign));
+                center = _mm512_add_ps(a, _mm512_div_ps(params, _mm512_add_ps(_mm512_set1_ps(1.0f), exp)));
+            }
+            center = _mm512_shuffle_ps(center, center, 0x44);
+            __m512 half = _mm512_mul_ps(_mm512_mul_ps(size, _mm512_set1_ps(0.5f)), _mm512_shuffle_ps(exp, exp, 0xEE));
+            _mm512_mask_storeu_ps(box, tail, _mm512_add_ps(center, _mm512_mul_ps(half, sign)));
+        }
+
+        template<SimdBoxEncodingType encoding> void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, const float* params, float* boxes)
+        {
+            __m512 _params = _mm512_broadcast_f32x4(_mm_loadu_ps(params));
+            size_t count4 = AlignLo(count, 4), i = 0;
+            for (; i < count4; i += 4)
+                DecodeBoxes4<encoding>(deltas + i * 4, anchors + i * 4, _params, boxes + i * 4);
+            if (i < count)
+                DecodeBoxes4<encoding>(deltas + i * 4, anchors + i * 4, _params, boxes + i * 4, TailMask16((count - i) * 4));
+        }
+
+        void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes)
+        {
+            if (encoding == SimdBoxEncodingSsd)
+                DetectionDecodeBoxes32f<SimdBoxEncodingSsd>(deltas, anchors, count, params, boxes);
+            else
+                DetectionDecodeBoxes32f<SimdBoxEncodingYolo>(deltas, anchors, count, params, boxes);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void FilterScores(const float* scores, __m512 threshold, __m512i index, uint32_t* indices, size_t& size, __mmask16 tail = -1)
+        {
+            __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, scores), threshold, _CMP_GT_OQ);
+            _mm512_mask_compressstoreu_epi32(indices + size, mask, index);
+            size += _mm_popcnt_u32(mask);
+        }
+
+        size_t DetectionFilterScores32f(const float* scores, size_t count, float threshold, uint32_t* indices)
+        {
+            size_t countF = AlignLo(count, F), i = 0, size = 0;
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            __m512i index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            for (; i < countF; i += F)
+            {
+                FilterScores(scores + i, _threshold, index, indices, size);
+                index = _mm512_add_epi32(index, _mm512_set1_epi32(F));
+            }
+            if (i < count)
+                FilterScores(scores + i, _threshold, index, indices, size, TailMask16(count - i));
+            return size;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct NmsBox
+        {
+            __m512 x0, y0, x1, y1, area;
+
+            SIMD_INLINE NmsBox(const float* box)
+            {
+                x0 = _mm512_set1_ps(box[0]);
+                y0 = _mm512_set1_ps(box[1]);
+                x1 = _mm512_set1_ps(box[2]);
+                y1 = _mm512_set1_ps(box[3]);
+                area = _mm512_set1_ps(box[4]);
+            }
+
+            SIMD_INLINE __m512 Intersection(const float* soa, size_t stride, size_t i, __mmask16 tail) const
+            {
+                __m512 w = _mm512_sub_ps(_mm512_min_ps(_mm512_maskz_loadu_ps(tail, soa + 2 * stride + i), x1), _mm512_max_ps(_mm512_maskz_loadu_ps(tail, soa + 0 * stride + i), x0));
+                __m512 h = _mm512_sub_ps(_mm512_min_ps(_mm512_maskz_loadu_ps(tail, soa + 3 * stride + i), y1), _mm512_max_ps(_mm512_maskz_loadu_ps(tail, soa + 1 * stride + i), y0));
+                return _mm512_mul_ps(_mm512_max_ps(w, _mm512_setzero_ps()), _mm512_max_ps(h, _mm512_setzero_ps()));
+            }
+
+            SIMD_INLINE __m512 Union(const float* soa, size_t stride, size_t i, __mmask16 tail, __m512 intersection) const
+            {
+                return _mm512_sub_ps(_mm512_add_ps(_mm512_maskz_loadu_ps(tail, soa + 4 * stride + i), area), intersection);
+            }
+        };
+
+        static bool NmsOverlap(const float* soa, size_t stride, size_t size, const float* box, float threshold)
+        {
+            NmsBox _box(box);
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 intersection = _box.Intersection(soa, stride, i, tail);
+                __m512 _union = _box.Union(soa, stride, i, tail, intersection);
+                if (_mm512_mask_cmp_ps_mask(tail, intersection, _mm512_mul_ps(_threshold, _union), _CMP_GT_OQ))
+                    return true;
+            }
+            return false;
+        }
+
+        static size_t NmsDecay(const float* soa, size_t stride, size_t size, const float* box, SimdNmsType type, float threshold, float gamma, float* scores)
+        {
+            NmsBox _box(box);
+            __m512 _threshold = _mm512_set1_ps(threshold), _gamma = _mm512_set1_ps(gamma), _1 = _mm512_set1_ps(1.0f);
+            __m512 maxScore = _mm512_set1_ps(-FLT_MAX);
+            __m512i maxIndex = _mm512_setzero_si512(), index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            for (size_t i = 0; i < size; i += F)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 intersection = _box.Intersection(soa, stride, i, tail);
+                __m512 _union = _box.Union(soa, stride, i, tail, intersection);
+                __m512 iou = _mm512_maskz_div_ps(_mm512_cmp_ps_mask(_union, _mm512_setzero_ps(), _CMP_GT_OQ), intersection, _union);
+                __m512 decay;
+                if (type == SimdNmsSoftLinear)
+                    decay = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(iou, _threshold, _CMP_GT_OQ), _1, _mm512_sub_ps(_1, iou));
+                else
+                    decay = Exponent(_mm512_mul_ps(_mm512_mul_ps(iou, iou), _gamma));
+                __m512 score = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, scores + i), decay);
+                _mm512_mask_storeu_ps(scores + i, tail, score);
+                __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, score, maxScore, _CMP_GT_OQ);
+                maxScore = _mm512_mask_blend_ps(greater, maxScore, score);
+                maxIndex = _mm512_mask_blend_epi32(greater, maxIndex, index);
+                index = _mm512_add_epi32(index, _mm512_set1_epi32(F));
+            }
+            float scoreBuf[F];
+            int32_t indexBuf[F];
+            _mm512_storeu_ps(scoreBuf, maxScore);
+            _mm512_storeu_si512(indexBuf, maxIndex);
+            size_t best = indexBuf[0];
+            float bestScore = scoreBuf[0];
+            for (size_t j = 1; j < F; ++j)
+            {
+                if (scoreBuf[j] > bestScore || (scoreBuf[j] == bestScore && (size_t)indexBuf[j] < best))
+                    best = indexBuf[j], bestScore = scoreBuf[j];
+            }
+            return best;
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores)
+        {
+            return Base::DetectionNms(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, dstScores, DetectionFilterScores32f, NmsOverlap, NmsDecay);
+        }
+    }
+#endif
+}
@@ -0,0 +1,172 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <bool align, bool mask> SIMD_INLINE void StoreBgr(const __m512i& b, const __m512i& g, const __m512i& r, uint8_t* bgr, const __mmask64* tails)
+        {
+            Store<align, mask>(bgr + 0 * A, InterleaveBgr<0>(b, g, r), tails[0]);
+            Store<align, mask>(bgr + 1 * A, InterleaveBgr<1>(b, g, r), tails[1]);
+            Store<align, mask>(bgr + 2 * A, InterleaveBgr<2>(b, g, r), tails[2]);
+        }
+
+        template <bool align, bool mask> SIMD_INLINE void StoreBgra(const __m512i& b, const __m512i& g, const __m512i& r, const __m512i& a, uint8_t* bgra, const __mmask64* tails)
+        {
+            __m512i _b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, b);
+            __m512i _g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, g);
+            __m512i _r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, r);
+            __m512i bg0 = UnpackU8<0>(_b, _g);
+            __m512i bg1 = UnpackU8<1>(_b, _g);
+            __m512i ra0 = UnpackU8<0>(_r, a);
+            __m512i ra1 = UnpackU8<1>(_r, a);
+            Store<align, mask>(bgra + 0 * A, UnpackU16<0>(bg0, ra0), tails[0]);
+            Store<align, mask>(bgra + 1 * A, UnpackU16<1>(bg0, ra0), tails[1]);
+            Store<align, mask>(bgra + 2 * A, UnpackU16<0>(bg1, ra1), tails[2]);
+            Store<align, mask>(bgra + 3 * A, UnpackU16<1>(bg1, ra1), tails[3]);
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format> SIMD_INLINE void YuvToAny(const __m512i& y, 
+            const __m512i& u, const __m512i& v, const __m512i& a, uint8_t* dst, const __mmask64* tails)
+        {
+            __m512i b = YuvToBlue<T>(y, u);
+            __m512i g = YuvToGreen<T>(y, u, v);
+            __m512i r = YuvToRed<T>(y, v);
+            if (format == SimdPixelFormatBgr24)
+                StoreBgr<align, mask>(b, g, r, dst, tails);
+            else if (format == SimdPixelFormatBgra32)
+                StoreBgra<align, mask>(b, g, r, a, dst, tails);
+            else if (format == SimdPixelFormatRgb24)
+                StoreBgr<align, mask>(r, g, b, dst, tails);
+            else
+                StoreBgra<align, mask>(r, g, b, a, dst, tails);
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format>
+#if defined(_MSC_VER) && _MSC_VER >= 1900      
+        inline 
+#else
+        SIMD_INLINE 
+#endif
+        void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, const __m512i& a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            const size_t N = (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) ? 3 : 4;
+            __m512i uv0 = Load<align, mask>(uv + 0, tails[0]);
+            __m512i uv1 = Load<align, mask>(uv + A, tails[1]);
+            __m512i u = _mm512_packus_epi16(_mm512_and_si512(uv0, K16_00FF), _mm512_and_si512(uv1, K16_00FF));
+            __m512i v = _mm512_packus_epi16(_mm512_srli_epi16(uv0, 8), _mm512_srli_epi16(uv1, 8));
+            __m512i u0 = UnpackU8<0>(u, u), u1 = UnpackU8<1>(u, u);
+            __m512i v0 = UnpackU8<0>(v, v), v1 = UnpackU8<1>(v, v);
+            YuvToAny<align, mask, T, format>(Load<align, mask>(y + 0, tails[0]), u0, v0, a, dst + 0 * N * A, tails + 2);
+            YuvToAny<align, mask, T, format>(Load<align, mask>(y + A, tails[1]), u1, v1, a, dst + 1 * N * A, tails + 2 + N);
+            y += yStride, dst += dstStride;
+            YuvToAny<align, mask, T, format>(Load<align, mask>(y + 0, tails[0]), u0, v0, a, dst + 0 * N * A, tails + 2);
+            YuvToAny<align, mask, T, format>(Load<align, mask>(y + A, tails[1]), u1, v1, a, dst + 1 * N * A, tails + 2 + N);
+        }
+
+        template <bool align, class T, SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) ? 3 : 4;
+            __m512i a = _mm512_set1_epi8(alpha);
+            size_t widthUV = width / 2;
+            size_t alignedWidth = AlignLo(widthUV, A);
+            size_t tail = widthUV - alignedWidth;
+            __mmask64 tailMasks[10];
+            for (size_t i = 0; i < 2; ++i)
+                tailMasks[0 + i] = TailMask64(tail * 2 - A * i);
+            for (size_t i = 0; i < 2 * N; ++i)
+                tailMasks[2 + i] = TailMask64(tail * 2 * N - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    Nv12ToAny<align, false, T, format>(y + col * 2, yStride, uv + col * 2, a, dst + col * 2 * N, dstStride, tailMasks);
+                if (col < widthUV)
+                    Nv12ToAny<align, true, T, format>(y + col * 2, yStride, uv + col * 2, a, dst + col * 2 * N, dstStride, tailMasks);
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<align, Base::Bt601, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<align, Base::Bt709, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<align, Base::Bt2020, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<align, Base::Trect871, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride))
+                Nv12ToAny<true, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                Nv12ToAny<false, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgr24>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgra32>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgb24>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgba32>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+    }
+#endif
+}
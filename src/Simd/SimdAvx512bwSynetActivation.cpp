@@ -73,6 +73,88 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template<bool align, bool mask> SIMD_INLINE void SynetGelu32f(const float* src, float* dst, size_t offset, __mmask16 tail = -1)
+        {
+            __m512 _src = Load<align, mask>(src + offset, tail);
+            __m512 _dst = Gelu(_src);
+            Store<align, mask>(dst + offset, _dst, tail);
+        }
+
+        template<bool align> void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                SynetGelu32f<align, false>(src, dst, i + 0 * F);
+                SynetGelu32f<align, false>(src, dst, i + 1 * F);
+                SynetGelu32f<align, false>(src, dst, i + 2 * F);
+                SynetGelu32f<align, false>(src, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                SynetGelu32f<align, false>(src, dst, i);
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                SynetGelu32f<align, true>(src, dst, i, tail);
+            }
+        }
+
+        void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGelu32f<true>(src, size, dst);
+            else
+                SynetGelu32f<false>(src, size, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool align, bool mask> SIMD_INLINE void SynetGeluTanh32f(const float* src, float* dst, size_t offset, __mmask16 tail = -1)
+        {
+            __m512 _src = Load<align, mask>(src + offset, tail);
+            __m512 _dst = GeluTanh(_src);
+            Store<align, mask>(dst + offset, _dst, tail);
+        }
+
+        template<bool align> void SynetGeluTanh32f(const float* src, size_t size, float* dst)
+        {
+            if (align)
+                assert(Aligned(src) && Aligned(dst));
+
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                SynetGeluTanh32f<align, false>(src, dst, i + 0 * F);
+                SynetGeluTanh32f<align, false>(src, dst, i + 1 * F);
+                SynetGeluTanh32f<align, false>(src, dst, i + 2 * F);
+                SynetGeluTanh32f<align, false>(src, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                SynetGeluTanh32f<align, false>(src, dst, i);
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                SynetGeluTanh32f<align, true>(src, dst, i, tail);
+            }
+        }
+
+        void SynetGeluTanh32f(const float* src, size_t size, float* dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGeluTanh32f<true>(src, size, dst);
+            else
+                SynetGeluTanh32f<false>(src, size, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<bool align, bool mask> SIMD_INLINE void SynetHardSigmoid32f(const float* src, __m512 scale, __m512 shift, float* dst, size_t offset, __mmask16 tail = -1)
         {
             __m512 _src = Load<align, mask>(src + offset, tail);
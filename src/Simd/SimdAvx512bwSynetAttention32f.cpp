@@ -0,0 +1,197 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 LoadAtt(const float* src, __mmask16 tail = -1)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        SIMD_INLINE __m512 LoadAtt(const uint16_t* src, __mmask16 tail = -1)
+        {
+            return BFloat16ToFloat32(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src)));
+        }
+
+        SIMD_INLINE float ValueAtt(const float* src)
+        {
+            return src[0];
+        }
+
+        SIMD_INLINE float ValueAtt(const uint16_t* src)
+        {
+            return Base::BFloat16ToFloat32(src[0]);
+        }
+
+        template<class T> float Score(const T* q, const T* k, size_t count, size_t depth, float scale, const float* mask, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), count4 = AlignLo(count, 4), j = 0;
+            __mmask16 tail = TailMask16(depth - depthF);
+            __m128 _scale = _mm_set1_ps(scale), _max = _mm_set1_ps(-FLT_MAX);
+            for (; j < count4; j += 4)
+            {
+                const T* k0 = k + j * depth, * k1 = k0 + depth, * k2 = k1 + depth, * k3 = k2 + depth;
+                __m512 sums[4] = { _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps(), _mm512_setzero_ps() };
+                size_t d = 0;
+                for (; d < depthF; d += F)
+                {
+                    __m512 _q = LoadAtt(q + d);
+                    sums[0] = _mm512_fmadd_ps(_q, LoadAtt(k0 + d), sums[0]);
+                    sums[1] = _mm512_fmadd_ps(_q, LoadAtt(k1 + d), sums[1]);
+                    sums[2] = _mm512_fmadd_ps(_q, LoadAtt(k2 + d), sums[2]);
+                    sums[3] = _mm512_fmadd_ps(_q, LoadAtt(k3 + d), sums[3]);
+                }
+                if (tail)
+                {
+                    __m512 _q = LoadAtt(q + d, tail);
+                    sums[0] = _mm512_fmadd_ps(_q, LoadAtt(k0 + d, tail), sums[0]);
+                    sums[1] = _mm512_fmadd_ps(_q, LoadAtt(k1 + d, tail), sums[1]);
+                    sums[2] = _mm512_fmadd_ps(_q, LoadAtt(k2 + d, tail), sums[2]);
+                    sums[3] = _mm512_fmadd_ps(_q, LoadAtt(k3 + d, tail), sums[3]);
+                }
+                __m128 sum = _mm_mul_ps(Extract4Sums(sums), _scale);
+                if (mask)
+                    sum = _mm_add_ps(sum, _mm_loadu_ps(mask + j));
+                _mm_storeu_ps(dst + j, sum);
+                _max = _mm_max_ps(_max, sum);
+            }
+            _max = _mm_max_ps(_max, Sse41::Shuffle32f<0x0E>(_max));
+            _max = _mm_max_ss(_max, Sse41::Shuffle32f<0x01>(_max));
+            float max = _mm_cvtss_f32(_max);
+            for (; j < count; ++j)
+            {
+                const T* kj = k + j * depth;
+                __m512 _sum = _mm512_setzero_ps();
+                size_t d = 0;
+                for (; d < depthF; d += F)
+                    _sum = _mm512_fmadd_ps(LoadAtt(q + d), LoadAtt(kj + d), _sum);
+                if (tail)
+                    _sum = _mm512_fmadd_ps(LoadAtt(q + d, tail), LoadAtt(kj + d, tail), _sum);
+                dst[j] = ExtractSum(_sum) * scale + (mask ? mask[j] : 0.0f);
+                max = Simd::Max(max, dst[j]);
+            }
+            return max;
+        }
+
+        static float Softmax(float* src, size_t count, float max)
+        {
+            Exp exp;
+            size_t countF = AlignLo(count, F), j = 0;
+            __mmask16 tail = TailMask16(count - countF);
+            __m512 _max = _mm512_set1_ps(max), _sum = _mm512_setzero_ps();
+            for (; j < countF; j += F)
+            {
+                __m512 value = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + j), _max));
+                _mm512_storeu_ps(src + j, value);
+                _sum = _mm512_add_ps(_sum, value);
+            }
+            if (tail)
+            {
+                __m512 value = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + j), _max));
+                _mm512_mask_storeu_ps(src + j, tail, value);
+                _sum = _mm512_add_ps(_sum, _mm512_maskz_mov_ps(tail, value));
+            }
+            return ExtractSum(_sum);
+        }
+
+        template<class T> void Accum(const T* p, const T* v, size_t count, size_t depth, float alpha, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), depthQF = AlignLo(depth, QF), d = 0;
+            __mmask16 tail = TailMask16(depth - depthF);
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            for (; d < depthQF; d += QF)
+            {
+                __m512 sum0 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 0 * F), _alpha);
+                __m512 sum1 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 1 * F), _alpha);
+                __m512 sum2 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 2 * F), _alpha);
+                __m512 sum3 = _mm512_mul_ps(_mm512_loadu_ps(dst + d + 3 * F), _alpha);
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                {
+                    __m512 _p = _mm512_set1_ps(ValueAtt(p + j));
+                    sum0 = _mm512_fmadd_ps(_p, LoadAtt(vj + 0 * F), sum0);
+                    sum1 = _mm512_fmadd_ps(_p, LoadAtt(vj + 1 * F), sum1);
+                    sum2 = _mm512_fmadd_ps(_p, LoadAtt(vj + 2 * F), sum2);
+                    sum3 = _mm512_fmadd_ps(_p, LoadAtt(vj + 3 * F), sum3);
+                }
+                _mm512_storeu_ps(dst + d + 0 * F, sum0);
+                _mm512_storeu_ps(dst + d + 1 * F, sum1);
+                _mm512_storeu_ps(dst + d + 2 * F, sum2);
+                _mm512_storeu_ps(dst + d + 3 * F, sum3);
+            }
+            for (; d < depthF; d += F)
+            {
+                __m512 sum = _mm512_mul_ps(_mm512_loadu_ps(dst + d), _alpha);
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                    sum = _mm512_fmadd_ps(_mm512_set1_ps(ValueAtt(p + j)), LoadAtt(vj), sum);
+                _mm512_storeu_ps(dst + d, sum);
+            }
+            if (tail)
+            {
+                __m512 sum = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + d), _alpha);
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                    sum = _mm512_fmadd_ps(_mm512_set1_ps(ValueAtt(p + j)), LoadAtt(vj, tail), sum);
+                _mm512_mask_storeu_ps(dst + d, tail, sum);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetAttention32f::SynetAttention32f(const AttentionParam32f& p)
+            : Avx2::SynetAttention32f(p)
+        {
+            _score32f = Score<float>;
+            _score16b = Score<uint16_t>;
+            _softmax = Softmax;
+            _accum32f = Accum<float>;
+            _accum16b = Accum<uint16_t>;
+            _convert = Avx512bw::Float32ToBFloat16;
+            SetBlocks(F);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility)
+        {
+            AttentionParam32f param(batch, heads, seqQ, seqK, depth, scale, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention32f(param);
+        }
+    }
+#endif
+}
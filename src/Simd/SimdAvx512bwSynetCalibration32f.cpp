@@ -0,0 +1,173 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration32f.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512bw
+    {
+        SynetCalibration32f::SynetCalibration32f(const Base::Calibration32fParam& param)
+            : Avx2::SynetCalibration32f(param)
+        {
+        }
+
+        void SynetCalibration32f::Range(const float* src, size_t spatial, float* min, float* max)
+        {
+            size_t C = _param.channels;
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                __mmask16 tail = TailMask16(spatial - spatialF);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m512 _min = _mm512_set1_ps(FLT_MAX), _max = _mm512_set1_ps(-FLT_MAX);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m512 _src = _mm512_loadu_ps(src + s);
+                        _min = _mm512_min_ps(_min, _src);
+                        _max = _mm512_max_ps(_max, _src);
+                    }
+                    if (tail)
+                    {
+                        __m512 _src = _mm512_maskz_loadu_ps(tail, src + s);
+                        _min = _mm512_mask_min_ps(_min, tail, _min, _src);
+                        _max = _mm512_mask_max_ps(_max, tail, _max, _src);
+                    }
+                    min[c] = _mm512_reduce_min_ps(_min);
+                    max[c] = _mm512_reduce_max_ps(_max);
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), c;
+                __mmask16 tail = TailMask16(C - CF);
+                for (c = 0; c < C; ++c)
+                {
+                    min[c] = FLT_MAX;
+                    max[c] = -FLT_MAX;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m512 _src = _mm512_loadu_ps(src + c);
+                        _mm512_storeu_ps(min + c, _mm512_min_ps(_mm512_loadu_ps(min + c), _src));
+                        _mm512_storeu_ps(max + c, _mm512_max_ps(_mm512_loadu_ps(max + c), _src));
+                    }
+                    if (tail)
+                    {
+                        __m512 _src = _mm512_maskz_loadu_ps(tail, src + c);
+                        _mm512_mask_storeu_ps(min + c, tail, _mm512_min_ps(_mm512_maskz_loadu_ps(tail, min + c), _src));
+                        _mm512_mask_storeu_ps(max + c, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, max + c), _src));
+                    }
+                    src += C;
+                }
+            }
+        }
+
+        SIMD_INLINE __m512i HistogramIndex(__m512 value, __m512 scale, __m512i bins, __m512i last)
+        {
+            __m512i index = _mm512_min_epi32(_mm512_cvttps_epi32(_mm512_mul_ps(_mm512_abs_ps(value), scale)), last);
+            return _mm512_mask_add_epi32(index, _mm512_cmp_ps_mask(value, _mm512_setzero_ps(), _CMP_GE_OQ), index, bins);
+        }
+
+        SIMD_INLINE void HistogramIncrement(const int32_t* index, size_t count, uint32_t* histogram)
+        {
+            for (size_t i = 0; i < count; ++i)
+                histogram[index[i]]++;
+        }
+
+        void SynetCalibration32f::Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram)
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            __m512i _bins = _mm512_set1_epi32((int)bins), _last = _mm512_set1_epi32((int)bins - 1);
+            SIMD_ALIGNED(64) int32_t index[F];
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F), tail = spatial - spatialF;
+                __mmask16 mask = TailMask16(tail);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m512 _scale = _mm512_set1_ps(scale[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        _mm512_store_si512(index, HistogramIndex(_mm512_loadu_ps(src + s), _scale, _bins, _last));
+                        HistogramIncrement(index, F, histogram);
+                    }
+                    if (tail)
+                    {
+                        _mm512_store_si512(index, HistogramIndex(_mm512_maskz_loadu_ps(mask, src + s), _scale, _bins, _last));
+                        HistogramIncrement(index, tail, histogram);
+                    }
+                    histogram += bins * 2;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), tail = C - CF, c;
+                __mmask16 mask = TailMask16(tail);
+                __m512i _step = _mm512_set1_epi32(int(bins * 2 * F));
+                __m512i _start = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(int(bins * 2)));
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    __m512i _offset = _start;
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m512i _index = HistogramIndex(_mm512_loadu_ps(src + c), _mm512_loadu_ps(scale + c), _bins, _last);
+                        _mm512_store_si512(index, _mm512_add_epi32(_index, _offset));
+                        HistogramIncrement(index, F, histogram);
+                        _offset = _mm512_add_epi32(_offset, _step);
+                    }
+                    if (tail)
+                    {
+                        __m512i _index = HistogramIndex(_mm512_maskz_loadu_ps(mask, src + c), _mm512_maskz_loadu_ps(mask, scale + c), _bins, _last);
+                        _mm512_store_si512(index, _mm512_add_epi32(_index, _offset));
+                        HistogramIncrement(index, tail, histogram);
+                    }
+                    src += C;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format)
+        {
+            Base::Calibration32fParam param(channels, bins ? bins : 2048, format);
+            if (!param.Valid())
+                return NULL;
+            return new Avx512bw::SynetCalibration32f(param);
+        }
+    }
+#endif
+}
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
 #include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdExp.h"
@@ -535,6 +536,100 @@ namespace Simd
                 else
                     SynetSwish32f(dst, size * count, &slope, dst);
             }
+            else if (activation == ::SimdConvolutionActivationGelu)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m512 _dst = _mm512_loadu_ps(dst + i);
+                                __m512 _bias = _mm512_loadu_ps(bias + i);
+                                _mm512_storeu_ps(dst + i, Gelu(_mm512_add_ps(_dst, _bias)));
+                            }
+                            if (i < count)
+                            {
+                                __m512 _dst = _mm512_maskz_loadu_ps(tail, dst + i);
+                                __m512 _bias = _mm512_maskz_loadu_ps(tail, bias + i);
+                                _mm512_mask_storeu_ps(dst + i, tail, Gelu(_mm512_add_ps(_dst, _bias)));
+                            }
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m512 _bias = _mm512_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m512 value = _mm512_add_ps(_mm512_loadu_ps(dst + j), _bias);
+                                _mm512_storeu_ps(dst + j, Gelu(value));
+                            }
+                            if (j < size)
+                            {
+                                __m512 value = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + j), _bias);
+                                _mm512_mask_storeu_ps(dst + j, tail, Gelu(value));
+                            }
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGelu32f(dst, size * count, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationGeluTanh)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m512 _dst = _mm512_loadu_ps(dst + i);
+                                __m512 _bias = _mm512_loadu_ps(bias + i);
+                                _mm512_storeu_ps(dst + i, GeluTanh(_mm512_add_ps(_dst, _bias)));
+                            }
+                            if (i < count)
+                            {
+                                __m512 _dst = _mm512_maskz_loadu_ps(tail, dst + i);
+                                __m512 _bias = _mm512_maskz_loadu_ps(tail, bias + i);
+                                _mm512_mask_storeu_ps(dst + i, tail, GeluTanh(_mm512_add_ps(_dst, _bias)));
+                            }
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m512 _bias = _mm512_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m512 value = _mm512_add_ps(_mm512_loadu_ps(dst + j), _bias);
+                                _mm512_storeu_ps(dst + j, GeluTanh(value));
+                            }
+                            if (j < size)
+                            {
+                                __m512 value = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + j), _bias);
+                                _mm512_mask_storeu_ps(dst + j, tail, GeluTanh(value));
+                            }
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGeluTanh32f(dst, size * count, dst);
+            }
             else
                 assert(0);
 #endif
@@ -542,6 +637,76 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<::SimdConvolutionActivationType type> void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            if (trans)
+            {
+                size_t countF = AlignLo(count, F);
+                __mmask16 tail = TailMask16(count - countF);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < countF; i += F)
+                    {
+                        __m512 value = _mm512_add_ps(_mm512_loadu_ps(dst + i), _mm512_loadu_ps(add + i));
+                        if (bias)
+                            value = _mm512_add_ps(value, _mm512_loadu_ps(bias + i));
+                        _mm512_storeu_ps(dst + i, Activate<type>(value, params, i));
+                    }
+                    if (i < count)
+                    {
+                        __m512 value = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + i), _mm512_maskz_loadu_ps(tail, add + i));
+                        if (bias)
+                            value = _mm512_add_ps(value, _mm512_maskz_loadu_ps(tail, bias + i));
+                        _mm512_mask_storeu_ps(dst + i, tail, Activate<type>(value, params, i, tail));
+                    }
+                    add += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                const ::SimdConvolutionActivationType row = type == ::SimdConvolutionActivationPrelu ? ::SimdConvolutionActivationLeakyRelu : type;
+                size_t sizeF = AlignLo(size, F);
+                __mmask16 tail = TailMask16(size - sizeF);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const float* ps = type == ::SimdConvolutionActivationPrelu ? params + i : params;
+                    __m512 _shift = bias ? _mm512_set1_ps(bias[i]) : _mm512_setzero_ps();
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm512_storeu_ps(dst + j, Activate<row>(_mm512_add_ps(_mm512_add_ps(_mm512_loadu_ps(dst + j), _mm512_loadu_ps(add + j)), _shift), ps, 0));
+                    if (j < size)
+                        _mm512_mask_storeu_ps(dst + j, tail, Activate<row>(_mm512_add_ps(_mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + j), _mm512_maskz_loadu_ps(tail, add + j)), _shift), ps, 0, tail));
+                    add += size;
+                    dst += size;
+                }
+            }
+        }
+
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: ConvolutionBiasAddActivation<::SimdConvolutionActivationIdentity>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationLeakyRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationLeakyRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRestrictRange: ConvolutionBiasAddActivation<::SimdConvolutionActivationRestrictRange>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationPrelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationPrelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationElu: ConvolutionBiasAddActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHswish: ConvolutionBiasAddActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationMish: ConvolutionBiasAddActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHardSigmoid: ConvolutionBiasAddActivation<::SimdConvolutionActivationHardSigmoid>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationSwish: ConvolutionBiasAddActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGeluTanh: ConvolutionBiasAddActivation<::SimdConvolutionActivationGeluTanh>(bias, count, size, params, trans, add, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f& p)
             : Avx2::SynetConvolution32fGemmNN(p)
         {
@@ -581,6 +746,10 @@ namespace Simd
                 _nhwcReorderB = Avx512bw::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = _N > Avx::F ? Avx512bw::ConvolutionBiasAndActivation : Avx::ConvolutionBiasAndActivation;
+            if (_N > Avx::F)
+                _biasAddActivation = Avx512bw::ConvolutionBiasAddActivation;
+            else
+                _biasAddActivation = Avx2::ConvolutionBiasAddActivation;
         }
 
         void SynetConvolution32fGemmNN::ImgToCol(const float* src, float* dst)
@@ -662,6 +831,7 @@ namespace Simd
         {
             _gemm.Init(InitGemmFuncs(Avx512bw::Gemm32fNT, "Avx512bw"));
             _biasAndActivation = Avx512bw::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx512bw::ConvolutionBiasAddActivation;
         }
 
         //-----------------------------------------------------------------------------------------
@@ -748,6 +918,7 @@ namespace Simd
                 _nhwcReorderB = Avx512bw::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = Avx512bw::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx512bw::ConvolutionBiasAddActivation;
         }
 
         //-----------------------------------------------------------------------------------------
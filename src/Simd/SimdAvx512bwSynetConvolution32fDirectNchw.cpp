@@ -41,7 +41,10 @@ namespace Simd
          SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
             : Avx2::SynetConvolution32fDirectNchw(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Avx512bw::ConvolutionBiasAndActivation;
+            _biasAddActivation = Avx512bw::ConvolutionBiasAddActivation;
         }
 
         template <size_t size> SIMD_INLINE void LoadWeight(const float * src, __m512 * dst)
@@ -292,6 +295,16 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const __m512* params)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGeluTanh>(__m512 value, const __m512* params)
+        {
+            return GeluTanh(value);
+        }
+
         template<int kernel, int stride, ::SimdConvolutionActivationType type>
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, 
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -443,47 +456,49 @@ namespace Simd
             case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
             case ::SimdConvolutionActivationHardSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHardSigmoid>;
             case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationGeluTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGeluTanh>;
             default:
                 assert(0);
                 return NULL;
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             if (p.dstW <= HF && p.kernelX <= 3)
-                return Avx2::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Avx2::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             switch (p.strideX)
             {
             case 1:
                 if (p.kernelX == 1)
-                    return Avx512bw::SetConvolutionBiasActivation<1, 1>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<1, 1>(activation);
                 if (p.kernelX == 2)
-                    return Avx512bw::SetConvolutionBiasActivation<2, 1>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<2, 1>(activation);
                 if (p.kernelX == 3)
-                    return Avx512bw::SetConvolutionBiasActivation<3, 1>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<3, 1>(activation);
                 if (p.kernelX == 4)
-                    return Avx512bw::SetConvolutionBiasActivation<4, 1>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<4, 1>(activation);
                 if (p.kernelX == 5)
-                    return Avx512bw::SetConvolutionBiasActivation<5, 1>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<5, 1>(activation);
                 break;
             case 2:
                 if (p.kernelX == 2)
-                    return Avx512bw::SetConvolutionBiasActivation<2, 2>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<2, 2>(activation);
                 if (p.kernelX == 3)
-                    return Avx512bw::SetConvolutionBiasActivation<3, 2>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<3, 2>(activation);
                 if (p.kernelX == 4)
-                    return Avx512bw::SetConvolutionBiasActivation<4, 2>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<4, 2>(activation);
                 if (p.kernelX == 5)
-                    return Avx512bw::SetConvolutionBiasActivation<5, 2>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<5, 2>(activation);
                 break;
             case 3:
                 if (p.kernelX == 3)
-                    return Avx512bw::SetConvolutionBiasActivation<3, 3>(p.activation);
+                    return Avx512bw::SetConvolutionBiasActivation<3, 3>(activation);
                 break;
             }
-            return Avx2::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+            return Avx2::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
         }
     }
 #endif
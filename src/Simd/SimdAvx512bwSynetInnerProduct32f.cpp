@@ -34,10 +34,83 @@ namespace Simd
 #if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
     namespace Avx512bw
     {
+        template<int rows> void InnerProduct32fSparse(size_t G, const float* src, size_t K, const float* value, const uint8_t* index, float* dst, size_t N, __mmask16 tail)
+        {
+            __m512 d00 = _mm512_setzero_ps(), d01 = _mm512_setzero_ps(), d10 = _mm512_setzero_ps(), d11 = _mm512_setzero_ps(),
+                d20 = _mm512_setzero_ps(), d21 = _mm512_setzero_ps(), d30 = _mm512_setzero_ps(), d31 = _mm512_setzero_ps(), s, w0, w1;
+            __m512i _3 = _mm512_set1_epi32(3), i0, i1;
+            const float* src0 = src + 0 * K;
+            const float* src1 = src + 1 * K;
+            const float* src2 = src + 2 * K;
+            const float* src3 = src + 3 * K;
+            for (size_t g = 0, o = 0; g < G; g += 1, o += 4)
+            {
+                i0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)index));
+                i1 = _mm512_and_si512(_mm512_srli_epi32(i0, 2), _3);
+                i0 = _mm512_and_si512(i0, _3);
+                w0 = _mm512_loadu_ps(value + 0 * F);
+                w1 = _mm512_loadu_ps(value + 1 * F);
+                if (rows > 0)
+                {
+                    s = _mm512_broadcast_f32x4(_mm_loadu_ps(src0 + o));
+                    d00 = _mm512_fmadd_ps(w0, _mm512_permutexvar_ps(i0, s), d00);
+                    d01 = _mm512_fmadd_ps(w1, _mm512_permutexvar_ps(i1, s), d01);
+                }
+                if (rows > 1)
+                {
+                    s = _mm512_broadcast_f32x4(_mm_loadu_ps(src1 + o));
+                    d10 = _mm512_fmadd_ps(w0, _mm512_permutexvar_ps(i0, s), d10);
+                    d11 = _mm512_fmadd_ps(w1, _mm512_permutexvar_ps(i1, s), d11);
+                }
+                if (rows > 2)
+                {
+                    s = _mm512_broadcast_f32x4(_mm_loadu_ps(src2 + o));
+                    d20 = _mm512_fmadd_ps(w0, _mm512_permutexvar_ps(i0, s), d20);
+                    d21 = _mm512_fmadd_ps(w1, _mm512_permutexvar_ps(i1, s), d21);
+                }
+                if (rows > 3)
+                {
+                    s = _mm512_broadcast_f32x4(_mm_loadu_ps(src3 + o));
+                    d30 = _mm512_fmadd_ps(w0, _mm512_permutexvar_ps(i0, s), d30);
+                    d31 = _mm512_fmadd_ps(w1, _mm512_permutexvar_ps(i1, s), d31);
+                }
+                value += 2 * F;
+                index += F;
+            }
+            if (rows > 0) _mm512_mask_storeu_ps(dst + 0 * N, tail, _mm512_add_ps(d00, d01));
+            if (rows > 1) _mm512_mask_storeu_ps(dst + 1 * N, tail, _mm512_add_ps(d10, d11));
+            if (rows > 2) _mm512_mask_storeu_ps(dst + 2 * N, tail, _mm512_add_ps(d20, d21));
+            if (rows > 3) _mm512_mask_storeu_ps(dst + 3 * N, tail, _mm512_add_ps(d30, d31));
+        }
+
+        static void SynetInnerProduct32fSparse(const float* src, size_t M, size_t N, size_t K, const float* value, const uint8_t* index, float* dst)
+        {
+            size_t G = K / 4, M4 = AlignLo(M, 4);
+            for (size_t n = 0; n < N; n += F)
+            {
+                __mmask16 tail = TailMask16(N - n);
+                size_t m = 0;
+                for (; m < M4; m += 4)
+                    InnerProduct32fSparse<4>(G, src + m * K, K, value, index, dst + m * N + n, N, tail);
+                switch (M - M4)
+                {
+                case 1: InnerProduct32fSparse<1>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                case 2: InnerProduct32fSparse<2>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                case 3: InnerProduct32fSparse<3>(G, src + m * K, K, value, index, dst + m * N + n, N, tail); break;
+                }
+                value += G * 2 * F;
+                index += G * F;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         SynetInnerProduct32fGemm::SynetInnerProduct32fGemm(const InnerProductParam32f& p)
             : Avx2::SynetInnerProduct32fGemm(p)
         {
             _biasAndActivation = Avx512bw::ConvolutionBiasAndActivation;
+            _spF = F;
+            _sparse = SynetInnerProduct32fSparse;
             if (_param.transpose)
             {
                 if (_param.input > Avx::F)
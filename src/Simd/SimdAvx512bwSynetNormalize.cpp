@@ -25,6 +25,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetConvolution32f.h"
 
 namespace Simd
 {
@@ -207,6 +208,279 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void LayerNormNchw(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(2 * spatial);
+                buf = _buf.data;
+            }
+            float* mean = buf, * norm = buf + spatial;
+            size_t spatialF = AlignLo(spatial, F);
+            __mmask16 spatialMask = TailMask16(spatial - spatialF);
+            __m512 _k = _mm512_set1_ps(1.0f / channels), _eps = _mm512_set1_ps(eps), _1 = _mm512_set1_ps(1.0f);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                {
+                    _mm512_storeu_ps(mean + s, _mm512_setzero_ps());
+                    _mm512_storeu_ps(norm + s, _mm512_setzero_ps());
+                }
+                if (s < spatial)
+                {
+                    _mm512_mask_storeu_ps(mean + s, spatialMask, _mm512_setzero_ps());
+                    _mm512_mask_storeu_ps(norm + s, spatialMask, _mm512_setzero_ps());
+                }
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm512_storeu_ps(mean + s, _mm512_add_ps(_mm512_loadu_ps(mean + s), _mm512_loadu_ps(ps + s)));
+                    if (s < spatial)
+                        _mm512_mask_storeu_ps(mean + s, spatialMask, _mm512_add_ps(_mm512_maskz_loadu_ps(spatialMask, mean + s), _mm512_maskz_loadu_ps(spatialMask, ps + s)));
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm512_storeu_ps(mean + s, _mm512_mul_ps(_mm512_loadu_ps(mean + s), _k));
+                if (s < spatial)
+                    _mm512_mask_storeu_ps(mean + s, spatialMask, _mm512_mul_ps(_mm512_maskz_loadu_ps(spatialMask, mean + s), _k));
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m512 _src = _mm512_sub_ps(_mm512_loadu_ps(ps + s), _mm512_loadu_ps(mean + s));
+                        _mm512_storeu_ps(norm + s, _mm512_fmadd_ps(_src, _src, _mm512_loadu_ps(norm + s)));
+                    }
+                    if (s < spatial)
+                    {
+                        __m512 _src = _mm512_sub_ps(_mm512_maskz_loadu_ps(spatialMask, ps + s), _mm512_maskz_loadu_ps(spatialMask, mean + s));
+                        _mm512_mask_storeu_ps(norm + s, spatialMask, _mm512_fmadd_ps(_src, _src, _mm512_maskz_loadu_ps(spatialMask, norm + s)));
+                    }
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm512_storeu_ps(norm + s, _mm512_div_ps(_1, _mm512_sqrt_ps(_mm512_fmadd_ps(_mm512_loadu_ps(norm + s), _k, _eps))));
+                if (s < spatial)
+                    _mm512_mask_storeu_ps(norm + s, spatialMask, _mm512_div_ps(_1, _mm512_sqrt_ps(_mm512_fmadd_ps(_mm512_maskz_loadu_ps(spatialMask, norm + s), _k, _eps))));
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m512 _scale = _mm512_set1_ps(scale[c]), _shift = _mm512_set1_ps(shift[c]);
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m512 _src = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(src + s), _mm512_loadu_ps(mean + s)), _mm512_loadu_ps(norm + s));
+                        _mm512_storeu_ps(dst + s, _mm512_fmadd_ps(_src, _scale, _shift));
+                    }
+                    if (s < spatial)
+                    {
+                        __m512 _src = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(spatialMask, src + s), 
+                            _mm512_maskz_loadu_ps(spatialMask, mean + s)), _mm512_maskz_loadu_ps(spatialMask, norm + s));
+                        _mm512_mask_storeu_ps(dst + s, spatialMask, _mm512_fmadd_ps(_src, _scale, _shift));
+                    }
+                    dst += spatial;
+                    src += spatial;
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+            }
+        }
+
+        void LayerNormNhwc(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            float k = 1.0f / channels;
+            size_t channelsF = AlignLo(channels, F);
+            __mmask16 channelsMask = TailMask16(channels - channelsF);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m512 _sum = _mm512_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _sum = _mm512_add_ps(_sum, _mm512_loadu_ps(src + c));
+                if (c < channels)
+                    _sum = _mm512_add_ps(_sum, _mm512_maskz_loadu_ps(channelsMask, src + c));
+                __m512 _mean = _mm512_set1_ps(ExtractSum(_sum) * k);
+                _sum = _mm512_setzero_ps();
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 _src = _mm512_sub_ps(_mm512_loadu_ps(src + c), _mean);
+                    _sum = _mm512_fmadd_ps(_src, _src, _sum);
+                }
+                if (c < channels)
+                {
+                    __m512 _src = _mm512_maskz_sub_ps(channelsMask, _mm512_maskz_loadu_ps(channelsMask, src + c), _mean);
+                    _sum = _mm512_fmadd_ps(_src, _src, _sum);
+                }
+                __m512 _norm = _mm512_set1_ps(1.0f / ::sqrt(ExtractSum(_sum) * k + eps));
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 _src = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(src + c), _mean), _norm);
+                    _mm512_storeu_ps(dst + c, _mm512_fmadd_ps(_src, _mm512_loadu_ps(scale + c), _mm512_loadu_ps(shift + c)));
+                }
+                if (c < channels)
+                {
+                    __m512 _src = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(channelsMask, src + c), _mean), _norm);
+                    _mm512_mask_storeu_ps(dst + c, channelsMask, _mm512_fmadd_ps(_src, 
+                        _mm512_maskz_loadu_ps(channelsMask, scale + c), _mm512_maskz_loadu_ps(channelsMask, shift + c)));
+                }
+                ConvolutionBiasAndActivation(NULL, channels, 1, activation, params, SimdTrue, dst);
+                dst += channels;
+                src += channels;
+            }
+        }
+
+        void SynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                LayerNormNchw(src, batch, channels, spatial, scale, shift, eps[0], activation, params, buf, dst);
+            else if (format == SimdTensorFormatNhwc)
+                LayerNormNhwc(src, batch, channels, spatial, scale, shift, eps[0], activation, params, dst);
+            else
+                assert(0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void GroupNormNchw(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            size_t gC = channels / groups, gS = gC * spatial;
+            size_t gSF = AlignLo(gS, F), spatialF = AlignLo(spatial, F);
+            __mmask16 gSMask = TailMask16(gS - gSF), spatialMask = TailMask16(spatial - spatialF);
+            float k = 1.0f / gS;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    __m512 _sum = _mm512_setzero_ps();
+                    size_t i = 0;
+                    for (; i < gSF; i += F)
+                        _sum = _mm512_add_ps(_sum, _mm512_loadu_ps(src + i));
+                    if (i < gS)
+                        _sum = _mm512_add_ps(_sum, _mm512_maskz_loadu_ps(gSMask, src + i));
+                    float mean = ExtractSum(_sum) * k;
+                    __m512 _mean = _mm512_set1_ps(mean);
+                    _sum = _mm512_setzero_ps();
+                    for (i = 0; i < gSF; i += F)
+                    {
+                        __m512 _src = _mm512_sub_ps(_mm512_loadu_ps(src + i), _mean);
+                        _sum = _mm512_fmadd_ps(_src, _src, _sum);
+                    }
+                    if (i < gS)
+                    {
+                        __m512 _src = _mm512_maskz_sub_ps(gSMask, _mm512_maskz_loadu_ps(gSMask, src + i), _mean);
+                        _sum = _mm512_fmadd_ps(_src, _src, _sum);
+                    }
+                    float norm = 1.0f / ::sqrt(ExtractSum(_sum) * k + eps);
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                    {
+                        float _scale = norm * scale[c];
+                        __m512 __scale = _mm512_set1_ps(_scale), __shift = _mm512_set1_ps(shift[c] - mean * _scale);
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _mm512_storeu_ps(dst + s, _mm512_fmadd_ps(_mm512_loadu_ps(src + s), __scale, __shift));
+                        if (s < spatial)
+                            _mm512_mask_storeu_ps(dst + s, spatialMask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(spatialMask, src + s), __scale, __shift));
+                        dst += spatial;
+                        src += spatial;
+                    }
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+            }
+        }
+
+        void GroupNormNhwc(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(3 * channels);
+                buf = _buf.data;
+            }
+            float* sum = buf, * _scale = buf + channels, * _shift = buf + 2 * channels;
+            size_t gC = channels / groups, channelsF = AlignLo(channels, F);
+            __mmask16 channelsMask = TailMask16(channels - channelsF);
+            float k = 1.0f / (gC * spatial);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _mm512_storeu_ps(sum + c, _mm512_setzero_ps());
+                if (c < channels)
+                    _mm512_mask_storeu_ps(sum + c, channelsMask, _mm512_setzero_ps());
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    const float* ps = src + s * channels;
+                    for (c = 0; c < channelsF; c += F)
+                        _mm512_storeu_ps(sum + c, _mm512_add_ps(_mm512_loadu_ps(sum + c), _mm512_loadu_ps(ps + c)));
+                    if (c < channels)
+                        _mm512_mask_storeu_ps(sum + c, channelsMask, _mm512_add_ps(_mm512_maskz_loadu_ps(channelsMask, sum + c), _mm512_maskz_loadu_ps(channelsMask, ps + c)));
+                }
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    float mean = 0;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        mean += sum[c];
+                    mean *= k;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        _shift[c] = mean, sum[c] = 0;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    const float* ps = src + s * channels;
+                    for (c = 0; c < channelsF; c += F)
+                    {
+                        __m512 _src = _mm512_sub_ps(_mm512_loadu_ps(ps + c), _mm512_loadu_ps(_shift + c));
+                        _mm512_storeu_ps(sum + c, _mm512_fmadd_ps(_src, _src, _mm512_loadu_ps(sum + c)));
+                    }
+                    if (c < channels)
+                    {
+                        __m512 _src = _mm512_sub_ps(_mm512_maskz_loadu_ps(channelsMask, ps + c), _mm512_maskz_loadu_ps(channelsMask, _shift + c));
+                        _mm512_mask_storeu_ps(sum + c, channelsMask, _mm512_fmadd_ps(_src, _src, _mm512_maskz_loadu_ps(channelsMask, sum + c)));
+                    }
+                }
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    float norm = 0;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        norm += sum[c];
+                    norm = 1.0f / ::sqrt(norm * k + eps);
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                    {
+                        _scale[c] = norm * scale[c];
+                        _shift[c] = shift[c] - _shift[c] * _scale[c];
+                    }
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (c = 0; c < channelsF; c += F)
+                        _mm512_storeu_ps(dst + c, _mm512_fmadd_ps(_mm512_loadu_ps(src + c), _mm512_loadu_ps(_scale + c), _mm512_loadu_ps(_shift + c)));
+                    if (c < channels)
+                        _mm512_mask_storeu_ps(dst + c, channelsMask, _mm512_fmadd_ps(_mm512_maskz_loadu_ps(channelsMask, src + c), 
+                            _mm512_maskz_loadu_ps(channelsMask, _scale + c), _mm512_maskz_loadu_ps(channelsMask, _shift + c)));
+                    dst += channels;
+                    src += channels;
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdTrue, dst - channels * spatial);
+            }
+        }
+
+        void SynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            assert(channels % groups == 0);
+            if (format == SimdTensorFormatNchw)
+                GroupNormNchw(src, batch, channels, spatial, groups, scale, shift, eps[0], activation, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                GroupNormNhwc(src, batch, channels, spatial, groups, scale, shift, eps[0], activation, params, buf, dst);
+            else
+                assert(0);
+        }
     }
 #endif
 }
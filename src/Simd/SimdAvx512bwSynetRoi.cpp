@@ -0,0 +1,99 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetRoi.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512bw
+    {
+        static void RoiAlignNhwc(const float* src, size_t channels, const Base::RoiAlignSample* samples, size_t count, float* dst)
+        {
+            size_t channelsQF = AlignLo(channels, QF), c = 0;
+            for (; c < channelsQF; c += QF)
+            {
+                __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps(), sum2 = _mm512_setzero_ps(), sum3 = _mm512_setzero_ps();
+                for (size_t s = 0; s < count; ++s)
+                {
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        const float* ps = src + samples[s].offset[k] * channels + c;
+                        __m512 w = _mm512_set1_ps(samples[s].weight[k]);
+                        sum0 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 0 * F), sum0);
+                        sum1 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 1 * F), sum1);
+                        sum2 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 2 * F), sum2);
+                        sum3 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 3 * F), sum3);
+                    }
+                }
+                _mm512_storeu_ps(dst + c + 0 * F, sum0);
+                _mm512_storeu_ps(dst + c + 1 * F, sum1);
+                _mm512_storeu_ps(dst + c + 2 * F, sum2);
+                _mm512_storeu_ps(dst + c + 3 * F, sum3);
+            }
+            for (; c < channels; c += F)
+            {
+                __mmask16 tail = TailMask16(channels - c);
+                __m512 sum = _mm512_setzero_ps();
+                for (size_t s = 0; s < count; ++s)
+                    for (size_t k = 0; k < 4; ++k)
+                        sum = _mm512_fmadd_ps(_mm512_set1_ps(samples[s].weight[k]), _mm512_maskz_loadu_ps(tail, src + samples[s].offset[k] * channels + c), sum);
+                _mm512_mask_storeu_ps(dst + c, tail, sum);
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            Base::SynetRoiAlign32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, samplingRatio, aligned, dst, dstH, dstW, format, RoiAlignNhwc);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void RoiPoolingMaxNhwc(const float* src, size_t srcW, size_t channels, size_t y0, size_t y1, size_t x0, size_t x1, float* dst)
+        {
+            __m512 init = _mm512_set1_ps(y0 < y1 && x0 < x1 ? -FLT_MAX : 0.0f);
+            for (size_t c = 0; c < channels; c += F)
+            {
+                __mmask16 tail = TailMask16(channels - c);
+                __m512 max = init;
+                for (size_t y = y0; y < y1; ++y)
+                    for (size_t x = x0; x < x1; ++x)
+                        max = _mm512_max_ps(max, _mm512_maskz_loadu_ps(tail, src + (y * srcW + x) * channels + c));
+                _mm512_mask_storeu_ps(dst + c, tail, max);
+            }
+        }
+
+        void SynetRoiPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            Base::SynetRoiPoolingMax32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, dst, dstH, dstW, format, RoiPoolingMaxNhwc);
+        }
+    }
+#endif
+}
@@ -0,0 +1,473 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Avx512bw
+    {
+        void SynetSoftmaxLayerForward21(const float* src, size_t outer, float* dst)
+        {
+            Exp exp;
+            size_t aligned = Simd::AlignLo(outer, F), tail = outer - aligned;
+            for (size_t o = 0; o < aligned; o += F)
+            {
+                __m512 s0 = _mm512_loadu_ps(src + 0);
+                __m512 s1 = _mm512_loadu_ps(src + F);
+                __m512 ss0 = _mm512_shuffle_ps(s0, s1, 0x88);
+                __m512 ss1 = _mm512_shuffle_ps(s0, s1, 0xDD);
+                __m512 max = _mm512_max_ps(ss0, ss1);
+                __m512 exp0 = exp.Exponent(_mm512_sub_ps(ss0, max));
+                __m512 exp1 = exp.Exponent(_mm512_sub_ps(ss1, max));
+                __m512 sum = _mm512_add_ps(exp0, exp1);
+                __m512 d0 = _mm512_div_ps(exp0, sum);
+                __m512 d1 = _mm512_div_ps(exp1, sum);
+                _mm512_storeu_ps(dst + 0, _mm512_unpacklo_ps(d0, d1));
+                _mm512_storeu_ps(dst + F, _mm512_unpackhi_ps(d0, d1));
+                src += DF;
+                dst += DF;
+            }
+            if (tail)
+            {
+                __mmask16 mask0 = TailMask16(tail * 2 - 0 * F);
+                __mmask16 mask1 = TailMask16(tail * 2 - 1 * F);
+                __m512 s0 = _mm512_maskz_loadu_ps(mask0, src + 0 * F);
+                __m512 s1 = _mm512_maskz_loadu_ps(mask1, src + 1 * F);
+                __m512 ss0 = _mm512_shuffle_ps(s0, s1, 0x88);
+                __m512 ss1 = _mm512_shuffle_ps(s0, s1, 0xDD);
+                __m512 max = _mm512_max_ps(ss0, ss1);
+                __m512 exp0 = exp.Exponent(_mm512_sub_ps(ss0, max));
+                __m512 exp1 = exp.Exponent(_mm512_sub_ps(ss1, max));
+                __m512 sum = _mm512_add_ps(exp0, exp1);
+                __m512 d0 = _mm512_div_ps(exp0, sum);
+                __m512 d1 = _mm512_div_ps(exp1, sum);
+                _mm512_mask_storeu_ps(dst + 0 * F, mask0, _mm512_unpacklo_ps(d0, d1));
+                _mm512_mask_storeu_ps(dst + 1 * F, mask1, _mm512_unpackhi_ps(d0, d1));
+            }
+        }
+
+        SIMD_INLINE void SynetSoftmaxLayerForward31(const Exp& exp, __m512 buf[3])
+        {
+            __m512 max = _mm512_max_ps(buf[0], _mm512_max_ps(buf[1], buf[2]));
+            buf[0] = exp.Exponent(_mm512_sub_ps(buf[0], max));
+            buf[1] = exp.Exponent(_mm512_sub_ps(buf[1], max));
+            buf[2] = exp.Exponent(_mm512_sub_ps(buf[2], max));
+            __m512 sum = _mm512_add_ps(buf[0], _mm512_add_ps(buf[1], buf[2]));
+            buf[0] = _mm512_div_ps(buf[0], sum);
+            buf[1] = _mm512_div_ps(buf[1], sum);
+            buf[2] = _mm512_div_ps(buf[2], sum);
+        }
+
+        void SynetSoftmaxLayerForward31(const float* src, size_t outer, float* dst)
+        {
+            static const __m512i idx = _mm512_setr_epi32(0x00, 0x03, 0x06, 0x09, 0x0C, 0x0F, 0x12, 0x15, 0x18, 0x1B, 0x1E, 0x21, 0x24, 0x27, 0x2A, 0x2D);
+            Exp exp;
+            __m512 buf[3];
+            size_t aligned = Simd::AlignLo(outer, F), tail = outer - aligned;
+            for (size_t o = 0; o < aligned; o += F)
+            {
+                buf[0] = _mm512_i32gather_ps(idx, src + 0, 4);
+                buf[1] = _mm512_i32gather_ps(idx, src + 1, 4);
+                buf[2] = _mm512_i32gather_ps(idx, src + 2, 4);
+                SynetSoftmaxLayerForward31(exp, buf);
+                _mm512_i32scatter_ps(dst + 0, idx, buf[0], 4);
+                _mm512_i32scatter_ps(dst + 1, idx, buf[1], 4);
+                _mm512_i32scatter_ps(dst + 2, idx, buf[2], 4);
+                src += 3 * F;
+                dst += 3 * F;
+            }
+            if (tail)
+            {
+                __mmask16 mask = TailMask16(tail);
+                buf[0] = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, src + 0, 4);
+                buf[1] = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, src + 1, 4);
+                buf[2] = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, idx, src + 2, 4);
+                SynetSoftmaxLayerForward31(exp, buf);
+                _mm512_mask_i32scatter_ps(dst + 0, mask, idx, buf[0], 4);
+                _mm512_mask_i32scatter_ps(dst + 1, mask, idx, buf[1], 4);
+                _mm512_mask_i32scatter_ps(dst + 2, mask, idx, buf[2], 4);
+            }
+        }
+
+        SIMD_INLINE float SoftmaxRowMax(const float* src, size_t count)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            __m512 _max = _mm512_set1_ps(src[0]);
+            for (; c < countF; c += F)
+                _max = _mm512_max_ps(_max, _mm512_loadu_ps(src + c));
+            if (c < count)
+            {
+                __mmask16 tail = TailMask16(count - c);
+                _max = _mm512_mask_max_ps(_max, tail, _max, _mm512_maskz_loadu_ps(tail, src + c));
+            }
+            return _mm512_reduce_max_ps(_max);
+        }
+
+        SIMD_INLINE float SoftmaxRowSum(const Exp& exp, const float* src, size_t count, float max)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            __m512 _max = _mm512_set1_ps(max), _sum = _mm512_setzero_ps();
+            for (; c < countF; c += F)
+                _sum = _mm512_add_ps(_sum, exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + c), _max)));
+            if (c < count)
+            {
+                __mmask16 tail = TailMask16(count - c);
+                _sum = _mm512_mask_add_ps(_sum, tail, _sum, exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + c), _max)));
+            }
+            return ExtractSum(_sum);
+        }
+
+        void SynetSoftmaxLayerForwardX1(const float* src, size_t outer, size_t count, float* dst)
+        {
+            Exp exp;
+            size_t countF = AlignLo(count, F);
+            __mmask16 tail = TailMask16(count - countF);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                __m512 _max = _mm512_set1_ps(SoftmaxRowMax(src, count)), _sum = _mm512_setzero_ps();
+                size_t c = 0;
+                for (; c < countF; c += F)
+                {
+                    __m512 _exp = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(src + c), _max));
+                    _sum = _mm512_add_ps(_sum, _exp);
+                    _mm512_storeu_ps(dst + c, _exp);
+                }
+                if (c < count)
+                {
+                    __m512 _exp = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + c), _max));
+                    _sum = _mm512_mask_add_ps(_sum, tail, _sum, _exp);
+                    _mm512_mask_storeu_ps(dst + c, tail, _exp);
+                }
+                __m512 _k = _mm512_set1_ps(1.0f / ExtractSum(_sum));
+                for (c = 0; c < countF; c += F)
+                    _mm512_storeu_ps(dst + c, _mm512_mul_ps(_mm512_loadu_ps(dst + c), _k));
+                if (c < count)
+                    _mm512_mask_storeu_ps(dst + c, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + c), _k));
+                src += count;
+                dst += count;
+            }
+        }
+
+        void SynetSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            if (count == 2 && inner == 1)
+                SynetSoftmaxLayerForward21(src, outer, dst);
+            else if (count == 3 && inner == 1)
+                SynetSoftmaxLayerForward31(src, outer, dst);
+            else if (inner == 1)
+                SynetSoftmaxLayerForwardX1(src, outer, count, dst);
+            else
+            {
+                Exp exp;
+                size_t aligned = Simd::AlignLo(inner, F);
+                __mmask16 tail = TailMask16(inner - aligned);
+                Array32f tmp(inner * 2);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner, * d;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    memcpy(max, src, inner * sizeof(float));
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(max + i, _mm512_max_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(max + i, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                        s += inner;
+                    }
+
+                    s = src;
+                    d = dst;
+                    memset(sum, 0, inner * sizeof(float));
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                        {
+                            __m512 _d = exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                            _mm512_storeu_ps(d + i, _d);
+                            _mm512_storeu_ps(sum + i, _mm512_add_ps(_d, _mm512_loadu_ps(sum + i)));
+                        }
+                        if (i < inner)
+                        {
+                            __m512 _d = exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                            _mm512_mask_storeu_ps(d + i, tail, _d);
+                            _mm512_mask_storeu_ps(sum + i, tail, _mm512_add_ps(_d, _mm512_maskz_loadu_ps(tail, sum + i)));
+                        }
+                        s += inner;
+                        d += inner;
+                    }
+
+                    d = dst;
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(d + i, _mm512_div_ps(_mm512_loadu_ps(d + i), _mm512_loadu_ps(sum + i)));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(d + i, tail, _mm512_div_ps(_mm512_maskz_loadu_ps(tail, d + i), _mm512_maskz_loadu_ps(tail, sum + i)));
+                        d += inner;
+                    }
+                    src += count * inner;
+                    dst += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                size_t countF = AlignLo(count, F);
+                __mmask16 tail = TailMask16(count - countF);
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max = SoftmaxRowMax(src, count);
+                    __m512 _shift = _mm512_set1_ps(max + ::log(SoftmaxRowSum(exp, src, count, max)));
+                    size_t c = 0;
+                    for (; c < countF; c += F)
+                        _mm512_storeu_ps(dst + c, _mm512_sub_ps(_mm512_loadu_ps(src + c), _shift));
+                    if (c < count)
+                        _mm512_mask_storeu_ps(dst + c, tail, _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, src + c), _shift));
+                    src += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                size_t aligned = Simd::AlignLo(inner, F);
+                __mmask16 tail = TailMask16(inner - aligned);
+                Array32f tmp(inner * 2);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner, * d;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    memcpy(max, src, inner * sizeof(float));
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(max + i, _mm512_max_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(max + i, tail, _mm512_max_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                        s += inner;
+                    }
+
+                    s = src;
+                    memset(sum, 0, inner * sizeof(float));
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(sum + i, _mm512_add_ps(_mm512_loadu_ps(sum + i), exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)))));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(sum + i, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, sum + i), 
+                                exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)))));
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        max[i] += ::log(sum[i]);
+
+                    s = src;
+                    d = dst;
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(d + i, _mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(d + i, tail, _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)));
+                        s += inner;
+                        d += inner;
+                    }
+                    src += count * inner;
+                    dst += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t SoftmaxRowArgMax(const float* src, size_t count, float& max)
+        {
+            size_t countF = AlignLo(count, F), c = 0;
+            __m512 _max = _mm512_set1_ps(src[0]);
+            __m512i _idx = _mm512_setzero_si512(), _cur = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _step = _mm512_set1_epi32(F);
+            for (; c < countF; c += F)
+            {
+                __m512 _src = _mm512_loadu_ps(src + c);
+                __mmask16 greater = _mm512_cmp_ps_mask(_src, _max, _CMP_GT_OQ);
+                _max = _mm512_mask_mov_ps(_max, greater, _src);
+                _idx = _mm512_mask_mov_epi32(_idx, greater, _cur);
+                _cur = _mm512_add_epi32(_cur, _step);
+            }
+            if (c < count)
+            {
+                __mmask16 tail = TailMask16(count - c);
+                __m512 _src = _mm512_maskz_loadu_ps(tail, src + c);
+                __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, _src, _max, _CMP_GT_OQ);
+                _max = _mm512_mask_mov_ps(_max, greater, _src);
+                _idx = _mm512_mask_mov_epi32(_idx, greater, _cur);
+            }
+            max = _mm512_reduce_max_ps(_max);
+            __mmask16 equal = _mm512_cmp_ps_mask(_max, _mm512_set1_ps(max), _CMP_EQ_OQ);
+            return _mm512_mask_reduce_min_epi32(equal, _idx);
+        }
+
+        void SynetSoftmaxArgMax32f(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob)
+        {
+            Exp exp;
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max;
+                    Base::SynetSoftmaxArgMaxStore(SoftmaxRowArgMax(src, count, max), indexType, index, o);
+                    if (prob)
+                        prob[o] = 1.0f / SoftmaxRowSum(exp, src, count, max);
+                    src += count;
+                }
+            }
+            else
+            {
+                size_t aligned = Simd::AlignLo(inner, F);
+                __mmask16 tail = TailMask16(inner - aligned);
+                Array32f tmp(inner * 2);
+                Array32i idx(inner);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    memcpy(max, src, inner * sizeof(float));
+                    memset(idx.data, 0, inner * sizeof(int32_t));
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        __m512i _c = _mm512_set1_epi32((int)c);
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                        {
+                            __m512 _src = _mm512_loadu_ps(s + i);
+                            __mmask16 greater = _mm512_cmp_ps_mask(_src, _mm512_loadu_ps(max + i), _CMP_GT_OQ);
+                            _mm512_mask_storeu_ps(max + i, greater, _src);
+                            _mm512_mask_storeu_epi32(idx.data + i, greater, _c);
+                        }
+                        if (i < inner)
+                        {
+                            __m512 _src = _mm512_maskz_loadu_ps(tail, s + i);
+                            __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, _src, _mm512_maskz_loadu_ps(tail, max + i), _CMP_GT_OQ);
+                            _mm512_mask_storeu_ps(max + i, greater, _src);
+                            _mm512_mask_storeu_epi32(idx.data + i, greater, _c);
+                        }
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        Base::SynetSoftmaxArgMaxStore(idx[i], indexType, index, o * inner + i);
+                    if (prob)
+                    {
+                        s = src;
+                        memset(sum, 0, inner * sizeof(float));
+                        for (size_t c = 0; c < count; ++c)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                                _mm512_storeu_ps(sum + i, _mm512_add_ps(_mm512_loadu_ps(sum + i), exp.Exponent(_mm512_sub_ps(_mm512_loadu_ps(s + i), _mm512_loadu_ps(max + i)))));
+                            if (i < inner)
+                                _mm512_mask_storeu_ps(sum + i, tail, _mm512_add_ps(_mm512_maskz_loadu_ps(tail, sum + i),
+                                    exp.Exponent(_mm512_sub_ps(_mm512_maskz_loadu_ps(tail, s + i), _mm512_maskz_loadu_ps(tail, max + i)))));
+                            s += inner;
+                        }
+                        size_t i = 0;
+                        for (; i < aligned; i += F)
+                            _mm512_storeu_ps(prob + o * inner + i, _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_loadu_ps(sum + i)));
+                        if (i < inner)
+                            _mm512_mask_storeu_ps(prob + o * inner + i, tail, _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_maskz_loadu_ps(tail, sum + i)));
+                    }
+                    src += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void SoftmaxRowTopK(const float* src, size_t count, size_t k, float* val, uint32_t* idx)
+        {
+            size_t size = 0, c = 0;
+            for (; c < k; ++c)
+                Base::SynetSoftmaxTopKInsert(src[c], (uint32_t)c, k, size, val, idx);
+            for (; c < count; c += F)
+            {
+                __mmask16 tail = TailMask16(count - c);
+                __mmask16 greater = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, src + c), _mm512_set1_ps(val[k - 1]), _CMP_GT_OQ);
+                for (size_t j = c; greater; greater >>= 1, ++j)
+                    if ((greater & 1) && src[j] > val[k - 1])
+                        Base::SynetSoftmaxTopKInsert(src[j], (uint32_t)j, k, size, val, idx);
+            }
+        }
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob)
+        {
+            Exp exp;
+            Array32f buf(inner > 1 ? count : 0), val(k);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    const float* row = src + i;
+                    if (inner > 1)
+                    {
+                        for (size_t c = 0; c < count; ++c)
+                            buf[c] = row[c * inner];
+                        row = buf.data;
+                    }
+                    SoftmaxRowTopK(row, count, k, val.data, index);
+                    if (prob)
+                    {
+                        float sum = SoftmaxRowSum(exp, row, count, val[0]);
+                        for (size_t j = 0; j < k; ++j)
+                            prob[j] = ::exp(val[j] - val[0]) / sum;
+                        prob += k;
+                    }
+                    index += k;
+                }
+                src += count * inner;
+            }
+        }
+    }
+#endif
+}
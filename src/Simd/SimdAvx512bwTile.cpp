@@ -187,12 +187,12 @@ namespace Simd
         {
             assert(dst < TileRegCount&& a < TileRegCount&& b < TileRegCount); 
             
-            TileMatMul8u8i<true>(g_tileConf.rows[dst], g_tileConf.colsb[dst] / 4, g_tileConf.colsb[a] / 4, g_tileRegs[dst], g_tileRegs[a], g_tileRegs[b]);
+            TileMatMul8u8i<false>(g_tileConf.rows[dst], g_tileConf.colsb[dst] / 4, g_tileConf.colsb[a] / 4, g_tileRegs[dst], g_tileRegs[a], g_tileRegs[b]);
         }
 
         void TileMatMul8u8i(Tile1024* dst, const Tile1024& a, const Tile1024& b)
         {
-            TileMatMul8u8i<true>(dst->row, dst->col, b.row, dst->tile, a.tile, b.tile);
+            TileMatMul8u8i<false>(dst->row, dst->col, b.row, dst->tile, a.tile, b.tile);
         }
 
         //-----------------------------------------------------------------------------------------
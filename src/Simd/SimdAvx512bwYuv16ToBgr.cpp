@@ -0,0 +1,366 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <bool align, bool mask> SIMD_INLINE void StoreBgr(const __m512i& b, const __m512i& g, const __m512i& r, uint8_t* bgr, const __mmask64* tails)
+        {
+            Store<align, mask>(bgr + 0 * A, InterleaveBgr<0>(b, g, r), tails[0]);
+            Store<align, mask>(bgr + 1 * A, InterleaveBgr<1>(b, g, r), tails[1]);
+            Store<align, mask>(bgr + 2 * A, InterleaveBgr<2>(b, g, r), tails[2]);
+        }
+
+        template <bool align, bool mask> SIMD_INLINE void StoreBgra(const __m512i& b, const __m512i& g, const __m512i& r, const __m512i& a, uint8_t* bgra, const __mmask64* tails)
+        {
+            __m512i _b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, b);
+            __m512i _g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, g);
+            __m512i _r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, r);
+            __m512i bg0 = UnpackU8<0>(_b, _g);
+            __m512i bg1 = UnpackU8<1>(_b, _g);
+            __m512i ra0 = UnpackU8<0>(_r, a);
+            __m512i ra1 = UnpackU8<1>(_r, a);
+            Store<align, mask>(bgra + 0 * A, UnpackU16<0>(bg0, ra0), tails[0]);
+            Store<align, mask>(bgra + 1 * A, UnpackU16<1>(bg0, ra0), tails[1]);
+            Store<align, mask>(bgra + 2 * A, UnpackU16<0>(bg1, ra1), tails[2]);
+            Store<align, mask>(bgra + 3 * A, UnpackU16<1>(bg1, ra1), tails[3]);
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format> SIMD_INLINE void YuvToAny(const __m512i& y, 
+            const __m512i& u, const __m512i& v, const __m512i& a, uint8_t* dst, const __mmask64* tails)
+        {
+            __m512i b = YuvToBlue<T>(y, u);
+            __m512i g = YuvToGreen<T>(y, u, v);
+            __m512i r = YuvToRed<T>(y, v);
+            if (format == SimdPixelFormatBgr24)
+                StoreBgr<align, mask>(b, g, r, dst, tails);
+            else if (format == SimdPixelFormatBgra32)
+                StoreBgra<align, mask>(b, g, r, a, dst, tails);
+            else if (format == SimdPixelFormatRgb24)
+                StoreBgr<align, mask>(r, g, b, dst, tails);
+            else
+                StoreBgra<align, mask>(r, g, b, a, dst, tails);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template <bool align, bool mask> SIMD_INLINE __m512i LoadYuv16(const uint8_t* src, const __m128i& shift, __mmask64 tail)
+        {
+            return _mm512_min_epu16(_mm512_srl_epi16(Load<align, mask>(src, tail), shift), K16_00FF);
+        }
+
+        template <bool align, bool mask> SIMD_INLINE __m512i LoadYuv16To8(const uint8_t* src, const __m128i& shift, const __mmask64* tails)
+        {
+            return PackI16ToU8(LoadYuv16<align, mask>(src + 0, shift, tails[0]), LoadYuv16<align, mask>(src + A, shift, tails[1]));
+        }
+
+        SIMD_INLINE __m512i Duplicate8(const __m512i& value16)
+        {
+            return _mm512_or_si512(value16, _mm512_slli_epi16(value16, 8));
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format>
+#if defined(_MSC_VER) && _MSC_VER >= 1900      
+        inline 
+#else
+        SIMD_INLINE 
+#endif
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, const uint8_t* v, 
+            const __m128i& shift, const __m512i& a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            __m512i _u = Duplicate8(LoadYuv16<align, mask>(u, shift, tails[2]));
+            __m512i _v = Duplicate8(LoadYuv16<align, mask>(v, shift, tails[2]));
+            YuvToAny<align, mask, T, format>(LoadYuv16To8<align, mask>(y, shift, tails), _u, _v, a, dst, tails + 3);
+            YuvToAny<align, mask, T, format>(LoadYuv16To8<align, mask>(y + yStride, shift, tails), _u, _v, a, dst + dstStride, tails + 3);
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format>
+#if defined(_MSC_VER) && _MSC_VER >= 1900      
+        inline 
+#else
+        SIMD_INLINE 
+#endif
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, 
+            const __m128i& shift, const __m512i& a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            __m512i _uv = LoadYuv16To8<align, mask>(uv, shift, tails);
+            __m512i _u = Duplicate8(_mm512_and_si512(_uv, K16_00FF));
+            __m512i _v = Duplicate8(_mm512_srli_epi16(_uv, 8));
+            YuvToAny<align, mask, T, format>(LoadYuv16To8<align, mask>(y, shift, tails), _u, _v, a, dst, tails + 3);
+            YuvToAny<align, mask, T, format>(LoadYuv16To8<align, mask>(y + yStride, shift, tails), _u, _v, a, dst + dstStride, tails + 3);
+        }
+
+        template <bool align, bool mask, class T, SimdPixelFormatType format> SIMD_INLINE void Yuv444p16ToBgr(const uint8_t* y, 
+            const uint8_t* u, const uint8_t* v, const __m128i& shift, const __m512i& a, uint8_t* dst, const __mmask64* tails)
+        {
+            YuvToAny<align, mask, T, format>(LoadYuv16To8<align, mask>(y, shift, tails), LoadYuv16To8<align, mask>(u, shift, tails),
+                LoadYuv16To8<align, mask>(v, shift, tails), a, dst, tails + 3);
+        }
+
+        enum Yuv16Layout
+        {
+            Yuv16Layout420p,
+            Yuv16LayoutP010,
+            Yuv16Layout444p,
+        };
+
+        template <bool align, Yuv16Layout layout, class T, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride,
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            if (layout != Yuv16Layout444p)
+                assert((width % 2 == 0) && (height % 2 == 0));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(dst) && Aligned(dstStride));
+
+            const size_t N = format == SimdPixelFormatBgr24 ? 3 : 4;
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            __m512i a = _mm512_set1_epi8(alpha);
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            __mmask64 tails[7];
+            for (size_t i = 0; i < 2; ++i)
+                tails[0 + i] = TailMask64(tail * 2 - A * i);
+            tails[2] = TailMask64(tail);
+            for (size_t i = 0; i < N; ++i)
+                tails[3 + i] = TailMask64(tail * N - A * i);
+            if (layout == Yuv16Layout444p)
+            {
+                for (size_t row = 0; row < height; ++row)
+                {
+                    size_t col = 0;
+                    for (; col < bodyWidth; col += A)
+                        Yuv444p16ToBgr<align, false, T, format>(y + col * 2, u + col * 2, v + col * 2, _shift, a, dst + col * N, tails);
+                    if (tail)
+                        Yuv444p16ToBgr<align, true, T, format>(y + col * 2, u + col * 2, v + col * 2, _shift, a, dst + col * N, tails);
+                    y += yStride;
+                    u += uStride;
+                    v += vStride;
+                    dst += dstStride;
+                }
+            }
+            else
+            {
+                for (size_t row = 0; row < height; row += 2)
+                {
+                    size_t col = 0;
+                    for (; col < bodyWidth; col += A)
+                    {
+                        if (layout == Yuv16Layout420p)
+                            Yuv420p16ToBgr<align, false, T, format>(y + col * 2, yStride, u + col, v + col, _shift, a, dst + col * N, dstStride, tails);
+                        else
+                            P010ToBgr<align, false, T, format>(y + col * 2, yStride, u + col * 2, _shift, a, dst + col * N, dstStride, tails);
+                    }
+                    if (tail)
+                    {
+                        if (layout == Yuv16Layout420p)
+                            Yuv420p16ToBgr<align, true, T, format>(y + col * 2, yStride, u + col, v + col, _shift, a, dst + col * N, dstStride, tails);
+                        else
+                            P010ToBgr<align, true, T, format>(y + col * 2, yStride, u + col * 2, _shift, a, dst + col * N, dstStride, tails);
+                    }
+                    y += 2 * yStride;
+                    u += uStride;
+                    v += vStride;
+                    dst += 2 * dstStride;
+                }
+            }
+        }
+
+        template <bool align, Yuv16Layout layout, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride, 
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift, 
+            uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv16ToBgr<align, layout, Base::Bt601, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv16ToBgr<align, layout, Base::Bt709, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv16ToBgr<align, layout, Base::Bt2020, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv16ToBgr<align, layout, Base::Trect871, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <Yuv16Layout layout, SimdPixelFormatType format> void Yuv16ToBgr(const uint8_t* y, size_t yStride,
+            const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int shift,
+            uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(dst) && Aligned(dstStride))
+                Yuv16ToBgr<true, layout, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha, yuvType);
+            else
+                Yuv16ToBgr<false, layout, format>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha, yuvType);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout420p, SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout420p, SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr<Yuv16LayoutP010, SimdPixelFormatBgr24>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr<Yuv16LayoutP010, SimdPixelFormatBgra32>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout444p, SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr<Yuv16Layout444p, SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void Yuv16ToBgr32f(__m256i y, __m256i u, __m256i v, const __m512* p, float* blue, float* green, float* red, __mmask16 tail)
+        {
+            __m512 _y = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(y)), p[0]);
+            __m512 _u = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(u));
+            __m512 _v = _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(v));
+            __m512 _0 = _mm512_setzero_ps(), _1 = _mm512_set1_ps(1.0f);
+            _mm512_mask_storeu_ps(blue, tail, _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(_mm512_add_ps(_y, p[5]), _mm512_mul_ps(_u, p[1])), _0), _1));
+            _mm512_mask_storeu_ps(green, tail, _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(_mm512_add_ps(_mm512_add_ps(_y, p[6]), _mm512_mul_ps(_u, p[2])), _mm512_mul_ps(_v, p[3])), _0), _1));
+            _mm512_mask_storeu_ps(red, tail, _mm512_min_ps(_mm512_max_ps(_mm512_add_ps(_mm512_add_ps(_y, p[7]), _mm512_mul_ps(_v, p[4])), _0), _1));
+        }
+
+        const __m256i K8_SHUFFLE_P010_TO_U = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD,
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m256i K8_SHUFFLE_P010_TO_V = SIMD_MM256_SETR_EPI8(
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF,
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template <Yuv16Layout layout> SIMD_INLINE void Yuv16ToBgr32f(const uint8_t* y, const uint8_t* u, const uint8_t* v,
+            const __m512* p, float* blue, float* green, float* red, __mmask16 tail, __mmask8 tailUV)
+        {
+            __m256i _y = _mm256_maskz_loadu_epi16(tail, y), _u, _v;
+            if (layout == Yuv16Layout420p)
+            {
+                __m128i u8 = _mm_maskz_loadu_epi16(tailUV, u);
+                _u = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(u8, u8)), _mm_unpackhi_epi16(u8, u8), 1);
+                __m128i v8 = _mm_maskz_loadu_epi16(tailUV, v);
+                _v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(v8, v8)), _mm_unpackhi_epi16(v8, v8), 1);
+            }
+            else if (layout == Yuv16LayoutP010)
+            {
+                __m256i uv = _mm256_maskz_loadu_epi16(tail, u);
+                _u = _mm256_shuffle_epi8(uv, K8_SHUFFLE_P010_TO_U);
+                _v = _mm256_shuffle_epi8(uv, K8_SHUFFLE_P010_TO_V);
+            }
+            else
+            {
+                _u = _mm256_maskz_loadu_epi16(tail, u);
+                _v = _mm256_maskz_loadu_epi16(tail, v);
+            }
+            Yuv16ToBgr32f(_y, _u, _v, p, blue, green, red, tail);
+        }
+
+        template <Yuv16Layout layout> void Yuv16ToBgr32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int shift, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            if (layout != Yuv16Layout444p)
+                assert((width % 2 == 0) && (height % 2 == 0));
+
+            Base::Yuv16ToBgr32fParam param(shift, yuvType);
+            __m512 p[8];
+            p[0] = _mm512_set1_ps(param.yA);
+            p[1] = _mm512_set1_ps(param.uB);
+            p[2] = _mm512_set1_ps(param.uG);
+            p[3] = _mm512_set1_ps(param.vG);
+            p[4] = _mm512_set1_ps(param.vR);
+            p[5] = _mm512_set1_ps(param.bB);
+            p[6] = _mm512_set1_ps(param.bG);
+            p[7] = _mm512_set1_ps(param.bR);
+            const size_t uvStep = layout == Yuv16Layout420p ? 1 : 2;
+            size_t bodyWidth = AlignLo(width, F);
+            size_t tail = width - bodyWidth;
+            __mmask16 body = __mmask16(-1), tailMask = TailMask16(tail);
+            __mmask8 bodyUV = __mmask8(-1), tailMaskUV = TailMask8(tail / 2);
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t col = 0;
+                for (; col < bodyWidth; col += F)
+                    Yuv16ToBgr32f<layout>(y + col * 2, u + col * uvStep, v + col * uvStep, p, blue + col, green + col, red + col, body, bodyUV);
+                if (tail)
+                    Yuv16ToBgr32f<layout>(y + col * 2, u + col * uvStep, v + col * uvStep, p, blue + col, green + col, red + col, tailMask, tailMaskUV);
+                y += yStride;
+                if (layout == Yuv16Layout444p || (row & 1))
+                {
+                    u += uStride;
+                    v += vStride;
+                }
+                blue += dstStride;
+                green += dstStride;
+                red += dstStride;
+            }
+        }
+
+        void Yuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr32f<Yuv16Layout420p>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void P010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            Yuv16ToBgr32f<Yuv16LayoutP010>(y, yStride, uv, uvStride, uv, uvStride, width, height, 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void Yuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr32f<Yuv16Layout444p>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, blue, green, red, dstStride, yuvType);
+        }
+    }
+#endif
+}
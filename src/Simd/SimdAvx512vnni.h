@@ -31,6 +31,14 @@ namespace Simd
 #ifdef SIMD_AVX512VNNI_ENABLE    
     namespace Avx512vnni
     {
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance);
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances);
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances);
+
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType);
     }
 #endif// SIMD_AVX512VNNI_ENABLE
 }
@@ -0,0 +1,158 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdAvx512vnni.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512VNNI_ENABLE)
+    namespace Avx512vnni
+    {
+        template<int M, int N> SIMD_INLINE void Int8QuantizedDots(size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots, size_t ldd)
+        {
+            size_t K64 = AlignLo(K, 64);
+            __mmask64 tail = Avx512bw::TailMask64(K - K64);
+            const __m512i sign = _mm512_set1_epi8(-128);
+            const uint8_t* a[M], * b[N];
+            __m512i d[M][N], _a[M], _b;
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A[i] + Base::INT8_QUANTIZED_HEADER;
+            for (size_t j = 0; j < N; ++j)
+            {
+                b[j] = B[j] + Base::INT8_QUANTIZED_HEADER;
+                for (size_t i = 0; i < M; ++i)
+                    d[i][j] = _mm512_setzero_si512();
+            }
+            for (size_t k = 0; k < K64; k += 64)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _a[i] = _mm512_loadu_si512(a[i] + k);
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = _mm512_xor_si512(_mm512_loadu_si512(b[j] + k), sign);
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_dpbusd_epi32(d[i][j], _a[i], _b);
+                }
+            }
+            if (K64 < K)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    _a[i] = _mm512_maskz_loadu_epi8(tail, a[i] + K64);
+                for (size_t j = 0; j < N; ++j)
+                {
+                    _b = _mm512_xor_si512(_mm512_maskz_loadu_epi8(tail, b[j] + K64), sign);
+                    for (size_t i = 0; i < M; ++i)
+                        d[i][j] = _mm512_dpbusd_epi32(d[i][j], _a[i], _b);
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j < N; ++j)
+                    dots[i * ldd + j] = (int32_t)Avx512bw::ExtractSum<uint32_t>(d[i][j]);
+        }
+
+        SIMD_INLINE int32_t Int8QuantizedSum(size_t K, const uint8_t* a)
+        {
+            size_t K64 = AlignLo(K, 64);
+            __m512i sum = _mm512_setzero_si512();
+            for (size_t k = 0; k < K64; k += 64)
+                sum = _mm512_add_epi64(sum, _mm512_sad_epu8(_mm512_loadu_si512(a + k), _mm512_setzero_si512()));
+            if (K64 < K)
+                sum = _mm512_add_epi64(sum, _mm512_sad_epu8(_mm512_maskz_loadu_epi8(Avx512bw::TailMask64(K - K64), a + K64), _mm512_setzero_si512()));
+            return (int32_t)_mm512_reduce_add_epi64(sum);
+        }
+
+        static void Int8QuantizedDots(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots)
+        {
+            size_t M4 = AlignLo(M, 4), N4 = AlignLo(N, 4), i = 0;
+            for (; i < M4; i += 4)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<4, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<4, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+            for (; i < M; i += 1)
+            {
+                size_t j = 0;
+                for (; j < N4; j += 4)
+                    Int8QuantizedDots<1, 4>(K, A + i, B + j, dots + i * N + j, N);
+                for (; j < N; j += 1)
+                    Int8QuantizedDots<1, 1>(K, A + i, B + j, dots + i * N + j, N);
+            }
+            for (i = 0; i < M; ++i)
+            {
+                int32_t correction = 128 * Int8QuantizedSum(K, A[i] + Base::INT8_QUANTIZED_HEADER);
+                for (size_t j = 0; j < N; ++j)
+                    dots[i * N + j] += correction;
+            }
+        }
+
+        static void Int8QuantizedStats(size_t K, const uint8_t* a, int32_t* sum, int32_t* squares)
+        {
+            size_t K64 = AlignLo(K, 64);
+            __mmask64 tail = Avx512bw::TailMask64(K - K64);
+            const __m512i sign = _mm512_set1_epi8(-128);
+            __m512i q = _mm512_setzero_si512(), _a;
+            for (size_t k = 0; k < K64; k += 64)
+            {
+                _a = _mm512_loadu_si512(a + k);
+                q = _mm512_dpbusd_epi32(q, _a, _mm512_xor_si512(_a, sign));
+            }
+            if (K64 < K)
+            {
+                _a = _mm512_maskz_loadu_epi8(tail, a + K64);
+                q = _mm512_dpbusd_epi32(q, _a, _mm512_xor_si512(_a, sign));
+            }
+            *sum = Int8QuantizedSum(K, a);
+            *squares = (int32_t)Avx512bw::ExtractSum<uint32_t>(q) + 128 * *sum;
+        }
+
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance)
+        {
+            Base::Int8QuantizedDistances(1, 1, size, &a, &b, type, distance, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances)
+        {
+            Base::Int8QuantizedDistances(M, N, K, A, B, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances)
+        {
+            Array8ucp a(M), b(N);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * (K + Base::INT8_QUANTIZED_HEADER);
+            for (size_t j = 0; j < N; ++j)
+                b[j] = B + j * (K + Base::INT8_QUANTIZED_HEADER);
+            Base::Int8QuantizedDistances(M, N, K, a.data, b.data, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+    }
+#endif
+}
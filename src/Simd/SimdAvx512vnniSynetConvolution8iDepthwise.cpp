@@ -172,6 +172,7 @@ namespace Simd
 						Save<term, activation, nofma>(dst, d00, norm, bias, params, scale, shift, upper, i, tail);
 					}
 					dst += p.dstC * a.size;
+					bias += a.biasStep;
 				}
 			}
 		}
@@ -393,6 +394,7 @@ namespace Simd
 			__m128i upper = _mm_set1_epi32(a.upper);
 			__m512i d00, d01, d02, d03, d10, d11, d12, d13, w0;
 			size_t srcC = p.srcC;
+			size_t dstC = p.dstC * a.size;
 			size_t srcCF = AlignLo(srcC, F);
 			size_t srcCF2 = AlignLo(srcC, F * 2);
 			size_t srcCF4 = AlignLo(srcC, F * 4);
@@ -430,14 +432,14 @@ namespace Simd
 						Madd4<false>(d13, LoadAs32i(ps + 3 * F + 1 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 0 * srcC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 0 * srcC, d02, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 0 * srcC, d03, norm, bias, params, scale, shift, upper, c + F * 3);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 1 * srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 1 * srcC, d12, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 1 * srcC, d13, norm, bias, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 0 * dstC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 0 * dstC, d02, norm, bias, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 0 * dstC, d03, norm, bias, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 1 * dstC, d11, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 1 * dstC, d12, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 1 * dstC, d13, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 3);
 			}
 			for (; c < srcCF2; c += F * 2)
 			{
@@ -459,10 +461,10 @@ namespace Simd
 						Madd4<false>(d11, LoadAs32i(ps + 1 * F + 1 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 0 * srcC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 1 * srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 0 * dstC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 1 * dstC, d11, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 1);
 			}
 			for (; c < srcCF; c += F)
 			{
@@ -479,8 +481,8 @@ namespace Simd
 						Madd4<false>(d10, LoadAs32i(ps + 0 * F + 1 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c);
 			}
 			for (; c < srcC; c += F)
 			{
@@ -497,8 +499,8 @@ namespace Simd
 						Madd4<false>(d10, LoadAs32i(ps + 0 * F + 1 * srcX, tail), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c, tail);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c, tail);
 			}
 		}
 
@@ -510,6 +512,7 @@ namespace Simd
 			__m128i upper = _mm_set1_epi32(a.upper);
 			__m512i d00, d01, d02, d03, d10, d11, d12, d13, d20, d21, d22, d23, d30, d31, d32, d33, w0;
 			size_t srcC = p.srcC;
+			size_t dstC = p.dstC * a.size;
 			size_t srcCF = AlignLo(srcC, F);
 			size_t srcCF2 = AlignLo(srcC, F * 2);
 			size_t srcCF4 = AlignLo(srcC, F * 4);
@@ -563,22 +566,22 @@ namespace Simd
 						Madd4<false>(d33, LoadAs32i(ps + 3 * F + 3 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 0 * srcC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 0 * srcC, d02, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 0 * srcC, d03, norm, bias, params, scale, shift, upper, c + F * 3);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 1 * srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 1 * srcC, d12, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 1 * srcC, d13, norm, bias, params, scale, shift, upper, c + F * 3);
-				Save<term, activation, nofma>(dst + 2 * srcC, d20, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 2 * srcC, d21, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 2 * srcC, d22, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 2 * srcC, d23, norm, bias, params, scale, shift, upper, c + F * 3);
-				Save<term, activation, nofma>(dst + 3 * srcC, d30, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 3 * srcC, d31, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 3 * srcC, d32, norm, bias, params, scale, shift, upper, c + F * 2);
-				Save<term, activation, nofma>(dst + 3 * srcC, d33, norm, bias, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 0 * dstC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 0 * dstC, d02, norm, bias, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 0 * dstC, d03, norm, bias, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 1 * dstC, d11, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 1 * dstC, d12, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 1 * dstC, d13, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 2 * dstC, d20, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 2 * dstC, d21, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 2 * dstC, d22, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 2 * dstC, d23, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 3);
+				Save<term, activation, nofma>(dst + 3 * dstC, d30, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 3 * dstC, d31, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 3 * dstC, d32, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 2);
+				Save<term, activation, nofma>(dst + 3 * dstC, d33, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 3);
 			}
 			for (; c < srcCF2; c += F * 2)
 			{
@@ -608,14 +611,14 @@ namespace Simd
 						Madd4<false>(d31, LoadAs32i(ps + 1 * F + 3 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 0 * srcC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 1 * srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 2 * srcC, d20, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 2 * srcC, d21, norm, bias, params, scale, shift, upper, c + F * 1);
-				Save<term, activation, nofma>(dst + 3 * srcC, d30, norm, bias, params, scale, shift, upper, c + F * 0);
-				Save<term, activation, nofma>(dst + 3 * srcC, d31, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 0 * dstC, d01, norm, bias, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 1 * dstC, d11, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 2 * dstC, d20, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 2 * dstC, d21, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c + F * 1);
+				Save<term, activation, nofma>(dst + 3 * dstC, d30, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 0);
+				Save<term, activation, nofma>(dst + 3 * dstC, d31, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c + F * 1);
 			}
 			for (; c < srcCF; c += F)
 			{
@@ -636,10 +639,10 @@ namespace Simd
 						Madd4<false>(d30, LoadAs32i(ps + 0 * F + 3 * srcX), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c);
-				Save<term, activation, nofma>(dst + 2 * srcC, d20, norm, bias, params, scale, shift, upper, c);
-				Save<term, activation, nofma>(dst + 3 * srcC, d30, norm, bias, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 2 * dstC, d20, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c);
+				Save<term, activation, nofma>(dst + 3 * dstC, d30, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c);
 			}
 			for (; c < srcC; c += F)
 			{
@@ -660,10 +663,10 @@ namespace Simd
 						Madd4<false>(d30, LoadAs32i(ps + 0 * F + 3 * srcX, tail), w0);
 					}
 				}
-				Save<term, activation, nofma>(dst + 0 * srcC, d00, norm, bias, params, scale, shift, upper, c, tail);
-				Save<term, activation, nofma>(dst + 1 * srcC, d10, norm, bias, params, scale, shift, upper, c, tail);
-				Save<term, activation, nofma>(dst + 2 * srcC, d20, norm, bias, params, scale, shift, upper, c, tail);
-				Save<term, activation, nofma>(dst + 3 * srcC, d30, norm, bias, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 0 * dstC, d00, norm, bias, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 1 * dstC, d10, norm, bias + 1 * a.biasStep, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 2 * dstC, d20, norm, bias + 2 * a.biasStep, params, scale, shift, upper, c, tail);
+				Save<term, activation, nofma>(dst + 3 * dstC, d30, norm, bias + 3 * a.biasStep, params, scale, shift, upper, c, tail);
 			}
 		}
 
@@ -681,25 +684,25 @@ namespace Simd
 			size_t dy = 0;
 			for (; dy < p.padY; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 			for (; dy < dstH; ++dy)
 			{
 				size_t dx = 0;
 				for (; dx < p.padX; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 				size_t offset = ((dy * p.strideY - p.padY) * p.srcW + dx * p.strideX - p.padX) * p.srcC;
 				for (; dx < dstW4; dx += 4)
-					ConvolutionNhwcDepthwise3x3Main4<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 4, offset += srcX * 4;
+					ConvolutionNhwcDepthwise3x3Main4<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 4, bias += a.biasStep * 4, offset += srcX * 4;
 				for (; dx < dstW2; dx += 2)
-					ConvolutionNhwcDepthwise3x3Main2<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, offset += srcX * 2;
+					ConvolutionNhwcDepthwise3x3Main2<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, bias += a.biasStep * 2, offset += srcX * 2;
 				for (; dx < dstW; dx += 1)
-					ConvolutionNhwcDepthwise3x3Main1<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, offset += srcX;
+					ConvolutionNhwcDepthwise3x3Main1<term, activation, nofma>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep, offset += srcX;
 				for (; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 			}
 			for (; dy < p.dstH; ++dy)
 				for (size_t dx = 0; dx < p.dstW; ++dx)
-					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+					ConvolutionNhwcDepthwise3x3Edge<term, activation, nofma>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
 		}
 
 		//---------------------------------------------------------------------
@@ -742,6 +745,8 @@ namespace Simd
 			case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(p, d); break;
 			case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(p, d); break;
 			case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(p, d); break;
+			case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, d); break;
+			case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(p, d); break;
 			default: assert(0);
 			}
 		}
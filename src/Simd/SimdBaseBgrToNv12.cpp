@@ -0,0 +1,90 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <class T, size_t N> SIMD_INLINE void BgrToNv12(const uint8_t* bgr0, size_t bgrStride, uint8_t* y0, size_t yStride, uint8_t* uv)
+        {
+            const uint8_t* bgr1 = bgr0 + bgrStride;
+            uint8_t* y1 = y0 + yStride;
+
+            y0[0] = BgrToY<T>(bgr0[0], bgr0[1], bgr0[2]);
+            y0[1] = BgrToY<T>(bgr0[N + 0], bgr0[N + 1], bgr0[N + 2]);
+            y1[0] = BgrToY<T>(bgr1[0], bgr1[1], bgr1[2]);
+            y1[1] = BgrToY<T>(bgr1[N + 0], bgr1[N + 1], bgr1[N + 2]);
+
+            int blue = Average(bgr0[0], bgr0[N + 0], bgr1[0], bgr1[N + 0]);
+            int green = Average(bgr0[1], bgr0[N + 1], bgr1[1], bgr1[N + 1]);
+            int red = Average(bgr0[2], bgr0[N + 2], bgr1[2], bgr1[N + 2]);
+
+            uv[0] = BgrToU<T>(blue, green, red);
+            uv[1] = BgrToV<T>(blue, green, red);
+        }
+
+        template <class T, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colBgr = 0; colY < width; colY += 2, colBgr += 2 * N)
+                    BgrToNv12<T, N>(bgr + colBgr, bgrStride, y + colY, yStride, uv + colY);
+                y += 2 * yStride;
+                uv += uvStride;
+                bgr += 2 * bgrStride;
+            }
+        }
+
+        template <size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<Bt601, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<Bt709, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<Bt2020, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12<Trect871, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<3>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<4>(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+    }
+}
@@ -0,0 +1,298 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef std::pair<float, uint32_t> DistanceItem;
+        typedef std::vector<DistanceItem> DistanceItems;
+
+        SIMD_INLINE float Distance(SimdDistanceType type, float ab, float aa, float bb)
+        {
+            switch (type)
+            {
+            case SimdDistanceCosine: return aa * bb > 0.0f ? 1.0f - ab / ::sqrt(aa * bb) : 1.0f;
+            case SimdDistanceSquaredL2: return Simd::Max(aa + bb - 2.0f * ab, 0.0f);
+            case SimdDistanceInnerProduct: return -ab;
+            default: return 0.0f;
+            }
+        }
+
+        SIMD_INLINE void PushTopK(DistanceItem* heap, size_t& size, size_t top, const DistanceItem& item)
+        {
+            if (size < top)
+            {
+                heap[size++] = item;
+                std::push_heap(heap, heap + size);
+            }
+            else if (item < heap[0])
+            {
+                std::pop_heap(heap, heap + top);
+                heap[top - 1] = item;
+                std::push_heap(heap, heap + top);
+            }
+        }
+
+        void DistancesTopK(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, const float* scales,
+            SimdDistanceType type, size_t top, uint32_t* indices, float* distances, DistanceDotsPtr dots, DistanceSquaresPtr squares)
+        {
+            if (M == 0 || top == 0)
+                return;
+            Array32f aa(M);
+            for (size_t i = 0; i < M; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                    sum += Simd::Square(A[i * K + k]);
+                aa[i] = sum;
+            }
+            const size_t L2 = Base::AlgCacheL2();
+            size_t mN = Simd::Max<size_t>(AlignLo(L2 / 2 / Simd::Max<size_t>(ldb, 1), 4), 4);
+            size_t mM = Simd::Min(Simd::Max<size_t>(AlignLo(L2 / 4 / Simd::Max<size_t>(K * 4, 1), 12), 12), M);
+            size_t threads = Simd::Max<size_t>(Simd::Min(Base::GetThreadNumber(), DivHi(N, mN)), 1);
+            DistanceItems heaps(threads * M * top);
+            std::vector<size_t> sizes(threads * M, 0);
+            Simd::Parallel(0, N, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array32f buf(mM * mN), bb(mN, true);
+                DistanceItem* heap = heaps.data() + thread * M * top;
+                size_t* size = sizes.data() + thread * M;
+                for (size_t j = begin; j < end; j += mN)
+                {
+                    size_t dN = Simd::Min(end, j + mN) - j;
+                    const uint8_t* b = B + j * ldb;
+                    if (type != SimdDistanceInnerProduct)
+                        squares(dN, K, b, ldb, bb.data);
+                    if (scales)
+                    {
+                        for (size_t n = 0; n < dN; ++n)
+                            bb[n] *= Simd::Square(scales[j + n]);
+                    }
+                    for (size_t i = 0; i < M; i += mM)
+                    {
+                        size_t dM = Simd::Min(M, i + mM) - i;
+                        dots(dM, dN, K, A + i * K, b, ldb, buf.data);
+                        for (size_t m = 0; m < dM; ++m)
+                        {
+                            const float* ab = buf.data + m * dN;
+                            for (size_t n = 0; n < dN; ++n)
+                            {
+                                float d = Distance(type, scales ? ab[n] * scales[j + n] : ab[n], aa[i + m], bb[n]);
+                                PushTopK(heap + (i + m) * top, size[i + m], top, DistanceItem(d, uint32_t(j + n)));
+                            }
+                        }
+                    }
+                }
+            }, threads, mN);
+            DistanceItems items;
+            for (size_t i = 0; i < M; ++i)
+            {
+                items.clear();
+                for (size_t t = 0; t < threads; ++t)
+                    items.insert(items.end(), heaps.begin() + (t * M + i) * top, heaps.begin() + (t * M + i) * top + sizes[t * M + i]);
+                size_t count = Simd::Min(items.size(), top);
+                std::partial_sort(items.begin(), items.begin() + count, items.end());
+                for (size_t t = 0; t < top; ++t)
+                {
+                    indices[i * top + t] = t < count ? items[t].second : 0xFFFFFFFF;
+                    distances[i * top + t] = t < count ? items[t].first : FLT_MAX;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class T> void DistanceDots(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                {
+                    const T* b = (const T*)(B + j * ldb);
+                    float sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += A[k] * DistanceValue(b[k]);
+                    dots[j] = sum;
+                }
+                A += K;
+                dots += N;
+            }
+        }
+
+        template<class T> void DistanceSquares(size_t N, size_t K, const uint8_t* B, size_t ldb, float* squares)
+        {
+            for (size_t j = 0; j < N; ++j)
+            {
+                const T* b = (const T*)(B + j * ldb);
+                float sum = 0;
+                for (size_t k = 0; k < K; ++k)
+                    sum += Simd::Square(DistanceValue(b[k]));
+                squares[j] = sum;
+            }
+        }
+
+        void DistancesTopK32f(size_t M, size_t N, size_t K, const float* A, const float* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(float), NULL, type, top, indices, distances, DistanceDots<float>, DistanceSquares<float>);
+        }
+
+        void DistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            Array32f a(M * K);
+            Float16ToFloat32(A, M * K, a.data);
+            DistancesTopK(M, N, K, a.data, (const uint8_t*)B, K * sizeof(uint16_t), NULL, type, top, indices, distances, DistanceDots<uint16_t>, DistanceSquares<uint16_t>);
+        }
+
+        void DistancesTopK8i(size_t M, size_t N, size_t K, const float* A, const int8_t* B, const float* scales, SimdDistanceType type, size_t top, uint32_t* indices, float* distances)
+        {
+            DistancesTopK(M, N, K, A, (const uint8_t*)B, K * sizeof(int8_t), scales, type, top, indices, distances, DistanceDots<int8_t>, DistanceSquares<int8_t>);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Int8QuantizedDistances(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances,
+            Int8QuantizedDotsPtr dots, Int8QuantizedStatsPtr stats)
+        {
+            const size_t L2 = Base::AlgCacheL2();
+            size_t mN = Simd::Min(Simd::Max<size_t>(AlignLo(L2 / 2 / (K + INT8_QUANTIZED_HEADER), 4), 4), N);
+            size_t mM = Simd::Min(Simd::Max<size_t>(AlignLo(L2 / 4 / (K + INT8_QUANTIZED_HEADER), 12), 12), M);
+            Array32i as(M * 2), bs(N * 2), buf(mM * mN);
+            for (size_t i = 0; i < M; ++i)
+                stats(K, A[i] + INT8_QUANTIZED_HEADER, as.data + i * 2 + 0, as.data + i * 2 + 1);
+            for (size_t j = 0; j < N; ++j)
+                stats(K, B[j] + INT8_QUANTIZED_HEADER, bs.data + j * 2 + 0, bs.data + j * 2 + 1);
+            for (size_t i = 0; i < M; i += mM)
+            {
+                size_t dM = Simd::Min(M, i + mM) - i;
+                for (size_t j = 0; j < N; j += mN)
+                {
+                    size_t dN = Simd::Min(N, j + mN) - j;
+                    dots(dM, dN, K, A + i, B + j, buf.data);
+                    for (size_t m = 0; m < dM; ++m)
+                    {
+                        const int32_t* ab = buf.data + m * dN;
+                        float* dst = distances + (i + m) * N + j;
+                        for (size_t n = 0; n < dN; ++n)
+                            dst[n] = Int8QuantizedDistance(type, K, A[i + m], as.data + (i + m) * 2, B[j + n], bs.data + (j + n) * 2, ab[n]);
+                    }
+                }
+            }
+        }
+
+        void Float32ToInt8Quantized(const float* src, size_t size, SimdBool symmetric, uint8_t* dst)
+        {
+            float min = FLT_MAX, max = -FLT_MAX;
+            for (size_t i = 0; i < size; ++i)
+            {
+                min = Simd::Min(min, src[i]);
+                max = Simd::Max(max, src[i]);
+            }
+            float scale, shift;
+            if (symmetric)
+            {
+                float abs = Simd::Max(::fabs(min), ::fabs(max));
+                scale = abs / 127.0f;
+                shift = -128.0f * scale;
+            }
+            else
+            {
+                scale = (max - min) / 255.0f;
+                shift = min;
+            }
+            float inverse = scale > 0.0f ? 1.0f / scale : 0.0f;
+            ((float*)dst)[0] = scale;
+            ((float*)dst)[1] = shift;
+            dst += INT8_QUANTIZED_HEADER;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)RestrictRange(Round((src[i] - shift) * inverse), 0, 255);
+            if (symmetric && scale == 0.0f)
+                memset(dst, 128, size);
+        }
+
+        void Int8QuantizedToFloat32(const uint8_t* src, size_t size, float* dst)
+        {
+            float scale = ((float*)src)[0], shift = ((float*)src)[1];
+            src += INT8_QUANTIZED_HEADER;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src[i]) * scale + shift;
+        }
+
+        static void Int8QuantizedDots(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                const uint8_t* a = A[i] + INT8_QUANTIZED_HEADER;
+                for (size_t j = 0; j < N; ++j)
+                {
+                    const uint8_t* b = B[j] + INT8_QUANTIZED_HEADER;
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += int32_t(a[k]) * int32_t(b[k]);
+                    dots[i * N + j] = sum;
+                }
+            }
+        }
+
+        static void Int8QuantizedStats(size_t K, const uint8_t* a, int32_t* sum, int32_t* squares)
+        {
+            int32_t s = 0, q = 0;
+            for (size_t k = 0; k < K; ++k)
+            {
+                s += a[k];
+                q += int32_t(a[k]) * int32_t(a[k]);
+            }
+            *sum = s;
+            *squares = q;
+        }
+
+        void DistanceInt8Quantized(const uint8_t* a, const uint8_t* b, size_t size, SimdDistanceType type, float* distance)
+        {
+            Int8QuantizedDistances(1, 1, size, &a, &b, type, distance, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances)
+        {
+            Int8QuantizedDistances(M, N, K, A, B, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+
+        void DistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances)
+        {
+            Array8ucp a(M), b(N);
+            for (size_t i = 0; i < M; ++i)
+                a[i] = A + i * (K + INT8_QUANTIZED_HEADER);
+            for (size_t j = 0; j < N; ++j)
+                b[j] = B + j * (K + INT8_QUANTIZED_HEADER);
+            Int8QuantizedDistances(M, N, K, a.data, b.data, type, distances, Int8QuantizedDots, Int8QuantizedStats);
+        }
+    }
+}
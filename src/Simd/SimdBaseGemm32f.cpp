@@ -33,8 +33,13 @@ namespace Simd
             for (size_t i = 0; i < M; ++i)
             {
                 float * pC = C + i * ldc;
-                for (size_t j = 0; j < N; ++j)
-                    pC[j] = b * pC[j];
+                if (b == 0.0f)
+                    memset(pC, 0, N * sizeof(float));
+                else
+                {
+                    for (size_t j = 0; j < N; ++j)
+                        pC[j] = b * pC[j];
+                }
                 for (size_t k = 0; k < K; ++k)
                 {
                     const float * pB = B + k * ldb;
@@ -51,8 +56,13 @@ namespace Simd
             for (size_t i = 0; i < M; ++i)
             {
                 float * pC = C + i * ldc;
-                for (size_t j = 0; j < N; ++j)
-                    pC[j] = b * pC[j];
+                if (b == 0.0f)
+                    memset(pC, 0, N * sizeof(float));
+                else
+                {
+                    for (size_t j = 0; j < N; ++j)
+                        pC[j] = b * pC[j];
+                }
                 for (size_t j = 0; j < N; ++j)
                 {
                     const float * pA = A + i * K;
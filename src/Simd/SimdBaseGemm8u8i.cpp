@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdGemm.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Gemm8u8iPackA(size_t M, size_t K, const uint8_t* A, size_t lda, SimdBool transA, size_t KA, uint8_t* pA)
+        {
+            for (size_t i = 0; i < M; ++i, pA += KA)
+            {
+                if (transA)
+                {
+                    for (size_t k = 0; k < K; ++k)
+                        pA[k] = A[k * lda + i];
+                }
+                else
+                    memcpy(pA, A + i * lda, K);
+                for (size_t k = K; k < KA; ++k)
+                    pA[k] = 0;
+            }
+        }
+
+        void Gemm8u8iPackB(size_t K, size_t N, const int8_t* B, size_t ldb, SimdBool transB, size_t F, size_t KA, int8_t* pB, int32_t* bSum)
+        {
+            size_t strideK = transB ? 1 : ldb, strideN = transB ? ldb : 1;
+            for (size_t j = 0; j < N; j += F)
+            {
+                for (size_t k = 0; k < KA; k += 4)
+                {
+                    for (size_t f = 0; f < F; ++f)
+                    {
+                        for (size_t c = 0; c < 4; ++c)
+                            *pB++ = (j + f < N && k + c < K) ? B[(j + f) * strideN + (k + c) * strideK] : 0;
+                    }
+                }
+                for (size_t f = 0; f < F; ++f)
+                {
+                    int32_t sum = 0;
+                    if (j + f < N)
+                    {
+                        for (size_t k = 0; k < K; ++k)
+                            sum += B[(j + f) * strideN + k * strideK];
+                    }
+                    bSum[j + f] = sum;
+                }
+            }
+        }
+
+        void Gemm8u8iSetRowParams(size_t M, const uint8_t* aZero, const float* aScale, int32_t* zero, float* scale)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                zero[i] = aZero ? aZero[i] : 0;
+                scale[i] = aScale ? aScale[i] : 1.0f;
+            }
+        }
+
+        void Gemm8u8iSetColParams(size_t N, size_t NF, const float* bScale, const float* bias, float* scale, float* shift)
+        {
+            for (size_t j = 0; j < NF; ++j)
+            {
+                scale[j] = j < N && bScale ? bScale[j] : 1.0f;
+                shift[j] = j < N && bias ? bias[j] : 0.0f;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Gemm8u8i(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+            const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType)
+        {
+            size_t strideAM = transA ? 1 : lda, strideAK = transA ? lda : 1;
+            size_t strideBK = transB ? 1 : ldb, strideBN = transB ? ldb : 1;
+            for (size_t i = 0; i < M; ++i)
+            {
+                int32_t zero = aZero ? aZero[i] : 0;
+                for (size_t j = 0; j < N; ++j)
+                {
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += (int32_t(A[i * strideAM + k * strideAK]) - zero) * int32_t(B[k * strideBK + j * strideBN]);
+                    if (cType == SimdTensorData32f)
+                        ((float*)C)[i * ldc + j] = float(sum) * (aScale ? aScale[i] : 1.0f) * (bScale ? bScale[j] : 1.0f) + (bias ? bias[j] : 0.0f);
+                    else
+                        ((int32_t*)C)[i * ldc + j] = sum;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes)
+        {
+            for (size_t i = 0; i < count; ++i)
+                DecodeBox(deltas + i * 4, anchors + i * 4, encoding, params, boxes + i * 4);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t count, float threshold, uint32_t* indices)
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                indices[size] = (uint32_t)i;
+                size += scores[i] > threshold ? 1 : 0;
+            }
+            return size;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static bool NmsOverlap(const float* soa, size_t stride, size_t size, const float* box, float threshold)
+        {
+            for (size_t i = 0; i < size; ++i)
+                if (NmsBoxOverlap(soa, stride, i, box, threshold))
+                    return true;
+            return false;
+        }
+
+        static size_t NmsDecay(const float* soa, size_t stride, size_t size, const float* box, SimdNmsType type, float threshold, float gamma, float* scores)
+        {
+            size_t best = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                scores[i] *= NmsBoxDecay(soa, stride, i, box, type, threshold, gamma);
+                if (scores[i] > scores[best])
+                    best = i;
+            }
+            return best;
+        }
+
+        SIMD_INLINE void NmsSetBox(const float* src, float* soa, size_t stride, size_t i)
+        {
+            soa[0 * stride + i] = src[0];
+            soa[1 * stride + i] = src[1];
+            soa[2 * stride + i] = src[2];
+            soa[3 * stride + i] = src[3];
+            soa[4 * stride + i] = NmsArea(src);
+        }
+
+        SIMD_INLINE void NmsGetBox(const float* soa, size_t stride, size_t i, float* dst)
+        {
+            for (size_t r = 0; r < 5; ++r)
+                dst[r] = soa[r * stride + i];
+        }
+
+        SIMD_INLINE void NmsSwapBox(float* soa, size_t stride, size_t i, size_t j)
+        {
+            for (size_t r = 0; r < 5; ++r)
+                std::swap(soa[r * stride + i], soa[r * stride + j]);
+        }
+
+        size_t DetectionNms(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores, NmsFilterPtr filter, NmsOverlapPtr overlap, NmsDecayPtr decay)
+        {
+            Array32u candidates(count);
+            size_t size = filter(scores, count, scoreThreshold, candidates.data);
+            if (size == 0)
+                return 0;
+            size_t stride = AlignHi(size, 16), kept = 0;
+            Array32f soa(stride * 5);
+            float box[5];
+            if (type == SimdNmsGreedy)
+            {
+                std::sort(candidates.data, candidates.data + size, [scores](uint32_t a, uint32_t b)
+                    { return scores[a] > scores[b] || (scores[a] == scores[b] && a < b); });
+                for (size_t i = 0; i < size; ++i)
+                {
+                    uint32_t index = candidates[i];
+                    const float* src = boxes + index * 4;
+                    box[0] = src[0], box[1] = src[1], box[2] = src[2], box[3] = src[3], box[4] = NmsArea(src);
+                    if (kept && overlap(soa.data, stride, kept, box, iouThreshold))
+                        continue;
+                    NmsSetBox(src, soa.data, stride, kept);
+                    indices[kept] = index;
+                    if (dstScores)
+                        dstScores[kept] = scores[index];
+                    kept++;
+                }
+            }
+            else
+            {
+                Array32f buffer(size);
+                float gamma = -1.0f / sigma;
+                size_t best = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    NmsSetBox(boxes + candidates[i] * 4, soa.data, stride, i);
+                    buffer[i] = scores[candidates[i]];
+                    if (buffer[i] > buffer[best])
+                        best = i;
+                }
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (best != i)
+                    {
+                        NmsSwapBox(soa.data, stride, i, best);
+                        std::swap(buffer[i], buffer[best]);
+                        std::swap(candidates[i], candidates[best]);
+                    }
+                    if (buffer[i] <= scoreThreshold)
+                        break;
+                    indices[kept] = candidates[i];
+                    if (dstScores)
+                        dstScores[kept] = buffer[i];
+                    kept++;
+                    if (i + 1 == size)
+                        break;
+                    NmsGetBox(soa.data, stride, i, box);
+                    best = i + 1 + decay(soa.data + i + 1, stride, size - i - 1, box, type, iouThreshold, gamma, buffer.data + i + 1);
+                }
+            }
+            return kept;
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores)
+        {
+            return DetectionNms(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, dstScores, DetectionFilterScores32f, NmsOverlap, NmsDecay);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <class T, SimdPixelFormatType format> SIMD_INLINE void YuvToAny(int y, int u, int v, int alpha, uint8_t* dst)
+        {
+            if (format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32)
+            {
+                dst[0] = YuvToBlue<T>(y, u);
+                dst[1] = YuvToGreen<T>(y, u, v);
+                dst[2] = YuvToRed<T>(y, v);
+            }
+            else
+            {
+                dst[0] = YuvToRed<T>(y, v);
+                dst[1] = YuvToGreen<T>(y, u, v);
+                dst[2] = YuvToBlue<T>(y, u);
+            }
+            if (format == SimdPixelFormatBgra32 || format == SimdPixelFormatRgba32)
+                dst[3] = alpha;
+        }
+
+        template <class T, SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t N = (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) ? 3 : 4;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colDst = 0; colY < width; colY += 2, colDst += 2 * N)
+                {
+                    int u = uv[colY + 0];
+                    int v = uv[colY + 1];
+                    YuvToAny<T, format>(y[colY + 0], u, v, alpha, dst + colDst + 0);
+                    YuvToAny<T, format>(y[colY + 1], u, v, alpha, dst + colDst + N);
+                    YuvToAny<T, format>(y[yStride + colY + 0], u, v, alpha, dst + dstStride + colDst + 0);
+                    YuvToAny<T, format>(y[yStride + colY + 1], u, v, alpha, dst + dstStride + colDst + N);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <SimdPixelFormatType format> void Nv12ToAny(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToAny<Bt601, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToAny<Bt709, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToAny<Bt2020, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToAny<Trect871, format>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgr24>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatBgra32>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgb24>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToAny<SimdPixelFormatRgba32>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+    }
+}
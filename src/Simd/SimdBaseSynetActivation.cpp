@@ -48,6 +48,40 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            size_t size4 = Simd::AlignLo(size, 4);
+            size_t i = 0;
+            for (; i < size4; i += 4)
+            {
+                dst[i + 0] = SynetGelu32f(src[i + 0]);
+                dst[i + 1] = SynetGelu32f(src[i + 1]);
+                dst[i + 2] = SynetGelu32f(src[i + 2]);
+                dst[i + 3] = SynetGelu32f(src[i + 3]);
+            }
+            for (; i < size; ++i)
+                dst[i] = SynetGelu32f(src[i]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetGeluTanh32f(const float* src, size_t size, float* dst)
+        {
+            size_t size4 = Simd::AlignLo(size, 4);
+            size_t i = 0;
+            for (; i < size4; i += 4)
+            {
+                dst[i + 0] = SynetGeluTanh32f(src[i + 0]);
+                dst[i + 1] = SynetGeluTanh32f(src[i + 1]);
+                dst[i + 2] = SynetGeluTanh32f(src[i + 2]);
+                dst[i + 3] = SynetGeluTanh32f(src[i + 3]);
+            }
+            for (; i < size; ++i)
+                dst[i] = SynetGeluTanh32f(src[i]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst)
         {
             float _scale = scale[0];
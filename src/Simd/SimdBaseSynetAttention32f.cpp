@@ -0,0 +1,226 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurer * SynetAttention32f::Perf(const String& func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    namespace Base
+    {
+        static float Score32f(const float* q, const float* k, size_t count, size_t depth, float scale, const float* mask, float* dst)
+        {
+            float max = -FLT_MAX;
+            for (size_t j = 0; j < count; ++j, k += depth)
+            {
+                float sum = 0.0f;
+                for (size_t d = 0; d < depth; ++d)
+                    sum += q[d] * k[d];
+                dst[j] = sum * scale + (mask ? mask[j] : 0.0f);
+                max = Simd::Max(max, dst[j]);
+            }
+            return max;
+        }
+
+        static float Score16b(const uint16_t* q, const uint16_t* k, size_t count, size_t depth, float scale, const float* mask, float* dst)
+        {
+            float max = -FLT_MAX;
+            for (size_t j = 0; j < count; ++j, k += depth)
+            {
+                float sum = 0.0f;
+                for (size_t d = 0; d < depth; ++d)
+                    sum += BFloat16ToFloat32(q[d]) * BFloat16ToFloat32(k[d]);
+                dst[j] = sum * scale + (mask ? mask[j] : 0.0f);
+                max = Simd::Max(max, dst[j]);
+            }
+            return max;
+        }
+
+        static float Softmax(float* src, size_t count, float max)
+        {
+            float sum = 0.0f;
+            for (size_t j = 0; j < count; ++j)
+            {
+                src[j] = ::exp(src[j] - max);
+                sum += src[j];
+            }
+            return sum;
+        }
+
+        static void Accum32f(const float* p, const float* v, size_t count, size_t depth, float alpha, float* dst)
+        {
+            for (size_t d = 0; d < depth; ++d)
+                dst[d] *= alpha;
+            for (size_t j = 0; j < count; ++j, v += depth)
+                for (size_t d = 0; d < depth; ++d)
+                    dst[d] += p[j] * v[d];
+        }
+
+        static void Accum16b(const uint16_t* p, const uint16_t* v, size_t count, size_t depth, float alpha, float* dst)
+        {
+            for (size_t d = 0; d < depth; ++d)
+                dst[d] *= alpha;
+            for (size_t j = 0; j < count; ++j, v += depth)
+                for (size_t d = 0; d < depth; ++d)
+                    dst[d] += BFloat16ToFloat32(p[j]) * BFloat16ToFloat32(v[d]);
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetAttention32f::SynetAttention32f(const AttentionParam32f& p)
+            : Simd::SynetAttention32f(p)
+            , _threads(Base::GetThreadNumber())
+        {
+            _bf16 = Bf16Soft(p.compatibility);
+            _score32f = Score32f;
+            _score16b = Score16b;
+            _softmax = Softmax;
+            _accum32f = Accum32f;
+            _accum16b = Accum16b;
+            _convert = Base::Float32ToBFloat16;
+            _convertV = NULL;
+            SetBlocks(1);
+        }
+
+        String SynetAttention32f::Desc() const
+        {
+            return Ext() + (_bf16 ? "::Bf16" : "::Fp32");
+        }
+
+        void SynetAttention32f::SetBlocks(size_t F)
+        {
+            const AttentionParam32f& p = _param;
+            size_t size = _bf16 ? sizeof(uint16_t) : sizeof(float);
+            _blockQ = Simd::Min(p.seqQ, Simd::Max<size_t>(1, Base::AlgCacheL1() / 2 / (p.depth * 2 * sizeof(float))));
+            _blockK = Simd::Min(AlignHi(p.seqK, F), Simd::Max(F, AlignLo(Base::AlgCacheL2() / 2 / (p.depth * 2 * size), F)));
+            _sizeT = _blockQ * (p.depth + 2) + _blockK;
+            if (_bf16)
+                _sizeT += DivHi((_blockQ + _blockK) * p.depth + AlignHi(_blockK, 2) * (p.depth + 1), 2);
+        }
+
+        size_t SynetAttention32f::ExternalBufferSize() const
+        {
+            return _sizeT * _threads;
+        }
+
+        void SynetAttention32f::Forward(const float* q, const float* k, const float* v, const float* mask, float* buf, float* dst)
+        {
+            const AttentionParam32f& p = _param;
+            buf = Buffer(buf);
+            size_t count = p.batch * p.heads, sizeQ = p.seqQ * p.depth, sizeK = p.seqK * p.depth;
+            size_t blocks = DivHi(p.seqQ, _blockQ);
+            Simd::Parallel(0, count * blocks, [&](size_t thread, size_t begin, size_t end)
+            {
+                float* bufT = buf + thread * _sizeT;
+                for (size_t task = begin; task < end; ++task)
+                {
+                    size_t head = task / blocks, q0 = (task % blocks) * _blockQ;
+                    size_t rows = Simd::Min(_blockQ, p.seqQ - q0), offsQ = head * sizeQ + q0 * p.depth, offsK = head * sizeK;
+                    ForwardRows(q + offsQ, k + offsK, v + offsK, mask ? mask + q0 * p.seqK : NULL, rows, bufT, dst + offsQ);
+                }
+            }, _threads);
+        }
+
+        void SynetAttention32f::ForwardRows(const float* q, const float* k, const float* v, const float* mask, size_t rows, float* buf, float* dst) const
+        {
+            const AttentionParam32f& p = _param;
+            float* max = buf, * sum = max + _blockQ, * out = sum + _blockQ, * score = out + _blockQ * p.depth;
+            uint16_t* q16 = (uint16_t*)(score + _blockK), * k16 = q16 + _blockQ * p.depth;
+            uint16_t* v16 = k16 + _blockK * p.depth, * p16 = v16 + AlignHi(_blockK, 2) * p.depth;
+            if (_bf16)
+                _convert(q, rows * p.depth, q16);
+            for (size_t i = 0; i < rows; ++i)
+            {
+                max[i] = -FLT_MAX;
+                sum[i] = 0.0f;
+            }
+            memset(out, 0, rows * p.depth * sizeof(float));
+            for (size_t k0 = 0; k0 < p.seqK; k0 += _blockK)
+            {
+                size_t cols = Simd::Min(_blockK, p.seqK - k0), offs = k0 * p.depth;
+                if (_bf16)
+                {
+                    _convert(k + offs, cols * p.depth, k16);
+                    if (_convertV)
+                        _convertV(v + offs, cols, p.depth, v16);
+                    else
+                        _convert(v + offs, cols * p.depth, v16);
+                }
+                for (size_t i = 0; i < rows; ++i)
+                {
+                    const float* qi = q + i * p.depth, * mi = mask ? mask + i * p.seqK + k0 : NULL;
+                    float* oi = out + i * p.depth;
+                    float top = _bf16 ? _score16b(q16 + i * p.depth, k16, cols, p.depth, p.scale, mi, score) :
+                        _score32f(qi, k + offs, cols, p.depth, p.scale, mi, score);
+                    top = Simd::Max(max[i], top);
+                    float alpha = ::exp(max[i] - top);
+                    max[i] = top;
+                    sum[i] = sum[i] * alpha + _softmax(score, cols, top);
+                    if (_bf16)
+                    {
+                        _convert(score, cols, p16);
+                        _accum16b(p16, v16, cols, p.depth, alpha, oi);
+                    }
+                    else
+                        _accum32f(score, v + offs, cols, p.depth, alpha, oi);
+                }
+            }
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const float* oi = out + i * p.depth;
+                float* di = dst + i * p.depth;
+                float norm = sum[i] > 0.0f ? 1.0f / sum[i] : 0.0f;
+                for (size_t d = 0; d < p.depth; ++d)
+                    di[d] = oi[d] * norm;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility)
+        {
+            AttentionParam32f param(batch, heads, seqQ, seqK, depth, scale, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention32f(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,279 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration32f.h"
+#include "Simd/SimdMath.h"
+
+#include <float.h>
+#include <math.h>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetCalibration32f::SynetCalibration32f(const Calibration32fParam& param)
+            : _param(param)
+        {
+            size_t C = _param.channels;
+            _min.Resize(C);
+            _max.Resize(C);
+            _range.Resize(C, true);
+            _scale.Resize(C, true);
+            _buffer.Resize(C * 2);
+            _histogram.Resize(C * _param.bins * 2, true);
+            for (size_t c = 0; c < C; ++c)
+            {
+                _min[c] = FLT_MAX;
+                _max[c] = -FLT_MAX;
+            }
+        }
+
+        void SynetCalibration32f::Update(const float* src, size_t batch, size_t spatial)
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            float * min = _buffer.data, * max = min + C;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                Range(src, spatial, min, max);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    _min[c] = Simd::Min(_min[c], min[c]);
+                    _max[c] = Simd::Max(_max[c], max[c]);
+                    float range = Simd::Max(-min[c], max[c]);
+                    if (range > _range[c])
+                    {
+                        Expand(c, range);
+                        _scale[c] = float(bins) / _range[c];
+                    }
+                }
+                Histogram(src, spatial, _scale.data, _histogram.data);
+                src += C * spatial;
+            }
+        }
+
+        void SynetCalibration32f::Expand(size_t channel, float range)
+        {
+            if (_range[channel] == 0.0f)
+            {
+                _range[channel] = range;
+                return;
+            }
+            size_t bins = _param.bins, half = bins / 2;
+            uint32_t* neg = _histogram.data + channel * bins * 2, * pos = neg + bins;
+            while (_range[channel] < range)
+            {
+                for (size_t i = 0; i < half; ++i)
+                {
+                    neg[i] = neg[2 * i + 0] + neg[2 * i + 1];
+                    pos[i] = pos[2 * i + 0] + pos[2 * i + 1];
+                }
+                for (size_t i = half; i < bins; ++i)
+                {
+                    neg[i] = 0;
+                    pos[i] = 0;
+                }
+                _range[channel] *= 2.0f;
+            }
+        }
+
+        void SynetCalibration32f::Range(const float* src, size_t spatial, float* min, float* max)
+        {
+            size_t C = _param.channels;
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < C; ++c)
+                {
+                    float lo = FLT_MAX, hi = -FLT_MAX;
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        lo = Simd::Min(lo, src[s]);
+                        hi = Simd::Max(hi, src[s]);
+                    }
+                    min[c] = lo;
+                    max[c] = hi;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < C; ++c)
+                {
+                    min[c] = FLT_MAX;
+                    max[c] = -FLT_MAX;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        min[c] = Simd::Min(min[c], src[c]);
+                        max[c] = Simd::Max(max[c], src[c]);
+                    }
+                    src += C;
+                }
+            }
+        }
+
+        void SynetCalibration32f::Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram)
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < C; ++c)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                        histogram[HistogramIndex(src[s], scale[c], (int)bins)]++;
+                    histogram += bins * 2;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t c = 0; c < C; ++c)
+                        histogram[c * bins * 2 + HistogramIndex(src[c], scale[c], (int)bins)]++;
+                    src += C;
+                }
+            }
+        }
+
+        float SynetCalibration32f::Percentile(const uint32_t* histogram, size_t channel, float percent) const
+        {
+            size_t bins = _param.bins;
+            uint64_t total = 0;
+            for (size_t i = 0; i < bins; ++i)
+                total += histogram[i];
+            uint64_t limit = uint64_t(::ceil(double(total) * Simd::Min(percent, 100.0f) / 100.0)), sum = 0;
+            size_t i = 0;
+            for (; i < bins; ++i)
+            {
+                sum += histogram[i];
+                if (sum >= limit)
+                    break;
+            }
+            return float(Simd::Min(i + 1, bins)) * _range[channel] / float(bins);
+        }
+
+        float SynetCalibration32f::Entropy(size_t channel, size_t levels) const
+        {
+            size_t bins = _param.bins;
+            const uint32_t* neg = _histogram.data + channel * bins * 2, * pos = neg + bins;
+            std::vector<double> hist(bins), p(bins), q(bins);
+            for (size_t i = 0; i < bins; ++i)
+                hist[i] = double(neg[i]) + double(pos[i]);
+            size_t last = bins;
+            while (last > 0 && hist[last - 1] == 0.0)
+                last--;
+            if (last <= levels)
+                return float(last) * _range[channel] / float(bins);
+            double outliers = 0.0, minDivergence = DBL_MAX;
+            for (size_t i = last; i < bins; ++i)
+                outliers += hist[i];
+            size_t step = Simd::Max<size_t>(1, bins / 256), best = last;
+            for (size_t i = levels; i <= last; i += step)
+            {
+                double right = 0.0, sumP = 0.0, sumQ = 0.0;
+                for (size_t k = i; k < last; ++k)
+                    right += hist[k];
+                for (size_t k = 0; k < i; ++k)
+                    p[k] = hist[k];
+                p[i - 1] += right + outliers;
+                for (size_t j = 0; j < levels; ++j)
+                {
+                    size_t beg = j * i / levels, end = (j + 1) * i / levels;
+                    double sum = 0.0, count = 0.0;
+                    for (size_t k = beg; k < end; ++k)
+                    {
+                        sum += hist[k];
+                        count += hist[k] != 0.0 ? 1.0 : 0.0;
+                    }
+                    double value = count > 0.0 ? sum / count : 0.0;
+                    for (size_t k = beg; k < end; ++k)
+                        q[k] = hist[k] != 0.0 ? value : 0.0;
+                }
+                for (size_t k = 0; k < i; ++k)
+                {
+                    sumP += p[k];
+                    sumQ += q[k];
+                }
+                double divergence = 0.0;
+                for (size_t k = 0; k < i; ++k)
+                {
+                    if (p[k] == 0.0)
+                        continue;
+                    double _p = p[k] / sumP, _q = q[k] > 0.0 ? q[k] / sumQ : 1.0e-9;
+                    divergence += _p * ::log(_p / _q);
+                }
+                if (divergence < minDivergence)
+                {
+                    minDivergence = divergence;
+                    best = i;
+                }
+            }
+            return float(best) * _range[channel] / float(bins);
+        }
+
+        void SynetCalibration32f::GetStats(SimdSynetCalibrationType type, float param, float* min, float* max) const
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            for (size_t c = 0; c < C; ++c)
+            {
+                float lo = _min[c], hi = _max[c];
+                if (lo > hi)
+                {
+                    min[c] = 0.0f;
+                    max[c] = 0.0f;
+                    continue;
+                }
+                if (type == SimdSynetCalibrationPercentile)
+                {
+                    const uint32_t* neg = _histogram.data + c * bins * 2, * pos = neg + bins;
+                    if (lo < 0.0f)
+                        lo = Simd::Max(lo, -Percentile(neg, c, param));
+                    if (hi > 0.0f)
+                        hi = Simd::Min(hi, Percentile(pos, c, param));
+                }
+                else if (type == SimdSynetCalibrationEntropy)
+                {
+                    float threshold = Entropy(c, param > 1.0f ? Simd::Min<size_t>(size_t(param), bins / 2) : 128);
+                    lo = Simd::Max(lo, -threshold);
+                    hi = Simd::Min(hi, threshold);
+                }
+                min[c] = lo;
+                max[c] = hi;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format)
+        {
+            Calibration32fParam param(channels, bins ? bins : 2048, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetCalibration32f(param);
+        }
+    }
+#endif
+}
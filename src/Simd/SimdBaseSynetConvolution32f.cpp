@@ -40,6 +40,128 @@ namespace Simd
     }
 #endif
 
+    void SynetConvolution32f::ForwardAdd(const float* src, float* buf, const float* add, float* dst)
+    {
+        _add = add;
+        Forward(src, buf, dst);
+        _add = NULL;
+    }
+
+    size_t SynetConvolution32f::Export(void* data, size_t size)
+    {
+        SynetPack measure(SynetPack::Measure);
+        measure.Header(Desc(), PackKey());
+        Pack(measure);
+        if (data && size >= measure.Size())
+        {
+            SynetPack save(SynetPack::Save, data, measure.Size());
+            save.Header(Desc(), PackKey());
+            Pack(save);
+        }
+        return measure.Size();
+    }
+
+    bool SynetConvolution32f::Import(const void* data, size_t size, bool attach)
+    {
+        _shapes.Clear();
+        SynetPack pack(attach && Aligned(data, SIMD_ALIGN) ? SynetPack::Attach : SynetPack::Load, data, size);
+        if (data == NULL || !pack.Header(Desc(), PackKey()))
+            return false;
+        Pack(pack);
+        _packed.reset();
+        return pack.Ok();
+    }
+
+    SynetPacked* SynetConvolution32f::CreatePacked()
+    {
+        size_t size = Export(NULL, 0);
+        SynetPacked* packed = new SynetPacked(size);
+        Export(packed->Data()->data, size);
+        return packed;
+    }
+
+    bool SynetConvolution32f::SetPacked(const SynetPacked& packed)
+    {
+        if (!Import(packed.Data()->data, packed.Data()->size, true))
+            return false;
+        _packed = packed.Data();
+        return true;
+    }
+
+    String SynetConvolution32f::PackKey() const
+    {
+        return ConvolutionPackKey(_param, _param.compatibility);
+    }
+
+    void SynetConvolution32f::Pack(SynetPack& pack)
+    {
+        pack.Item(_weight, _param.SizeW(), _pWeight);
+        PackBiasAndParams(pack);
+    }
+
+    void SynetConvolution32f::PackBiasAndParams(SynetPack& pack)
+    {
+        pack.Item(_bias, _param.dstC, _pBias);
+        pack.Item(_params, PackParamsSize(_param.activation, _param.dstC), _pParams);
+    }
+
+    bool SynetConvolution32f::Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init)
+    {
+        const ConvParam32f& p = _param;
+        if (batch == p.batch && srcH == p.srcH && srcW == p.srcW)
+        {
+            _shapes.Select(NULL);
+            return true;
+        }
+        String key = ShapeKey(batch, srcH, srcW);
+        SynetConvolution32f* shaped = _shapes.Get(key);
+        if (shaped == NULL)
+        {
+            if (batch == 0 || srcH + p.padY + p.padH < p.dilationY * (p.kernelY - 1) + 1 || srcW + p.padX + p.padW < p.dilationX * (p.kernelX - 1) + 1)
+                return false;
+            SimdConvolutionParameters conv = p;
+            conv.srcH = srcH;
+            conv.srcW = srcW;
+            conv.dstH = (srcH + p.padY + p.padH - (p.dilationY * (p.kernelY - 1) + 1)) / p.strideY + 1;
+            conv.dstW = (srcW + p.padX + p.padW - (p.dilationX * (p.kernelX - 1) + 1)) / p.strideX + 1;
+            if (_shapes.Shared().get() == NULL && (_shapes.Kept().weight == NULL || _shapes.Kept().internal))
+            {
+                if (_packed.get() == NULL)
+                {
+                    SynetShapes<SynetConvolution32f>::Params kept = _shapes.Kept();
+                    SynetPacked* packed = CreatePacked();
+                    bool attached = SetPacked(*packed);
+                    delete packed;
+                    _shapes.Keep(kept);
+                    if (!attached)
+                        return false;
+                }
+                _shapes.Share(_packed);
+            }
+            shaped = (SynetConvolution32f*)init(batch, &conv, p.compatibility);
+            if (shaped == NULL)
+                return false;
+            if (_shapes.Shared().get() == NULL || !shaped->SetPacked(SynetPacked(_shapes.Shared())))
+            {
+                if (_shapes.Kept().weight == NULL)
+                {
+                    delete shaped;
+                    return false;
+                }
+                _shapes.SetParams(shaped);
+            }
+            _shapes.Add(key, shaped);
+        }
+        _shapes.Select(shaped);
+        return true;
+    }
+
+    void SynetConvolution32f::KeepParams(const float* weight, SimdBool internal, const float* bias, const float* params)
+    {
+        _packed.reset();
+        _shapes.Keep(SynetShapes<SynetConvolution32f>::Params(weight, internal == SimdTrue, bias, params));
+    }
+
     namespace Base
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst)
@@ -296,10 +418,110 @@ namespace Simd
                 else
                     SynetSwish32f(dst, size * count, &slope, dst);
             }
+            else if (activation == ::SimdConvolutionActivationGelu)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            for (size_t i = 0; i < count; ++i)
+                                dst[i] = SynetGelu32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            for (size_t j = 0; j < size; ++j)
+                                dst[j] = SynetGelu32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGelu32f(dst, size * count, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationGeluTanh)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            for (size_t i = 0; i < count; ++i)
+                                dst[i] = SynetGeluTanh32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            for (size_t j = 0; j < size; ++j)
+                                dst[j] = SynetGeluTanh32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGeluTanh32f(dst, size * count, dst);
+            }
             else
                 assert(0);
         }
 
+        //-----------------------------------------------------------------------------------------
+
+        template<::SimdConvolutionActivationType type> void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, const float* params, SimdBool trans, const float* add, float* dst)
+        {
+            if (trans)
+            {
+                for (size_t j = 0; j < size; ++j)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        dst[i] = Activate<type>(dst[i] + add[i] + (bias ? bias[i] : 0.0f), params, i);
+                    add += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float shift = bias ? bias[i] : 0.0f;
+                    for (size_t j = 0; j < size; ++j)
+                        dst[j] = Activate<type>(dst[j] + add[j] + shift, params, i);
+                    add += size;
+                    dst += size;
+                }
+            }
+        }
+
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, const float* add, float* dst)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: ConvolutionBiasAddActivation<::SimdConvolutionActivationIdentity>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationLeakyRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationLeakyRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRestrictRange: ConvolutionBiasAddActivation<::SimdConvolutionActivationRestrictRange>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationPrelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationPrelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationElu: ConvolutionBiasAddActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHswish: ConvolutionBiasAddActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationMish: ConvolutionBiasAddActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHardSigmoid: ConvolutionBiasAddActivation<::SimdConvolutionActivationHardSigmoid>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationSwish: ConvolutionBiasAddActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGeluTanh: ConvolutionBiasAddActivation<::SimdConvolutionActivationGeluTanh>(bias, count, size, params, trans, add, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : SynetConvolution32f(p)
         {
@@ -346,6 +568,7 @@ namespace Simd
             }
             _gemm.Init(InitGemmFuncs(Base::Gemm32fNN, "Base"));
             _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _biasAddActivation = Base::ConvolutionBiasAddActivation;
         }
 
         size_t SynetConvolution32fGemmNN::ExternalBufferSize() const
@@ -370,6 +593,24 @@ namespace Simd
             }
         }
 
+        void SynetConvolution32fGemmNN::Pack(SynetPack& pack)
+        {
+            if (_nhwcWeight.data)
+                pack.Item(_nhwcWeight);
+            else
+                pack.Item(_weight, _param.SizeW(), _pWeight);
+            PackBiasAndParams(pack);
+        }
+
+        String SynetConvolution32fGemmNN::PackKey() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetConvolution32f::PackKey();
+            if (_nhwcWeight.data)
+                ss << "-" << _M * _merge << "x" << _N << "x" << _K;
+            return ss.str();
+        }
+
         void SynetConvolution32fGemmNN::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -396,7 +637,12 @@ namespace Simd
                     else
                         _gemm.Run(GemmArgs(_M*_merge, _N, _K, &_1, tmp, _ldS, _weight, _ldW, &_0, dst, _ldD));
                     for (size_t m = 0; m < _merge; ++m)
-                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                    {
+                        if (_add)
+                            _biasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, _add + (b + m) * _sizeD, dst + m * _sizeD);
+                        else
+                            _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                    }
                     src += _sizeS * _merge;
                     dst += _sizeD * _merge;
                 }
@@ -431,7 +677,10 @@ namespace Simd
                         else
                             _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight + _grW * g, _ldW, tmp + _grS * g, _ldS, &_0, dst + _grD * g, _ldD));
                     }
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
+                    if (_add)
+                        _biasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, _add + b * _sizeD, dst);
+                    else
+                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
                     src += _sizeS;
                     dst += _sizeD;
                 }
@@ -591,6 +840,7 @@ namespace Simd
             _sizeD = p.dstC*p.dstH*p.dstW;
             _gemm.Init(InitGemmFuncs(Base::Gemm32fNT, "Base"));
             _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _biasAddActivation = Base::ConvolutionBiasAddActivation;
         }
 
         size_t SynetConvolution32fGemmNT::ExternalBufferSize() const
@@ -608,13 +858,19 @@ namespace Simd
                 if (p.trans)
                 {
                     _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight, _K, src, _K, &_0, dst, _N));
-                    _biasAndActivation(_bias, 1, p.dstH * p.dstW, p.activation, _params, SimdFalse, dst);
+                    if (_add)
+                        _biasAddActivation(_bias, 1, p.dstH * p.dstW, p.activation, _params, SimdFalse, _add + b * _sizeD, dst);
+                    else
+                        _biasAndActivation(_bias, 1, p.dstH * p.dstW, p.activation, _params, SimdFalse, dst);
                 }
                 else
                 {
                     ImgToRow(src, _param, buf);
                     _gemm.Run(GemmArgs(_M, _N, _K, &_1, _weight, _K, buf, _K, &_0, dst, _N));
-                    _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, SimdFalse, dst);
+                    if (_add)
+                        _biasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, SimdFalse, _add + b * _sizeD, dst);
+                    else
+                        _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, SimdFalse, dst);
                 }
                 src += _sizeS;
                 dst += _sizeD;
@@ -785,6 +1041,7 @@ namespace Simd
                 assert(0);
             _gemm.Init(InitGemmFuncs(Base::Gemm32fNN, "Base"));
             _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _biasAddActivation = Base::ConvolutionBiasAddActivation;
         }
 
         String SynetConvolution32fWinograd::Desc() const 
@@ -801,7 +1058,7 @@ namespace Simd
 
         size_t SynetConvolution32fWinograd::InternalBufferSize() const
         {
-            return Simd::SynetConvolution32f::InternalBufferSize() + _winogradWeight.size;
+            return Simd::SynetConvolution32f::InternalBufferSize() + OwnedSize(_winogradWeight);
         }
 
         void SynetConvolution32fWinograd::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -823,6 +1080,22 @@ namespace Simd
             if (internal)
                 *internal = SimdTrue;
         }
+
+        void SynetConvolution32fWinograd::Pack(SynetPack& pack)
+        {
+            pack.Item(_winogradWeight);
+            pack.Item(_nhwcWeight);
+            PackBiasAndParams(pack);
+        }
+
+        String SynetConvolution32fWinograd::PackKey() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetConvolution32f::PackKey() << "-" << _count << "-" << _strideW;
+            if (_nhwcWeight.data)
+                ss << "-" << _M * _merge << "x" << _N << "x" << _K << "-" << _nhwcStrideW;
+            return ss.str();
+        }
         
         void SynetConvolution32fWinograd::Forward(const float * src, float * buf, float * dst)
         {
@@ -844,7 +1117,10 @@ namespace Simd
                     for (size_t i = 0; i < _count; ++i)
                         _gemm.Run(GemmArgs(_M, _N, _K, &_1, _winogradWeight.data + i * _strideW, _K, bufS + i * _strideS, _N, &_0, bufD + i * _strideD, _N));
                     _setOutput(bufD, _strideD, dst, p.dstC, p.dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
+                    if (_add)
+                        _biasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, _add + b * _sizeD, dst);
+                    else
+                        _biasAndActivation(_bias, p.dstC, p.dstH*p.dstW, p.activation, _params, p.trans, dst);
                     src += _sizeS;
                     dst += _sizeD;
                 }
@@ -962,7 +1238,10 @@ namespace Simd
                 for (size_t m = 0; m < _merge; ++m)
                 {
                     _setOutput(bufD + m * _strideD, _strideD * _merge, dst + m * _sizeD, p.dstC, p.dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
+                    if (_add)
+                        _biasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, _add + (b + m) * _sizeD, dst + m * _sizeD);
+                    else
+                        _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst + m * _sizeD);
                 }
                 src += _sizeS * _merge;
                 dst += _sizeD * _merge;
@@ -997,7 +1276,10 @@ namespace Simd
                             _gemm.Run(GemmArgs(M, _N, _K, &_1, bufS + i * _strideS, _K, _winogradWeight.data + i * _strideW, _N, &_0, bufD + i * _strideD, _N));
                     }
                     _setOutput(bufD, _strideD, dst + dstY * p.dstC * p.dstW, p.dstC, dstH, p.dstW, p.trans);
-                    _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
+                    if (_add)
+                        _biasAddActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, _add + b * _sizeD + dstY * p.dstC * p.dstW, dst + dstY * p.dstC * p.dstW);
+                    else
+                        _biasAndActivation(_bias, p.dstC, dstH * p.dstW, p.activation, _params, p.trans, dst + dstY * p.dstC * p.dstW);
                 }
                 src += _sizeS;
                 dst += _sizeD;
@@ -1017,7 +1299,10 @@ namespace Simd
             _grS = _srcC * p.srcH * p.srcW;
             _grD = _dstC * p.dstH  * p.dstW;
             _pad = p.IsPad(0) ? 0 : 1;
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _biasAddActivation = Base::ConvolutionBiasAddActivation;
         }
 
         size_t SynetConvolution32fDirectNchw::ExternalBufferSize() const
@@ -1033,6 +1318,7 @@ namespace Simd
             const ConvParam32f & p = _param;
             if(_pad)
                 buf = Buffer(buf);
+            ConvolutionBiasActivationPtr convolution = _add ? _convolutionBiasIdentity : _convolutionBiasActivation;
             for (size_t b = 0; b < p.batch; ++b)
             {
                 const float * weight = _weight;
@@ -1043,10 +1329,10 @@ namespace Simd
                     if (_pad)
                     {
                         Pad(src, buf);
-                        _convolutionBiasActivation(buf, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
+                        convolution(buf, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
                     }
                     else
-                        _convolutionBiasActivation(src, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
+                        convolution(src, _srcC, _srcH, _srcW, weight, bias, params, dst, _dstC, p.dstH, p.dstW);
                     weight += _grW;
                     if (bias)
                         bias += _dstC;
@@ -1055,6 +1341,11 @@ namespace Simd
                     src += _grS;
                     dst += _grD;
                 }
+                if (_add)
+                {
+                    size_t size = _grD * p.group;
+                    _biasAddActivation(NULL, p.dstC, p.dstH * p.dstW, p.activation, _params, SimdFalse, _add + b * size, dst - size);
+                }
             }
         }
 
@@ -1214,34 +1505,36 @@ namespace Simd
             case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
             case ::SimdConvolutionActivationHardSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHardSigmoid>;
             case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationGeluTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGeluTanh>;
             default:
                 assert(0);
                 return NULL;
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             switch (p.strideX)
             {
             case 1:
                 if (p.kernelX == 1)
-                    return Base::SetConvolutionBiasActivation<1, 1>(p.activation);
+                    return Base::SetConvolutionBiasActivation<1, 1>(activation);
                 if (p.kernelX == 2)
-                    return Base::SetConvolutionBiasActivation<2, 1>(p.activation);
+                    return Base::SetConvolutionBiasActivation<2, 1>(activation);
                 if (p.kernelX == 3)
-                    return Base::SetConvolutionBiasActivation<3, 1>(p.activation);
+                    return Base::SetConvolutionBiasActivation<3, 1>(activation);
                 break;
             case 2: 
                 if (p.kernelX == 2)
-                    return Base::SetConvolutionBiasActivation<2, 2>(p.activation);
+                    return Base::SetConvolutionBiasActivation<2, 2>(activation);
                 if (p.kernelX == 3)
-                    return Base::SetConvolutionBiasActivation<3, 2>(p.activation);
+                    return Base::SetConvolutionBiasActivation<3, 2>(activation);
                 break;
             case 3: 
                 if (p.kernelX == 3)
-                    return Base::SetConvolutionBiasActivation<3, 3>(p.activation);
+                    return Base::SetConvolutionBiasActivation<3, 3>(activation);
                 break;
             }
             return NULL;
@@ -1255,11 +1548,28 @@ namespace Simd
             _batch = p.batch;
             _sizeS = p.srcC*p.srcH*p.srcW;
             _sizeD = p.dstC*p.dstH*p.dstW;
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _biasAddActivation = Base::ConvolutionBiasAddActivation;
         }
 
         void SynetConvolution32fDirectNhwc::Forward(const float * src, float * buf, float * dst)
         {
+            const ConvParam32f& p = _param;
+            if (_add)
+            {
+                ConvParam32f identity = p;
+                identity.activation = ::SimdConvolutionActivationIdentity;
+                for (size_t b = 0; b < _batch; ++b)
+                {
+                    _convolutionBiasIdentity(src, identity, _weight, _bias, _params, dst);
+                    _biasAddActivation(NULL, p.dstC, p.dstH * p.dstW, p.activation, _params, SimdTrue, _add + b * _sizeD, dst);
+                    src += _sizeS;
+                    dst += _sizeD;
+                }
+                return;
+            }
             for (size_t b = 0; b < _batch; ++b)
             {
                 _convolutionBiasActivation(src, _param, _weight, _bias, _params, dst);
@@ -1328,7 +1638,7 @@ namespace Simd
             }
         }
 
-        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             return ConvolutionDirectNhwcConvolutionBiasActivationDefault;
         }
@@ -1375,7 +1685,9 @@ namespace Simd
                     for (size_t i = 0; i < _count; ++i)
                         dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
+                if (_add)
+                    ConvolutionBiasAddActivation(NULL, _count, 1, _param.activation, _params, ::SimdTrue, _add + b * _sizeD, dst);
+                else if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);                
                 src += _sizeS;
                 dst += _sizeD;
@@ -1415,8 +1727,8 @@ namespace Simd
 
         size_t SynetConvolution32fNhwcDirect::InternalBufferSize() const
         {
-            size_t size = _buffer.size + _rWeight.size + _rBias.size + _rParams.size;
-            size += _old.weight.size;
+            size_t size = _buffer.size + OwnedSize(_rWeight) + OwnedSize(_rBias) + OwnedSize(_rParams);
+            size += OwnedSize(_old.weight);
             return size;
         }
 
@@ -1486,6 +1798,9 @@ namespace Simd
                 case SimdConvolutionActivationSwish:
                     _rParams.data[0] = params[0];
                     break;
+                case SimdConvolutionActivationGelu:
+                case SimdConvolutionActivationGeluTanh:
+                    break;
                 default:
                     assert(0);
                 }
@@ -1493,21 +1808,51 @@ namespace Simd
             }
         }
 
+        void SynetConvolution32fNhwcDirect::Pack(SynetPack& pack)
+        {
+            if (_old.enable && _old.weight.data)
+                pack.Item(_weight, _old.weight.size, _old.weight);
+            else if (_rWeight.data)
+                pack.Item(_weight, _rWeight.size, _rWeight);
+            else
+                pack.Item(_weight, _param.SizeW(), _pWeight);
+            if (_rBias.data)
+                pack.Item(_bias, _rBias.size, _rBias);
+            else
+                pack.Item(_bias, _param.dstC, _pBias);
+            if (_rParams.data)
+                pack.Item(_params, _rParams.size, _rParams);
+            else
+                pack.Item(_params, PackParamsSize(_param.activation, _param.dstC), _pParams);
+        }
+
+        String SynetConvolution32fNhwcDirect::PackKey() const
+        {
+            std::stringstream ss;
+            ss << SynetConvolution32f::PackKey();
+            if (_old.enable && _old.weight.data)
+                ss << "-" << _old.alg.microD << "-" << _old.alg.macroC << "-" << _old.alg.macroD;
+            else if (_rWeight.data)
+                ss << "-" << _run.At(0).alg.F;
+            return ss.str();
+        }
+
         void SynetConvolution32fNhwcDirect::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
             for (size_t b = 0; b < p.batch; ++b)
             {
+                const float* add = _add ? _add + b * _sizeD : NULL;
                 if(_old.enable)
-                    _old.convolution(src, _param, _old.alg, _weight, _bias, _params, dst);
+                    _old.convolution(src, _param, _old.alg, _weight, _bias, _params, add, dst);
                 else
-                _run.Run(RunArgs(src, _param, _weight, _bias, _params, dst));
+                _run.Run(RunArgs(src, _param, _weight, _bias, _params, add, dst));
                 src += _sizeS;
                 dst += _sizeD;
             }
         }
 
-        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
+        void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, const float* add, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
             {
@@ -1518,10 +1863,12 @@ namespace Simd
                     for (size_t yBeg = 0; yBeg < p.dstH;)
                     {
                         size_t yEnd = Simd::Min(yBeg + a.macroH, p.dstH);
+                        if (add && sc == 0)
+                            CopyResidual(add + yBeg * p.dstW * p.dstC + dc, (yEnd - yBeg) * p.dstW, macroD, p.dstC, dst + yBeg * p.dstW * p.dstC + dc);
                         if (sc + macroC == p.srcC)
-                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC ? 1 : 0);
+                            a.convolutions[TermLast](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, macroC == p.srcC && !add ? 1 : 0);
                         else
-                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 ? 1 : 0);
+                            a.convolutions[TermInterim](src + sc, p, a, macroD, yBeg, yEnd, macroC, weight, bias + dc, params, dst + dc, sc == 0 && !add ? 1 : 0);
                         yBeg = yEnd;
                     }
                     weight += a.F * macroC;
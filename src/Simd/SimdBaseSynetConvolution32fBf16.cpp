@@ -81,6 +81,12 @@ namespace Simd
                 *internal = SimdTrue;
         }
 
+        void SynetConvolution32fBf16Gemm::Pack(SynetPack& pack)
+        {
+            pack.Item(_weight);
+            PackBiasAndParams(pack);
+        }
+
         void SynetConvolution32fBf16Gemm::Forward(const float * src, float * buf_, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -100,7 +106,10 @@ namespace Simd
                     for (size_t g = 0; g < p.group; ++g)
                         GemmNN(_M, _N, _K, wgt + _grW * g, _ldW, buf + _grS * g, _ldS, dst + _grD * g, _ldD);
                 }
-                ConvolutionBiasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst);
+                if (_add)
+                    ConvolutionBiasAddActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, _add + b * _sizeD, dst);
+                else
+                    ConvolutionBiasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst);
                 src += _sizeS;
                 dst += _sizeD;
             }
@@ -300,7 +309,7 @@ namespace Simd
 
         size_t SynetConvolution32fBf16Nhwc::InternalBufferSize() const
         {
-            return _buffer.size + _weight.size / 2 + _bias.size + _params.size;
+            return _buffer.size + OwnedSize(_weight) / 2 + OwnedSize(_bias) + OwnedSize(_params);
         }
 
         void SynetConvolution32fBf16Nhwc::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
@@ -312,6 +321,20 @@ namespace Simd
             SetParams(params);
         }
 
+        void SynetConvolution32fBf16Nhwc::Pack(SynetPack& pack)
+        {
+            pack.Item(_weight);
+            pack.Item(_bias);
+            pack.Item(_params);
+        }
+
+        String SynetConvolution32fBf16Nhwc::PackKey() const
+        {
+            std::stringstream ss;
+            ss << SynetConvolution32f::PackKey() << "-" << _alg.microD << "-" << _alg.macroC << "-" << _alg.macroD;
+            return ss.str();
+        }
+
         void SynetConvolution32fBf16Nhwc::SetWeight(const float * weight)
         {
             const ConvParam32f& p = _param;
@@ -410,6 +433,9 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 _params.data[0] = params[0];
                 break;
+            case SimdConvolutionActivationGelu:
+            case SimdConvolutionActivationGeluTanh:
+                break;
             default:
                 assert(0);
             }
@@ -420,14 +446,17 @@ namespace Simd
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
             buf = Buffer(buf);
+            const float* add = _add;
             for (size_t b = 0; b < p.batch; b += a.batch)
             {
                 if(a.mode)
-                    ForwardGemm(src, (uint16_t*)buf, dst);
+                    ForwardGemm(src, (uint16_t*)buf, add, dst);
                 else
-                    ForwardConv(src, (uint16_t*)buf, dst);
+                    ForwardConv(src, (uint16_t*)buf, add, dst);
                 src += p.srcH * p.srcW * p.srcC * a.batch;
                 dst += p.dstH * p.dstW * p.dstC * a.batch;
+                if (add)
+                    add += p.dstH * p.dstW * p.dstC * a.batch;
             }
         }
 
@@ -436,7 +465,7 @@ namespace Simd
             return p.trans != 0 && p.group == 1;
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardConv(const float* src, uint16_t* buf, const float* add, float* dst)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
@@ -454,11 +483,13 @@ namespace Simd
                         size_t offs = Offset(yBeg, sc, sc + macroC);
                         if (dc == 0)
                             _convert(src + sc, p, yBeg, yEnd, macroC, buf + offs);
+                        if (add && sc == 0)
+                            CopyResidual(add + yBeg * p.dstW * p.dstC, (yEnd - yBeg) * p.dstW, macroD, p.dstC, dst + yBeg * p.dstW * p.dstC);
                         if (sc + macroC == p.srcC)
-                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroC, macroC == p.srcC ? 1 : 0, 
+                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroC, macroC == p.srcC && !add ? 1 : 0, 
                                 weight, bias, params, dst + yBeg * p.dstW * p.dstC);
                         else
-                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroC, sc == 0 ? 1 : 0,
+                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroC, sc == 0 && !add ? 1 : 0,
                                 weight, bias, params, dst + yBeg * p.dstW * p.dstC);
                         yBeg = yEnd;
                     }
@@ -467,11 +498,13 @@ namespace Simd
                 bias += macroD;
                 if (p.activation == ::SimdConvolutionActivationPrelu)
                     params += macroD;
+                if (add)
+                    add += macroD;
                 dst += macroD;
             }
         }
 
-        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, uint16_t* buf, float* dst)
+        void SynetConvolution32fBf16Nhwc::ForwardGemm(const float* src, uint16_t* buf, const float* add, float* dst)
         {
             const ConvParam32f& p = _param;
             const AlgParam& a = _alg;
@@ -501,11 +534,13 @@ namespace Simd
                             else
                                 _convert(src + sc, p, yBeg, yEnd, macroC, buf + offs);
                         }
+                        if (add && sc == 0)
+                            CopyResidual(add + yBeg * p.dstW * p.dstC, (yEnd - yBeg) * p.dstW, macroD, p.dstC, dst + yBeg * p.dstW * p.dstC);
                         if (sc + macroC == p.srcC)
-                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroK, macroC == p.srcC ? 1 : 0,
+                            _convolutions[TermLast](buf + offs, p, macroD, yEnd - yBeg, macroK, macroC == p.srcC && !add ? 1 : 0,
                                 weight, bias, params, dst + yBeg * p.dstW * p.dstC);
                         else
-                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroK, sc == 0 ? 1 : 0,
+                            _convolutions[TermInterim](buf + offs, p, macroD, yEnd - yBeg, macroK, sc == 0 && !add ? 1 : 0,
                                 weight, bias, params, dst + yBeg * p.dstW * p.dstC);
                         yBeg = yEnd;
                     }
@@ -514,6 +549,8 @@ namespace Simd
                 bias += macroD;
                 if (p.activation == ::SimdConvolutionActivationPrelu)
                     params += macroD;
+                if (add)
+                    add += macroD;
                 dst += macroD;
             }
         }
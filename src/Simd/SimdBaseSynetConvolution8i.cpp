@@ -63,6 +63,20 @@ namespace Simd
         }
     }
 
+    void CvtParam::Pack(SynetPack& pack)
+    {
+        pack.Item(zero);
+        pack.Item(scale);
+        pack.Item(shift);
+        pack.Item(iScale);
+        pack.Item(iShift);
+        pack.Value(neg);
+        pack.Value(iMin);
+        pack.Value(iMax);
+        pack.Value(uMin);
+        pack.Value(uMax);
+    }
+
     //-------------------------------------------------------------------------
 
     SynetConvolution8i::SynetConvolution8i(const ConvParam8i& p)
@@ -74,6 +88,8 @@ namespace Simd
         _sizeS = p.srcC * p.srcH * p.srcW;
         _sizeD = p.dstC * p.dstH * p.dstW;
         _merge = 1;
+        _addScale = NULL;
+        _addShift = NULL;
         _src8u = p.srcT == SimdTensorData8u;
         _dst8u = p.dstT == SimdTensorData8u;
         _weight.Resize(p.kernelY * p.kernelX * p.srcC / p.group * p.dstC);
@@ -92,8 +108,62 @@ namespace Simd
 
     size_t SynetConvolution8i::InternalBufferSize() const
     {
-        return (_buffer.size + _weight.size) * sizeof(uint8_t) + _srcCvt.Size() + 
-            _dstCvt.Size() + (_norm.size + _bias.size + _params.size) * sizeof(float);
+        return (_buffer.size + OwnedSize(_weight)) * sizeof(uint8_t) + _srcCvt.Size() + 
+            _dstCvt.Size() + (OwnedSize(_norm) + OwnedSize(_bias) + OwnedSize(_params)) * sizeof(float);
+    }
+
+    size_t SynetConvolution8i::Export(void* data, size_t size)
+    {
+        SynetPack measure(SynetPack::Measure);
+        measure.Header(Desc(), PackKey());
+        Pack(measure);
+        if (data && size >= measure.Size())
+        {
+            SynetPack save(SynetPack::Save, data, measure.Size());
+            save.Header(Desc(), PackKey());
+            Pack(save);
+        }
+        return measure.Size();
+    }
+
+    bool SynetConvolution8i::Import(const void* data, size_t size, bool attach)
+    {
+        SynetPack pack(attach && Aligned(data, SIMD_ALIGN) ? SynetPack::Attach : SynetPack::Load, data, size);
+        if (data == NULL || !pack.Header(Desc(), PackKey()))
+            return false;
+        Pack(pack);
+        return pack.Ok();
+    }
+
+    SynetPacked* SynetConvolution8i::CreatePacked()
+    {
+        size_t size = Export(NULL, 0);
+        SynetPacked* packed = new SynetPacked(size);
+        Export(packed->Data()->data, size);
+        return packed;
+    }
+
+    bool SynetConvolution8i::SetPacked(const SynetPacked& packed)
+    {
+        if (!Import(packed.Data()->data, packed.Data()->size, true))
+            return false;
+        _packed = packed.Data();
+        return true;
+    }
+
+    String SynetConvolution8i::PackKey() const
+    {
+        return ConvolutionPackKey(_param, _param.compatibility);
+    }
+
+    void SynetConvolution8i::Pack(SynetPack& pack)
+    {
+        _srcCvt.Pack(pack);
+        _dstCvt.Pack(pack);
+        pack.Item(_weight);
+        pack.Item(_norm);
+        pack.Item(_bias);
+        pack.Item(_params);
     }
 
     void SynetConvolution8i::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
@@ -232,12 +302,20 @@ namespace Simd
         case SimdConvolutionActivationSwish:
             _params[0] = params[0];
             break;
+        case SimdConvolutionActivationGelu:
+        case SimdConvolutionActivationGeluTanh:
+            break;
         default:
             assert(0);
         }
     }
 
     void SynetConvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+    {
+        ForwardAdd(src, buf, NULL, NULL, NULL, dst);
+    }
+
+    void SynetConvolution8i::ForwardAdd(const uint8_t* src, uint8_t* buf, const uint8_t* add, const float* addScale, const float* addShift, uint8_t* dst)
     {
         if (buf == NULL)
         {
@@ -245,12 +323,108 @@ namespace Simd
             buf = _buffer.data;
         }
         const ConvParam8i& p = _param;
+        size_t size = _dst8u ? sizeof(uint8_t) : sizeof(float);
+        _addScale = addScale ? addScale : _dstCvt.iScale.data;
+        _addShift = addShift ? addShift : _dstCvt.iShift.data;
         uint8_t* src8u = _src8u ? NULL : Allocate<uint8_t>(buf, _sizeS * _merge);
         for (size_t b = 0; b < p.batch; b += _merge)
         {
             if (!_src8u)
                 _convertSrc((float*)src + b * _sizeS, _merge, p.srcC, p.srcH, p.srcW, p.srcF, _srcCvt.scale.data, _srcCvt.shift.data, src8u, p.compatibility);
-            Forward8u(_src8u ? src + b * _sizeS : src8u, buf, dst + b * _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float)));
+            Forward8u(_src8u ? src + b * _sizeS : src8u, buf, add ? add + b * _sizeD * size : NULL, dst + b * _sizeD * size);
+        }
+    }
+
+    void SynetConvolution8i::AddResidual(const uint8_t* add, float* dst)
+    {
+        const ConvParam8i& p = _param;
+        size_t size = p.dstH * p.dstW;
+        for (size_t m = 0, i = 0; m < _merge; ++m)
+        {
+            if (p.trans)
+            {
+                for (size_t s = 0; s < size; ++s)
+                    for (size_t c = 0; c < p.dstC; ++c, ++i)
+                        dst[i] += Residual(add, i, c);
+            }
+            else
+            {
+                for (size_t c = 0; c < p.dstC; ++c)
+                    for (size_t s = 0; s < size; ++s, ++i)
+                        dst[i] += Residual(add, i, c);
+            }
+        }
+    }
+
+    void SynetConvolution8i::Activate(float* dst, size_t batch)
+    {
+        const ConvParam8i& p = _param;
+        switch (p.activation)
+        {
+        case SimdConvolutionActivationIdentity:
+            break;
+        case SimdConvolutionActivationRelu:
+        {
+            float slope = 0;
+            Base::SynetRelu32f(dst, batch * _sizeD, &slope, dst);
+            break;
+        }
+        case SimdConvolutionActivationLeakyRelu:
+            Base::SynetRelu32f(dst, batch * _sizeD, _params.data, dst);
+            break;
+        case SimdConvolutionActivationRestrictRange:
+            Base::SynetRestrictRange32f(dst, batch * _sizeD, _params.data, _params.data + 1, dst);
+            break;
+        case SimdConvolutionActivationPrelu:
+            for (size_t b = 0; b < batch; ++b)
+                Base::SynetPreluLayerForward(dst + b * _sizeD, _params.data, p.dstC, p.dstH * p.dstW, dst + b * _sizeD, p.dstF);
+            break;
+        case SimdConvolutionActivationElu:
+            Base::SynetElu32f(dst, batch * _sizeD, _params.data, dst);
+            break;
+        case SimdConvolutionActivationHswish:
+            Base::SynetHswish32f(dst, batch * _sizeD, _params.data, _params.data + 1, dst);
+            break;
+        case SimdConvolutionActivationMish:
+            Base::SynetMish32f(dst, batch * _sizeD, _params.data, dst);
+            break;
+        case SimdConvolutionActivationHardSigmoid:
+            Base::SynetHardSigmoid32f(dst, batch * _sizeD, _params.data, _params.data + 1, dst);
+            break;
+        case SimdConvolutionActivationSwish:
+            Base::SynetSwish32f(dst, batch * _sizeD, _params.data, dst);
+            break;
+        case SimdConvolutionActivationGelu:
+            Base::SynetGelu32f(dst, batch * _sizeD, dst);
+            break;
+        case SimdConvolutionActivationGeluTanh:
+            Base::SynetGeluTanh32f(dst, batch * _sizeD, dst);
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    float SynetConvolution8i::Activate(float value, size_t channel) const
+    {
+        const float* params = _params.data;
+        switch (_param.activation)
+        {
+        case SimdConvolutionActivationIdentity:
+        case SimdConvolutionActivationRelu:
+        case SimdConvolutionActivationRestrictRange: return Base::Activate<SimdConvolutionActivationRestrictRange>(value, params, channel);
+        case SimdConvolutionActivationLeakyRelu:
+        case SimdConvolutionActivationPrelu: return Base::Activate<SimdConvolutionActivationPrelu>(value, params, channel);
+        case SimdConvolutionActivationElu: return Base::Activate<SimdConvolutionActivationElu>(value, params, channel);
+        case SimdConvolutionActivationHswish: return Base::Activate<SimdConvolutionActivationHswish>(value, params, channel);
+        case SimdConvolutionActivationMish: return Base::Activate<SimdConvolutionActivationMish>(value, params, channel);
+        case SimdConvolutionActivationHardSigmoid: return Base::Activate<SimdConvolutionActivationHardSigmoid>(value, params, channel);
+        case SimdConvolutionActivationSwish: return Base::Activate<SimdConvolutionActivationSwish>(value, params, channel);
+        case SimdConvolutionActivationGelu: return Base::Activate<SimdConvolutionActivationGelu>(value, params, channel);
+        case SimdConvolutionActivationGeluTanh: return Base::Activate<SimdConvolutionActivationGeluTanh>(value, params, channel);
+        default:
+            assert(0);
+            return value;
         }
     }
 
@@ -312,7 +486,7 @@ namespace Simd
             return size;
         }
 
-        void SynetConvolution8iGemmNN::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetConvolution8iGemmNN::Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst)
         {
             const ConvParam8i& p = _param;
             const int8_t * weight = _weight.data;
@@ -345,44 +519,9 @@ namespace Simd
                 }
             }
             Convert<int32_t, float, float>(sum, _merge, p.dstC, p.dstH, p.dstW, p.dstF, _norm.data, _bias.data, 0, 0, dst32f);
-            switch (p.activation)
-            {
-            case SimdConvolutionActivationIdentity:
-                break;
-            case SimdConvolutionActivationRelu:
-            {
-                float slope = 0;
-                SynetRelu32f(dst32f, _merge * _sizeD, &slope, dst32f);
-                break;
-            }
-            case SimdConvolutionActivationLeakyRelu:
-                SynetRelu32f(dst32f, _merge * _sizeD, _params.data, dst32f);
-                break;
-            case SimdConvolutionActivationRestrictRange:
-                SynetRestrictRange32f(dst32f, _merge * _sizeD, _params.data, _params.data + 1, dst32f);
-                break;
-            case SimdConvolutionActivationPrelu:
-                for (size_t m = 0; m < _merge; ++m)
-                    SynetPreluLayerForward(dst32f + m * _sizeD, _params.data, p.dstC, p.dstH*p.dstW, dst32f + m * _sizeD, p.dstF);
-                break;
-            case SimdConvolutionActivationElu:
-                SynetElu32f(dst32f, _merge * _sizeD, _params.data, dst32f);
-                break;
-            case SimdConvolutionActivationHswish:
-                SynetHswish32f(dst32f, _merge * _sizeD, _params.data, _params.data + 1, dst32f);
-                break;
-            case SimdConvolutionActivationMish:
-                SynetMish32f(dst32f, _merge * _sizeD, _params.data, dst32f);
-                break;
-            case SimdConvolutionActivationHardSigmoid:
-                SynetHardSigmoid32f(dst32f, _merge * _sizeD, _params.data, _params.data + 1, dst32f);
-                break;
-            case SimdConvolutionActivationSwish:
-                SynetSwish32f(dst32f, _merge * _sizeD, _params.data, dst32f);
-                break;
-            default:
-                assert(0);
-            }
+            if (add)
+                AddResidual(add, dst32f);
+            Activate(dst32f, _merge);
             if (_dst8u)
                 Convert<float, uint8_t, float>(dst32f, _merge, p.dstC, p.dstH, p.dstW, p.dstF, _dstCvt.scale.data, _dstCvt.shift.data, _dstCvt.uMin, _dstCvt.uMax, dst);
         }
@@ -414,6 +553,8 @@ namespace Simd
             size_t size = SynetConvolution8i::ExternalBufferSize();
             size += AlignHi(_sizeP * sizeof(uint8_t), SIMD_ALIGN);
             size += AlignHi(_sizeB * sizeof(int32_t), SIMD_ALIGN);
+            if (_sizeB == 0 && _dst8u)
+                size += AlignHi(_sizeD * sizeof(int32_t), SIMD_ALIGN);
             return size;
         }
 
@@ -425,6 +566,23 @@ namespace Simd
             _alg.upper = Set4(_dstCvt.uMax);
         }
 
+        void SynetConvolution8iNhwcDirect::Pack(SynetPack& pack)
+        {
+            SynetConvolution8i::Pack(pack);
+            if (pack.Loading() && pack.Ok())
+            {
+                _alg.zero = Set4(_srcCvt.zero[0]);
+                _alg.upper = Set4(_dstCvt.uMax);
+            }
+        }
+
+        String SynetConvolution8iNhwcDirect::PackKey() const
+        {
+            std::stringstream ss;
+            ss << SynetConvolution8i::PackKey() << "-" << _alg.F;
+            return ss.str();
+        }
+
         bool SynetConvolution8iNhwcDirect::Preferable(const ConvParam8i& p)
         {
             return false;
@@ -511,21 +669,60 @@ namespace Simd
             _weight.Swap(weight);
         }
 
-        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst)
         {
             int32_t * sum = _sizeB ? Allocate<int32_t>(buf, _sizeB) : (int32_t*)dst;
             uint8_t * pad = _sizeP ? Allocate<uint8_t>(buf, _sizeP) : NULL;
+            if (_sizeB == 0 && _dst8u)
+            {
+                int32_t* res = Allocate<int32_t>(buf, _sizeD);
+                if (add)
+                    sum = res;
+            }
+            size_t size = _dst8u ? sizeof(uint8_t) : sizeof(float);
             for (size_t m = 0; m < _merge; ++m)
             {
                 if (_sizeP)
                 {
                     PadInput(src, pad);
-                    Forward8u(pad, _paramP, sum, dst);
+                    Forward8u(pad, _paramP, sum, add, dst);
                 }
                 else
-                    Forward8u(src, _param, sum, dst);
+                    Forward8u(src, _param, sum, add, dst);
+                if (add)
+                    SetZeroNormResidual(add, dst);
                 src += _sizeS;
-                dst += _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float));
+                if (add)
+                    add += _sizeD * size;
+                dst += _sizeD * size;
+            }
+        }
+
+        void SynetConvolution8iNhwcDirect::SetResidual(const uint8_t* add, size_t dc, size_t macroD, size_t yBeg, size_t yEnd, const float* norm, int32_t* buf)
+        {
+            const ConvParam8i& p = _param;
+            for (size_t i = yBeg * p.dstW * p.dstC, n = yEnd * p.dstW * p.dstC; i < n; i += p.dstC)
+            {
+                for (size_t c = 0; c < macroD; ++c)
+                    buf[i + c] = norm[c] != 0.0f ? Round(Residual(add, i + dc + c, dc + c) / norm[c]) : 0;
+            }
+        }
+
+        void SynetConvolution8iNhwcDirect::SetZeroNormResidual(const uint8_t* add, uint8_t* dst)
+        {
+            const ConvParam8i& p = _param;
+            for (size_t c = 0; c < p.dstC; ++c)
+            {
+                if (_norm[c] != 0.0f)
+                    continue;
+                for (size_t i = c; i < _sizeD; i += p.dstC)
+                {
+                    float value = Activate(_bias[c] + Residual(add, i, c), c);
+                    if (_dst8u)
+                        dst[i] = SynetConvert32fTo8u(value, _dstCvt.scale[c], _dstCvt.shift[c], _dstCvt.uMin, _dstCvt.uMax);
+                    else
+                        ((float*)dst)[i] = value;
+                }
             }
         }
 
@@ -549,7 +746,7 @@ namespace Simd
                 memset(dst, _srcCvt.zero[0], tailY), dst += tailY;
         }
 
-        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, const ConvParam8i& p, int32_t* buf, uint8_t* dst)
+        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, const ConvParam8i& p, int32_t* buf, const uint8_t* add, uint8_t* dst)
         {
             const int8_t* weight = _weight.data;
             const float* norm = _norm.data;
@@ -566,16 +763,18 @@ namespace Simd
                     for (size_t yBeg = 0; yBeg < p.dstH;)
                     {
                         size_t yEnd = Simd::Min(yBeg + _alg.macroH, p.dstH);
+                        if (add && sc == 0)
+                            SetResidual(add, dc, macroD, yBeg, yEnd, norm, buf);
                         if (sc + macroC == p.srcC)
                         {
-                            int first = macroC == p.srcC ? 1 : 0;
+                            int first = macroC == p.srcC && !add ? 1 : 0;
                             if (_alg.size == 1)
                                 _convolutions[Term8iLast8u](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst, first);
                             else
                                 _convolutions[Term8iLast32f](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst, first);
                         }
                         else
-                            _convolutions[Term8iInterim](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst, sc == 0 ? 1 : 0);
+                            _convolutions[Term8iInterim](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst, sc == 0 && !add ? 1 : 0);
                         yBeg = yEnd;
                     }
                     weight += DivHi(macroC, 4) * _alg.F * 4;
@@ -606,12 +805,32 @@ namespace Simd
             return Ext() + "::NhwcDepthwise" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p"));
         }
 
+        size_t SynetConvolution8iNhwcDepthwise::ExternalBufferSize() const
+        {
+            size_t size = SynetConvolution8i::ExternalBufferSize();
+            size += AlignHi(_sizeD * sizeof(float), SIMD_ALIGN);
+            return size;
+        }
+
         void SynetConvolution8iNhwcDepthwise::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
         {
             SynetConvolution8i::SetParams(weight, bias, params, stats);
             _alg.zero = _srcCvt.zero[0];
             _alg.upper = Set4(_dstCvt.uMax);
             _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
+            _alg.biasStep = 0;
+        }
+
+        void SynetConvolution8iNhwcDepthwise::Pack(SynetPack& pack)
+        {
+            SynetConvolution8i::Pack(pack);
+            if (pack.Loading() && pack.Ok())
+            {
+                _alg.zero = _srcCvt.zero[0];
+                _alg.upper = Set4(_dstCvt.uMax);
+                _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
+                _alg.biasStep = 0;
+            }
         }
 
         bool SynetConvolution8iNhwcDepthwise::Preferable(const ConvParam8i& p)
@@ -619,7 +838,7 @@ namespace Simd
             return false;
         }
 
-        void SynetConvolution8iNhwcDepthwise::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        void SynetConvolution8iNhwcDepthwise::Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst)
         {
             const int8_t* weight = _weight.data;
             const float* norm = _norm.data;
@@ -627,14 +846,35 @@ namespace Simd
             const float* params = _params.data;
             const float* scale = _dstCvt.scale.data;
             const float* shift = _dstCvt.shift.data;
+            AlgParam alg = _alg;
+            float* residual = NULL;
+            if (add)
+            {
+                residual = Allocate<float>(buf, _sizeD);
+                alg.biasStep = (int32_t)_param.dstC;
+                bias = residual;
+            }
             for (size_t m = 0; m < _merge; ++m)
             {
-                _convolution(src, _param, _alg, weight, norm, bias, params, scale, shift, dst);
+                if (add)
+                {
+                    SetResidual(add, residual);
+                    add += _sizeD * _alg.size;
+                }
+                _convolution(src, _param, alg, weight, norm, bias, params, scale, shift, dst);
                 src += _sizeS;
                 dst += _sizeD * _alg.size;
             }
         }
 
+        void SynetConvolution8iNhwcDepthwise::SetResidual(const uint8_t* add, float* dst)
+        {
+            const ConvParam8i& p = _param;
+            for (size_t i = 0; i < _sizeD; i += p.dstC)
+                for (size_t c = 0; c < p.dstC; ++c)
+                    dst[i + c] = _bias[c] + Residual(add, i + c, c);
+        }
+
         //---------------------------------------------------------------------
 
 //#define SIMD_BASE_ONLY_GEMM_NN
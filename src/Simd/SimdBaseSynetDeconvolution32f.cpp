@@ -40,6 +40,125 @@ namespace Simd
     }
 #endif
 
+    size_t SynetDeconvolution32f::Export(void* data, size_t size)
+    {
+        SynetPack measure(SynetPack::Measure);
+        measure.Header(Desc(), PackKey());
+        Pack(measure);
+        if (data && size >= measure.Size())
+        {
+            SynetPack save(SynetPack::Save, data, measure.Size());
+            save.Header(Desc(), PackKey());
+            Pack(save);
+        }
+        return measure.Size();
+    }
+
+    bool SynetDeconvolution32f::Import(const void* data, size_t size, bool attach)
+    {
+        _shapes.Clear();
+        SynetPack pack(attach && Aligned(data, SIMD_ALIGN) ? SynetPack::Attach : SynetPack::Load, data, size);
+        if (data == NULL || !pack.Header(Desc(), PackKey()))
+            return false;
+        Pack(pack);
+        _packed.reset();
+        return pack.Ok();
+    }
+
+    SynetPacked* SynetDeconvolution32f::CreatePacked()
+    {
+        size_t size = Export(NULL, 0);
+        SynetPacked* packed = new SynetPacked(size);
+        Export(packed->Data()->data, size);
+        return packed;
+    }
+
+    bool SynetDeconvolution32f::SetPacked(const SynetPacked& packed)
+    {
+        if (!Import(packed.Data()->data, packed.Data()->size, true))
+            return false;
+        _packed = packed.Data();
+        return true;
+    }
+
+    String SynetDeconvolution32f::PackKey() const
+    {
+        return ConvolutionPackKey(_param, _param.compatibility);
+    }
+
+    void SynetDeconvolution32f::Pack(SynetPack& pack)
+    {
+        pack.Item(_weight, _param.SizeW(), _pWeight);
+        PackBiasAndParams(pack);
+    }
+
+    void SynetDeconvolution32f::PackBiasAndParams(SynetPack& pack)
+    {
+        pack.Item(_bias, _param.dstC, _pBias);
+        pack.Item(_params, PackParamsSize(_param.activation, _param.dstC), _pParams);
+    }
+
+    bool SynetDeconvolution32f::Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init)
+    {
+        const DeconvParam32f& p = _param;
+        if (batch == p.batch && srcH == p.srcH && srcW == p.srcW)
+        {
+            _shapes.Select(NULL);
+            return true;
+        }
+        String key = ShapeKey(batch, srcH, srcW);
+        SynetDeconvolution32f* shaped = _shapes.Get(key);
+        if (shaped == NULL)
+        {
+            if (batch == 0 || srcH == 0 || srcW == 0)
+                return false;
+            size_t dstH = p.strideY * (srcH - 1) + p.dilationY * (p.kernelY - 1) + 1;
+            size_t dstW = p.strideX * (srcW - 1) + p.dilationX * (p.kernelX - 1) + 1;
+            if (dstH <= p.padY + p.padH || dstW <= p.padX + p.padW)
+                return false;
+            SimdConvolutionParameters conv = p;
+            conv.srcH = srcH;
+            conv.srcW = srcW;
+            conv.dstH = dstH - p.padY - p.padH;
+            conv.dstW = dstW - p.padX - p.padW;
+            if (_shapes.Shared().get() == NULL && (_shapes.Kept().weight == NULL || _shapes.Kept().internal))
+            {
+                if (_packed.get() == NULL)
+                {
+                    SynetShapes<SynetDeconvolution32f>::Params kept = _shapes.Kept();
+                    SynetPacked* packed = CreatePacked();
+                    bool attached = SetPacked(*packed);
+                    delete packed;
+                    _shapes.Keep(kept);
+                    if (!attached)
+                        return false;
+                }
+                _shapes.Share(_packed);
+            }
+            shaped = (SynetDeconvolution32f*)init(batch, &conv, p.compatibility);
+            if (shaped == NULL)
+                return false;
+            if (_shapes.Shared().get() == NULL || !shaped->SetPacked(SynetPacked(_shapes.Shared())))
+            {
+                if (_shapes.Kept().weight == NULL)
+                {
+                    delete shaped;
+                    return false;
+                }
+                _shapes.SetParams(shaped);
+            }
+            _shapes.Add(key, shaped);
+        }
+        _shapes.Select(shaped);
+        return true;
+    }
+
+    void SynetDeconvolution32f::KeepParams(const float* weight, SimdBool internal, const float* bias, const float* params)
+    {
+        _packed.reset();
+        _shapes.Keep(SynetShapes<SynetDeconvolution32f>::Params(weight, internal == SimdTrue, bias, params));
+    }
+
     namespace Base
     {
         SynetDeconvolution32fGemmNN::SynetDeconvolution32fGemmNN(const DeconvParam32f & p)
@@ -129,6 +248,26 @@ namespace Simd
             }
         }
 
+        void SynetDeconvolution32fGemmNN::Pack(SynetPack& pack)
+        {
+            if (_nhwcWeight.data)
+                pack.Item(_nhwcWeight);
+            else if (_weightT.data)
+                pack.Item(_weightT);
+            else
+                pack.Item(_weight, _param.SizeW(), _pWeight);
+            PackBiasAndParams(pack);
+        }
+
+        String SynetDeconvolution32fGemmNN::PackKey() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetDeconvolution32f::PackKey();
+            if (_nhwcWeight.data)
+                ss << "-" << _M * _merge << "x" << _N << "x" << _K;
+            return ss.str();
+        }
+
         void SynetDeconvolution32fGemmNN::Forward(const float * src, float * buf, float * dst)
         {
             const DeconvParam32f & p = _param;
@@ -231,59 +370,8 @@ namespace Simd
 
         void SynetDeconvolution32fGemmNN::RowToImg(const float * src, float * dst)
         {
-            const DeconvParam32f & p = _param;
-            assert(p.trans && p.group == 1);
-            if (p.IsPad(0) && p.IsDilation(1) && p.kernelY == p.strideX && p.kernelX == p.strideX)
-            {
-                for (size_t sy = 0; sy < p.srcH; ++sy)
-                {
-                    for (size_t sx = 0; sx < p.srcW; ++sx)
-                    {
-                        size_t dy = sy * p.strideY;
-                        for (size_t ky = 0; ky < p.kernelY; ky++, dy += 1)
-                        {
-                            size_t dx = sx * p.strideX;
-                            for (size_t kx = 0; kx < p.kernelX; kx++, dx += 1)
-                            {
-                                memcpy(dst + (dy * p.dstW + dx)*p.dstC, src, p.dstC * sizeof(float));
-                                src += p.dstC;
-                            }
-                        }
-                    }
-                }
-            }
-            else
-            {
-                for (size_t dy = 0; dy < p.dstH; ++dy)
-                    for (size_t dx = 0; dx < p.dstW; ++dx)
-                        memset(dst + (dy*p.dstW + dx)*p.dstC, 0, p.dstC * sizeof(float));
-                for (size_t sy = 0; sy < p.srcH; ++sy)
-                {
-                    for (size_t sx = 0; sx < p.srcW; ++sx)
-                    {
-                        size_t dy = sy * p.strideY - p.padY;
-                        for (size_t ky = 0; ky < p.kernelY; ky++, dy += p.dilationY)
-                        {
-                            if (dy < p.dstH)
-                            {
-                                size_t dx = sx * p.strideX - p.padX;
-                                for (size_t kx = 0; kx < p.kernelX; kx++, dx += p.dilationX)
-                                {
-                                    if (dx < p.dstW)
-                                    {
-                                        float * d = dst + (dy * p.dstW + dx)*p.dstC;
-                                        for (size_t dc = 0; dc < p.dstC; ++dc)
-                                            d[dc] += src[dc];
-                                    }
-                                    src += p.dstC;
-                                }
-                            }
-                            else
-                                src += p.kernelX * p.dstC;
-                        }
-                    }
-                }
-            }
+            assert(_param.trans && _param.group == 1);
+            SynetDeconvolutionRowToImg(_param, src, dst);
         }
 
         //---------------------------------------------------------------------
@@ -347,7 +435,7 @@ namespace Simd
 
         size_t SynetDeconvolution32fNhwcDirect2x2::InternalBufferSize() const
         {
-            return _buffer.size + _rWeight.size + _rBias.size + _rParams.size;
+            return _buffer.size + OwnedSize(_rWeight) + OwnedSize(_rBias) + OwnedSize(_rParams);
         }
 
         void SynetDeconvolution32fNhwcDirect2x2::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -409,6 +497,9 @@ namespace Simd
                 case SimdConvolutionActivationSwish:
                     _rParams.data[0] = params[0];
                     break;
+                case SimdConvolutionActivationGelu:
+                case SimdConvolutionActivationGeluTanh:
+                    break;
                 default:
                     assert(0);
                 }
@@ -427,6 +518,31 @@ namespace Simd
             }
         }
 
+        void SynetDeconvolution32fNhwcDirect2x2::Pack(SynetPack& pack)
+        {
+            if (_rWeight.data)
+                pack.Item(_weight, _rWeight.size, _rWeight);
+            else
+                pack.Item(_weight, _param.SizeW(), _pWeight);
+            if (_rBias.data)
+                pack.Item(_bias, _rBias.size, _rBias);
+            else
+                pack.Item(_bias, _param.dstC, _pBias);
+            if (_rParams.data)
+                pack.Item(_params, _rParams.size, _rParams);
+            else
+                pack.Item(_params, PackParamsSize(_param.activation, _param.dstC), _pParams);
+        }
+
+        String SynetDeconvolution32fNhwcDirect2x2::PackKey() const
+        {
+            std::stringstream ss;
+            ss << SynetDeconvolution32f::PackKey();
+            if (_rWeight.data)
+                ss << "-" << _alg.microD << "-" << _alg.macroC << "-" << _alg.macroD;
+            return ss.str();
+        }
+
         bool SynetDeconvolution32fNhwcDirect2x2::Preferable(const DeconvParam32f & p)
         {
             return false;
@@ -434,12 +550,155 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SynetDeconvolution32fBf16::SynetDeconvolution32fBf16(const DeconvParam32f & p, ConvolutionInitPtr init, BiasAndActivation biasAndActivation)
+            : SynetDeconvolution32f(p)
+        {
+            SimdConvolutionParameters conv = p;
+            conv.dstC = p.kernelY * p.kernelX * p.dstC;
+            conv.dstH = p.srcH;
+            conv.dstW = p.srcW;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.activation = SimdConvolutionActivationIdentity;
+            _conv = (SynetConvolution32f*)init(p.batch, &conv, p.compatibility);
+            assert(_conv);
+            _sizeB = conv.dstC * conv.dstH * conv.dstW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _biasAndActivation = biasAndActivation;
+        }
+
+        SynetDeconvolution32fBf16::~SynetDeconvolution32fBf16()
+        {
+            delete _conv;
+        }
+
+        String SynetDeconvolution32fBf16::Ext() const
+        {
+            return _conv->Ext();
+        }
+
+        size_t SynetDeconvolution32fBf16::ExternalBufferSize() const
+        {
+            return _sizeB * _param.batch + _conv->ExternalBufferSize();
+        }
+
+        size_t SynetDeconvolution32fBf16::InternalBufferSize() const
+        {
+            return _buffer.size + _conv->InternalBufferSize();
+        }
+
+        void SynetDeconvolution32fBf16::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            SynetDeconvolution32f::SetParams(weight, internal, bias, params);
+            _conv->SetParams(weight, internal, NULL, NULL);
+        }
+
+        void SynetDeconvolution32fBf16::Forward(const float * src, float * buf, float * dst)
+        {
+            const DeconvParam32f & p = _param;
+            buf = Buffer(buf);
+            float * gemm = buf;
+            _conv->Forward(src, buf + _sizeB * p.batch, gemm);
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                SynetDeconvolutionRowToImg(p, gemm, dst);
+                _biasAndActivation(_bias, p.dstC, p.dstH * p.dstW, p.activation, _params, p.trans, dst);
+                gemm += _sizeB;
+                dst += _sizeD;
+            }
+        }
+
+        void SynetDeconvolution32fBf16::Pack(SynetPack& pack)
+        {
+            _conv->Pack(pack);
+            PackBiasAndParams(pack);
+        }
+
+        String SynetDeconvolution32fBf16::PackKey() const
+        {
+            return Simd::SynetDeconvolution32f::PackKey() + "-" + _conv->PackKey();
+        }
+
+        bool SynetDeconvolution32fBf16::Preferable(const DeconvParam32f & p)
+        {
+            return p.trans && p.group == 1;
+        }
+
+        //---------------------------------------------------------------------
+
+        void SynetDeconvolutionRowToImg(const SimdConvolutionParameters & p, const float * src, float * dst)
+        {
+            if (p.padY == 0 && p.padX == 0 && p.padH == 0 && p.padW == 0 && p.dilationY == 1 && p.dilationX == 1 && p.kernelY == p.strideY && p.kernelX == p.strideX)
+            {
+                for (size_t sy = 0; sy < p.srcH; ++sy)
+                {
+                    for (size_t sx = 0; sx < p.srcW; ++sx)
+                    {
+                        size_t dy = sy * p.strideY;
+                        for (size_t ky = 0; ky < p.kernelY; ky++, dy += 1)
+                        {
+                            size_t dx = sx * p.strideX;
+                            for (size_t kx = 0; kx < p.kernelX; kx++, dx += 1)
+                            {
+                                memcpy(dst + (dy * p.dstW + dx)*p.dstC, src, p.dstC * sizeof(float));
+                                src += p.dstC;
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (size_t dy = 0; dy < p.dstH; ++dy)
+                    for (size_t dx = 0; dx < p.dstW; ++dx)
+                        memset(dst + (dy*p.dstW + dx)*p.dstC, 0, p.dstC * sizeof(float));
+                for (size_t sy = 0; sy < p.srcH; ++sy)
+                {
+                    for (size_t sx = 0; sx < p.srcW; ++sx)
+                    {
+                        size_t dy = sy * p.strideY - p.padY;
+                        for (size_t ky = 0; ky < p.kernelY; ky++, dy += p.dilationY)
+                        {
+                            if (dy < p.dstH)
+                            {
+                                size_t dx = sx * p.strideX - p.padX;
+                                for (size_t kx = 0; kx < p.kernelX; kx++, dx += p.dilationX)
+                                {
+                                    if (dx < p.dstW)
+                                    {
+                                        float * d = dst + (dy * p.dstW + dx)*p.dstC;
+                                        for (size_t dc = 0; dc < p.dstC; ++dc)
+                                            d[dc] += src[dc];
+                                    }
+                                    src += p.dstC;
+                                }
+                            }
+                            else
+                                src += p.kernelX * p.dstC;
+                        }
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
             DeconvParam32f param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
-            if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
+            if (Bf16Soft(compatibility) && SynetDeconvolution32fBf16::Preferable(param))
+                return new SynetDeconvolution32fBf16(param, Base::SynetConvolution32fInit, Base::ConvolutionBiasAndActivation);
+            else if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
                 return new SynetDeconvolution32fGemmNN(param);
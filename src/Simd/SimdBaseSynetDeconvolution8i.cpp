@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetDeconvolution8i.h"
+#include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetDeconvolution8i::SynetDeconvolution8i(const DeconvParam8i& p, SynetConvolution8i* conv, BiasAndActivationPtr biasAndActivation, Convert32fTo8uPtr convert32fTo8u)
+        : _param(p)
+        , _conv(conv)
+        , _biasAndActivation(biasAndActivation)
+        , _convert32fTo8u(convert32fTo8u)
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        , _perf(NULL)
+#endif
+    {
+        _sizeB = p.kernelY * p.kernelX * p.dstC * p.srcH * p.srcW;
+        _sizeD = p.dstC * p.dstH * p.dstW;
+        _sizeC = AlignHi(_conv->ExternalBufferSize(), SIMD_ALIGN);
+    }
+
+    SynetDeconvolution8i::~SynetDeconvolution8i()
+    {
+        delete _conv;
+    }
+
+    size_t SynetDeconvolution8i::ExternalBufferSize() const
+    {
+        const DeconvParam8i& p = _param;
+        return _sizeC + (_sizeB + (p.dstT == SimdTensorData8u ? _sizeD : 0)) * p.batch * sizeof(float);
+    }
+
+    size_t SynetDeconvolution8i::InternalBufferSize() const
+    {
+        return _buffer.size + _conv->InternalBufferSize() + _dstCvt.Size() + (_bias.size + _params.size) * sizeof(float);
+    }
+
+    void SynetDeconvolution8i::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+    {
+        const DeconvParam8i& p = _param;
+        size_t K = p.kernelY * p.kernelX;
+        Array32f dstMin(K * p.dstC), dstMax(K * p.dstC);
+        for (size_t k = 0; k < K; ++k)
+        {
+            memcpy(dstMin.data + k * p.dstC, stats[2], p.dstC * sizeof(float));
+            memcpy(dstMax.data + k * p.dstC, stats[3], p.dstC * sizeof(float));
+        }
+        const float* convStats[4] = { stats[0], stats[1], dstMin.data, dstMax.data };
+        _conv->SetParams(weight, NULL, NULL, convStats);
+        _bias.Resize(p.dstC, true);
+        if (bias)
+            memcpy(_bias.data, bias, p.dstC * sizeof(float));
+        if (params)
+        {
+            _params.Resize(p.activation == SimdConvolutionActivationPrelu ? p.dstC : 2);
+            memcpy(_params.data, params, _params.size * sizeof(float));
+        }
+        if (p.dstT == SimdTensorData8u)
+            _dstCvt.Init(stats[2], stats[3], p.dstC, p.compatibility);
+    }
+
+    void SynetDeconvolution8i::Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+    {
+        const DeconvParam8i& p = _param;
+        buf = Buffer(buf);
+        float* gemm = (float*)(buf + _sizeC);
+        float* img = p.dstT == SimdTensorData8u ? gemm + _sizeB * p.batch : (float*)dst;
+        _conv->Forward(src, buf, (uint8_t*)gemm);
+        for (size_t b = 0; b < p.batch; ++b)
+        {
+            float* pImg = img + b * _sizeD;
+            Base::SynetDeconvolutionRowToImg(p, gemm + b * _sizeB, pImg);
+            _biasAndActivation(_bias.data, p.dstC, p.dstH * p.dstW, p.activation, _params.data, SimdTrue, pImg);
+        }
+        if (p.dstT == SimdTensorData8u)
+            _convert32fTo8u(img, p.batch, p.dstC, p.dstH, p.dstW, p.dstF, _dstCvt.scale.data, _dstCvt.shift.data, dst, p.compatibility);
+    }
+
+    uint8_t* SynetDeconvolution8i::Buffer(uint8_t* buffer)
+    {
+        if (buffer)
+            return buffer;
+        else
+        {
+            _buffer.Resize(ExternalBufferSize());
+            return _buffer.data;
+        }
+    }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurer * SynetDeconvolution8i::Perf(const char* func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    void* SynetDeconvolution8i::Create(const DeconvParam8i& p, ConvolutionInitPtr init, BiasAndActivationPtr biasAndActivation, Convert32fTo8uPtr convert32fTo8u)
+    {
+        if (!p.Valid())
+            return NULL;
+        SimdConvolutionParameters conv = p.Conv();
+        SynetConvolution8i* c = (SynetConvolution8i*)init(p.batch, &conv, p.compatibility);
+        if (c == NULL)
+            return NULL;
+        return new SynetDeconvolution8i(p, c, biasAndActivation, convert32fTo8u);
+    }
+
+    namespace Base
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+        {
+            DeconvParam8i param(batch, conv, compatibility);
+            return Simd::SynetDeconvolution8i::Create(param, Base::SynetConvolution8iInit, Base::ConvolutionBiasAndActivation, Base::SynetConvert32fTo8u);
+        }
+    }
+#endif
+}
@@ -64,6 +64,31 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        static void SynetInnerProduct32fSparse(const float* src, size_t M, size_t N, size_t K, const float* value, const uint8_t* index, float* dst)
+        {
+            size_t G = K / 4;
+            for (size_t m = 0; m < M; ++m)
+            {
+                const float* val = value;
+                const uint8_t* idx = index;
+                for (size_t n = 0; n < N; ++n)
+                {
+                    float sum = 0.0f;
+                    for (size_t g = 0; g < G; ++g, val += 2)
+                    {
+                        const float* s = src + g * 4;
+                        sum += val[0] * s[idx[g] & 3] + val[1] * s[(idx[g] >> 2) & 3];
+                    }
+                    dst[n] = sum;
+                    idx += G;
+                }
+                src += K;
+                dst += N;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         SynetInnerProduct32fGemm::SynetInnerProduct32fGemm(const InnerProductParam32f & p)
             : SynetInnerProduct32f(p)
             , _0(0.0f)
@@ -76,6 +101,8 @@ namespace Simd
             _ldD = _N;
             _biasAndActivation = Base::ConvolutionBiasAndActivation;
             _prod = NULL;
+            _spF = 1;
+            _sparse = SynetInnerProduct32fSparse;
             if (_param.transpose)
             {
                 _gemm = Base::Gemm32fNT;
@@ -92,14 +119,63 @@ namespace Simd
 
         String SynetInnerProduct32fGemm::Desc() const 
         { 
-            return Ext() + "::Gemm" + (_prod ? "Prod" : 
+            return Ext() + "::Gemm" + (_prod ? "Prod" : _spValue.size ? "Sparse" :
                 String("N") + (_cbWeight.size ? "Ncb" : (_param.transpose == SimdTrue ? "T" : "N")));
         }
 
+        bool SynetInnerProduct32fGemm::SetSparse(const float* weight)
+        {
+            const size_t SPARSE_BATCH_MAX = 16;
+            if (_sparse == NULL || _M > SPARSE_BATCH_MAX || _K % 4 != 0)
+                return false;
+            size_t G = _K / 4, strideN = _param.transpose ? _K : 1, strideK = _param.transpose ? 1 : _N;
+            for (size_t n = 0; n < _N; ++n)
+            {
+                for (size_t k = 0; k < _K; k += 4)
+                {
+                    const float* w = weight + n * strideN + k * strideK;
+                    size_t nonZero = 0;
+                    for (size_t i = 0; i < 4; ++i)
+                        nonZero += w[i * strideK] != 0.0f ? 1 : 0;
+                    if (nonZero > 2)
+                        return false;
+                }
+            }
+            _spValue.Resize(AlignHi(_N, _spF) * G * 2, true);
+            _spIndex.Resize(AlignHi(_N, _spF) * G, true);
+            for (size_t n = 0; n < _N; ++n)
+            {
+                float* value = _spValue.data + (n / _spF) * G * 2 * _spF + n % _spF;
+                uint8_t* index = _spIndex.data + (n / _spF) * G * _spF + n % _spF;
+                for (size_t g = 0; g < G; ++g, value += 2 * _spF, index += _spF)
+                {
+                    const float* w = weight + n * strideN + g * 4 * strideK;
+                    uint8_t idx[2] = { 0, 0 };
+                    for (size_t i = 0, nonZero = 0; i < 4; ++i)
+                    {
+                        if (w[i * strideK] != 0.0f)
+                        {
+                            value[nonZero * _spF] = w[i * strideK];
+                            idx[nonZero++] = uint8_t(i);
+                        }
+                    }
+                    index[0] = idx[0] | (idx[1] << 2);
+                }
+            }
+            return true;
+        }
+
         void SynetInnerProduct32fGemm::SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params)
         {
             Simd::SynetInnerProduct32f::SetParams(weight, internal, bias, params);
-            if (_cbWeight.data)
+            if (SetSparse(weight))
+            {
+                _prod = NULL;
+                _cbWeight.Resize(0);
+                if (internal)
+                    *internal = SimdTrue;
+            }
+            else if (_cbWeight.data)
             {
                 Array32f buffer;
                 if (_param.transpose)
@@ -122,7 +198,9 @@ namespace Simd
                 _prod(src, _weight, _bias, _N, _K, dst);
             else
             {
-                if (_cbWeight.data)
+                if (_spValue.data)
+                    _sparse(src, _M, _N, _K, _spValue.data, _spIndex.data, dst);
+                else if (_cbWeight.data)
                     _cbRun(_M, _N, _K, src, _cbWeight.data, dst, GemmKernelAny, NHWC_GEMM_COMPATIBLE);
                 else
                     _gemm(_M, _N, _K, &_1, src, _ldS, _weight, _ldW, &_0, dst, _ldD);
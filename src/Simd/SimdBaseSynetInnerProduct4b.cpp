@@ -0,0 +1,171 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInnerProduct4b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct4b::SynetInnerProduct4b(const InnerProductParam4b& p)
+        : _param(p)
+        , _threads(Base::GetThreadNumber())
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        , _perf(NULL)
+#endif
+    {
+        _weight.Resize(p.output * p.RowSize());
+        _scale.Resize(p.output * p.Groups());
+        _shift.Resize(p.output * p.Groups());
+        _sums.Resize(p.batch * p.Groups());
+    }
+
+    size_t SynetInnerProduct4b::InternalBufferSize() const
+    {
+        return _weight.size + (_scale.size + _shift.size + _bias.size + _params.size + _sums.size) * sizeof(float);
+    }
+
+    void SynetInnerProduct4b::SetParams(const float* weight, const float* bias, const float* params)
+    {
+        const InnerProductParam4b& p = _param;
+        size_t G = p.Groups(), R = p.RowSize();
+        for (size_t o = 0; o < p.output; ++o)
+        {
+            uint8_t* dstW = _weight.data + o * R;
+            memset(dstW, 0, R);
+            for (size_t g = 0; g < G; ++g)
+            {
+                size_t beg = g * p.group, end = Simd::Min(beg + p.group, p.input);
+                float min = FLT_MAX, max = -FLT_MAX;
+                for (size_t i = beg; i < end; ++i)
+                {
+                    float w = p.transpose ? weight[o * p.input + i] : weight[i * p.output + o];
+                    min = Simd::Min(min, w);
+                    max = Simd::Max(max, w);
+                }
+                float scale = (max - min) / 15.0f, inv = scale > 0.0f ? 1.0f / scale : 0.0f;
+                _scale[o * G + g] = scale;
+                _shift[o * G + g] = min;
+                for (size_t i = beg; i < end; ++i)
+                {
+                    float w = p.transpose ? weight[o * p.input + i] : weight[i * p.output + o];
+                    int q = Simd::RestrictRange(Simd::Round((w - min) * inv), 0, 15);
+                    dstW[i / 2] |= uint8_t(q << ((i & 1) * 4));
+                }
+            }
+        }
+        if (bias)
+        {
+            _bias.Resize(p.output);
+            memcpy(_bias.data, bias, p.output * sizeof(float));
+        }
+        else
+            _bias.Resize(0);
+        if (params)
+        {
+            size_t size = p.activation == SimdConvolutionActivationPrelu ? p.output : 2;
+            _params.Resize(size);
+            memcpy(_params.data, params, size * sizeof(float));
+        }
+        else
+            _params.Resize(0);
+    }
+
+    void SynetInnerProduct4b::Forward(const float* src, float* dst)
+    {
+        const InnerProductParam4b& p = _param;
+        size_t G = p.Groups(), R = p.RowSize();
+        for (size_t b = 0; b < p.batch; ++b)
+        {
+            const float* ps = src + b * p.input;
+            float* sums = _sums.data + b * G;
+            for (size_t g = 0; g < G; ++g)
+            {
+                size_t beg = g * p.group, end = Simd::Min(beg + p.group, p.input);
+                float sum = 0.0f;
+                for (size_t i = beg; i < end; ++i)
+                    sum += ps[i];
+                sums[g] = sum;
+            }
+        }
+        Simd::Parallel(0, p.output, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t o = begin; o < end; ++o)
+            {
+                const uint8_t* weight = _weight.data + o * R;
+                const float* scale = _scale.data + o * G, * shift = _shift.data + o * G;
+                for (size_t b = 0; b < p.batch; ++b)
+                    dst[b * p.output + o] = _dot(src + b * p.input, weight, scale, shift, _sums.data + b * G, p.input, p.group);
+            }
+        }, _threads);
+        _biasAndActivation(_bias.data, p.output, p.batch, p.activation, _params.data, SimdTrue, dst);
+    }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+    Base::PerformanceMeasurer* SynetInnerProduct4b::Perf(const String& func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    namespace Base
+    {
+        static float Dot4b(const float* src, const uint8_t* weight, const float* scale, const float* shift, const float* sums, size_t input, size_t group)
+        {
+            float sum = 0.0f;
+            for (size_t g = 0, beg = 0; beg < input; g += 1, beg += group)
+            {
+                size_t end = Simd::Min(beg + group, input);
+                float dot = 0.0f;
+                for (size_t i = beg; i < end; ++i)
+                    dot += float((weight[i / 2] >> ((i & 1) * 4)) & 0xF) * src[i];
+                sum += dot * scale[g] + shift[g] * sums[g];
+            }
+            return sum;
+        }
+
+        SynetInnerProduct4b::SynetInnerProduct4b(const InnerProductParam4b& p)
+            : Simd::SynetInnerProduct4b(p)
+        {
+            _dot = Dot4b;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation)
+        {
+            InnerProductParam4b param(batch, input, output, group, transpose, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInnerProduct4b(param);
+        }
+    }
+#endif
+}
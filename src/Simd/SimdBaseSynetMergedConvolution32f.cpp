@@ -31,6 +31,106 @@
 namespace Simd
 {
 #if defined(SIMD_SYNET_ENABLE)
+    size_t SynetMergedConvolution32f::Export(void* data, size_t size)
+    {
+        SynetPack measure(SynetPack::Measure);
+        measure.Header(Desc(), PackKey());
+        Pack(measure);
+        if (data && size >= measure.Size())
+        {
+            SynetPack save(SynetPack::Save, data, measure.Size());
+            save.Header(Desc(), PackKey());
+            Pack(save);
+        }
+        return measure.Size();
+    }
+
+    bool SynetMergedConvolution32f::Import(const void* data, size_t size, bool attach)
+    {
+        _shapes.Clear();
+        SynetPack pack(attach && Aligned(data, SIMD_ALIGN) ? SynetPack::Attach : SynetPack::Load, data, size);
+        if (data == NULL || !pack.Header(Desc(), PackKey()))
+            return false;
+        Pack(pack);
+        return pack.Ok();
+    }
+
+    SynetPacked* SynetMergedConvolution32f::CreatePacked()
+    {
+        size_t size = Export(NULL, 0);
+        SynetPacked* packed = new SynetPacked(size);
+        Export(packed->Data()->data, size);
+        return packed;
+    }
+
+    bool SynetMergedConvolution32f::SetPacked(const SynetPacked& packed)
+    {
+        if (!Import(packed.Data()->data, packed.Data()->size, true))
+            return false;
+        _packed = packed.Data();
+        return true;
+    }
+
+    String SynetMergedConvolution32f::PackKey() const
+    {
+        std::stringstream ss;
+        ss << _param.count << "-" << int(_param.add);
+        for (size_t i = 0; i < _param.count; ++i)
+            ss << "-" << ConvolutionPackKey(_param.origin[i], _param.conv[i].compatibility);
+        return ss.str();
+    }
+
+    bool SynetMergedConvolution32f::Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init)
+    {
+        const MergConvParam32f& p = _param;
+        if (batch == p.conv[0].batch && srcH == p.conv[0].srcH && srcW == p.conv[0].srcW)
+        {
+            _shapes.Select(NULL);
+            return true;
+        }
+        String key = ShapeKey(batch, srcH, srcW);
+        SynetMergedConvolution32f* shaped = _shapes.Get(key);
+        if (shaped == NULL)
+        {
+            if (batch == 0)
+                return false;
+            SimdConvolutionParameters convs[3];
+            for (size_t i = 0; i < p.count; ++i)
+            {
+                SimdConvolutionParameters& c = convs[i];
+                c = p.origin[i];
+                c.srcH = i ? convs[i - 1].dstH : srcH;
+                c.srcW = i ? convs[i - 1].dstW : srcW;
+                if (c.srcH + c.padY + c.padH < c.dilationY * (c.kernelY - 1) + 1 || c.srcW + c.padX + c.padW < c.dilationX * (c.kernelX - 1) + 1)
+                    return false;
+                c.dstH = (c.srcH + c.padY + c.padH - (c.dilationY * (c.kernelY - 1) + 1)) / c.strideY + 1;
+                c.dstW = (c.srcW + c.padX + c.padW - (c.dilationX * (c.kernelX - 1) + 1)) / c.strideX + 1;
+            }
+            if (_shapes.Shared().get() == NULL)
+            {
+                if (_packed.get())
+                    _shapes.Share(_packed);
+                else
+                {
+                    SynetPacked* packed = CreatePacked();
+                    _shapes.Share(packed->Data());
+                    delete packed;
+                }
+            }
+            shaped = (SynetMergedConvolution32f*)init(batch, convs, p.count, p.add, p.conv[0].compatibility);
+            if (shaped == NULL || !shaped->SetPacked(SynetPacked(_shapes.Shared())))
+            {
+                delete shaped;
+                return false;
+            }
+            _shapes.Add(key, shaped);
+        }
+        _shapes.Select(shaped);
+        return true;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace Base
     {
         template<SimdConvolutionActivationType type, UpdateType update> void DirectConvolution(const float* src, const SimdConvolutionParameters& p,
@@ -138,6 +238,8 @@ namespace Simd
                 case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(_param, i, _convolution); break;
                 case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(_param, i, _convolution); break;
                 case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(_param, i, _convolution); break;
+                case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(_param, i, _convolution); break;
+                case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(_param, i, _convolution); break;
                 default: assert(0);
                 }
             }
@@ -148,11 +250,40 @@ namespace Simd
             return _sizeB[0] + _sizeB[1];
         }
 
+        void SynetMergedConvolution32f::Pack(SynetPack& pack)
+        {
+            const MergConvParam32f& p = _param;
+            for (size_t i = 0; i < p.count; ++i)
+            {
+                if (_rWeight[i].data)
+                    pack.Item(_weight[i], _rWeight[i].size, _rWeight[i]);
+                else
+                    pack.Item(_weight[i], p.conv[i].SizeW(), _pWeight[i]);
+                if (_rBias[i].data)
+                    pack.Item(_bias[i], _rBias[i].size, _rBias[i]);
+                else
+                    pack.Item(_bias[i], p.conv[i].dstC, _pBias[i]);
+                if (_rParams[i].data)
+                    pack.Item(_params[i], _rParams[i].size, _rParams[i]);
+                else
+                    pack.Item(_params[i], PackParamsSize(p.conv[i].activation, p.conv[i].dstC), _pParams[i]);
+            }
+        }
+
+        String SynetMergedConvolution32f::PackKey() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetMergedConvolution32f::PackKey();
+            if (_rWeight[0].data || _rWeight[1].data)
+                ss << "-" << _miC << "-" << _maC;
+            return ss.str();
+        }
+
         size_t SynetMergedConvolution32f::InternalBufferSize() const
         {
             size_t size = _buffer.size;
             for (size_t i = 0; i < _param.count; ++i)
-                size += _rWeight[i].size + _rBias[i].size + _rParams[i].size;
+                size += OwnedSize(_rWeight[i]) + OwnedSize(_rBias[i]) + OwnedSize(_rParams[i]);
             return size;
         }
 
@@ -229,6 +360,9 @@ namespace Simd
                     case SimdConvolutionActivationSwish:
                         _rParams[i].data[0] = params[i][0];
                         break;
+                    case SimdConvolutionActivationGelu:
+                    case SimdConvolutionActivationGeluTanh:
+                        break;
                     default:
                         assert(0);
                     }
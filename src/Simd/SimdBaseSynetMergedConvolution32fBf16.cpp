@@ -199,6 +199,8 @@ namespace Simd
                 case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(_param, i, _input, _depthwise, _output[0]); break;
                 case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(_param, i, _input, _depthwise, _output[0]); break;
                 case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(_param, i, _input, _depthwise, _output[0]); break;
+                case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(_param, i, _input, _depthwise, _output[0]); break;
+                case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(_param, i, _input, _depthwise, _output[0]); break;
                 default: assert(0);
                 }
             }
@@ -214,13 +216,32 @@ namespace Simd
 
         size_t SynetMergedConvolution32fBf16::InternalBufferSize() const
         {
-            size_t size = _buffer.size + _weightD.size;
-            size += (_weightI.size + _weightO.size) / 2;
+            size_t size = _buffer.size + OwnedSize(_weightD);
+            size += (OwnedSize(_weightI) + OwnedSize(_weightO)) / 2;
             for (size_t i = 0; i < _param.count; ++i)
-                size += _bias[i].size + _params[i].size;
+                size += OwnedSize(_bias[i]) + OwnedSize(_params[i]);
             return size;
         }
 
+        void SynetMergedConvolution32fBf16::Pack(SynetPack& pack)
+        {
+            pack.Item(_weightI);
+            pack.Item(_weightD);
+            pack.Item(_weightO);
+            for (size_t i = 0; i < _param.count; ++i)
+            {
+                pack.Item(_bias[i]);
+                pack.Item(_params[i]);
+            }
+        }
+
+        String SynetMergedConvolution32fBf16::PackKey() const
+        {
+            std::stringstream ss;
+            ss << Simd::SynetMergedConvolution32f::PackKey() << "-" << _alg.miC << "-" << _alg.maC;
+            return ss.str();
+        }
+
         void SynetMergedConvolution32fBf16::SetParams(const float* const* weight, SimdBool* internal, const float* const* bias, const float* const* params)
         {
             const MergConvParam32f& p = _param;
@@ -400,6 +421,9 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 dst.data[0] = src[0];
                 break;
+            case SimdConvolutionActivationGelu:
+            case SimdConvolutionActivationGeluTanh:
+                break;
             default:
                 assert(0);
             }
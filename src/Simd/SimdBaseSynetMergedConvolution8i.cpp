@@ -90,6 +90,8 @@ namespace Simd
             case SimdConvolutionActivationMish: _depthwise = DepthwiseConvolution<SimdConvolutionActivationMish>; break;
             case SimdConvolutionActivationHardSigmoid: _depthwise = DepthwiseConvolution<SimdConvolutionActivationHardSigmoid>; break;
             case SimdConvolutionActivationSwish: _depthwise = DepthwiseConvolution<SimdConvolutionActivationSwish>; break;
+            case SimdConvolutionActivationGelu: _depthwise = DepthwiseConvolution<SimdConvolutionActivationGelu>; break;
+            case SimdConvolutionActivationGeluTanh: _depthwise = DepthwiseConvolution<SimdConvolutionActivationGeluTanh>; break;
             default: assert(0);
             }
 
@@ -211,6 +213,9 @@ namespace Simd
                 case SimdConvolutionActivationSwish:
                     _params[i][0] = params[i][0];
                     break;
+                case SimdConvolutionActivationGelu:
+                case SimdConvolutionActivationGeluTanh:
+                    break;
                 default:
                     assert(0);
                 }
@@ -479,6 +484,12 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 SynetSwish32f(dst, sizeD, params, dst);
                 break;
+            case SimdConvolutionActivationGelu:
+                SynetGelu32f(dst, sizeD, dst);
+                break;
+            case SimdConvolutionActivationGeluTanh:
+                SynetGeluTanh32f(dst, sizeD, dst);
+                break;
             default:
                 assert(0);
             }
@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdArray.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetConvolution32f.h"
 
 namespace Simd
 {
@@ -126,6 +127,163 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            float _eps = eps[0], k = 1.0f / channels;
+            if (format == SimdTensorFormatNchw)
+            {
+                Array32f _buf;
+                if (buf == NULL)
+                {
+                    _buf.Resize(2 * spatial);
+                    buf = _buf.data;
+                }
+                float* mean = buf, * norm = buf + spatial;
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                        mean[s] = 0, norm[s] = 0;
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        for (size_t s = 0; s < spatial; ++s)
+                            mean[s] += ps[s];
+                    }
+                    for (size_t s = 0; s < spatial; ++s)
+                        mean[s] *= k;
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        for (size_t s = 0; s < spatial; ++s)
+                            norm[s] += Simd::Square(ps[s] - mean[s]);
+                    }
+                    for (size_t s = 0; s < spatial; ++s)
+                        norm[s] = 1.0f / ::sqrt(norm[s] * k + _eps);
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        for (size_t s = 0; s < spatial; ++s)
+                            dst[s] = (src[s] - mean[s]) * norm[s] * scale[c] + shift[c];
+                        dst += spatial;
+                        src += spatial;
+                    }
+                    ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+                }
+            }
+            else if (format == SimdTensorFormatNhwc)
+            {
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        float mean = 0, norm = 0;
+                        for (size_t c = 0; c < channels; ++c)
+                            mean += src[c];
+                        mean *= k;
+                        for (size_t c = 0; c < channels; ++c)
+                            norm += Simd::Square(src[c] - mean);
+                        norm = 1.0f / ::sqrt(norm * k + _eps);
+                        for (size_t c = 0; c < channels; ++c)
+                            dst[c] = (src[c] - mean) * norm * scale[c] + shift[c];
+                        ConvolutionBiasAndActivation(NULL, channels, 1, activation, params, SimdTrue, dst);
+                        dst += channels;
+                        src += channels;
+                    }
+                }
+            }
+            else
+                assert(0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            assert(channels % groups == 0);
+            size_t gC = channels / groups, gS = gC * spatial;
+            float _eps = eps[0], k = 1.0f / gS;
+            if (format == SimdTensorFormatNchw)
+            {
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t g = 0; g < groups; ++g)
+                    {
+                        float mean = 0, norm = 0;
+                        for (size_t i = 0; i < gS; ++i)
+                            mean += src[i];
+                        mean *= k;
+                        for (size_t i = 0; i < gS; ++i)
+                            norm += Simd::Square(src[i] - mean);
+                        norm = 1.0f / ::sqrt(norm * k + _eps);
+                        for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        {
+                            float _scale = norm * scale[c], _shift = shift[c] - mean * _scale;
+                            for (size_t s = 0; s < spatial; ++s)
+                                dst[s] = src[s] * _scale + _shift;
+                            dst += spatial;
+                            src += spatial;
+                        }
+                    }
+                    ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+                }
+            }
+            else if (format == SimdTensorFormatNhwc)
+            {
+                Array32f _buf;
+                if (buf == NULL)
+                {
+                    _buf.Resize(3 * channels);
+                    buf = _buf.data;
+                }
+                float* sum = buf, * _scale = buf + channels, * _shift = buf + 2 * channels;
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        sum[c] = 0;
+                    for (size_t s = 0; s < spatial; ++s)
+                        for (size_t c = 0; c < channels; ++c)
+                            sum[c] += src[s * channels + c];
+                    for (size_t g = 0; g < groups; ++g)
+                    {
+                        float mean = 0;
+                        for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                            mean += sum[c];
+                        mean *= k;
+                        for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                            _shift[c] = mean, sum[c] = 0;
+                    }
+                    for (size_t s = 0; s < spatial; ++s)
+                        for (size_t c = 0; c < channels; ++c)
+                            sum[c] += Simd::Square(src[s * channels + c] - _shift[c]);
+                    for (size_t g = 0; g < groups; ++g)
+                    {
+                        float norm = 0;
+                        for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                            norm += sum[c];
+                        norm = 1.0f / ::sqrt(norm * k + _eps);
+                        for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        {
+                            _scale[c] = norm * scale[c];
+                            _shift[c] = shift[c] - _shift[c] * _scale[c];
+                        }
+                    }
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        for (size_t c = 0; c < channels; ++c)
+                            dst[c] = src[c] * _scale[c] + _shift[c];
+                        dst += channels;
+                        src += channels;
+                    }
+                    ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdTrue, dst - channels * spatial);
+                }
+            }
+            else
+                assert(0);
+        }
     }
 #endif
 }
@@ -173,6 +173,7 @@ namespace Simd
                 return GetPermute<uint8_t>(count);
             case SimdTensorData16b:
             case SimdTensorData16f:
+            case SimdTensorData16u:
                 return GetPermute<uint16_t>(count);
             default:
                 return NULL;
@@ -0,0 +1,224 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetRoi.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <float.h>
+#include <vector>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        static void RoiAlignSamples(size_t srcH, size_t srcW, const float* roi, float spatialScale, size_t samplingRatio, SimdBool aligned,
+            size_t dstH, size_t dstW, std::vector<RoiAlignSample>& samples, size_t& grid)
+        {
+            float offset = aligned ? 0.5f : 0.0f;
+            float roiX = roi[0] * spatialScale - offset, roiY = roi[1] * spatialScale - offset;
+            float roiW = roi[2] * spatialScale - offset - roiX, roiH = roi[3] * spatialScale - offset - roiY;
+            if (!aligned)
+            {
+                roiW = Simd::Max(roiW, 1.0f);
+                roiH = Simd::Max(roiH, 1.0f);
+            }
+            float binH = roiH / float(dstH), binW = roiW / float(dstW);
+            size_t gridH = samplingRatio ? samplingRatio : Simd::Max<size_t>((size_t)::ceil(binH), 1);
+            size_t gridW = samplingRatio ? samplingRatio : Simd::Max<size_t>((size_t)::ceil(binW), 1);
+            grid = gridH * gridW;
+            samples.resize(dstH * dstW * grid);
+            float norm = 1.0f / float(grid);
+            RoiAlignSample* sample = samples.data();
+            for (size_t ph = 0; ph < dstH; ++ph)
+            {
+                for (size_t pw = 0; pw < dstW; ++pw)
+                {
+                    for (size_t iy = 0; iy < gridH; ++iy)
+                    {
+                        float y = roiY + float(ph) * binH + (float(iy) + 0.5f) * binH / float(gridH);
+                        for (size_t ix = 0; ix < gridW; ++ix, ++sample)
+                        {
+                            float x = roiX + float(pw) * binW + (float(ix) + 0.5f) * binW / float(gridW);
+                            if (y < -1.0f || y > float(srcH) || x < -1.0f || x > float(srcW))
+                            {
+                                for (size_t k = 0; k < 4; ++k)
+                                    sample->offset[k] = 0, sample->weight[k] = 0.0f;
+                                continue;
+                            }
+                            float sy = Simd::Max(y, 0.0f), sx = Simd::Max(x, 0.0f);
+                            size_t y0 = (size_t)sy, x0 = (size_t)sx, y1, x1;
+                            if (y0 >= srcH - 1)
+                                y0 = y1 = srcH - 1, sy = float(y0);
+                            else
+                                y1 = y0 + 1;
+                            if (x0 >= srcW - 1)
+                                x0 = x1 = srcW - 1, sx = float(x0);
+                            else
+                                x1 = x0 + 1;
+                            float ly = sy - float(y0), lx = sx - float(x0), hy = 1.0f - ly, hx = 1.0f - lx;
+                            sample->offset[0] = y0 * srcW + x0;
+                            sample->offset[1] = y0 * srcW + x1;
+                            sample->offset[2] = y1 * srcW + x0;
+                            sample->offset[3] = y1 * srcW + x1;
+                            sample->weight[0] = hy * hx * norm;
+                            sample->weight[1] = hy * lx * norm;
+                            sample->weight[2] = ly * hx * norm;
+                            sample->weight[3] = ly * lx * norm;
+                        }
+                    }
+                }
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format, RoiAlignNhwcPtr nhwc)
+        {
+            size_t dstSize = srcC * dstH * dstW, srcS = srcH * srcW, dstS = dstH * dstW;
+            size_t threads = Simd::Max<size_t>(Simd::Min(Base::GetThreadNumber(), roiCount), 1);
+            Simd::Parallel(0, roiCount, [&](size_t thread, size_t begin, size_t end)
+            {
+                std::vector<RoiAlignSample> samples;
+                size_t grid;
+                for (size_t r = begin; r < end; ++r)
+                {
+                    RoiAlignSamples(srcH, srcW, rois + r * 4, spatialScale, samplingRatio, aligned, dstH, dstW, samples, grid);
+                    float* pDst = dst + r * dstSize;
+                    if (format == SimdTensorFormatNhwc)
+                    {
+                        for (size_t i = 0; i < dstS; ++i)
+                            nhwc(src, srcC, samples.data() + i * grid, grid, pDst + i * srcC);
+                    }
+                    else
+                    {
+                        for (size_t c = 0; c < srcC; ++c)
+                        {
+                            const float* pSrc = src + c * srcS;
+                            const RoiAlignSample* sample = samples.data();
+                            for (size_t i = 0; i < dstS; ++i)
+                            {
+                                float sum = 0.0f;
+                                for (size_t s = 0; s < grid; ++s, ++sample)
+                                    for (size_t k = 0; k < 4; ++k)
+                                        sum += sample->weight[k] * pSrc[sample->offset[k]];
+                                pDst[i] = sum;
+                            }
+                            pDst += dstS;
+                        }
+                    }
+                }
+            }, threads);
+        }
+
+        static void RoiAlignNhwc(const float* src, size_t channels, const RoiAlignSample* samples, size_t count, float* dst)
+        {
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = 0.0f;
+            for (size_t s = 0; s < count; ++s)
+            {
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const float* ps = src + samples[s].offset[k] * channels;
+                    float w = samples[s].weight[k];
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] += w * ps[c];
+                }
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            SynetRoiAlign32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, samplingRatio, aligned, dst, dstH, dstW, format, RoiAlignNhwc);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetRoiPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format, RoiPoolingMaxNhwcPtr nhwc)
+        {
+            size_t dstSize = srcC * dstH * dstW, srcS = srcH * srcW, dstS = dstH * dstW;
+            size_t threads = Simd::Max<size_t>(Simd::Min(Base::GetThreadNumber(), roiCount), 1);
+            Simd::Parallel(0, roiCount, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t r = begin; r < end; ++r)
+                {
+                    const float* roi = rois + r * 4;
+                    int roiX = Round(roi[0] * spatialScale), roiY = Round(roi[1] * spatialScale);
+                    int roiW = Simd::Max(Round(roi[2] * spatialScale) - roiX + 1, 1);
+                    int roiH = Simd::Max(Round(roi[3] * spatialScale) - roiY + 1, 1);
+                    float binH = float(roiH) / float(dstH), binW = float(roiW) / float(dstW);
+                    float* pDst = dst + r * dstSize;
+                    for (size_t ph = 0; ph < dstH; ++ph)
+                    {
+                        size_t y0 = Simd::RestrictRange((int)::floor(float(ph) * binH) + roiY, 0, (int)srcH);
+                        size_t y1 = Simd::RestrictRange((int)::ceil(float(ph + 1) * binH) + roiY, 0, (int)srcH);
+                        for (size_t pw = 0; pw < dstW; ++pw)
+                        {
+                            size_t x0 = Simd::RestrictRange((int)::floor(float(pw) * binW) + roiX, 0, (int)srcW);
+                            size_t x1 = Simd::RestrictRange((int)::ceil(float(pw + 1) * binW) + roiX, 0, (int)srcW);
+                            if (format == SimdTensorFormatNhwc)
+                                nhwc(src, srcW, srcC, y0, y1, x0, x1, pDst + (ph * dstW + pw) * srcC);
+                            else
+                            {
+                                for (size_t c = 0; c < srcC; ++c)
+                                {
+                                    const float* pSrc = src + c * srcS;
+                                    float max = y0 < y1 && x0 < x1 ? -FLT_MAX : 0.0f;
+                                    for (size_t y = y0; y < y1; ++y)
+                                        for (size_t x = x0; x < x1; ++x)
+                                            max = Simd::Max(max, pSrc[y * srcW + x]);
+                                    pDst[c * dstS + ph * dstW + pw] = max;
+                                }
+                            }
+                        }
+                    }
+                }
+            }, threads);
+        }
+
+        static void RoiPoolingMaxNhwc(const float* src, size_t srcW, size_t channels, size_t y0, size_t y1, size_t x0, size_t x1, float* dst)
+        {
+            float init = y0 < y1 && x0 < x1 ? -FLT_MAX : 0.0f;
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = init;
+            for (size_t y = y0; y < y1; ++y)
+            {
+                for (size_t x = x0; x < x1; ++x)
+                {
+                    const float* ps = src + (y * srcW + x) * channels;
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = Simd::Max(dst[c], ps[c]);
+                }
+            }
+        }
+
+        void SynetRoiPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            SynetRoiPoolingMax32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, dst, dstH, dstW, format, RoiPoolingMaxNhwc);
+        }
+    }
+#endif
+}
@@ -131,6 +131,177 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
+        {
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max = src[0];
+                    for (size_t c = 1; c < count; ++c)
+                        max = Simd::Max(max, src[c]);
+                    float sum = 0;
+                    for (size_t c = 0; c < count; ++c)
+                        sum += ::exp(src[c] - max);
+                    float shift = max + ::log(sum);
+                    for (size_t c = 0; c < count; ++c)
+                        dst[c] = src[c] - shift;
+                    src += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                Array32f tmp(inner * 2);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner, * d;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    for (size_t i = 0; i < inner; ++i)
+                        max[i] = src[i], sum[i] = 0;
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                            max[i] = Simd::Max(max[i], s[i]);
+                        s += inner;
+                    }
+
+                    s = src;
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                            sum[i] += ::exp(s[i] - max[i]);
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        max[i] += ::log(sum[i]);
+
+                    s = src;
+                    d = dst;
+                    for (size_t c = 0; c < count; ++c)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                            d[i] = s[i] - max[i];
+                        s += inner;
+                        d += inner;
+                    }
+                    src += count * inner;
+                    dst += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetSoftmaxArgMax32f(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob)
+        {
+            if (inner == 1)
+            {
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    float max = src[0];
+                    size_t idx = 0;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        if (src[c] > max)
+                        {
+                            max = src[c];
+                            idx = c;
+                        }
+                    }
+                    SynetSoftmaxArgMaxStore(idx, indexType, index, o);
+                    if (prob)
+                    {
+                        float sum = 0;
+                        for (size_t c = 0; c < count; ++c)
+                            sum += ::exp(src[c] - max);
+                        prob[o] = 1.0f / sum;
+                    }
+                    src += count;
+                }
+            }
+            else
+            {
+                Array32f tmp(inner * 2);
+                Array32i idx(inner);
+                const float* s;
+                float* max = tmp.data, * sum = tmp.data + inner;
+                for (size_t o = 0; o < outer; ++o)
+                {
+                    for (size_t i = 0; i < inner; ++i)
+                        max[i] = src[i], idx[i] = 0;
+                    s = src + inner;
+                    for (size_t c = 1; c < count; ++c)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                        {
+                            if (s[i] > max[i])
+                            {
+                                max[i] = s[i];
+                                idx[i] = (int32_t)c;
+                            }
+                        }
+                        s += inner;
+                    }
+                    for (size_t i = 0; i < inner; ++i)
+                        SynetSoftmaxArgMaxStore(idx[i], indexType, index, o * inner + i);
+                    if (prob)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                            sum[i] = 0;
+                        s = src;
+                        for (size_t c = 0; c < count; ++c)
+                        {
+                            for (size_t i = 0; i < inner; ++i)
+                                sum[i] += ::exp(s[i] - max[i]);
+                            s += inner;
+                        }
+                        for (size_t i = 0; i < inner; ++i)
+                            prob[o * inner + i] = 1.0f / sum[i];
+                    }
+                    src += count * inner;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void SynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob)
+        {
+            Array32f buf(inner > 1 ? count : 0), val(k);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    const float* row = src + i;
+                    if (inner > 1)
+                    {
+                        for (size_t c = 0; c < count; ++c)
+                            buf[c] = row[c * inner];
+                        row = buf.data;
+                    }
+                    size_t size = 0;
+                    for (size_t c = 0; c < count; ++c)
+                        if (size < k || row[c] > val[k - 1])
+                            SynetSoftmaxTopKInsert(row[c], (uint32_t)c, k, size, val.data, index);
+                    if (prob)
+                    {
+                        float sum = 0;
+                        for (size_t c = 0; c < count; ++c)
+                            sum += ::exp(row[c] - val[0]);
+                        for (size_t j = 0; j < k; ++j)
+                            prob[j] = ::exp(val[j] - val[0]) / sum;
+                        prob += k;
+                    }
+                    index += k;
+                }
+                src += count * inner;
+            }
+        }
     }
 #endif
 }
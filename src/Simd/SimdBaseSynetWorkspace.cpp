@@ -0,0 +1,155 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetWorkspace.h"
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetDeconvolution8i.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdSynetMergedConvolution32f.h"
+#include "Simd/SimdSynetMergedConvolution8i.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        SynetWorkspace::SynetWorkspace()
+            : _size(0)
+            , _planned(true)
+        {
+        }
+
+        size_t SynetWorkspace::AddContext(SimdSynetContextType type, const void* context, size_t step)
+        {
+            size_t size = 0;
+            switch (type)
+            {
+            case SimdSynetContextAttention32f:
+                size = ((Simd::SynetAttention32f*)context)->ExternalBufferSize() * sizeof(float);
+                break;
+            case SimdSynetContextConvolution32f:
+                size = ((SynetConvolution32f*)context)->Shaped()->ExternalBufferSize() * sizeof(float);
+                break;
+            case SimdSynetContextConvolution8i:
+                size = ((SynetConvolution8i*)context)->ExternalBufferSize();
+                break;
+            case SimdSynetContextDeconvolution32f:
+                size = ((SynetDeconvolution32f*)context)->Shaped()->ExternalBufferSize() * sizeof(float);
+                break;
+            case SimdSynetContextDeconvolution8i:
+                size = ((SynetDeconvolution8i*)context)->ExternalBufferSize();
+                break;
+            case SimdSynetContextInnerProduct8i:
+                size = ((Simd::SynetInnerProduct8i*)context)->ExternalBufferSize();
+                break;
+            case SimdSynetContextMergedConvolution32f:
+                size = ((Simd::SynetMergedConvolution32f*)context)->Shaped()->ExternalBufferSize() * sizeof(float);
+                break;
+            case SimdSynetContextMergedConvolution8i:
+                size = ((Simd::SynetMergedConvolution8i*)context)->ExternalBufferSize();
+                break;
+            case SimdSynetContextInnerProduct32f:
+            case SimdSynetContextPermute:
+            case SimdSynetContextScale8i:
+                break;
+            default:
+                assert(0);
+            }
+            return AddBuffer(size, step, step);
+        }
+
+        size_t SynetWorkspace::AddBuffer(size_t size, size_t first, size_t last)
+        {
+            assert(first <= last);
+            Buffer buffer;
+            buffer.size = AlignHi(size, SIMD_ALIGN);
+            buffer.first = first;
+            buffer.last = last;
+            buffer.offset = 0;
+            _buffers.push_back(buffer);
+            _planned = false;
+            return _buffers.size() - 1;
+        }
+
+        size_t SynetWorkspace::Size()
+        {
+            if (!_planned)
+                Plan();
+            return _size;
+        }
+
+        size_t SynetWorkspace::Offset(size_t index)
+        {
+            assert(index < _buffers.size());
+            if (!_planned)
+                Plan();
+            return index < _buffers.size() ? _buffers[index].offset : 0;
+        }
+
+        void SynetWorkspace::Plan()
+        {
+            std::vector<size_t> order(_buffers.size()), placed;
+            for (size_t i = 0; i < order.size(); ++i)
+                order[i] = i;
+            std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) { return _buffers[a].size > _buffers[b].size; });
+            _size = 0;
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                Buffer& buffer = _buffers[order[i]];
+                std::vector<const Buffer*> alive;
+                for (size_t j = 0; j < placed.size(); ++j)
+                {
+                    const Buffer& other = _buffers[placed[j]];
+                    if (other.first <= buffer.last && buffer.first <= other.last)
+                        alive.push_back(&other);
+                }
+                std::sort(alive.begin(), alive.end(), [](const Buffer* a, const Buffer* b) { return a->offset < b->offset; });
+                size_t offset = 0;
+                for (size_t j = 0; j < alive.size(); ++j)
+                {
+                    if (alive[j]->offset >= offset + buffer.size)
+                        break;
+                    offset = Simd::Max(offset, alive[j]->offset + alive[j]->size);
+                }
+                buffer.offset = offset;
+                _size = Simd::Max(_size, offset + buffer.size);
+                if (buffer.size)
+                    placed.push_back(order[i]);
+            }
+            _planned = true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetWorkspaceInit()
+        {
+            return new SynetWorkspace();
+        }
+    }
+#endif
+}
@@ -29,6 +29,8 @@
 #include "Simd/SimdPoint.hpp"
 #include "Simd/SimdParallel.hpp"
 
+#include <algorithm>
+
 namespace Simd
 {
     static SIMD_INLINE void SetInv(const float * mat, float * inv)
@@ -76,6 +78,19 @@ namespace Simd
     {
     }
 
+    bool WarpAffine::SetMatrix(const float* mat)
+    {
+        memcpy(_param.mat, mat, 6 * sizeof(float));
+        SetInv(_param.mat, _param.inv);
+        _first = true;
+        return _param.Valid();
+    }
+
+    void WarpAffine::SetThreads(size_t threads)
+    {
+        _threads = Simd::Max<size_t>(threads, 1);
+    }
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
@@ -372,6 +387,66 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, WarpAffineInitPtr init)
+            : _param(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            const WarpAffParam& p = _param;
+            _workers.resize(Simd::Max<size_t>(_threads, 1), NULL);
+            for (size_t i = 0; i < _workers.size(); ++i)
+            {
+                _workers[i] = (WarpAffine*)init(p.srcW, p.srcH, p.srcS, p.dstW, p.dstH, p.dstS, p.channels, p.mat, p.flags, p.border);
+                _workers[i]->SetThreads(1);
+            }
+        }
+
+        WarpAffineBatch::~WarpAffineBatch()
+        {
+            for (size_t i = 0; i < _workers.size(); ++i)
+                delete _workers[i];
+        }
+
+        bool WarpAffineBatch::Run(const uint8_t* src, size_t count, const float* mats, uint8_t** dst)
+        {
+            const WarpAffParam& p = _param;
+            float cx = float(p.dstW) * 0.5f, cy = float(p.dstH) * 0.5f, inv[6];
+            _order.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                SetInv(mats + i * 6, inv);
+                _order[i].first = cx * inv[3] + cy * inv[4] + inv[5];
+                _order[i].second = i;
+            }
+            std::stable_sort(_order.begin(), _order.end(), [](const std::pair<float, size_t>& a, const std::pair<float, size_t>& b) { return a.first < b.first; });
+
+            std::vector<uint8_t> valid(count, 1);
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                WarpAffine* worker = _workers[thread];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t index = _order[i].second;
+                    if (worker->SetMatrix(mats + index * 6))
+                        worker->Run(src, dst[index]);
+                    else
+                    {
+                        valid[index] = 0;
+                        if (p.NeedFill())
+                            FillPixel(dst[index], p.dstS, p.dstW, p.dstH, p.border, p.PixelSize());
+                    }
+                }
+            }, _workers.size(), 1);
+            return std::find(valid.begin(), valid.end(), 0) == valid.end();
+        }
+
+        const float* WarpAffineBatch::Identity()
+        {
+            static const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            return identity;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
         {
             WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, 1);
@@ -384,5 +459,13 @@ namespace Simd
             else
                 return NULL;
         }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, WarpAffineBatch::Identity(), flags, border, 1);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new WarpAffineBatch(param, WarpAffineInit);
+        }
     }
 }
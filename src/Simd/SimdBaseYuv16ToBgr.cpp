@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE int Yuv16ToYuv8(int value, int shift)
+        {
+            return Min(value >> shift, 255);
+        }
+
+        template <class T, size_t N> SIMD_INLINE void Yuv8ToBgr(int y, int u, int v, int alpha, uint8_t* dst)
+        {
+            dst[0] = YuvToBlue<T>(y, u);
+            dst[1] = YuvToGreen<T>(y, u, v);
+            dst[2] = YuvToRed<T>(y, v);
+            if (N == 4)
+                dst[3] = alpha;
+        }
+
+        template <class T, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t uvStep, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, int alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (const uint16_t*)y, * y1 = (const uint16_t*)(y + yStride);
+                const uint16_t* u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+                uint8_t* dst0 = dst, * dst1 = dst + dstStride;
+                for (size_t colY = 0, colUV = 0; colY < width; colY += 2, colUV += uvStep)
+                {
+                    int _u = Yuv16ToYuv8(u16[colUV], shift);
+                    int _v = Yuv16ToYuv8(v16[colUV], shift);
+                    Yuv8ToBgr<T, N>(Yuv16ToYuv8(y0[colY + 0], shift), _u, _v, alpha, dst0 + (colY + 0) * N);
+                    Yuv8ToBgr<T, N>(Yuv16ToYuv8(y0[colY + 1], shift), _u, _v, alpha, dst0 + (colY + 1) * N);
+                    Yuv8ToBgr<T, N>(Yuv16ToYuv8(y1[colY + 0], shift), _u, _v, alpha, dst1 + (colY + 0) * N);
+                    Yuv8ToBgr<T, N>(Yuv16ToYuv8(y1[colY + 1], shift), _u, _v, alpha, dst1 + (colY + 1) * N);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t uvStep, size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, int alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgr<Bt601, N>(y, yStride, u, uStride, v, vStride, uvStep, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgr<Bt709, N>(y, yStride, u, uStride, v, vStride, uvStep, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420p16ToBgr<Bt2020, N>(y, yStride, u, uStride, v, vStride, uvStep, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv420p16ToBgr<Trect871, N>(y, yStride, u, uStride, v, vStride, uvStep, width, height, shift, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv420p16ToBgr<3>(y, yStride, u, uStride, v, vStride, 1, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv420p16ToBgr<4>(y, yStride, u, uStride, v, vStride, 1, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<3>(y, yStride, uv, uvStride, uv + 2, uvStride, 2, width, height, 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<4>(y, yStride, uv, uvStride, uv + 2, uvStride, 2, width, height, 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template <class T, size_t N> void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, int alpha)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+                for (size_t col = 0; col < width; ++col)
+                    Yuv8ToBgr<T, N>(Yuv16ToYuv8(y16[col], shift), Yuv16ToYuv8(u16[col], shift), Yuv16ToYuv8(v16[col], shift), alpha, dst + col * N);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                dst += dstStride;
+            }
+        }
+
+        template <size_t N> void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int shift, uint8_t* dst, size_t dstStride, int alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv444p16ToBgr<Bt601, N>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv444p16ToBgr<Bt709, N>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv444p16ToBgr<Bt2020, N>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv444p16ToBgr<Trect871, N>(y, yStride, u, uStride, v, vStride, width, height, shift, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv444p16ToBgr<3>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv444p16ToBgr<4>(y, yStride, u, uStride, v, vStride, width, height, bitDepth - 8, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void Yuv420p16ToBgr32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t uvStep,
+            size_t width, size_t height, int shift, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0));
+            Yuv16ToBgr32fParam param(shift, yuvType);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    size_t colUV = (col >> 1) * uvStep;
+                    Yuv16ToBgr32f(y16[col], u16[colUV], v16[colUV], param, blue + col, green + col, red + col);
+                }
+                y += yStride;
+                if (row & 1)
+                {
+                    u += uStride;
+                    v += vStride;
+                }
+                blue += dstStride;
+                green += dstStride;
+                red += dstStride;
+            }
+        }
+
+        void Yuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv420p16ToBgr32f(y, yStride, u, uStride, v, vStride, 1, width, height, bitDepth - 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void P010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr32f(y, yStride, uv, uvStride, uv + 2, uvStride, 2, width, height, 8, blue, green, red, dstStride, yuvType);
+        }
+
+        void Yuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+        {
+            assert(bitDepth >= 8 && bitDepth <= 16);
+            Yuv16ToBgr32fParam param(bitDepth - 8, yuvType);
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint16_t* y16 = (const uint16_t*)y, * u16 = (const uint16_t*)u, * v16 = (const uint16_t*)v;
+                for (size_t col = 0; col < width; ++col)
+                    Yuv16ToBgr32f(y16[col], u16[col], v16[col], param, blue + col, green + col, red + col);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                blue += dstStride;
+                green += dstStride;
+                red += dstStride;
+            }
+        }
+    }
+}
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <memory>
 
 #include <limits.h>
@@ -623,15 +624,25 @@ namespace Simd
                 nodes[i][RANK] = 0;
             }
 
+            std::vector<int> order(N);
             for (i = 0; i < N; i++)
+                order[i] = i;
+            std::sort(order.begin(), order.end(), [&vec](int a, int b) { return vec[a].rect.left < vec[b].rect.left; });
+
+            for (int o = 0; o < N; o++)
             {
+                i = order[o];
+                const Rect & r = vec[i].rect;
+                double range = sizeDifferenceMax * (r.Width() + r.Height()) * 0.5;
+
                 int root = i;
                 while (nodes[root][PARENT] >= 0)
                     root = nodes[root][PARENT];
 
-                for (j = 0; j < N; j++)
+                for (int p = o + 1; p < N && vec[order[p]].rect.left - r.left <= range; p++)
                 {
-                    if (i == j || !similar(vec[i], vec[j]))
+                    j = order[p];
+                    if (!similar(vec[i], vec[j]))
                         continue;
                     int root2 = j;
 
@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDistance_h__
+#define __SimdDistance_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdFloat16.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef void(*DistanceDotsPtr)(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, float* dots);
+        typedef void(*DistanceSquaresPtr)(size_t N, size_t K, const uint8_t* B, size_t ldb, float* squares);
+
+        SIMD_INLINE float DistanceValue(float value)
+        {
+            return value;
+        }
+
+        SIMD_INLINE float DistanceValue(uint16_t value)
+        {
+            return Float16ToFloat32(value);
+        }
+
+        SIMD_INLINE float DistanceValue(int8_t value)
+        {
+            return float(value);
+        }
+
+        void DistancesTopK(size_t M, size_t N, size_t K, const float* A, const uint8_t* B, size_t ldb, const float* scales, 
+            SimdDistanceType type, size_t top, uint32_t* indices, float* distances, DistanceDotsPtr dots, DistanceSquaresPtr squares);
+
+        //-------------------------------------------------------------------------------------------------
+
+        const size_t INT8_QUANTIZED_HEADER = 2 * sizeof(float);
+
+        typedef void(*Int8QuantizedDotsPtr)(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, int32_t* dots);
+        typedef void(*Int8QuantizedStatsPtr)(size_t K, const uint8_t* a, int32_t* sum, int32_t* squares);
+
+        SIMD_INLINE float Int8QuantizedDistance(SimdDistanceType type, size_t K, const uint8_t* a, const int32_t* as, const uint8_t* b, const int32_t* bs, int32_t ab)
+        {
+            double aScale = ((float*)a)[0], aShift = ((float*)a)[1];
+            double bScale = ((float*)b)[0], bShift = ((float*)b)[1];
+            double dab = aScale * bScale * ab + aScale * bShift * as[0] + aShift * bScale * bs[0] + aShift * bShift * K;
+            if (type == SimdDistanceInnerProduct)
+                return float(-dab);
+            double daa = aScale * aScale * as[1] + 2.0 * aScale * aShift * as[0] + aShift * aShift * K;
+            double dbb = bScale * bScale * bs[1] + 2.0 * bScale * bShift * bs[0] + bShift * bShift * K;
+            if (type == SimdDistanceCosine)
+                return daa * dbb > 0.0 ? float(1.0 - dab / ::sqrt(daa * dbb)) : 1.0f;
+            return float(Simd::Max(daa + dbb - 2.0 * dab, 0.0));
+        }
+
+        void Int8QuantizedDistances(size_t M, size_t N, size_t K, const uint8_t* const* A, const uint8_t* const* B, SimdDistanceType type, float* distances,
+            Int8QuantizedDotsPtr dots, Int8QuantizedStatsPtr stats);
+    }
+}
+
+#endif//__SimdDistance_h__
@@ -204,6 +204,34 @@ namespace Simd
             __m128 exp = Detail::Exp2(_mm_mul_ps(_mm_set1_ps(2.88539008f), value));
             return _mm_div_ps(_mm_sub_ps(exp, _1), _mm_add_ps(_1, exp));
         }
+
+        SIMD_INLINE __m128 Erf(__m128 value)
+        {
+            __m128 sign = _mm_and_ps(_mm_set1_ps(-0.0f), value);
+            __m128 x = _mm_xor_ps(value, sign);
+            __m128 t = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.3275911f), x)));
+            __m128 p = _mm_set1_ps(1.061405429f);
+            p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-1.453152027f));
+            p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(1.421413741f));
+            p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(-0.284496736f));
+            p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(0.254829592f));
+            __m128 exp = Exponent(_mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(x, x)));
+            __m128 erf = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(p, t), exp));
+            return _mm_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m128 Gelu(__m128 value)
+        {
+            __m128 erf = Erf(_mm_mul_ps(value, _mm_set1_ps(0.70710678f)));
+            return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), value), _mm_add_ps(_mm_set1_ps(1.0f), erf));
+        }
+
+        SIMD_INLINE __m128 GeluTanh(__m128 value)
+        {
+            __m128 arg = _mm_mul_ps(value, _mm_add_ps(_mm_set1_ps(1.5957691f), _mm_mul_ps(_mm_set1_ps(0.0713548f), _mm_mul_ps(value, value))));
+            __m128 exp = Exponent(_mm_sub_ps(_mm_setzero_ps(), arg));
+            return _mm_div_ps(value, _mm_add_ps(_mm_set1_ps(1.0f), exp));
+        }
     }
 #endif //SIMD_SSE41_ENABLE   
 
@@ -369,6 +397,34 @@ namespace Simd
             __m256 exp = Detail::Exp2(_mm256_mul_ps(_mm256_set1_ps(2.88539008f), value));
             return _mm256_div_ps(_mm256_sub_ps(exp, _1), _mm256_add_ps(_1, exp));
         }
+
+        SIMD_INLINE __m256 Erf(__m256 value)
+        {
+            __m256 sign = _mm256_and_ps(_mm256_set1_ps(-0.0f), value);
+            __m256 x = _mm256_xor_ps(value, sign);
+            __m256 t = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_fmadd_ps(_mm256_set1_ps(0.3275911f), x, _mm256_set1_ps(1.0f)));
+            __m256 p = _mm256_set1_ps(1.061405429f);
+            p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(-1.453152027f));
+            p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(1.421413741f));
+            p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(-0.284496736f));
+            p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(0.254829592f));
+            __m256 exp = Exponent(_mm256_fnmadd_ps(x, x, _mm256_setzero_ps()));
+            __m256 erf = _mm256_fnmadd_ps(_mm256_mul_ps(p, t), exp, _mm256_set1_ps(1.0f));
+            return _mm256_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m256 Gelu(__m256 value)
+        {
+            __m256 erf = Erf(_mm256_mul_ps(value, _mm256_set1_ps(0.70710678f)));
+            return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), value), _mm256_add_ps(_mm256_set1_ps(1.0f), erf));
+        }
+
+        SIMD_INLINE __m256 GeluTanh(__m256 value)
+        {
+            __m256 arg = _mm256_mul_ps(value, _mm256_fmadd_ps(_mm256_set1_ps(0.0713548f), _mm256_mul_ps(value, value), _mm256_set1_ps(1.5957691f)));
+            __m256 exp = Exponent(_mm256_sub_ps(_mm256_setzero_ps(), arg));
+            return _mm256_div_ps(value, _mm256_add_ps(_mm256_set1_ps(1.0f), exp));
+        }
     }
 #endif //SIMD_AVX2_ENABLE
 
@@ -534,6 +590,34 @@ namespace Simd
             __m512 exp = Detail::Exp2(_mm512_mul_ps(_mm512_set1_ps(2.88539008f), value));
             return _mm512_div_ps(_mm512_sub_ps(exp, _1), _mm512_add_ps(_1, exp));
         }
+
+        SIMD_INLINE __m512 Erf(__m512 value)
+        {
+            __m512 sign = _mm512_and_ps(_mm512_set1_ps(-0.0f), value);
+            __m512 x = _mm512_xor_ps(value, sign);
+            __m512 t = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_fmadd_ps(_mm512_set1_ps(0.3275911f), x, _mm512_set1_ps(1.0f)));
+            __m512 p = _mm512_set1_ps(1.061405429f);
+            p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(-1.453152027f));
+            p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(1.421413741f));
+            p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(-0.284496736f));
+            p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(0.254829592f));
+            __m512 exp = Exponent(_mm512_fnmadd_ps(x, x, _mm512_setzero_ps()));
+            __m512 erf = _mm512_fnmadd_ps(_mm512_mul_ps(p, t), exp, _mm512_set1_ps(1.0f));
+            return _mm512_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m512 Gelu(__m512 value)
+        {
+            __m512 erf = Erf(_mm512_mul_ps(value, _mm512_set1_ps(0.70710678f)));
+            return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), value), _mm512_add_ps(_mm512_set1_ps(1.0f), erf));
+        }
+
+        SIMD_INLINE __m512 GeluTanh(__m512 value)
+        {
+            __m512 arg = _mm512_mul_ps(value, _mm512_fmadd_ps(_mm512_set1_ps(0.0713548f), _mm512_mul_ps(value, value), _mm512_set1_ps(1.5957691f)));
+            __m512 exp = Exponent(_mm512_sub_ps(_mm512_setzero_ps(), arg));
+            return _mm512_div_ps(value, _mm512_add_ps(_mm512_set1_ps(1.0f), exp));
+        }
     }
 #endif
 
@@ -863,38 +863,20 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToRgb(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Rgba32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr);
-                BgrToRgba(bgr, dst.planes[0]);
+                Nv12ToRgba(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             default:
                 assert(0);
             }
@@ -935,12 +917,8 @@ namespace Simd
             switch (dst.format)
             {
             case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgraToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgraToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
                 break;
-            }
             case Frame<A>::Yuv420p:
                 BgraToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -965,12 +943,8 @@ namespace Simd
             switch (dst.format)
             {
             case Frame<A>::Nv12:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(src.planes[0], dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgrToNv12(src.planes[0], dst.planes[0], dst.planes[1]);
                 break;
-            }
             case Frame<A>::Yuv420p:
                 BgrToYuv420p(src.planes[0], dst.planes[0], dst.planes[1], dst.planes[2]);
                 break;
@@ -1027,9 +1001,7 @@ namespace Simd
             {
                 View<A> bgr(src.Size(), View<A>::Bgr24);
                 RgbToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(bgr, dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgrToNv12(bgr, dst.planes[0], dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
@@ -1063,9 +1035,7 @@ namespace Simd
             {
                 View<A> bgr(src.Size(), View<A>::Bgr24);
                 RgbaToBgr(src.planes[0], bgr);
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                BgrToYuv420p(bgr, dst.planes[0], u, v);
-                InterleaveUv(u, v, dst.planes[1]);
+                BgrToNv12(bgr, dst.planes[0], dst.planes[1]);
                 break;
             }
             case Frame<A>::Yuv420p:
@@ -502,6 +502,14 @@ namespace Simd
         GemmKernelF4,
     };
 
+    namespace Base
+    {
+        void Gemm8u8iPackA(size_t M, size_t K, const uint8_t* A, size_t lda, SimdBool transA, size_t KA, uint8_t* pA);
+        void Gemm8u8iPackB(size_t K, size_t N, const int8_t* B, size_t ldb, SimdBool transB, size_t F, size_t KA, int8_t* pB, int32_t* bSum);
+        void Gemm8u8iSetRowParams(size_t M, const uint8_t* aZero, const float* aScale, int32_t* zero, float* scale);
+        void Gemm8u8iSetColParams(size_t N, size_t NF, const float* bScale, const float* bias, float* scale, float* shift);
+    }
+
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
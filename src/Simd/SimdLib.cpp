@@ -68,14 +68,20 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdSynetCalibration32f.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynetDeconvolution8i.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct4b.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetPermute.h"
 #include "Simd/SimdSynetScale8i.h"
+#include "Simd/SimdSynetWorkspace.h"
 #include "Simd/SimdWarpAffine.h"
 
 #include "Simd/SimdBase.h"
@@ -1162,6 +1168,28 @@ SIMD_API void SimdBgraToRgba(const uint8_t* bgra, size_t width, size_t height, s
         Base::BgraToRgba(bgra, width, height, bgraStride, rgba, rgbaStride);
 }
 
+SIMD_API void SimdBgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+    uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgraToNv12(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgraToNv12(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgraToNv12(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgraToNv12(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+}
+
 SIMD_API void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
     SIMD_EMPTY();
@@ -1548,6 +1576,28 @@ SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t width, size_t height, size
         Base::BgrToRgb(bgr, width, height, bgrStride, rgb, rgbStride);
 }
 
+SIMD_API void SimdBgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+    uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BgrToNv12(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToNv12(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToNv12(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgrToNv12(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+}
+
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
 {
     SIMD_EMPTY();
@@ -2202,6 +2252,35 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API void SimdDetectionDecodeBoxes32f(const float * deltas, const float * anchors, size_t count, SimdBoxEncodingType encoding, const float * params, float * boxes)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDetectionDecodeBoxes32fPtr) (const float * deltas, const float * anchors, size_t count, SimdBoxEncodingType encoding, const float * params, float * boxes);
+    const static SimdDetectionDecodeBoxes32fPtr simdDetectionDecodeBoxes32f = SIMD_FUNC3(DetectionDecodeBoxes32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDetectionDecodeBoxes32f(deltas, anchors, count, encoding, params, boxes);
+}
+
+SIMD_API size_t SimdDetectionFilterScores32f(const float * scores, size_t count, float threshold, uint32_t * indices)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionFilterScores32fPtr) (const float * scores, size_t count, float threshold, uint32_t * indices);
+    const static SimdDetectionFilterScores32fPtr simdDetectionFilterScores32f = SIMD_FUNC3(DetectionFilterScores32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDetectionFilterScores32f(scores, count, threshold, indices);
+}
+
+SIMD_API size_t SimdDetectionNms32f(const float * boxes, const float * scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+    float scoreThreshold, uint32_t * indices, float * dstScores)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdDetectionNms32fPtr) (const float * boxes, const float * scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+        float scoreThreshold, uint32_t * indices, float * dstScores);
+    const static SimdDetectionNms32fPtr simdDetectionNms32f = SIMD_FUNC3(DetectionNms32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDetectionNms32f(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, dstScores);
+}
+
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
@@ -2768,6 +2847,72 @@ SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t siz
     simdCosineDistance32f(a, b, size, distance);
 }
 
+SIMD_API void SimdDistancesTopK32f(size_t M, size_t N, size_t K, const float * A, const float * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistancesTopK32fPtr) (size_t M, size_t N, size_t K, const float * A, const float * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+    const static SimdDistancesTopK32fPtr simdDistancesTopK32f = SIMD_FUNC3(DistancesTopK32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistancesTopK32f(M, N, K, A, B, type, top, indices, distances);
+}
+
+SIMD_API void SimdDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistancesTopK16fPtr) (size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+    const static SimdDistancesTopK16fPtr simdDistancesTopK16f = SIMD_FUNC3(DistancesTopK16f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistancesTopK16f(M, N, K, A, B, type, top, indices, distances);
+}
+
+SIMD_API void SimdDistancesTopK8i(size_t M, size_t N, size_t K, const float * A, const int8_t * B, const float * scales, SimdDistanceType type, size_t top, uint32_t * indices, float * distances)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistancesTopK8iPtr) (size_t M, size_t N, size_t K, const float * A, const int8_t * B, const float * scales, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+    const static SimdDistancesTopK8iPtr simdDistancesTopK8i = SIMD_FUNC3(DistancesTopK8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistancesTopK8i(M, N, K, A, B, scales, type, top, indices, distances);
+}
+
+SIMD_API void SimdFloat32ToInt8Quantized(const float * src, size_t size, SimdBool symmetric, uint8_t * dst)
+{
+    SIMD_EMPTY();
+    Base::Float32ToInt8Quantized(src, size, symmetric, dst);
+}
+
+SIMD_API void SimdInt8QuantizedToFloat32(const uint8_t * src, size_t size, float * dst)
+{
+    SIMD_EMPTY();
+    Base::Int8QuantizedToFloat32(src, size, dst);
+}
+
+SIMD_API void SimdDistanceInt8Quantized(const uint8_t * a, const uint8_t * b, size_t size, SimdDistanceType type, float * distance)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistanceInt8QuantizedPtr) (const uint8_t * a, const uint8_t * b, size_t size, SimdDistanceType type, float * distance);
+    const static SimdDistanceInt8QuantizedPtr simdDistanceInt8Quantized = SIMD_FUNC4(DistanceInt8Quantized, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistanceInt8Quantized(a, b, size, type, distance);
+}
+
+SIMD_API void SimdDistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * const * A, const uint8_t * const * B, SimdDistanceType type, float * distances)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistancesMxNaInt8QuantizedPtr) (size_t M, size_t N, size_t K, const uint8_t * const * A, const uint8_t * const * B, SimdDistanceType type, float * distances);
+    const static SimdDistancesMxNaInt8QuantizedPtr simdDistancesMxNaInt8Quantized = SIMD_FUNC4(DistancesMxNaInt8Quantized, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistancesMxNaInt8Quantized(M, N, K, A, B, type, distances);
+}
+
+SIMD_API void SimdDistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * A, const uint8_t * B, SimdDistanceType type, float * distances)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdDistancesMxNpInt8QuantizedPtr) (size_t M, size_t N, size_t K, const uint8_t * A, const uint8_t * B, SimdDistanceType type, float * distances);
+    const static SimdDistancesMxNpInt8QuantizedPtr simdDistancesMxNpInt8Quantized = SIMD_FUNC4(DistancesMxNpInt8Quantized, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdDistancesMxNpInt8Quantized(M, N, K, A, B, type, distances);
+}
+
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
@@ -2833,6 +2978,17 @@ SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, c
     simdGemm32fNT(M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+SIMD_API void SimdGemm8u8i(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, SimdBool transA, const int8_t * B, size_t ldb, SimdBool transB,
+    const uint8_t * aZero, const float * aScale, const float * bScale, const float * bias, void * C, size_t ldc, SimdTensorDataType cType)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdGemm8u8iPtr) (size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, SimdBool transA, const int8_t * B, size_t ldb, SimdBool transB,
+        const uint8_t * aZero, const float * aScale, const float * bScale, const float * bias, void * C, size_t ldc, SimdTensorDataType cType);
+    const static SimdGemm8u8iPtr simdGemm8u8i = SIMD_FUNC4(Gemm8u8i, SIMD_AMXBF16_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC);
+
+    simdGemm8u8i(M, N, K, A, lda, transA, B, ldb, transB, aZero, aScale, bScale, bias, C, ldc, cType);
+}
+
 SIMD_API void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
@@ -4410,6 +4566,94 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API void SimdNv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DA)
+        Sse41::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -4474,6 +4718,72 @@ SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const ui
         Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
 }
 
+SIMD_API void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+    float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgrPlanar32f(y, yStride, uv, uvStride, width, height, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::P010ToBgrPlanar32f(y, yStride, uv, uvStride, width, height, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DF)
+        Sse41::P010ToBgrPlanar32f(y, yStride, uv, uvStride, width, height, blue, green, red, dstStride, yuvType);
+    else
+#endif
+        Base::P010ToBgrPlanar32f(y, yStride, uv, uvStride, width, height, blue, green, red, dstStride, yuvType);
+}
+
 SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
 {
     SIMD_EMPTY();
@@ -5857,131 +6167,297 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #endif
 }
 
-SIMD_API void SimdSynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility)
+SIMD_API void * SimdSynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void(*SimdSynetConvert32fTo8uPtr) (const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert32fTo8uPtr simdSynetConvert32fTo8u = SIMD_FUNC4(SynetConvert32fTo8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    typedef void* (*SimdSynetAttention32fInitPtr) (size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetAttention32fInitPtr simdSynetAttention32fInit = SIMD_FUNC4(SynetAttention32fInit, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
 
-    simdSynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+    return simdSynetAttention32fInit(batch, heads, seqQ, seqK, depth, scale, compatibility);
 #else
     assert(0);
+    return 0;
 #endif
 }
 
-SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility)
+SIMD_API size_t SimdSynetAttention32fExternalBufferSize(const void * context)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void(*SimdSynetConvert8uTo32fPtr) (const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvert8uTo32fPtr simdSynetConvert8uTo32f = SIMD_FUNC3(SynetConvert8uTo32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);//, SIMD_NEON_FUNC);
-
-    simdSynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
+    return ((SynetAttention32f*)context)->ExternalBufferSize();
 #else
     assert(0);
+    return 0;
 #endif
 }
 
-SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility)
+SIMD_API size_t SimdSynetAttention32fInternalBufferSize(const void * context)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void* (*SimdSynetConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC7(SynetConvolution32fInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-    return simdSynetConvolution32fInit(batch, params, compatibility);
+    return ((SynetAttention32f*)context)->InternalBufferSize();
 #else
     assert(0);
     return 0;
 #endif
 }
 
-SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context)
+SIMD_API const char* SimdSynetAttention32fInfo(const void* context)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetConvolution32f*)context)->ExternalBufferSize();
+    return ((SynetAttention32f*)context)->Info();
 #else
     assert(0);
     return 0;
 #endif
 }
 
-SIMD_API size_t SimdSynetConvolution32fInternalBufferSize(const void * context)
+SIMD_API void SimdSynetAttention32fForward(void * context, const float * q, const float * k, const float * v, const float * mask, float * buf, float * dst)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetConvolution32f*)context)->InternalBufferSize();
+    SynetAttention32f * c = (SynetAttention32f*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(q, k, v, mask, buf, dst);
 #else
     assert(0);
-    return 0;
 #endif
 }
 
-SIMD_API const char* SimdSynetConvolution32fInfo(const void* context)
+SIMD_API void* SimdSynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetConvolution32f*)context)->Info();
+    typedef void* (*SimdSynetCalibration32fInitPtr) (size_t channels, size_t bins, SimdTensorFormatType format);
+    const static SimdSynetCalibration32fInitPtr simdSynetCalibration32fInit = SIMD_FUNC3(SynetCalibration32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetCalibration32fInit(channels, bins, format);
 #else
     assert(0);
     return 0;
 #endif
 }
 
-SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params)
+SIMD_API void SimdSynetCalibration32fUpdate(void* context, const float* src, size_t batch, size_t spatial)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    ((SynetConvolution32f*)context)->SetParams(weight, internal, bias, params);
+    ((Base::SynetCalibration32f*)context)->Update(src, batch, spatial);
 #else
     assert(0);
 #endif
 }
 
-SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst)
+SIMD_API void SimdSynetCalibration32fGetStats(const void* context, SimdSynetCalibrationType type, float param, float* min, float* max)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    SynetConvolution32f * c = (SynetConvolution32f*)context;
-    SIMD_PERF_EXT(c);
-    c->Forward(src, buf, dst);
+    ((const Base::SynetCalibration32f*)context)->GetStats(type, param, min, max);
 #else
     assert(0);
 #endif
 }
 
-SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+SIMD_API void SimdSynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetConvolution8iInitPtr simdSynetConvolution8iInit = SIMD_FUNC6(SynetConvolution8iInit, SIMD_AMXBF16_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-    
-    return simdSynetConvolution8iInit(batch, conv, compatibility);
+    typedef void(*SimdSynetConvert32fTo8uPtr) (const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetConvert32fTo8uPtr simdSynetConvert32fTo8u = SIMD_FUNC4(SynetConvert32fTo8u, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdSynetConvert32fTo8u(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
 #else
     assert(0);
-    return 0;
 #endif
 }
 
-SIMD_API size_t SimdSynetConvolution8iExternalBufferSize(const void* context)
+SIMD_API void SimdSynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetConvolution8i*)context)->ExternalBufferSize();
+    typedef void(*SimdSynetConvert8uTo32fPtr) (const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetConvert8uTo32fPtr simdSynetConvert8uTo32f = SIMD_FUNC3(SynetConvert8uTo32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);//, SIMD_NEON_FUNC);
+
+    simdSynetConvert8uTo32f(src, batch, channels, height, width, format, scale, shift, dst, compatibility);
 #else
     assert(0);
-    return 0;
 #endif
 }
 
-SIMD_API size_t SimdSynetConvolution8iInternalBufferSize(const void* context)
+SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetConvolution8i*)context)->InternalBufferSize();
+    typedef void* (*SimdSynetConvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetConvolution32fInitPtr simdSynetConvolution32fInit = SIMD_FUNC7(SynetConvolution32fInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetConvolution32fInit(batch, params, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution32fExternalBufferSize(const void * context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Shaped()->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution32fInternalBufferSize(const void * context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetConvolution32fInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Shaped()->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetConvolution32fSetParams(void * context, const float * weight, SimdBool * internal, const float * bias, const float * params)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = (SynetConvolution32f*)context;
+    SimdBool packed = SimdFalse;
+    c->ClearShapes();
+    c->SetParams(weight, &packed, bias, params);
+    c->KeepParams(weight, packed, bias, params);
+    if (internal)
+        *internal = packed;
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = ((SynetConvolution32f*)context)->Shaped();
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, const float * add, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution32f * c = ((SynetConvolution32f*)context)->Shaped();
+    SIMD_PERF_EXT(c);
+    c->ForwardAdd(src, buf, add, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution32fExport(const void* context, void* data, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Export(data, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fImport(void* context, const void* data, size_t size, SimdBool attach)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Import(data, size, attach == SimdTrue) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void* SimdSynetConvolution32fPackedInit(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->CreatePacked();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fSetPacked(void* context, const void* packed)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->SetPacked(*(SynetPacked*)packed) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution32fReshape(void* context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution32f*)context)->Reshape(batch, srcH, srcW, SimdSynetConvolution32fInit) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetConvolution8iInitPtr simdSynetConvolution8iInit = SIMD_FUNC6(SynetConvolution8iInit, SIMD_AMXBF16_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    
+    return simdSynetConvolution8iInit(batch, conv, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution8iExternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution8iInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->InternalBufferSize();
 #else
     assert(0);
     return 0;
@@ -6021,12 +6497,68 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
 #endif
 }
 
+SIMD_API void SimdSynetConvolution8iForwardAdd(void* context, const uint8_t* src, uint8_t* buf, const uint8_t* add, const float* addScale, const float* addShift, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetConvolution8i* c = (SynetConvolution8i*)context;
+    SIMD_PERF_EXT(c);
+    c->ForwardAdd(src, buf, add, addScale, addShift, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API size_t SimdSynetConvolution8iExport(const void* context, void* data, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->Export(data, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution8iImport(void* context, const void* data, size_t size, SimdBool attach)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->Import(data, size, attach == SimdTrue) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void* SimdSynetConvolution8iPackedInit(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->CreatePacked();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetConvolution8iSetPacked(void* context, const void* packed)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetConvolution8i*)context)->SetPacked(*(SynetPacked*)packed) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC5(SynetDeconvolution32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static SimdSynetDeconvolution32fInitPtr simdSynetDeconvolution32fInit = SIMD_FUNC6(SynetDeconvolution32fInit, SIMD_AMXBF16_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
     
     return simdSynetDeconvolution32fInit(batch, params, compatibility);
 #else
@@ -6039,7 +6571,7 @@ SIMD_API size_t SimdSynetDeconvolution32fExternalBufferSize(const void * context
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetDeconvolution32f*)context)->ExternalBufferSize();
+    return ((SynetDeconvolution32f*)context)->Shaped()->ExternalBufferSize();
 #else
     assert(0);
     return 0;
@@ -6061,7 +6593,7 @@ SIMD_API const char* SimdSynetDeconvolution32fInfo(const void* context)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetDeconvolution32f*)context)->Info();
+    return ((SynetDeconvolution32f*)context)->Shaped()->Info();
 #else
     assert(0);
     return 0;
@@ -6072,7 +6604,13 @@ SIMD_API void SimdSynetDeconvolution32fSetParams(void * context, const float * w
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    ((SynetDeconvolution32f*)context)->SetParams(weight, internal, bias, params);
+    SynetDeconvolution32f * d = (SynetDeconvolution32f*)context;
+    SimdBool packed = SimdFalse;
+    d->ClearShapes();
+    d->SetParams(weight, &packed, bias, params);
+    d->KeepParams(weight, packed, bias, params);
+    if (internal)
+        *internal = packed;
 #else
     assert(0);
 #endif
@@ -6082,7 +6620,7 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    SynetDeconvolution32f * d = (SynetDeconvolution32f*)context;
+    SynetDeconvolution32f * d = ((SynetDeconvolution32f*)context)->Shaped();
     SIMD_PERF_EXT(d);
     d->Forward(src, buf, dst);
 #else
@@ -6090,6 +6628,86 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 #endif
 }
 
+SIMD_API SimdBool SimdSynetDeconvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetDeconvolution32f*)context)->Reshape(batch, srcH, srcW, SimdSynetDeconvolution32fInit) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API void * SimdSynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetDeconvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetDeconvolution8iInitPtr simdSynetDeconvolution8iInit = SIMD_FUNC6(SynetDeconvolution8iInit, SIMD_AMXBF16_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetDeconvolution8iInit(batch, conv, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetDeconvolution8iExternalBufferSize(const void * context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetDeconvolution8i*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetDeconvolution8iInternalBufferSize(const void * context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetDeconvolution8i*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetDeconvolution8iInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetDeconvolution8i*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetDeconvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const* stats)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetDeconvolution8i*)context)->SetParams(weight, bias, params, stats);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetDeconvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetDeconvolution8i * c = (SynetDeconvolution8i*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
     SIMD_EMPTY();
@@ -6262,45 +6880,187 @@ SIMD_API void SimdSynetInnerProduct32fSetParams(void* context, const float* weig
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    ((SynetInnerProduct32f*)context)->SetParams(weight, internal, bias, params);
+    ((SynetInnerProduct32f*)context)->SetParams(weight, internal, bias, params);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct32fForward(void* context, const float* src, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct32f* c = (SynetInnerProduct32f*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void* SimdSynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct4bInitPtr) (size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+    const static SimdSynetInnerProduct4bInitPtr simdSynetInnerProduct4bInit = SIMD_FUNC3(SynetInnerProduct4bInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetInnerProduct4bInit(batch, input, output, group, transpose, activation);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct4bInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct4b*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetInnerProduct4bInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct4b*)context)->Info();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct4bSetParams(void* context, const float* weight, const float* bias, const float* params)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetInnerProduct4b*)context)->SetParams(weight, bias, params);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct4bForward(void* context, const float* src, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    SynetInnerProduct4b* c = (SynetInnerProduct4b*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+    const static SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetInnerProduct8iPtr) (size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetInnerProduct8iPtr simdSynetInnerProduct8i = SIMD_FUNC3(SynetInnerProduct8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetInnerProduct8i(M, N, K, src, weight, dst, compatibility);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void* SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+    SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetInnerProduct8iInitPtr) (size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+        SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    const static SimdSynetInnerProduct8iInitPtr simdSynetInnerProduct8iInit = SIMD_FUNC6(SynetInnerProduct8iInit, SIMD_AMXBF16_FUNC, SIMD_AVX512VNNI_FUNC, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetInnerProduct8iInit(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->ExternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetInnerProduct8i*)context)->Info();
 #else
     assert(0);
+    return 0;
 #endif
 }
 
-SIMD_API void SimdSynetInnerProduct32fForward(void* context, const float* src, float* dst)
+SIMD_API void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    SynetInnerProduct32f* c = (SynetInnerProduct32f*)context;
-    SIMD_PERF_EXT(c);
-    c->Forward(src, dst);
+    ((SynetInnerProduct8i*)context)->SetParams(weight, bias, params, stats);
 #else
     assert(0);
 #endif
 }
 
-SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst)
+SIMD_API void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void(*SimdSynetInnerProductLayerForwardPtr) (const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
-    const static SimdSynetInnerProductLayerForwardPtr simdSynetInnerProductLayerForward = SIMD_FUNC5(SynetInnerProductLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
-
-    simdSynetInnerProductLayerForward(src, weight, bias, count, size, dst);
+    SynetInnerProduct8i* c = (SynetInnerProduct8i*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
 #else
     assert(0);
 #endif
 }
 
-SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility)
+SIMD_API void SimdSynetLogSoftmaxLayerForward(const float* src, size_t outer, size_t count, size_t inner, float* dst)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    typedef void(*SimdSynetInnerProduct8iPtr) (size_t M, size_t N, size_t K, const uint8_t* src, const int8_t* weight, int32_t* dst, SimdSynetCompatibilityType compatibility);
-    const static SimdSynetInnerProduct8iPtr simdSynetInnerProduct8i = SIMD_FUNC3(SynetInnerProduct8i, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    typedef void(*SimdSynetLogSoftmaxLayerForwardPtr) (const float* src, size_t outer, size_t count, size_t inner, float* dst);
+    const static SimdSynetLogSoftmaxLayerForwardPtr simdSynetLogSoftmaxLayerForward = SIMD_FUNC3(SynetLogSoftmaxLayerForward, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
 
-    simdSynetInnerProduct8i(M, N, K, src, weight, dst, compatibility);
+    simdSynetLogSoftmaxLayerForward(src, outer, count, inner, dst);
 #else
     assert(0);
 #endif
@@ -6337,7 +7097,7 @@ SIMD_API size_t SimdSynetMergedConvolution32fExternalBufferSize(const void * con
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetMergedConvolution32f*)context)->ExternalBufferSize();
+    return ((SynetMergedConvolution32f*)context)->Shaped()->ExternalBufferSize();
 #else
     assert(0);
     return 0;
@@ -6359,7 +7119,7 @@ SIMD_API const char* SimdSynetMergedConvolution32fInfo(const void* context)
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    return ((SynetMergedConvolution32f*)context)->Info();
+    return ((SynetMergedConvolution32f*)context)->Shaped()->Info();
 #else
     assert(0);
     return 0;
@@ -6370,7 +7130,9 @@ SIMD_API void SimdSynetMergedConvolution32fSetParams(void * context, const float
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    ((SynetMergedConvolution32f*)context)->SetParams(weight, internal, bias, params);
+    SynetMergedConvolution32f * c = (SynetMergedConvolution32f*)context;
+    c->ClearShapes();
+    c->SetParams(weight, internal, bias, params);
 #else
     assert(0);
 #endif
@@ -6380,7 +7142,7 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 {
     SIMD_EMPTY();
 #if defined(SIMD_SYNET_ENABLE)
-    SynetMergedConvolution32f * c = (SynetMergedConvolution32f*)context;
+    SynetMergedConvolution32f * c = ((SynetMergedConvolution32f*)context)->Shaped();
     SIMD_PERF_EXT(c);
     c->Forward(src, buf, dst);
 #else
@@ -6388,6 +7150,39 @@ SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float *
 #endif
 }
 
+SIMD_API SimdBool SimdSynetMergedConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetMergedConvolution32f*)context)->Reshape(batch, srcH, srcW, SimdSynetMergedConvolution32fInit) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
+SIMD_API size_t SimdSynetMergedConvolution32fExport(const void* context, void* data, size_t size)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetMergedConvolution32f*)context)->Export(data, size);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API SimdBool SimdSynetMergedConvolution32fImport(void* context, const void* data, size_t size, SimdBool attach)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((SynetMergedConvolution32f*)context)->Import(data, size, attach == SimdTrue) ? SimdTrue : SimdFalse;
+#else
+    assert(0);
+    return SimdFalse;
+#endif
+}
+
 SIMD_API void* SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility)
 {
     SIMD_EMPTY();
@@ -6485,6 +7280,36 @@ SIMD_API void SimdSynetNormalizeLayerForward(const float* src, size_t batch, siz
 #endif
 }
 
+SIMD_API void SimdSynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+    const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetLayerNorm32fPtr) (const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+        const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+    const static SimdSynetLayerNorm32fPtr simdSynetLayerNorm32f = SIMD_FUNC3(SynetLayerNorm32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetLayerNorm32f(src, batch, channels, spatial, format, scale, shift, eps, activation, params, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+    const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetGroupNorm32fPtr) (const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+        const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+    const static SimdSynetGroupNorm32fPtr simdSynetGroupNorm32f = SIMD_FUNC3(SynetGroupNorm32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetGroupNorm32f(src, batch, channels, spatial, groups, format, scale, shift, eps, activation, params, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetPermuteInit(const size_t* shape, const size_t* order, size_t count, SimdTensorDataType type)
 {
     SIMD_EMPTY();
@@ -6567,6 +7392,36 @@ SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH
 #endif
 }
 
+SIMD_API void SimdSynetRoiAlign32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+    size_t samplingRatio, SimdBool aligned, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRoiAlign32fPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+        size_t samplingRatio, SimdBool aligned, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+    const static SimdSynetRoiAlign32fPtr simdSynetRoiAlign32f = SIMD_FUNC3(SynetRoiAlign32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetRoiAlign32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, samplingRatio, aligned, dst, dstH, dstW, format);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetRoiPoolingMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+    float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetRoiPoolingMax32fPtr) (const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+        float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+    const static SimdSynetRoiPoolingMax32fPtr simdSynetRoiPoolingMax32f = SIMD_FUNC3(SynetRoiPoolingMax32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetRoiPoolingMax32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, dst, dstH, dstW, format);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
@@ -6721,6 +7576,19 @@ SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* sl
 #endif
 }
 
+SIMD_API void SimdSynetSoftmaxArgMax32f(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxArgMax32fPtr) (const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob);
+    const static SimdSynetSoftmaxArgMax32fPtr simdSynetSoftmaxArgMax32f = SIMD_FUNC3(SynetSoftmaxArgMax32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetSoftmaxArgMax32f(src, outer, count, inner, indexType, index, prob);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst)
 {
     SIMD_EMPTY();
@@ -6734,6 +7602,19 @@ SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size
 #endif
 }
 
+SIMD_API void SimdSynetSoftmaxTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetSoftmaxTopK32fPtr) (const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob);
+    const static SimdSynetSoftmaxTopK32fPtr simdSynetSoftmaxTopK32f = SIMD_FUNC3(SynetSoftmaxTopK32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetSoftmaxTopK32f(src, outer, count, inner, k, index, prob);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst)
 {
     SIMD_EMPTY();
@@ -6760,6 +7641,19 @@ SIMD_API void SimdSynetSwish32f(const float* src, size_t size, const float* slop
 #endif
 }
 
+SIMD_API void SimdSynetGelu32f(const float* src, size_t size, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetGelu32fPtr) (const float* src, size_t size, float* dst);
+    const static SimdSynetGelu32fPtr simdSynetGelu32f = SIMD_FUNC3(SynetGelu32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetGelu32f(src, size, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetTanh32f(const float* src, size_t size, const float* slope, float* dst)
 {
     SIMD_EMPTY();
@@ -6786,6 +7680,61 @@ SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float* src, size_t si
 #endif
 }
 
+SIMD_API void* SimdSynetWorkspaceInit()
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return Base::SynetWorkspaceInit();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetWorkspaceAddContext(void* workspace, SimdSynetContextType type, const void* context, size_t step)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetWorkspace*)workspace)->AddContext(type, context, step);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetWorkspaceAddBuffer(void* workspace, size_t size, size_t first, size_t last)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetWorkspace*)workspace)->AddBuffer(size, first, last);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetWorkspaceSize(void* workspace)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetWorkspace*)workspace)->Size();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetWorkspaceOffset(void* workspace, size_t index)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetWorkspace*)workspace)->Offset(index);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
@@ -7006,6 +7955,20 @@ SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t
     ((WarpAffine*)context)->Run(src, dst);
 }
 
+SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpAffineBatchInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpAffineBatchInitPtr simdWarpAffineBatchInit = SIMD_FUNC3(WarpAffineBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpAffineBatchInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border);
+}
+
+SIMD_API SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, size_t count, const float* mats, uint8_t** dst)
+{
+    SIMD_EMPTY();
+    return ((Base::WarpAffineBatch*)context)->Run(src, count, mats, dst) ? SimdTrue : SimdFalse;
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -7323,6 +8286,138 @@ SIMD_API void SimdYuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8
         Base::Yuva444pToBgraV2(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride, yuvType);
 }
 
+SIMD_API void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::Yuv420p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DF)
+        Sse41::Yuv420p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+        Base::Yuv420p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+}
+
+SIMD_API void SimdYuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv444p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv444p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+    size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv444p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::Yuv444p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::DF)
+        Sse41::Yuv444p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+    else
+#endif
+        Base::Yuv444p16ToBgrPlanar32f(y, yStride, u, uStride, v, vStride, width, height, bitDepth, blue, green, red, dstStride, yuvType);
+}
+
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
@@ -131,7 +131,7 @@ typedef enum
 
 /*! @ingroup synet_types
     Describes type of activation function. 
-    It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit, 
+    It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit, ::SimdSynetDeconvolution8iInit, 
     ::SimdSynetInnerProduct32fInit, ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution8iInit.
 */
 typedef enum
@@ -211,6 +211,22 @@ typedef enum
         \endverbatim
     */
     SimdConvolutionActivationSwish,
+    /*!
+        GELU (https://en.wikipedia.org/wiki/Activation_function) activation function.
+        It has no parameters. The exact (erf based) form is used.
+        \verbatim
+        dst[i] = 0.5 * src[i] * (1 + Erf(src[i] / Sqrt(2)));
+        \endverbatim
+    */
+    SimdConvolutionActivationGelu,
+    /*!
+        GELU (https://en.wikipedia.org/wiki/Activation_function) activation function in tanh approximated form.
+        It has no parameters.
+        \verbatim
+        dst[i] = 0.5 * src[i] * (1 + Tanh(Sqrt(2 / Pi) * (src[i] + 0.044715 * src[i]^3)));
+        \endverbatim
+    */
+    SimdConvolutionActivationGeluTanh,
 } SimdConvolutionActivationType;
 
 /*! @ingroup c_types
@@ -254,6 +270,46 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup c_types
+    Describes type of distance between vectors. It is used in functions ::SimdDistancesTopK32f, ::SimdDistancesTopK16f, ::SimdDistancesTopK8i, ::SimdDistanceInt8Quantized, 
+    ::SimdDistancesMxNaInt8Quantized and ::SimdDistancesMxNpInt8Quantized.
+*/
+typedef enum
+{
+    /*! Cosine distance: 1 - Sum(a[k]*b[k])/Sqrt(Sum(a[k]*a[k])*Sum(b[k]*b[k])). */
+    SimdDistanceCosine,
+    /*! Squared Euclidean distance: Sum((a[k] - b[k])*(a[k] - b[k])). */
+    SimdDistanceSquaredL2,
+    /*! Negative inner product: -Sum(a[k]*b[k]). */
+    SimdDistanceInnerProduct,
+} SimdDistanceType;
+
+/*! @ingroup c_types
+    Describes encoding of bounding boxes relative to anchors. It is used in function ::SimdDetectionDecodeBoxes32f.
+*/
+typedef enum
+{
+    /*! SSD encoding: anchor is (cx, cy, w, h), offsets are scaled by 4 variances:
+        cx' = cx + dx*v[0]*w, cy' = cy + dy*v[1]*h, w' = w*exp(dw*v[2]), h' = h*exp(dh*v[3]). */
+    SimdBoxEncodingSsd,
+    /*! YOLO encoding: anchor is (x, y, w, h) where (x, y) is a top-left corner of grid cell and (w, h) is an anchor size, params are cell sizes (sx, sy):
+        cx' = x + sigmoid(dx)*sx, cy' = y + sigmoid(dy)*sy, w' = w*exp(dw), h' = h*exp(dh). */
+    SimdBoxEncodingYolo,
+} SimdBoxEncodingType;
+
+/*! @ingroup c_types
+    Describes type of non-maximum suppression. It is used in function ::SimdDetectionNms32f.
+*/
+typedef enum
+{
+    /*! Greedy NMS: a box is removed if its IoU with any kept box exceeds threshold. */
+    SimdNmsGreedy,
+    /*! Linear Soft-NMS: a score of box is multiplied by (1 - IoU) if IoU with a kept box exceeds threshold. */
+    SimdNmsSoftLinear,
+    /*! Gaussian Soft-NMS: a score of box is multiplied by exp(-IoU*IoU/sigma). */
+    SimdNmsSoftGaussian,
+} SimdNmsType;
+
 /*! @ingroup c_types
     Describes formats of image file. It is used in functions ::SimdImageSaveToMemory and ::SimdImageSaveToFile.
 */
@@ -419,10 +475,21 @@ typedef enum
     SimdResizeMethodAreaFast,
 } SimdResizeMethodType;
 
+/*! @ingroup synet_types
+    Describes method of estimation of quantization range used in function ::SimdSynetCalibration32fGetStats.
+*/
+typedef enum
+{
+    SimdSynetCalibrationMinMax, /*!< Minimal and maximal observed values. */
+    SimdSynetCalibrationPercentile, /*!< Values which cut given percent of observed values (parameter is percent, for example 99.99). */
+    SimdSynetCalibrationEntropy, /*!< Symmetric threshold which minimizes Kullback-Leibler divergence between original and quantized distributions (parameter is a number of quantization levels, 128 by default). */
+} SimdSynetCalibrationType;
+
 /*! @ingroup synet_types
     Describes Synet calculation compatibility flags. This type used in functions ::SimdSynetAdd8i, ::SimdSynetScaleLayerForward, 
-    ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetScale8iInit,
-    ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetMergedConvolution32fInit, ::SimdSynetMergedConvolution8iInit.
+    ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetInnerProduct8iInit, ::SimdSynetScale8iInit,
+    ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit, ::SimdSynetDeconvolution8iInit, 
+    ::SimdSynetMergedConvolution32fInit, ::SimdSynetMergedConvolution8iInit, ::SimdSynetAttention32fInit.
 */
 typedef enum
 {
@@ -445,6 +512,24 @@ typedef enum
     SimdSynetCompatibility16fpMask = 192, /*!< Bit mask of options of 16-bit floating point (Half Precision) format. */
 } SimdSynetCompatibilityType;
 
+/*! @ingroup synet_types
+    Describes type of Synet context registered in workspace planner with function ::SimdSynetWorkspaceAddContext.
+*/
+typedef enum
+{
+    SimdSynetContextConvolution32f, /*!< FP32 convolution context (see ::SimdSynetConvolution32fInit). */
+    SimdSynetContextConvolution8i, /*!< INT8 convolution context (see ::SimdSynetConvolution8iInit). */
+    SimdSynetContextDeconvolution32f, /*!< FP32 deconvolution context (see ::SimdSynetDeconvolution32fInit). */
+    SimdSynetContextDeconvolution8i, /*!< INT8 deconvolution context (see ::SimdSynetDeconvolution8iInit). */
+    SimdSynetContextInnerProduct32f, /*!< FP32 inner product context (see ::SimdSynetInnerProduct32fInit). */
+    SimdSynetContextMergedConvolution32f, /*!< FP32 merged convolution context (see ::SimdSynetMergedConvolution32fInit). */
+    SimdSynetContextMergedConvolution8i, /*!< INT8 merged convolution context (see ::SimdSynetMergedConvolution8iInit). */
+    SimdSynetContextPermute, /*!< Permute context (see ::SimdSynetPermuteInit). */
+    SimdSynetContextScale8i, /*!< INT8 scale context (see ::SimdSynetScale8iInit). */
+    SimdSynetContextAttention32f, /*!< FP32 attention context (see ::SimdSynetAttention32fInit). */
+    SimdSynetContextInnerProduct8i, /*!< INT8 inner product context (see ::SimdSynetInnerProduct8iInit). */
+} SimdSynetContextType;
+
 /*! @ingroup synet_types
     Describes operation type used in function ::SimdSynetEltwiseLayerForward.
 */
@@ -501,6 +586,7 @@ typedef enum
     SimdTensorData8u, /*!< 8-bit unsigned integer. */
     SimdTensorData16b, /*!< 16-bit BFloat16 (Brain Floating Point). */
     SimdTensorData16f, /*!< 16-bit floating point (Half Precision). */
+    SimdTensorData16u, /*!< 16-bit unsigned integer. */
 } SimdTensorDataType;
 
 /*! @ingroup transform
@@ -548,7 +634,7 @@ typedef enum
 
 /*! @ingroup synet_types
     Describes convolution (deconvolution) parameters. It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, 
-    ::SimdSynetDeconvolution32fInit, ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution8iInit.
+    ::SimdSynetDeconvolution32fInit, ::SimdSynetDeconvolution8iInit, ::SimdSynetMergedConvolution32fInit and ::SimdSynetMergedConvolution8iInit.
 */
 typedef struct SimdConvolutionParameters
 {
@@ -1706,6 +1792,29 @@ extern "C"
     */
     SIMD_API void SimdBgraToRgba(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgba, size_t rgbaStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to NV12.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image must have half width and half height relative to Y component. It contains interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup bgra_conversion
 
         \fn void SimdBgraToYuv420p(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -2041,6 +2150,29 @@ extern "C"
     */
     SIMD_API void SimdBgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to NV12.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image must have half width and half height relative to Y component. It contains interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height, uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -2767,6 +2899,58 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionDecodeBoxes32f(const float * deltas, const float * anchors, size_t count, SimdBoxEncodingType encoding, const float * params, float * boxes);
+
+        \short Decodes bounding boxes predicted by CNN detector relative to anchors.
+
+        \param [in] deltas - a pointer to predicted box offsets. The size of array is 4*count (dx, dy, dw, dh for every box).
+        \param [in] anchors - a pointer to anchors. The size of array is 4*count. Its format depends on encoding (see ::SimdBoxEncodingType).
+        \param [in] count - a number of boxes.
+        \param [in] encoding - a type of box encoding (see ::SimdBoxEncodingType).
+        \param [in] params - a pointer to 4 encoding parameters (variances for SSD, cell sizes (sx, sy) for YOLO).
+        \param [out] boxes - a pointer to decoded boxes. The size of array is 4*count (left, top, right, bottom for every box).
+    */
+    SIMD_API void SimdDetectionDecodeBoxes32f(const float * deltas, const float * anchors, size_t count, SimdBoxEncodingType encoding, const float * params, float * boxes);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionFilterScores32f(const float * scores, size_t count, float threshold, uint32_t * indices);
+
+        \short Selects indices of scores which are greater than threshold.
+
+        \param [in] scores - a pointer to scores. The size of array is count.
+        \param [in] count - a number of scores.
+        \param [in] threshold - a score threshold.
+        \param [out] indices - a pointer to output indices in ascending order. The size of array must be at least count.
+        \return a number of selected indices.
+    */
+    SIMD_API size_t SimdDetectionFilterScores32f(const float * scores, size_t count, float threshold, uint32_t * indices);
+
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionNms32f(const float * boxes, const float * scores, size_t count, SimdNmsType type, float iouThreshold, float sigma, float scoreThreshold, uint32_t * indices, float * dstScores);
+
+        \short Performs non-maximum suppression of bounding boxes.
+
+        Only boxes with score greater than scoreThreshold are considered. 
+        Kept boxes are returned in order of descending score (the score of box at the moment of its selection for Soft-NMS).
+
+        \param [in] boxes - a pointer to boxes. The size of array is 4*count (left, top, right, bottom for every box).
+        \param [in] scores - a pointer to box scores. The size of array is count.
+        \param [in] count - a number of boxes.
+        \param [in] type - a type of NMS (see ::SimdNmsType).
+        \param [in] iouThreshold - an IoU threshold (it is not used in Gaussian Soft-NMS).
+        \param [in] sigma - a parameter of Gaussian Soft-NMS. It must be positive if type is ::SimdNmsSoftGaussian.
+        \param [in] scoreThreshold - a score threshold.
+        \param [out] indices - a pointer to indices of kept boxes. The size of array must be at least count.
+        \param [out] dstScores - a pointer to scores of kept boxes. The size of array must be at least count. It can be NULL.
+        \return a number of kept boxes.
+    */
+    SIMD_API size_t SimdDetectionNms32f(const float * boxes, const float * scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+        float scoreThreshold, uint32_t * indices, float * dstScores);
+
     /*! @ingroup edge_background
 
         \fn void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
@@ -3334,6 +3518,171 @@ extern "C"
     */
     SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
+    /*! @ingroup correlation
+
+        \fn void SimdDistancesTopK32f(size_t M, size_t N, size_t K, const float * A, const float * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+        \short Finds top nearest 32-bit float vectors of gallery for every query vector.
+
+        Distances between query and gallery vectors are calculated block by block and only the nearest gallery vectors 
+        are kept for every query, so the full M*N matrix of distances is never stored. The function uses multiple threads 
+        (see ::SimdSetThreadNumber) which process different blocks of gallery.
+
+        Algorithm description:
+        \verbatim
+        distance[i, j] = Distance(type, A[i*K + k], B[j*K + k]);
+        indices[i*top + t], distances[i*top + t] - index and distance of t-th nearest B vector for i-th A vector (in ascending order of distance).
+        \endverbatim
+
+        \note If N < top then the tail of output is filled by indices 0xFFFFFFFF and distances FLT_MAX.
+
+        \param [in] M - a number of query vectors.
+        \param [in] N - a number of gallery vectors.
+        \param [in] K - a size of vectors.
+        \param [in] A - a pointer to 32-bit float query vectors. Its size must be M*K.
+        \param [in] B - a pointer to 32-bit float gallery vectors. Its size must be N*K.
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [in] top - a number of nearest gallery vectors to find.
+        \param [out] indices - a pointer to output indices of nearest gallery vectors. Its size must be M*top.
+        \param [out] distances - a pointer to output distances to nearest gallery vectors. Its size must be M*top.
+    */
+    SIMD_API void SimdDistancesTopK32f(size_t M, size_t N, size_t K, const float * A, const float * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+    /*! @ingroup float16
+
+        \fn void SimdDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+        \short Finds top nearest 16-bit float vectors of gallery for every query vector.
+
+        It is analogue of function ::SimdDistancesTopK32f for 16-bit float query and gallery vectors.
+
+        \param [in] M - a number of query vectors.
+        \param [in] N - a number of gallery vectors.
+        \param [in] K - a size of vectors.
+        \param [in] A - a pointer to 16-bit float query vectors. Its size must be M*K.
+        \param [in] B - a pointer to 16-bit float gallery vectors. Its size must be N*K.
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [in] top - a number of nearest gallery vectors to find.
+        \param [out] indices - a pointer to output indices of nearest gallery vectors. Its size must be M*top.
+        \param [out] distances - a pointer to output distances to nearest gallery vectors. Its size must be M*top.
+    */
+    SIMD_API void SimdDistancesTopK16f(size_t M, size_t N, size_t K, const uint16_t * A, const uint16_t * B, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+    /*! @ingroup correlation
+
+        \fn void SimdDistancesTopK8i(size_t M, size_t N, size_t K, const float * A, const int8_t * B, const float * scales, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+        \short Finds top nearest 8-bit quantized vectors of gallery for every 32-bit float query vector.
+
+        It is analogue of function ::SimdDistancesTopK32f for gallery vectors quantized to 8-bit integers with scale per vector:
+        \verbatim
+        b[j, k] = B[j*K + k]*scales[j];
+        \endverbatim
+
+        \param [in] M - a number of query vectors.
+        \param [in] N - a number of gallery vectors.
+        \param [in] K - a size of vectors.
+        \param [in] A - a pointer to 32-bit float query vectors. Its size must be M*K.
+        \param [in] B - a pointer to 8-bit integer gallery vectors. Its size must be N*K.
+        \param [in] scales - a pointer to scales of gallery vectors. Its size must be N.
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [in] top - a number of nearest gallery vectors to find.
+        \param [out] indices - a pointer to output indices of nearest gallery vectors. Its size must be M*top.
+        \param [out] distances - a pointer to output distances to nearest gallery vectors. Its size must be M*top.
+    */
+    SIMD_API void SimdDistancesTopK8i(size_t M, size_t N, size_t K, const float * A, const int8_t * B, const float * scales, SimdDistanceType type, size_t top, uint32_t * indices, float * distances);
+
+    /*! @ingroup correlation
+
+        \fn void SimdFloat32ToInt8Quantized(const float * src, size_t size, SimdBool symmetric, uint8_t * dst);
+
+        \short Encodes 32-bit float vector to 8-bit quantized format.
+
+        Quantized vector consists of header (32-bit float scale and shift) and 8-bit codes:
+        \verbatim
+        src[i] ~ dst_codes[i]*scale + shift;
+        \endverbatim
+        In symmetric mode scale = max(abs(src[i]))/127 and shift = -128*scale (codes are signed values shifted by 128).
+        In asymmetric mode scale = (max(src[i]) - min(src[i]))/255 and shift = min(src[i]).
+
+        \param [in] src - a pointer to the input 32-bit float vector.
+        \param [in] size - a size of the vector.
+        \param [in] symmetric - a flag of symmetric quantization.
+        \param [out] dst - a pointer to the output quantized vector. Its size must be size + 8 bytes.
+    */
+    SIMD_API void SimdFloat32ToInt8Quantized(const float * src, size_t size, SimdBool symmetric, uint8_t * dst);
+
+    /*! @ingroup correlation
+
+        \fn void SimdInt8QuantizedToFloat32(const uint8_t * src, size_t size, float * dst);
+
+        \short Decodes 8-bit quantized vector (see ::SimdFloat32ToInt8Quantized) to 32-bit float vector.
+
+        \param [in] src - a pointer to the input quantized vector. Its size must be size + 8 bytes.
+        \param [in] size - a size of the vector.
+        \param [out] dst - a pointer to the output 32-bit float vector.
+    */
+    SIMD_API void SimdInt8QuantizedToFloat32(const uint8_t * src, size_t size, float * dst);
+
+    /*! @ingroup correlation
+
+        \fn void SimdDistanceInt8Quantized(const uint8_t * a, const uint8_t * b, size_t size, SimdDistanceType type, float * distance);
+
+        \short Calculates distance between two 8-bit quantized vectors (see ::SimdFloat32ToInt8Quantized).
+
+        Dot products of codes are accumulated in 32-bit integers (with using of VPDPBUSD on AVX-512VNNI), 
+        so the result is equal to the distance between decoded vectors up to rounding of the final float point operations.
+
+        \note The size of vectors must not exceed 32768.
+
+        \param [in] a - a pointer to the first quantized vector.
+        \param [in] b - a pointer to the second quantized vector.
+        \param [in] size - a size of vectors.
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [out] distance - a pointer to 32-bit float with distance.
+    */
+    SIMD_API void SimdDistanceInt8Quantized(const uint8_t * a, const uint8_t * b, size_t size, SimdDistanceType type, float * distance);
+
+    /*! @ingroup correlation
+
+        \fn void SimdDistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * const * A, const uint8_t * const * B, SimdDistanceType type, float * distances);
+
+        \short Calculates mutual distances between two arrays of 8-bit quantized vectors (see ::SimdFloat32ToInt8Quantized).
+
+        \verbatim
+        distances[i, j] = Distance(type, A[i], B[j]);
+        \endverbatim
+
+        \param [in] M - a number of A vectors.
+        \param [in] N - a number of B vectors.
+        \param [in] K - a size of vectors (it must not exceed 32768).
+        \param [in] A - a pointer to the first array with pointers to quantized vectors.
+        \param [in] B - a pointer to the second array with pointers to quantized vectors.
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [out] distances - a pointer to result 32-bit float array with distances. Its size must be M*N.
+    */
+    SIMD_API void SimdDistancesMxNaInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * const * A, const uint8_t * const * B, SimdDistanceType type, float * distances);
+
+    /*! @ingroup correlation
+
+        \fn void SimdDistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * A, const uint8_t * B, SimdDistanceType type, float * distances);
+
+        \short Calculates mutual distances between two packed arrays of 8-bit quantized vectors (see ::SimdFloat32ToInt8Quantized).
+
+        \verbatim
+        distances[i, j] = Distance(type, A + i*(K + 8), B + j*(K + 8));
+        \endverbatim
+
+        \param [in] M - a number of A vectors.
+        \param [in] N - a number of B vectors.
+        \param [in] K - a size of vectors (it must not exceed 32768).
+        \param [in] A - a pointer to the first packed array of quantized vectors. Its size must be M*(K + 8).
+        \param [in] B - a pointer to the second packed array of quantized vectors. Its size must be N*(K + 8).
+        \param [in] type - a type of distance (see ::SimdDistanceType).
+        \param [out] distances - a pointer to result 32-bit float array with distances. Its size must be M*N.
+    */
+    SIMD_API void SimdDistancesMxNpInt8Quantized(size_t M, size_t N, size_t K, const uint8_t * A, const uint8_t * B, SimdDistanceType type, float * distances);
+
     /*! @ingroup gaussian_filter
 
         \fn void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -3477,6 +3826,42 @@ extern "C"
     */
     SIMD_API void SimdGemm32fNT(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
+    /*! @ingroup matrix
+
+        \fn void SimdGemm8u8i(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, SimdBool transA, const int8_t * B, size_t ldb, SimdBool transB, const uint8_t * aZero, const float * aScale, const float * bScale, const float * bias, void * C, size_t ldc, SimdTensorDataType cType);
+
+        \short Performs general matrix multiplication of 8-bit unsigned integer matrix A and 8-bit signed integer matrix B.
+
+        Algorithm's details:
+        \verbatim
+        I(i, j) = Sum(k)((A(i, k) - aZero[i]) * B(k, j));
+
+        C(i, j) = I(i, j); // cType == SimdTensorData32i
+        C(i, j) = I(i, j) * aScale[i] * bScale[j] + bias[j]; // cType == SimdTensorData32f
+        \endverbatim
+
+        \note Products are accumulated in 32-bit integers without saturation. Matrices A and B are repacked in internal buffers at every call.
+
+        \param [in] M - a height of A and height of C matrices.
+        \param [in] N - a width of B and width of C matrices.
+        \param [in] K - a width of A and height of B matrices.
+        \param [in] A - a pointer to input A matrix. Its size is M x K (K x M if transA is ::SimdTrue).
+        \param [in] lda - a leading dimension of A matrix.
+        \param [in] transA - a flag of transposed A matrix.
+        \param [in] B - a pointer to input B matrix. Its size is K x N (N x K if transB is ::SimdTrue).
+        \param [in] ldb - a leading dimension of B matrix.
+        \param [in] transB - a flag of transposed B matrix.
+        \param [in] aZero - a pointer to zero points of rows of A matrix (M values). It can be NULL (all zero points are equal to 0).
+        \param [in] aScale - a pointer to scales of rows of A matrix (M values). It can be NULL (all scales are equal to 1). It is used only for ::SimdTensorData32f output.
+        \param [in] bScale - a pointer to scales of columns of B matrix (N values). It can be NULL (all scales are equal to 1). It is used only for ::SimdTensorData32f output.
+        \param [in] bias - a pointer to bias (N values). It can be NULL. It is used only for ::SimdTensorData32f output.
+        \param [out] C - a pointer to output C matrix.
+        \param [in] ldc - a leading dimension of C matrix (in elements).
+        \param [in] cType - a type of output C matrix. It can be ::SimdTensorData32i or ::SimdTensorData32f.
+    */
+    SIMD_API void SimdGemm8u8i(size_t M, size_t N, size_t K, const uint8_t * A, size_t lda, SimdBool transA, const int8_t * B, size_t ldb, SimdBool transB,
+        const uint8_t * aZero, const float * aScale, const float * bScale, const float * bias, void * C, size_t ldc, SimdTensorDataType cType);
+
     /*! @ingroup gray_conversion
 
         \fn void SimdGrayToBgr(const uint8_t * gray, size_t width, size_t height, size_t grayStride, uint8_t * bgr, size_t bgrStride);
@@ -5175,6 +5560,104 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved U and V values.
+
+        \note This function has a C++ wrapper Simd::Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -5222,36 +5705,118 @@ extern "C"
     SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
         size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
 
-    /*! @ingroup operation
+    /*! @ingroup yuv_conversion
 
-        \fn void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
+        \fn void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short Calculates result 8-bit gray image as product of two vectors.
+        \short Converts P010 image to 24-bit BGR image.
 
-        For all points:
-        \verbatim
-        dst[x, y] = horizontal[x]*vertical[y]/255;
-        \endverbatim
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved 16-bit U and V values.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
 
-        \note This function has a C++ wrappers: Simd::VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, View<A>& dst).
+        \note This function has a C++ wrapper Simd::P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType).
 
-        \param [in] vertical - a pointer to pixels data of vertical vector. It length is equal to result image height.
-        \param [in] horizontal - a pointer to pixels data of horizontal vector. It length is equal to result image width.
-        \param [out] dst - a pointer to pixels data of result image.
-        \param [in] stride - a row size of dst image.
-        \param [in] width - an image width.
-        \param [in] height - an image height.
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
     */
-    SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
-        uint8_t * dst, size_t stride, size_t width, size_t height);
+    SIMD_API void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
 
-    /*! @ingroup recursive_bilateral_filter
+    /*! @ingroup yuv_conversion
 
-        \fn void * SimdRecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
+        \fn void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
 
-        \short Creates Recursive bilateral filter context.
+        \short Converts P010 image to 32-bit BGRA image.
 
-        An using example:
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved 16-bit U and V values.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
+
+        \note This function has a C++ wrapper Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdP010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+        \short Converts P010 image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component and contain interleaved 16-bit U and V values.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+        Output values are normalized to range [0, 1] and are computed with full precision of input samples.
+        Output planes may point to the same buffer (NCHW tensor) and may be swapped to get RGB order.
+
+        \note This function has a C++ wrapper Simd::P010ToBgrPlanar32f(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [out] blue - a pointer to output 32-bit float image with blue color plane.
+        \param [out] green - a pointer to output 32-bit float image with green color plane.
+        \param [out] red - a pointer to output 32-bit float image with red color plane.
+        \param [in] dstStride - a row size of output blue, green and red images (in 32-bit float values).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+    /*! @ingroup operation
+
+        \fn void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
+
+        \short Calculates result 8-bit gray image as product of two vectors.
+
+        For all points:
+        \verbatim
+        dst[x, y] = horizontal[x]*vertical[y]/255;
+        \endverbatim
+
+        \note This function has a C++ wrappers: Simd::VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, View<A>& dst).
+
+        \param [in] vertical - a pointer to pixels data of vertical vector. It length is equal to result image height.
+        \param [in] horizontal - a pointer to pixels data of horizontal vector. It length is equal to result image width.
+        \param [out] dst - a pointer to pixels data of result image.
+        \param [in] stride - a row size of dst image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+    */
+    SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal,
+        uint8_t * dst, size_t stride, size_t width, size_t height);
+
+    /*! @ingroup recursive_bilateral_filter
+
+        \fn void * SimdRecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
+
+        \short Creates Recursive bilateral filter context.
+
+        An using example:
         \verbatim
         float sigmaSpatial = 0.2f, sigmaRange = 0.2f;
         void* filter = SimdRecursiveBilateralFilterInit(width, height, channels, &sigmaSpatial, &sigmaRange, SimdRecursiveBilateralFilterFast);
@@ -6504,6 +7069,132 @@ extern "C"
     SIMD_API void SimdSynetAdd8i(const uint8_t * aData, const float * aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_attention
+
+        \fn void * SimdSynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+
+        \short Initilizes FP32 fused scaled dot-product attention algorithm.
+
+        Algorithm's details (for every batch and head):
+        \verbatim
+        dst = Softmax(Q * K^T * scale + mask) * V
+        \endverbatim
+
+        Softmax is computed blockwise (online) along keys, so the full matrix of scores is never stored.
+
+        \param [in] batch - a batch size.
+        \param [in] heads - a number of attention heads.
+        \param [in] seqQ - a length of query sequence.
+        \param [in] seqK - a length of key (and value) sequence.
+        \param [in] depth - a size of query, key and value vectors in every head.
+        \param [in] scale - a scale of dot products. It is usually equal to 1/sqrt(depth).
+        \param [in] compatibility - a flags of calculation compatibility. If it contains ::SimdSynetCompatibility16bfSoft (or ::SimdSynetCompatibility16bfHard 
+            and AVX-512BF16 is available) queries, keys, values and attention weights are converted to BFloat16 format block by block before calculation.
+        \return a pointer to FP32 attention context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetAttention32fExternalBufferSize, ::SimdSynetAttention32fInternalBufferSize,
+            ::SimdSynetAttention32fInfo and ::SimdSynetAttention32fForward.
+    */
+    SIMD_API void * SimdSynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup synet_attention
+
+        \fn size_t SimdSynetAttention32fExternalBufferSize(const void * context);
+
+        \short Gets size (in 32-bit float values) of external temporary buffer required for FP32 attention algorithm.
+
+        \param [in] context - a pointer to FP32 attention context. It must be created by function ::SimdSynetAttention32fInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for FP32 attention algorithm.
+    */
+    SIMD_API size_t SimdSynetAttention32fExternalBufferSize(const void * context);
+
+    /*! @ingroup synet_attention
+
+        \fn size_t SimdSynetAttention32fInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside FP32 attention algorithm.
+
+        \param [in] context - a pointer to FP32 attention context. It must be created by function ::SimdSynetAttention32fInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside FP32 attention algorithm.
+    */
+    SIMD_API size_t SimdSynetAttention32fInternalBufferSize(const void * context);
+
+    /*! @ingroup synet_attention
+
+        \fn const char* SimdSynetAttention32fInfo(const void* context);
+
+        \short Gets description of internal implementation of FP32 attention algorithm.
+
+        \param [in] context - a pointer to FP32 attention context. It must be created by function ::SimdSynetAttention32fInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of FP32 attention algorithm.
+    */
+    SIMD_API const char* SimdSynetAttention32fInfo(const void* context);
+
+    /*! @ingroup synet_attention
+
+        \fn void SimdSynetAttention32fForward(void * context, const float * q, const float * k, const float * v, const float * mask, float * buf, float * dst);
+
+        \short Performs forward propagation of FP32 attention algorithm.
+
+        \param [in] context - a pointer to FP32 attention context. It must be created by function ::SimdSynetAttention32fInit and released by function ::SimdRelease.
+        \param [in] q - a pointer to query tensor. Its shape is [batch, heads, seqQ, depth].
+        \param [in] k - a pointer to key tensor. Its shape is [batch, heads, seqK, depth].
+        \param [in] v - a pointer to value tensor. Its shape is [batch, heads, seqK, depth].
+        \param [in] mask - a pointer to additive mask. Its shape is [seqQ, seqK]. It is broadcasted over batch and heads. 
+            Use large negative values (for example -10000) to exclude keys. Can be NULL.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer is determined by function ::SimdSynetAttention32fExternalBufferSize.
+            Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor. Its shape is [batch, heads, seqQ, depth].
+    */
+    SIMD_API void SimdSynetAttention32fForward(void * context, const float * q, const float * k, const float * v, const float * mask, float * buf, float * dst);
+
+    /*! @ingroup synet_calibration
+
+        \fn void* SimdSynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+
+        \short Initilizes collector of quantization statistics of 32-bit float tensor.
+
+        The collector accumulates per-channel minimal and maximal values and histograms of absolute values (separately for negative and positive values). 
+        Histogram range is automatically extended when new values exceed it (neighboring bins are merged).
+        Collected statistics are used to estimate quantization ranges for INT8 Synet frameworks (see ::SimdSynetCalibration32fGetStats).
+
+        \param [in] channels - a number of channels in tensor.
+        \param [in] bins - a number of histogram bins for each sign and channel. It must be even and not less than 256. If it is zero then 2048 bins are used.
+        \param [in] format - a format of tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \return a pointer to calibration context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetCalibration32fUpdate and ::SimdSynetCalibration32fGetStats.
+    */
+    SIMD_API void* SimdSynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+
+    /*! @ingroup synet_calibration
+
+        \fn void SimdSynetCalibration32fUpdate(void* context, const float* src, size_t batch, size_t spatial);
+
+        \short Accumulates statistics of given 32-bit float tensor.
+
+        \param [in, out] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibration32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor. Its shape is [batch, channels, spatial] or [batch, spatial, channels] (depends on format).
+        \param [in] batch - a batch size.
+        \param [in] spatial - a spatial size (height * width) of tensor.
+    */
+    SIMD_API void SimdSynetCalibration32fUpdate(void* context, const float* src, size_t batch, size_t spatial);
+
+    /*! @ingroup synet_calibration
+
+        \fn void SimdSynetCalibration32fGetStats(const void* context, SimdSynetCalibrationType type, float param, float* min, float* max);
+
+        \short Estimates per-channel quantization ranges with using of collected statistics.
+
+        The output arrays can be passed as statistics (stats[0] - min, stats[1] - max) to functions ::SimdSynetConvolution8iSetParams, ::SimdSynetScale8iSetParams and others.
+        If channel has no collected values then its range is [0, 0].
+
+        \param [in] context - a pointer to calibration context. It must be created by function ::SimdSynetCalibration32fInit and released by function ::SimdRelease.
+        \param [in] type - a method of estimation of quantization range (see ::SimdSynetCalibrationType).
+        \param [in] param - a parameter of estimation method (percent for ::SimdSynetCalibrationPercentile, number of quantization levels for ::SimdSynetCalibrationEntropy).
+        \param [out] min - a pointer to array with minimal values of channels. Its size is equal to channels.
+        \param [out] max - a pointer to array with maximal values of channels. Its size is equal to channels.
+    */
+    SIMD_API void SimdSynetCalibration32fGetStats(const void* context, SimdSynetCalibrationType type, float param, float* min, float* max);
+
     /*! @ingroup synet_conversion
 
         \fn void SimdSynetConvert32fTo8u(const float * src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float * shift, uint8_t * dst, SimdSynetCompatibilityType compatibility);
@@ -6557,7 +7248,9 @@ extern "C"
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize, 
-            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams and ::SimdSynetConvolution32fForward.
+            ::SimdSynetConvolution32fInfo, ::SimdSynetConvolution32fSetParams, ::SimdSynetConvolution32fForward, 
+            ::SimdSynetConvolution32fExport, ::SimdSynetConvolution32fImport, ::SimdSynetConvolution32fPackedInit, ::SimdSynetConvolution32fSetPacked 
+            and ::SimdSynetConvolution32fReshape.
     */
     SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -6621,6 +7314,107 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, const float * add, float * dst);
+
+        \short Performs forward propagation of FP32 convolution algorithm with fused residual addition.
+
+        It computes dst = Activation(Convolution(src) + bias + add). The residual is added before the activation, so a convolution with activation followed by an eltwise sum layer can be done in one pass over the output.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution32fExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [in] add - a pointer to residual tensor. It has the same shape and format as output tensor. Can be NULL (it is equal to ::SimdSynetConvolution32fForward).
+        \param [out] dst - a pointer to output tensor. It must not overlap with residual tensor.
+    */
+    SIMD_API void SimdSynetConvolution32fForwardAdd(void * context, const float * src, float * buf, const float * add, float * dst);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports packed internal weights of FP32 convolution algorithm.
+
+        The output is an opaque versioned blob. Its header stores the implementation (ISA and algorithm), the convolution parameters and the cache sizes used for packing.
+        Call the function with data = NULL to get the required size of the blob.
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetConvolution32fSetParams.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer in bytes.
+        \return the size in bytes of the blob. The blob is written only if size is not less than this value.
+    */
+    SIMD_API size_t SimdSynetConvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, SimdBool attach);
+
+        \short Imports packed internal weights of FP32 convolution algorithm. It replaces ::SimdSynetConvolution32fSetParams and does no repacking.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to a blob created by function ::SimdSynetConvolution32fExport.
+        \param [in] size - a size of the blob in bytes.
+        \param [in] attach - a flag to use the blob without copying (for example memory-mapped file). 
+            In this case the blob must be aligned to 64 bytes and must stay alive until the context is released. An unaligned blob is copied.
+        \return ::SimdTrue if the blob matches the context (the same implementation, layout of packed weights and parameters besides batch and spatial sizes) and it was imported successfully.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fImport(void * context, const void * data, size_t size, SimdBool attach);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void * SimdSynetConvolution32fPackedInit(const void * context);
+
+        \short Creates shared read-only packed weights of FP32 convolution algorithm.
+
+        The packed weights can be attached to many FP32 convolution contexts (for example one context per worker thread) with using of function ::SimdSynetConvolution32fSetPacked.
+        So the memory used for weights does not grow with number of contexts. 
+
+        \param [in] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetConvolution32fSetParams.
+        \return a pointer to shared packed weights. It must be released with using of function ::SimdRelease. 
+            The weights are reference counted: they can be released before the contexts which use them.
+    */
+    SIMD_API void * SimdSynetConvolution32fPackedInit(const void * context);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fSetPacked(void * context, const void * packed);
+
+        \short Attaches shared packed weights to FP32 convolution context. It replaces ::SimdSynetConvolution32fSetParams.
+
+        The context parameters may differ from parameters of the context used in ::SimdSynetConvolution32fPackedInit in batch or spatial size 
+        if the implementation and layout of packed weights are the same. 
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] packed - a pointer to shared packed weights created by function ::SimdSynetConvolution32fPackedInit.
+        \return ::SimdTrue if the weights are compatible with the context and were attached. 
+            In this case the context must not be passed to function ::SimdSynetConvolution32fSetParams.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fSetPacked(void * context, const void * packed);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Changes batch size and spatial size of input tensor of FP32 convolution context.
+
+        Output sizes are recalculated from the convolution parameters passed to function ::SimdSynetConvolution32fInit.
+        The context creates an internal plan for every new input shape and caches it, so switching between known shapes is cheap.
+        Plans with the same layout of packed weights share the weights packed by function ::SimdSynetConvolution32fSetParams without a copy. 
+        If the algorithm chosen for the new shape uses another layout, its plan packs the weights again from the original weights passed to function ::SimdSynetConvolution32fSetParams.
+        The context keeps only pointers to them, so the caller must keep weights, biases and parameters alive (and unchanged) while the context is reshaped. 
+        A call of function ::SimdSynetConvolution32fSetParams drops cached plans and returns the context to the initial shape.
+        After successful call functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInfo and ::SimdSynetConvolution32fForward work with the new shape.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetConvolution32fSetParams.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return ::SimdTrue if the context was reshaped. ::SimdFalse if the new shape is invalid, or if the weights were attached by function ::SimdSynetConvolution32fSetPacked (or ::SimdSynetConvolution32fImport) 
+            and the algorithm chosen for the new shape uses another layout of packed weights. In this case the context keeps its current shape.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -6632,7 +7426,8 @@ extern "C"
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to INT8 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetConvolution8iExternalBufferSize, ::SimdSynetConvolution8iInternalBufferSize, 
-            ::SimdSynetConvolution8iInfo, ::SimdSynetConvolution8iSetParams and ::SimdSynetConvolution8iForward.
+            ::SimdSynetConvolution8iInfo, ::SimdSynetConvolution8iSetParams, ::SimdSynetConvolution8iForward, 
+            ::SimdSynetConvolution8iExport, ::SimdSynetConvolution8iImport, ::SimdSynetConvolution8iPackedInit and ::SimdSynetConvolution8iSetPacked.
     */
     SIMD_API void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -6696,18 +7491,103 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+    /*! @ingroup synet_convolution_int8
+
+        \fn void SimdSynetConvolution8iForwardAdd(void * context, const uint8_t * src, uint8_t * buf, const uint8_t * add, const float * addScale, const float * addShift, uint8_t * dst);
+
+        \short Performs forward propagation of INT8 convolution algorithm with fused residual addition.
+
+        It computes dst = Activation(Convolution(src) + bias + add) before output quantization. 
+        The residual tensor has the same shape, format and type as output tensor. 
+        If output type is ::SimdTensorData8u then the residual is dequantized as add[i] * addScale[c] + addShift[c] (c is channel index).
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [in] add - a pointer to residual tensor. Can be NULL (it is equal to ::SimdSynetConvolution8iForward).
+        \param [in] addScale - a pointer to per channel dequantization scale of the residual. Can be NULL (the output quantization of the context is used). It is ignored for FP32 output.
+        \param [in] addShift - a pointer to per channel dequantization shift of the residual. Can be NULL (the output quantization of the context is used). It is ignored for FP32 output.
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetConvolution8iForwardAdd(void * context, const uint8_t * src, uint8_t * buf, const uint8_t * add, const float * addScale, const float * addShift, uint8_t * dst);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+        \short Exports packed internal weights of INT8 convolution algorithm.
+
+        The output is an opaque versioned blob. Its header stores the implementation (ISA and algorithm), the convolution parameters and the cache sizes used for packing.
+        Call the function with data = NULL to get the required size of the blob.
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetConvolution8iSetParams.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer in bytes.
+        \return the size in bytes of the blob. The blob is written only if size is not less than this value.
+    */
+    SIMD_API size_t SimdSynetConvolution8iExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, SimdBool attach);
+
+        \short Imports packed internal weights of INT8 convolution algorithm. It replaces ::SimdSynetConvolution8iSetParams and does no repacking.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to a blob created by function ::SimdSynetConvolution8iExport.
+        \param [in] size - a size of the blob in bytes.
+        \param [in] attach - a flag to use the blob without copying (for example memory-mapped file). 
+            In this case the blob must be aligned to 64 bytes and must stay alive until the context is released. An unaligned blob is copied.
+        \return ::SimdTrue if the blob matches the context (the same implementation, layout of packed weights and parameters besides batch and spatial sizes) and it was imported successfully.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iImport(void * context, const void * data, size_t size, SimdBool attach);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn void * SimdSynetConvolution8iPackedInit(const void * context);
+
+        \short Creates shared read-only packed weights of INT8 convolution algorithm.
+
+        The packed weights can be attached to many INT8 convolution contexts (for example one context per worker thread) with using of function ::SimdSynetConvolution8iSetPacked.
+        So the memory used for weights does not grow with number of contexts. 
+
+        \param [in] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetConvolution8iSetParams.
+        \return a pointer to shared packed weights. It must be released with using of function ::SimdRelease. 
+            The weights are reference counted: they can be released before the contexts which use them.
+    */
+    SIMD_API void * SimdSynetConvolution8iPackedInit(const void * context);
+
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iSetPacked(void * context, const void * packed);
+
+        \short Attaches shared packed weights to INT8 convolution context. It replaces ::SimdSynetConvolution8iSetParams.
+
+        The context parameters may differ from parameters of the context used in ::SimdSynetConvolution8iPackedInit in batch or spatial size 
+        if the implementation and layout of packed weights are the same. 
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] packed - a pointer to shared packed weights created by function ::SimdSynetConvolution8iPackedInit.
+        \return ::SimdTrue if the weights are compatible with the context and were attached. 
+            In this case the context must not be passed to function ::SimdSynetConvolution8iSetParams.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iSetPacked(void * context, const void * packed);
+
     /*! @ingroup synet_deconvolution_fp32
 
         \fn void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
         \short Initilizes FP32 deconvolution algorithm.
 
+        If compatibility contains ::SimdSynetCompatibility16bfSoft (or ::SimdSynetCompatibility16bfHard on platforms with hardware BF16 support)
+        then matrix multiplication of deconvolution in NHWC format is performed in BF16 format with using of BF16 convolution microkernels.
+
         \param [in] batch - a batch size.
         \param [in] conv - a pointer to deconvolution parameters.
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to FP32 deconvolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetDeconvolution32fExternalBufferSize, ::SimdSynetDeconvolution32fInternalBufferSize, 
-            ::SimdSynetDeconvolution32fInfo, ::SimdSynetDeconvolution32fSetParams and ::SimdSynetDeconvolution32fForward.
+            ::SimdSynetDeconvolution32fInfo, ::SimdSynetDeconvolution32fSetParams, ::SimdSynetDeconvolution32fForward and ::SimdSynetDeconvolution32fReshape.
     */
     SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -6771,6 +7651,107 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_deconvolution_fp32
+
+        \fn SimdBool SimdSynetDeconvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Changes batch size and spatial size of input tensor of FP32 deconvolution context.
+
+        Output sizes are recalculated from the convolution parameters passed to function ::SimdSynetDeconvolution32fInit.
+        The context creates an internal plan for every new input shape and caches it, so switching between known shapes is cheap.
+        Plans with the same layout of packed weights share the weights packed by function ::SimdSynetDeconvolution32fSetParams without a copy. 
+        If the algorithm chosen for the new shape uses another layout, its plan packs the weights again from the original weights passed to function ::SimdSynetDeconvolution32fSetParams.
+        The context keeps only pointers to them, so the caller must keep weights, biases and parameters alive (and unchanged) while the context is reshaped. 
+        A call of function ::SimdSynetDeconvolution32fSetParams drops cached plans and returns the context to the initial shape.
+        After successful call functions ::SimdSynetDeconvolution32fExternalBufferSize, ::SimdSynetDeconvolution32fInfo and ::SimdSynetDeconvolution32fForward work with the new shape.
+
+        \param [in, out] context - a pointer to FP32 deconvolution context. It must be created by function ::SimdSynetDeconvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetDeconvolution32fSetParams.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return ::SimdTrue if the context was reshaped. ::SimdFalse if the new shape is invalid. In this case the context keeps its current shape.
+    */
+    SIMD_API SimdBool SimdSynetDeconvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn void * SimdSynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+
+        \short Initilizes INT8 deconvolution algorithm.
+
+        Matrix multiplication of deconvolution is performed with using of INT8 convolution microkernels (see ::SimdSynetConvolution8iInit).
+        Accumulation of overlapped outputs, bias, activation function and output quantization are performed in 32-bit float point.
+        It supports only NHWC format (::SimdTensorFormatNhwc) and group = 1.
+
+        \param [in] batch - a batch size.
+        \param [in] conv - a pointer to deconvolution parameters. Input (srcT) and output (dstT) can be ::SimdTensorData32f or ::SimdTensorData8u.
+        \param [in] compatibility - a flags of calculation compatibility.
+        \return a pointer to INT8 deconvolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetDeconvolution8iExternalBufferSize, ::SimdSynetDeconvolution8iInternalBufferSize, 
+            ::SimdSynetDeconvolution8iInfo, ::SimdSynetDeconvolution8iSetParams and ::SimdSynetDeconvolution8iForward.
+    */
+    SIMD_API void * SimdSynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn size_t SimdSynetDeconvolution8iExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for INT8 deconvolution algorithm.
+
+        \param [in] context - a pointer to INT8 deconvolution context. It must be created by function ::SimdSynetDeconvolution8iInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for INT8 deconvolution algorithm.
+    */
+    SIMD_API size_t SimdSynetDeconvolution8iExternalBufferSize(const void * context);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn size_t SimdSynetDeconvolution8iInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside INT8 deconvolution algorithm.
+
+        \param [in] context - a pointer to INT8 deconvolution context. It must be created by function ::SimdSynetDeconvolution8iInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside INT8 deconvolution algorithm.
+    */
+    SIMD_API size_t SimdSynetDeconvolution8iInternalBufferSize(const void * context);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn const char* SimdSynetDeconvolution8iInfo(const void* context);
+
+        \short Gets description of internal implementation of INT8 deconvolution algorithm.
+
+        \param [in] context - a pointer to INT8 deconvolution context. It must be created by function ::SimdSynetDeconvolution8iInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of INT8 deconvolution algorithm.
+    */
+    SIMD_API const char* SimdSynetDeconvolution8iInfo(const void* context);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn void SimdSynetDeconvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const * stats);
+
+        \short Sets weights, biases, parameters of activation function, input/output tensor statistics required for INT8 deconvolution algorithm.
+
+        \param [in, out] context - a pointer to INT8 deconvolution context. It must be created by function ::SimdSynetDeconvolution8iInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) deconvolution weights.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+    */
+    SIMD_API void SimdSynetDeconvolution8iSetParams(void * context, const float * weight, const float * bias, const float * params, const float * const* stats);
+
+    /*! @ingroup synet_deconvolution_int8
+
+        \fn void SimdSynetDeconvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+        \short Performs forward propagation of INT8 deconvolution algorithm.
+
+        \param [in] context - a pointer to INT8 deconvolution context. It must be created by function ::SimdSynetDeconvolution8iInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetDeconvolution8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetDeconvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -7165,38 +8146,112 @@ extern "C"
 
     /*! @ingroup synet_inner_product
 
-        \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+        \fn void * SimdSynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
 
-        \short This function is used for forward propagation of InnerProductLayer.
+        \short Initilizes FP32 inner product algorithm with 4-bit compressed weights.
 
-        Algorithm's details:
+        Weights are quantized to 4-bit unsigned integers with group-wise (along input dimension) scale and shift:
         \verbatim
-        for(i = 0; i < count; ++i)
-        {
-            dst[i] = (bias ? bias[i] : 0);
-            for(j = 0; j < size; ++j)
-               dst[i] += src[j]*weight[i*size + j];
-        }
+        weight[o][i] ~ q[o][i] * scale[o][i / group] + shift[o][i / group], where q[o][i] in [0, 15]
         \endverbatim
+        Shift is equal to minimal weight in the group, scale is equal to (max - min) / 15. 
+        So the absolute error of each restored weight does not exceed (max - min) / 30 of its group.
+        Weights are dequantized in registers, input, output and accumulation are in 32-bit float point.
+        This algorithm is useful for memory bound cases (small batch and large weight matrix).
 
-        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
-
-        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to size.
-        \param [in] weight - a pointer to the 32-bit float array with weight coefficients. The size of the array must be equal to count*size.
-        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. The size of the array must be equal to count. Can be NULL. 
-        \param [in] count - a size of output array.
-        \param [in] size - a size of input array.
-        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count.
+        \param [in] batch - a batch size.
+        \param [in] input - a input vector size.
+        \param [in] output - a output vector size.
+        \param [in] group - a size of quantization group. It must be a multiple of 32.
+        \param [in] transpose - a flag of transposing of weight matrix. If it is ::SimdTrue then weight has shape [output, input], else [input, output].
+        \param [in] activation - an activation function type used after inner product.
+        \return a pointer to 4-bit inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct4bInternalBufferSize, ::SimdSynetInnerProduct4bInfo, 
+            ::SimdSynetInnerProduct4bSetParams and ::SimdSynetInnerProduct4bForward.
     */
-    SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+    SIMD_API void* SimdSynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
 
     /*! @ingroup synet_inner_product
 
-        \fn void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t * src, const int8_t * weight, int32_t * dst, SimdSynetCompatibilityType compatibility);
+        \fn size_t SimdSynetInnerProduct4bInternalBufferSize(const void * context);
 
-        \short This function is used for INT8 forward propagation of InnerProductLayer.
+        \short Gets size of internal buffer used inside 4-bit inner product algorithm.
 
-        Algorithm's details:
+        \param [in] context - a pointer to 4-bit inner product context. It must be created by function ::SimdSynetInnerProduct4bInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside 4-bit inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct4bInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn const char* SimdSynetInnerProduct4bInfo(const void* context);
+
+        \short Gets description of internal implementation of 4-bit inner product algorithm.
+
+        \param [in] context - a pointer to 4-bit inner product context. It must be created by function ::SimdSynetInnerProduct4bInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of 4-bit inner product algorithm.
+    */
+    SIMD_API const char* SimdSynetInnerProduct4bInfo(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct4bSetParams(void* context, const float* weight, const float* bias, const float* params);
+
+        \short Sets weights, biases and parameters of activation function required for 4-bit inner product algorithm.
+
+        \param [in, out] context - a pointer to 4-bit inner product context. It must be created by function ::SimdSynetInnerProduct4bInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) inner product weights. They are compressed to internal buffer.
+        \param [in] bias - a pointer to bias. Can be NULL.
+        \param [in] params - a pointer to parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+    */
+    SIMD_API void SimdSynetInnerProduct4bSetParams(void* context, const float* weight, const float* bias, const float* params);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct4bForward(void* context, const float* src, float* dst);
+
+        \short Performs forward propagation of 4-bit inner product algorithm.
+
+        \param [in] context - a pointer to 4-bit inner product context. It must be created by function ::SimdSynetInnerProduct4bInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor. Its shape is [batch, input].
+        \param [out] dst - a pointer to output tensor. Its shape is [batch, output].
+    */
+    SIMD_API void SimdSynetInnerProduct4bForward(void* context, const float* src, float* dst);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+
+        \short This function is used for forward propagation of InnerProductLayer.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            dst[i] = (bias ? bias[i] : 0);
+            for(j = 0; j < size; ++j)
+               dst[i] += src[j]*weight[i*size + j];
+        }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to size.
+        \param [in] weight - a pointer to the 32-bit float array with weight coefficients. The size of the array must be equal to count*size.
+        \param [in] bias - a pointer to the 32-bit float array with bias coefficients. The size of the array must be equal to count. Can be NULL. 
+        \param [in] count - a size of output array.
+        \param [in] size - a size of input array.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to count.
+    */
+    SIMD_API void SimdSynetInnerProductLayerForward(const float * src, const float * weight, const float * bias, size_t count, size_t size, float * dst);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t * src, const int8_t * weight, int32_t * dst, SimdSynetCompatibilityType compatibility);
+
+        \short This function is used for INT8 forward propagation of InnerProductLayer.
+
+        Algorithm's details:
         \verbatim
         for (i = 0; i < M; ++i)
         {
@@ -7222,6 +8277,113 @@ extern "C"
     */
     SIMD_API void SimdSynetInnerProduct8i(size_t M, size_t N, size_t K, const uint8_t * src, const int8_t * weight, int32_t * dst, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_inner_product
+
+        \fn void * SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+        \short Initilizes INT8 inner product algorithm.
+
+        Input is quantized to 8-bit unsigned integers, weights are quantized to 8-bit signed integers with per output channel scales.
+        Bias and activation function are applied in 32-bit float point.
+
+        \param [in] batch - a batch size.
+        \param [in] input - a input vector size.
+        \param [in] output - a output vector size.
+        \param [in] transpose - a flag of transposing of weight matrix. If it is ::SimdTrue then weight has shape [output, input], else [input, output].
+        \param [in] srcT - a type of input tensor (::SimdTensorData32f or ::SimdTensorData8u).
+        \param [in] dstT - a type of output tensor (::SimdTensorData32f or ::SimdTensorData8u).
+        \param [in] activation - an activation function type used after inner product.
+        \param [in] compatibility - a flags of calculation compatibility.
+        \return a pointer to INT8 inner product context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetInnerProduct8iExternalBufferSize, ::SimdSynetInnerProduct8iInternalBufferSize, 
+            ::SimdSynetInnerProduct8iInfo, ::SimdSynetInnerProduct8iSetParams and ::SimdSynetInnerProduct8iForward.
+    */
+    SIMD_API void* SimdSynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, 
+        SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iExternalBufferSize(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn size_t SimdSynetInnerProduct8iInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside INT8 inner product algorithm.
+    */
+    SIMD_API size_t SimdSynetInnerProduct8iInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+        \short Gets description of internal implementation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \return string with description of internal implementation of INT8 inner product algorithm.
+    */
+    SIMD_API const char* SimdSynetInnerProduct8iInfo(const void* context);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats);
+
+        \short Sets weights, biases, parameters of activation function, input/output tensor statistics required for INT8 inner product algorithm.
+
+        \param [in, out] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) inner product weights.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+        \param [in] stats - a pointer to pointers with statistics of input(min - stats[0], max - stats[1]) and output(min - stats[2], max - stats[3]) tensors.
+    */
+    SIMD_API void SimdSynetInnerProduct8iSetParams(void* context, const float* weight, const float* bias, const float* params, const float* const* stats);
+
+    /*! @ingroup synet_inner_product
+
+        \fn void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+        \short Performs forward propagation of INT8 inner product algorithm.
+
+        \param [in] context - a pointer to INT8 inner product context. It must be created by function ::SimdSynetInnerProduct8iInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor (uint8_t or float, see srcT). Its shape is [batch, input].
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetInnerProduct8iExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor (uint8_t or float, see dstT). Its shape is [batch, output].
+    */
+    SIMD_API void SimdSynetInnerProduct8iForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetLogSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
+        \short This function is used for forward propagation of LogSoftmaxLayer.
+
+        Algorithm's details (for every outer and inner index):
+        \verbatim
+        max = Max(src[c]);
+        sum = Sum(exp(src[c] - max));
+        dst[c] = src[c] - max - log(sum);
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input and output arrays.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to outer*count*inner.
+    */
+    SIMD_API void SimdSynetLogSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetLrnLayerCrossChannels(const float * src, size_t half, size_t channels, size_t spatial, const float * k, float * dst, SimdTensorFormatType format);
@@ -7267,7 +8429,8 @@ extern "C"
         \param [in] compatibility - a flags of calculation compatibility.
         \return a pointer to FP32 merged convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
             This pointer is used in functions ::SimdSynetMergedConvolution32fExternalBufferSize, ::SimdSynetMergedConvolution32fInternalBufferSize, 
-            ::SimdSynetMergedConvolution32fInfo, ::SimdSynetMergedConvolution32fSetParams and ::SimdSynetMergedConvolution32fForward.
+            ::SimdSynetMergedConvolution32fInfo, ::SimdSynetMergedConvolution32fSetParams, ::SimdSynetMergedConvolution32fForward, ::SimdSynetMergedConvolution32fReshape,
+            ::SimdSynetMergedConvolution32fExport and ::SimdSynetMergedConvolution32fImport.
     */
     SIMD_API void * SimdSynetMergedConvolution32fInit(size_t batch, const SimdConvolutionParameters * convs, 
         size_t count, SimdBool add, SimdSynetCompatibilityType compatibility);
@@ -7332,6 +8495,57 @@ extern "C"
     */
     SIMD_API void SimdSynetMergedConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_merged_convolution_fp32
+
+        \fn SimdBool SimdSynetMergedConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+        \short Changes batch size and spatial size of input tensor of FP32 merged convolution context without repacking of its weights.
+
+        Output sizes are recalculated from the convolution parameters passed to function ::SimdSynetMergedConvolution32fInit. The input sizes of the second and the third convolutions are taken from outputs of previous ones.
+        The context creates an internal plan for every new input shape and caches it, so switching between known shapes is cheap.
+        All plans share the weights packed by function ::SimdSynetMergedConvolution32fSetParams. A call of function ::SimdSynetMergedConvolution32fSetParams drops cached plans and returns the context to the initial shape.
+        After successful call functions ::SimdSynetMergedConvolution32fExternalBufferSize, ::SimdSynetMergedConvolution32fInfo and ::SimdSynetMergedConvolution32fForward work with the new shape.
+
+        \param [in, out] context - a pointer to FP32 merged convolution context. It must be created by function ::SimdSynetMergedConvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetMergedConvolution32fSetParams.
+        \param [in] batch - a new batch size.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return ::SimdTrue if the context was reshaped. ::SimdFalse if the new shape is invalid or the algorithm chosen for it uses another layout of packed weights. 
+            In this case the context keeps its current shape and a new context has to be created for the new shape.
+    */
+    SIMD_API SimdBool SimdSynetMergedConvolution32fReshape(void * context, size_t batch, size_t srcH, size_t srcW);
+
+    /*! @ingroup synet_merged_convolution_fp32
+
+        \fn size_t SimdSynetMergedConvolution32fExport(const void * context, void * data, size_t size);
+
+        \short Exports packed internal weights of FP32 merged convolution algorithm.
+
+        The output is an opaque versioned blob. Its header stores the implementation (ISA and algorithm), the parameters of all merged convolutions and the cache sizes used for packing.
+        Call the function with data = NULL to get the required size of the blob.
+
+        \param [in] context - a pointer to FP32 merged convolution context. It must be created by function ::SimdSynetMergedConvolution32fInit and released by function ::SimdRelease. Its parameters must be set by function ::SimdSynetMergedConvolution32fSetParams.
+        \param [out] data - a pointer to output buffer. Can be NULL.
+        \param [in] size - a size of output buffer in bytes.
+        \return the size in bytes of the blob. The blob is written only if size is not less than this value.
+    */
+    SIMD_API size_t SimdSynetMergedConvolution32fExport(const void * context, void * data, size_t size);
+
+    /*! @ingroup synet_merged_convolution_fp32
+
+        \fn SimdBool SimdSynetMergedConvolution32fImport(void * context, const void * data, size_t size, SimdBool attach);
+
+        \short Imports packed internal weights of FP32 merged convolution algorithm. It replaces ::SimdSynetMergedConvolution32fSetParams and does no repacking.
+
+        \param [in, out] context - a pointer to FP32 merged convolution context. It must be created by function ::SimdSynetMergedConvolution32fInit and released by function ::SimdRelease.
+        \param [in] data - a pointer to a blob created by function ::SimdSynetMergedConvolution32fExport.
+        \param [in] size - a size of the blob in bytes.
+        \param [in] attach - a flag to use the blob without copying (for example memory-mapped file). 
+            In this case the blob must be aligned to 64 bytes and must stay alive until the context is released. An unaligned blob is copied.
+        \return ::SimdTrue if the blob matches the context (the same implementation, layout of packed weights and parameters besides batch and spatial sizes) and it was imported successfully.
+    */
+    SIMD_API SimdBool SimdSynetMergedConvolution32fImport(void * context, const void * data, size_t size, SimdBool attach);
+
     /*! @ingroup synet_merged_convolution_int8
 
         \fn void * SimdSynetMergedConvolution8iInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdSynetCompatibilityType compatibility);
@@ -7465,6 +8679,90 @@ extern "C"
     SIMD_API void SimdSynetNormalizeLayerForward(const float* src, size_t batch, size_t channels, size_t spatial,
         const float* scale, const float* eps, SimdBool acrossSpatial, SimdTensorFormatType format, float* buf, float* dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        \short Performs forward propagation of LayerNormLayer (normalization across channels) with optional activation.
+
+        Algorithm's details (NHWC format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(s = 0; s < spatial; ++s)
+            {
+                mean = 0;
+                for(c = 0; c < channels; ++c)
+                    mean += src[b, s, c];
+                mean /= channels;
+                var = 0;
+                for(c = 0; c < channels; ++c)
+                    var += Square(src[b, s, c] - mean);
+                var /= channels;
+                for(c = 0; c < channels; ++c)
+                    dst[b, s, c] = Activation((src[b, s, c] - mean) / Sqrt(var + eps) * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] batch - a batch size of input and output tensor.
+        \param [in] channels - a number of channels in input and output tensor.
+        \param [in] spatial - a spatial size (height*width) of input and output tensor.
+        \param [in] format - a format of input and output tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] scale - an array with scale parameters. The size of the array is equal to channels.
+        \param [in] shift - an array with shift parameters. The size of the array is equal to channels.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [in] activation - an activation function type applied after normalization.
+        \param [in] params - a pointer to activation parameters (see ::SimdConvolutionActivationType). Can be NULL for activations without parameters.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer must be equal to 2*spatial (it is used only for ::SimdTensorFormatNchw). Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+    */
+    SIMD_API void SimdSynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+        const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format, const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        \short Performs forward propagation of GroupNormLayer with optional activation.
+
+        Channels are split into groups, mean and variance are estimated for every group across its channels and whole spatial size.
+        InstanceNorm is the case of groups = channels. The case of groups = 1 normalizes whole tensor of every batch item.
+
+        Algorithm's details (NCHW format):
+        \verbatim
+        size = channels / groups * spatial;
+        for(b = 0; b < batch; ++b)
+            for(g = 0; g < groups; ++g)
+            {
+                mean = Sum(src[b, g, i], i = 0..size) / size;
+                var = Sum(Square(src[b, g, i] - mean), i = 0..size) / size;
+                for(c = 0; c < channels / groups; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        dst[b, g, c, s] = Activation((src[b, g, c, s] - mean) / Sqrt(var + eps) * scale[g, c] + shift[g, c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] batch - a batch size of input and output tensor.
+        \param [in] channels - a number of channels in input and output tensor. It must be a multiple of groups.
+        \param [in] spatial - a spatial size (height*width) of input and output tensor.
+        \param [in] groups - a number of groups.
+        \param [in] format - a format of input and output tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] scale - an array with scale parameters. The size of the array is equal to channels.
+        \param [in] shift - an array with shift parameters. The size of the array is equal to channels.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [in] activation - an activation function type applied after normalization.
+        \param [in] params - a pointer to activation parameters (see ::SimdConvolutionActivationType). Can be NULL for activations without parameters.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer must be equal to 3*channels (it is used only for ::SimdTensorFormatNhwc). Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+    */
+    SIMD_API void SimdSynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+        const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
     /*! @ingroup synet_permute
 
         \fn void* SimdSynetPermuteInit(const size_t * shape, const size_t* order, size_t count, SimdTensorDataType type);
@@ -7587,6 +8885,61 @@ extern "C"
     SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+    /*! @ingroup synet_pooling
+
+        \fn void SimdSynetRoiAlign32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale, size_t samplingRatio, SimdBool aligned, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        \short Performs ROI Align (bilinear sampling of regions of interest into fixed size output) for batch of ROIs.
+
+        Every output bin is an average of samplingRatio*samplingRatio bilinearly interpolated points of input feature map. 
+        Points outside of feature map (more than one pixel) give zero contribution.
+        ROIs are processed in parallel threads.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float feature map. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] rois - a pointer to ROIs (x0, y0, x1, y1) in image coordinates. The size of the array must be equal to 4*roiCount.
+        \param [in] roiCount - a number of ROIs.
+        \param [in] spatialScale - a scale from image coordinates to feature map coordinates.
+        \param [in] samplingRatio - a number of sampling points in bin along each axis. If it is 0 then it is adaptive (ceil(roiSize/dstSize)).
+        \param [in] aligned - a flag to shift ROI coordinates by -0.5 pixel (pixel-center alignment). If it is not set then minimal ROI size is 1 pixel.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to roiCount*srcC*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] format - a format of (input/output) tensor. Outputs of different ROIs follow one after another.
+    */
+    SIMD_API void SimdSynetRoiAlign32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+        size_t samplingRatio, SimdBool aligned, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+    /*! @ingroup synet_pooling
+
+        \fn void SimdSynetRoiPoolingMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale, float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+        \short Performs ROI Max Pooling for batch of ROIs.
+
+        ROI coordinates are rounded to feature map pixels, every output bin is a maximum over corresponding rectangle of feature map (or 0 for empty rectangle).
+        ROIs are processed in parallel threads.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float feature map. The size of the array must be equal to srcC*srcH*srcW.
+        \param [in] srcC - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] rois - a pointer to ROIs (x0, y0, x1, y1) in image coordinates. The size of the array must be equal to 4*roiCount.
+        \param [in] roiCount - a number of ROIs.
+        \param [in] spatialScale - a scale from image coordinates to feature map coordinates.
+        \param [out] dst - a pointer to the output 32-bit float array. The size of the array must be equal to roiCount*srcC*dstH*dstW.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] format - a format of (input/output) tensor. Outputs of different ROIs follow one after another.
+    */
+    SIMD_API void SimdSynetRoiPoolingMax32f(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * rois, size_t roiCount, float spatialScale,
+        float * dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
 
     /*! @ingroup synet_activation
 
@@ -7814,6 +9167,26 @@ extern "C"
     */
     SIMD_API void SimdSynetSigmoid32f(const float* src, size_t size, const float* slope, float* dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxArgMax32f(const float * src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void * index, float * prob);
+
+        \short Finds index of maximal value and its softmax probability along softmax dimmension without materializing of probabilities.
+
+        It can be used for segmentation (per-pixel class label map, outer = batch, count = channels, inner = height*width for NCHW format or
+        outer = batch*height*width, count = channels, inner = 1 for NHWC format) and classification heads.
+        In case of equal maximal values the lowest index is returned.
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input array.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input array.
+        \param [in] indexType - a type of output indices. It can be ::SimdTensorData8u (count must be not greater than 256), ::SimdTensorData16u (count must be not greater than 65536) or ::SimdTensorData32i.
+        \param [out] index - a pointer to the output array with indices of maximal values. The size of the array must be equal to outer*inner.
+        \param [out] prob - a pointer to the output 32-bit float array with softmax probabilities of maximal values. The size of the array must be equal to outer*inner. Can be NULL.
+    */
+    SIMD_API void SimdSynetSoftmaxArgMax32f(const float * src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void * index, float * prob);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
@@ -7830,6 +9203,24 @@ extern "C"
     */
     SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmaxTopK32f(const float * src, size_t outer, size_t count, size_t inner, size_t k, uint32_t * index, float * prob);
+
+        \short Finds K maximal values and their softmax probabilities along softmax dimmension without materializing of probabilities.
+
+        Output values are sorted in descending order (in case of equal values the lower index goes first).
+
+        \param [in] src - a pointer to the input 32-bit float array. The size of the array must be equal to outer*count*inner.
+        \param [in] outer - an outer size of input array.
+        \param [in] count - a size of softmax dimmension.
+        \param [in] inner - an inner size of input array.
+        \param [in] k - a number of found maximal values. It must be in range [1 .. count].
+        \param [out] index - a pointer to the output array with indices of maximal values. Its shape is [outer, inner, k].
+        \param [out] prob - a pointer to the output 32-bit float array with softmax probabilities of maximal values. Its shape is [outer, inner, k]. Can be NULL.
+    */
+    SIMD_API void SimdSynetSoftmaxTopK32f(const float * src, size_t outer, size_t count, size_t inner, size_t k, uint32_t * index, float * prob);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetSoftplus32f(const float* src, size_t size, const float * beta, const float * threshold, float * dst);
@@ -7873,6 +9264,26 @@ extern "C"
     */
     SIMD_API void SimdSynetSwish32f(const float* src, size_t size, const float* slope, float* dst);
 
+    /*! @ingroup synet_activation
+
+        \fn void SimdSynetGelu32f(const float * src, size_t size, float * dst);
+
+        \short This function is used for forward propagation of GeluLayer.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = 0.5 * src[i] * (1 + erf(src[i] / sqrt(2)));
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [out] dst - a pointer to output 32-bit float array.
+    */
+    SIMD_API void SimdSynetGelu32f(const float* src, size_t size, float* dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetTanh32f(const float * src, size_t size, const float * slope, float * dst);
@@ -7912,6 +9323,78 @@ extern "C"
     */
     SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float * src, size_t size, SimdSynetUnaryOperation32fType type, float * dst);
 
+    /*! @ingroup synet_workspace
+
+        \fn void* SimdSynetWorkspaceInit();
+
+        \short Initilizes workspace planner for external buffers of sequence of Synet layers.
+
+        The planner collects external (temporary) buffers of layer contexts and user buffers together with their lifetimes 
+        (indices of first and last step of network where buffer is used) and places them in one memory arena. 
+        Buffers with overlapping lifetimes never share memory, other buffers may reuse the same memory.
+
+        \return a pointer to workspace planner context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetWorkspaceAddContext, ::SimdSynetWorkspaceAddBuffer, ::SimdSynetWorkspaceSize and ::SimdSynetWorkspaceOffset.
+    */
+    SIMD_API void* SimdSynetWorkspaceInit();
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceAddContext(void* workspace, SimdSynetContextType type, const void* context, size_t step);
+
+        \short Registers external buffer of Synet layer context in workspace planner.
+
+        The buffer size is taken from corresponding function ExternalBufferSize (for example ::SimdSynetConvolution32fExternalBufferSize).
+        Contexts without external buffer (FP32 inner product, permute, scale) are registered with zero size.
+        The buffer is alive only at given step.
+
+        \param [in, out] workspace - a pointer to workspace planner context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \param [in] type - a type of Synet context (see ::SimdSynetContextType).
+        \param [in] context - a pointer to Synet context. Its parameters must be set (with SetParams) before registration.
+        \param [in] step - an index of network step where the context is used.
+        \return an index of registered buffer. It is used in function ::SimdSynetWorkspaceOffset.
+    */
+    SIMD_API size_t SimdSynetWorkspaceAddContext(void* workspace, SimdSynetContextType type, const void* context, size_t step);
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceAddBuffer(void* workspace, size_t size, size_t first, size_t last);
+
+        \short Registers user buffer (for example intermediate tensor) in workspace planner.
+
+        \param [in, out] workspace - a pointer to workspace planner context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \param [in] size - a size of buffer in bytes.
+        \param [in] first - an index of first network step where the buffer is used.
+        \param [in] last - an index of last network step where the buffer is used. It must be not less then first.
+        \return an index of registered buffer. It is used in function ::SimdSynetWorkspaceOffset.
+    */
+    SIMD_API size_t SimdSynetWorkspaceAddBuffer(void* workspace, size_t size, size_t first, size_t last);
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceSize(void* workspace);
+
+        \short Gets size of memory arena required for all registered buffers.
+
+        \param [in, out] workspace - a pointer to workspace planner context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \return size of memory arena in bytes.
+    */
+    SIMD_API size_t SimdSynetWorkspaceSize(void* workspace);
+
+    /*! @ingroup synet_workspace
+
+        \fn size_t SimdSynetWorkspaceOffset(void* workspace, size_t index);
+
+        \short Gets offset of registered buffer in memory arena.
+
+        Offsets are aligned to 64 bytes, so if the arena is allocated with ::SimdAllocate then every buffer is aligned too.
+
+        \param [in, out] workspace - a pointer to workspace planner context. It must be created by function ::SimdSynetWorkspaceInit and released by function ::SimdRelease.
+        \param [in] index - an index of buffer returned by function ::SimdSynetWorkspaceAddContext or ::SimdSynetWorkspaceAddBuffer.
+        \return offset of the buffer in memory arena in bytes.
+    */
+    SIMD_API size_t SimdSynetWorkspaceOffset(void* workspace, size_t index);
+
     /*! @ingroup texture_estimation
 
         \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
@@ -8150,6 +9633,65 @@ extern "C"
     */
     SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t* dst);
 
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates context of batched warp affine (many crops from one image).
+
+        The context performs warp affine of one input image with many different matrices into many output images of the same size.
+        Crops are ordered by their position in the input image and distributed across threads, so neighbouring crops share input rows in cache.
+
+        An using example (for BGR image):
+        \verbatim
+        SimdWarpAffineFlags flags = SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant;
+        void* context = SimdWarpAffineBatchInit(srcW, srcH, srcS, dstW, dstH, dstS, 3, flags, NULL);
+        if (context)
+        {
+             SimdWarpAffineBatchRun(context, src, count, mats, dsts);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::WarpAffine(const View<A>& src, const float * mats, std::vector<View<A>> & dsts, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output images.
+        \param [in] dstH - a height of output images.
+        \param [in] dstS - a row size (in bytes) of the output images.
+        \param [in] channels - a channel number of input and output images. Its value must be in range [1..4].
+        \param [in] flags - a flags of algorithm parameters.
+        \param [in] border - a pointer to to the array with color of border. The size of the array mast be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to batched warp affine context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpAffineBatchRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, size_t count, const float* mats, uint8_t** dst);
+
+        \short Performs batched warp affine for current image.
+
+        Every output image is equal to the result of ::SimdWarpAffineRun with corresponding matrix. Output images with degenerate matrices are filled by border color 
+        (if ::SimdWarpAffineBorderConstant flag is used) or are not changed (if ::SimdWarpAffineBorderTransparent flag is used).
+
+        \note This function has a C++ wrapper Simd::WarpAffine(const View<A>& src, const float * mats, std::vector<View<A>> & dsts, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a batched warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] count - a number of output images.
+        \param [in] mats - a pointer to array of count 2x3 matrices with coefficients of affine warp.
+        \param [out] dst - a pointer to array of count pointers to pixels data of the output images.
+        \return ::SimdTrue if all matrices are not degenerate and ::SimdFalse otherwise.
+    */
+    SIMD_API SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, size_t count, const float* mats, uint8_t** dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -8594,6 +10136,188 @@ extern "C"
     SIMD_API void SimdYuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         const uint8_t* a, size_t aStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, SimdYuvType yuvType);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P 16-bit image to 24-bit BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have half width and half height relative to Y component.
+        Samples are stored in low bits of 16-bit values.
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P 16-bit image to 32-bit BGRA image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have half width and half height relative to Y component.
+        Samples are stored in low bits of 16-bit values.
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P 16-bit image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have half width and half height relative to Y component.
+        Samples are stored in low bits of 16-bit values.
+        Output values are normalized to range [0, 1] and are computed with full precision of input samples.
+        Output planes may point to the same buffer (NCHW tensor) and may be swapped to get RGB order.
+
+        \note This function has a C++ wrapper Simd::Yuv420p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width. It must be even number.
+        \param [in] height - an image height. It must be even number.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] blue - a pointer to output 32-bit float image with blue color plane.
+        \param [out] green - a pointer to output 32-bit float image with green color plane.
+        \param [out] red - a pointer to output 32-bit float image with red color plane.
+        \param [in] dstStride - a row size of output blue, green and red images (in 32-bit float values).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P 16-bit image to 24-bit BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
+
+        \note This function has a C++ wrapper Simd::Yuv444p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV444P 16-bit image to 32-bit BGRA image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+        High bit depth samples are reduced to 8 bits by right shift before conversion.
+
+        \note This function has a C++ wrapper Simd::Yuv444p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+        \short Converts YUV444P 16-bit image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+        Output values are normalized to range [0, 1] and are computed with full precision of input samples.
+        Output planes may point to the same buffer (NCHW tensor) and may be swapped to get RGB order.
+
+        \note This function has a C++ wrapper Simd::Yuv444p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input samples (the values are stored in low bits). It must be in range [8, 16].
+        \param [out] blue - a pointer to output 32-bit float image with blue color plane.
+        \param [out] green - a pointer to output 32-bit float image with green color plane.
+        \param [out] red - a pointer to output 32-bit float image with red color plane.
+        \param [in] dstStride - a row size of output blue, green and red images (in 32-bit float values).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv444p16ToBgrPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
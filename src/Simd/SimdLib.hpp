@@ -28,6 +28,7 @@
 #include "Simd/SimdView.hpp"
 #include "Simd/SimdPixel.hpp"
 #include "Simd/SimdPyramid.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #ifndef __SimdLib_hpp__
 #define __SimdLib_hpp__
@@ -915,6 +916,30 @@ namespace Simd
         SimdBgraToRgba(bgra.data, bgra.width, bgra.height, bgra.stride, rgba.data, rgba.stride);
     }
 
+    /*! @ingroup bgra_conversion
+
+        \fn void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 32-bit BGRA image to NV12.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgraToNv12.
+
+        \param [in] bgra - an input 32-bit BGRA image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color planes.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgraToNv12(const View<A>& bgra, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdBgraToNv12(bgra.data, bgra.stride, bgra.width, bgra.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgra_conversion
 
         \fn void BgraToYuv420p(const View<A>& bgra, View<A>& y, View<A>& u, View<A>& v)
@@ -1183,6 +1208,30 @@ namespace Simd
         SimdRgbToBgra(bgr.data, bgr.width, bgr.height, bgr.stride, rgba.data, rgba.stride, alpha);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts 24-bit BGR image to NV12.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToNv12.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [out] y - an output 8-bit image with Y color plane.
+        \param [out] uv - an output 16-bit image with interleaved UV color planes.
+        \param [in] yuvType - a type of output YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToNv12(const View<A>& bgr, View<A>& y, View<A>& uv, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdBgrToNv12(bgr.data, bgr.stride, bgr.width, bgr.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToYuv420p(const View<A>& bgr, View<A>& y, View<A>& u, View<A>& v)
@@ -2986,6 +3035,104 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgb));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgba.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgba));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgba.format == View<A>::Rgba32);
+
+        SimdNv12ToRgba(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgba.data, rgba.stride, alpha, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -3030,6 +3177,86 @@ namespace Simd
         SimdOperationBinary16i(a.data, a.stride, b.data, b.stride, a.width, a.height, dst.data, dst.stride, type);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 24-bit BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgr.format == View<A>::Bgr24);
+
+        SimdP010ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void P010ToBgrPlanar32f(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input UV image must have half width and half height relative to Y component.
+        Samples are stored in high bits of 16-bit values (P010, P012 and P016 formats).
+        Output values are normalized to range [0, 1].
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgrPlanar32f.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit U and V color planes.
+        \param [out] blue - an output 32-bit float image with blue color plane.
+        \param [out] green - an output 32-bit float image with green color plane.
+        \param [out] red - an output 32-bit float image with red color plane.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgrPlanar32f(const View<A>& y, const View<A>& uv, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, blue) && EqualSize(y, green) && EqualSize(y, red));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && blue.format == View<A>::Float && green.format == View<A>::Float && red.format == View<A>::Float);
+        assert(blue.stride == green.stride && blue.stride == red.stride && blue.stride % sizeof(float) == 0);
+
+        SimdP010ToBgrPlanar32f(y.data, y.stride, uv.data, uv.stride, y.width, y.height, (float*)blue.data, (float*)green.data, (float*)red.data, blue.stride / sizeof(float), yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, View<A>& dst)
@@ -4614,6 +4841,45 @@ namespace Simd
         }
     }
 
+    /*! @ingroup warp_affine
+
+        \fn bool WarpAffine(const View<A>& src, const float * mats, std::vector<View<A>> & dsts, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs batched warp affine (many crops) for current image.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpAffineBatchInit and ::SimdWarpAffineBatchRun.
+
+        \param [in] src - an input image.
+        \param [in] mats - a pointer to array of dsts.size() 2x3 matrices with coefficients of affine warp.
+        \param [in, out] dsts - output images. They must have the same size, format and stride.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array mast be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+        \return true if all matrices were applied (see ::SimdWarpAffineBatchRun).
+    */
+    template<template<class> class A> SIMD_INLINE bool WarpAffine(const View<A>& src, const float * mats, std::vector<View<A>> & dsts,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.ChannelSize() == 1 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+        if (dsts.empty())
+            return true;
+
+        std::vector<uint8_t*> dst(dsts.size());
+        for (size_t i = 0; i < dsts.size(); ++i)
+        {
+            assert(src.format == dsts[i].format && EqualSize(dsts[0], dsts[i]) && dsts[0].stride == dsts[i].stride);
+            dst[i] = dsts[i].data;
+        }
+        void* context = SimdWarpAffineBatchInit(src.width, src.height, src.stride, dsts[0].width, dsts[0].height, dsts[0].stride, src.ChannelCount(), flags, border);
+        bool result = false;
+        if (context)
+        {
+            result = SimdWarpAffineBatchRun(context, src.data, dst.size(), mats, dst.data()) == SimdTrue;
+            SimdRelease(context);
+        }
+        return result;
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuva420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, const View<A>& a, View<A>& bgra)
@@ -4641,6 +4907,178 @@ namespace Simd
         SimdYuva420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride, y.width, y.height, bgra.data, bgra.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV420P 16-bit image to 24-bit BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Samples are stored in low bits of 16-bit values.
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v) && EqualSize(y, bgr));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420p16ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV420P 16-bit image to 32-bit BGRA image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Samples are stored in low bits of 16-bit values.
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v) && EqualSize(y, bgra));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV420P 16-bit image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Samples are stored in low bits of 16-bit values.
+        Output values are normalized to range [0, 1].
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgrPlanar32f.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] blue - an output 32-bit float image with blue color plane.
+        \param [out] green - an output 32-bit float image with green color plane.
+        \param [out] red - an output 32-bit float image with red color plane.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && EqualSize(u, v) && EqualSize(y, blue) && EqualSize(y, green) && EqualSize(y, red));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && blue.format == View<A>::Float && green.format == View<A>::Float && red.format == View<A>::Float);
+        assert(blue.stride == green.stride && blue.stride == red.stride && blue.stride % sizeof(float) == 0);
+
+        SimdYuv420p16ToBgrPlanar32f(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, (float*)blue.data, (float*)green.data, (float*)red.data, blue.stride / sizeof(float), yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV444P 16-bit image to 24-bit BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444p16ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(y, u) && EqualSize(y, v) && EqualSize(y, bgr));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv444p16ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV444P 16-bit image to 32-bit BGRA image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+
+        \note This function is a C++ wrapper for function ::SimdYuv444p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. It is equal to 255 by default.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(y, u) && EqualSize(y, v) && EqualSize(y, bgra));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv444p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv444p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts YUV444P 16-bit image to planar 32-bit float BGR image.
+
+        The input Y and output images must have the same width and height.
+        The input Y, U and V images must have the same width and height.
+        Samples are stored in low bits of 16-bit values.
+        Output values are normalized to range [0, 1].
+
+        \note This function is a C++ wrapper for function ::SimdYuv444p16ToBgrPlanar32f.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [8, 16].
+        \param [out] blue - an output 32-bit float image with blue color plane.
+        \param [out] green - an output 32-bit float image with green color plane.
+        \param [out] red - an output 32-bit float image with red color plane.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv444p16ToBgrPlanar32f(const View<A>& y, const View<A>& u, const View<A>& v, int bitDepth, View<A>& blue, View<A>& green, View<A>& red, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(EqualSize(y, u) && EqualSize(y, v) && EqualSize(y, blue) && EqualSize(y, green) && EqualSize(y, red));
+        assert(y.format == View<A>::Int16 && u.format == View<A>::Int16 && v.format == View<A>::Int16 && blue.format == View<A>::Float && green.format == View<A>::Float && red.format == View<A>::Float);
+        assert(blue.stride == green.stride && blue.stride == red.stride && blue.stride % sizeof(float) == 0);
+
+        SimdYuv444p16ToBgrPlanar32f(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, (float*)blue.data, (float*)green.data, (float*)red.data, blue.stride / sizeof(float), yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
@@ -5161,6 +5599,85 @@ namespace Simd
         for (size_t level = 1; level < pyramid.Size(); ++level)
             Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
     }
+
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void Build(Pyramid<A> & pyramid, const std::vector<Rectangle<ptrdiff_t>> & changed, ::SimdReduceType reduceType, bool compensation = true, size_t threadNumber = 1)
+
+        \short Updates the pyramid after changes of some regions of its lowest level.
+
+        Changed regions are propagated to upper levels (with taking into account of reduce kernel size).
+        Only tiles of upper levels which intersect with changed regions are recomputed. Tiles of one level are processed in parallel.
+        The result is the same as after full building of the pyramid with function Simd::Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation).
+
+        \note Upper levels of the pyramid must be already built for previous state of the lowest level.
+
+        \param [in, out] pyramid - an updated pyramid.
+        \param [in] changed - a list of changed regions at the lowest level of the pyramid.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+        \param [in] threadNumber - a maximal number of threads used for processing of tiles. It is equal to 1 by default.
+    */
+    template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, const std::vector<Rectangle<ptrdiff_t>> & changed, ::SimdReduceType reduceType, bool compensation = true, size_t threadNumber = 1)
+    {
+        typedef Rectangle<ptrdiff_t> Rect;
+        const ptrdiff_t TILE = 64, MARGIN = 2;
+
+        std::vector<Rect> dirty, next, tiles;
+        for (size_t i = 0; i < changed.size() && pyramid.Size() > 1; ++i)
+        {
+            Rect rect = changed[i].Intersection(Rect(pyramid.At(0).Size()));
+            if (!rect.Empty())
+                dirty.push_back(rect);
+        }
+        if (dirty.empty())
+            return;
+
+        threadNumber = std::max<size_t>(threadNumber, 1);
+        std::vector<View<A>> buffers(threadNumber);
+        for (size_t thread = 0; thread < threadNumber; ++thread)
+            buffers[thread].Recreate(TILE + 2 * MARGIN, TILE + 2 * MARGIN, View<A>::Gray8);
+
+        for (size_t level = 1; level < pyramid.Size(); ++level)
+        {
+            const View<A> & src = pyramid.At(level - 1);
+            View<A> & dst = pyramid.At(level);
+            ptrdiff_t tilesX = (dst.width + TILE - 1) / TILE, tilesY = (dst.height + TILE - 1) / TILE;
+            std::vector<uint8_t> marks(tilesX * tilesY, 0);
+            next.clear();
+            for (size_t i = 0; i < dirty.size(); ++i)
+            {
+                const Rect & r = dirty[i];
+                Rect d(std::max<ptrdiff_t>(r.Left() - MARGIN, 0) / 2, std::max<ptrdiff_t>(r.Top() - MARGIN, 0) / 2,
+                    std::min<ptrdiff_t>((r.Right() + MARGIN) / 2 + 1, dst.width), std::min<ptrdiff_t>((r.Bottom() + MARGIN) / 2 + 1, dst.height));
+                next.push_back(d);
+                for (ptrdiff_t ty = d.Top() / TILE; ty <= (d.Bottom() - 1) / TILE; ++ty)
+                    for (ptrdiff_t tx = d.Left() / TILE; tx <= (d.Right() - 1) / TILE; ++tx)
+                        marks[ty * tilesX + tx] = 1;
+            }
+            tiles.clear();
+            for (ptrdiff_t ty = 0; ty < tilesY; ++ty)
+                for (ptrdiff_t tx = 0; tx < tilesX; ++tx)
+                    if (marks[ty * tilesX + tx])
+                        tiles.push_back(Rect(tx * TILE, ty * TILE, std::min<ptrdiff_t>(tx * TILE + TILE, dst.width), std::min<ptrdiff_t>(ty * TILE + TILE, dst.height)));
+
+            Simd::Parallel(0, tiles.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const Rect & t = tiles[i];
+                    Rect e(std::max<ptrdiff_t>(t.Left() - MARGIN, 0), std::max<ptrdiff_t>(t.Top() - MARGIN, 0),
+                        std::min<ptrdiff_t>(t.Right() + MARGIN, dst.width), std::min<ptrdiff_t>(t.Bottom() + MARGIN, dst.height));
+                    Rect s(e.Left() * 2, e.Top() * 2, std::min<ptrdiff_t>(e.Right() * 2, src.width), std::min<ptrdiff_t>(e.Bottom() * 2, src.height));
+                    View<A> buffer = buffers[thread].Region(e.Size(), View<A>::TopLeft);
+                    Simd::ReduceGray(src.Region(s), buffer, reduceType, compensation);
+                    Simd::Copy(buffer.Region(t.Shifted(-e.TopLeft())), dst.Region(t).Ref());
+                }
+            }, threadNumber);
+
+            dirty.swap(next);
+        }
+    }
 }
 
 #endif
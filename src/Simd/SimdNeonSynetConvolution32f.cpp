@@ -421,6 +421,8 @@ namespace Simd
                 else
                     Neon::SynetSwish32f(dst, size * count, &threshold, dst);
             }
+            else if (activation == ::SimdConvolutionActivationGelu || activation == ::SimdConvolutionActivationGeluTanh)
+                Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
             else
                 assert(0);
         }
@@ -649,7 +651,9 @@ namespace Simd
                     for (size_t i = 0; i < _count; ++i)
                         dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
+                if (_add)
+                    Base::ConvolutionBiasAddActivation(NULL, _count, 1, _param.activation, _params, ::SimdTrue, _add + b * _sizeD, dst);
+                else if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
                 src += _sizeS;
                 dst += _sizeD;
@@ -695,6 +699,8 @@ namespace Simd
 
         bool SynetConvolution32fNhwcDirect::Preferable(const ConvParam32f& p)
         {
+            if (p.activation == SimdConvolutionActivationGelu || p.activation == SimdConvolutionActivationGeluTanh)
+                return false;
             if (p.trans != SimdTrue || p.group != 1 || !p.IsDilation(1))
                 return false;
             if (!p.Is1x1() && p.dstW < 6 + p.padX + p.padY)
@@ -37,7 +37,9 @@ namespace Simd
         SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
             : Base::SynetConvolution32fDirectNchw(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Neon::ConvolutionBiasAndActivation;
         }
 
         template <size_t size> SIMD_INLINE void LoadWeight(const float * src, float32x4_t * dst)
@@ -316,6 +318,8 @@ namespace Simd
 
         bool SynetConvolution32fDirectNchw::Preferable(const ConvParam32f & p)
         {
+            if (p.activation == SimdConvolutionActivationGelu || p.activation == SimdConvolutionActivationGeluTanh)
+                return false;
             if (!p.IsDilation(1))
                 return false;
             if (!(p.IsStride(1) || p.IsStride(2) || p.IsStride(3)))
@@ -344,33 +348,33 @@ namespace Simd
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             if (p.dstW < F)
-                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             switch (p.strideX)
             {
             case 1:
                 if (p.kernelX == 1)
-                    return Neon::SetConvolutionBiasActivation<1, 1>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<1, 1>(activation);
                 if (p.kernelX == 2)
-                    return Neon::SetConvolutionBiasActivation<2, 1>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<2, 1>(activation);
                 if (p.kernelX == 3)
-                    return Neon::SetConvolutionBiasActivation<3, 1>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<3, 1>(activation);
                 break;
             case 2:
                 if (p.kernelX == 2)
-                    return Neon::SetConvolutionBiasActivation<2, 2>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<2, 2>(activation);
                 if (p.kernelX == 3)
-                    return Neon::SetConvolutionBiasActivation<3, 2>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<3, 2>(activation);
                 break;
             case 3:
                 if (p.kernelX == 3)
-                    return Neon::SetConvolutionBiasActivation<3, 3>(p.activation);
+                    return Neon::SetConvolutionBiasActivation<3, 3>(activation);
                 break;
             default:
-                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             }
             assert(0);
             return NULL;
@@ -37,11 +37,15 @@ namespace Simd
         SynetConvolution32fDirectNhwc::SynetConvolution32fDirectNhwc(const ConvParam32f & p)
             : Base::SynetConvolution32fDirectNhwc(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Neon::ConvolutionBiasAndActivation;
         }
 
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
         {
+            if (p.activation == SimdConvolutionActivationGelu || p.activation == SimdConvolutionActivationGeluTanh)
+                return false;
             if (!p.IsDilation(1) || p.trans == 0)
                 return false;
             if (p.group == 1)
@@ -994,13 +998,13 @@ namespace Simd
             return NULL;
         }
 
-        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr func = NULL;
             if (p.dstC >= F && p.dstH >= p.padY + p.padH && p.dstW >= p.padX + p.padW)
             {
-                switch (p.activation)
+                switch (activation)
                 {
                 case ::SimdConvolutionActivationIdentity: func = GetConvolutionBiasActivation<::SimdConvolutionActivationIdentity>(p); break;
                 case ::SimdConvolutionActivationRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRelu>(p); break;
@@ -1014,7 +1018,7 @@ namespace Simd
                 case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
                 }
             }
-            return func ? func : Base::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation();
+            return func ? func : Base::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(activation);
         };
     }
 #endif// SIMD_NEON_ENABLE
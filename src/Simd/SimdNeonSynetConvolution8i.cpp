@@ -23,6 +23,9 @@
 */
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
+#include "Simd/SimdSynetDeconvolution8i.h"
+#include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
@@ -655,6 +658,8 @@ namespace Simd
 
         bool SynetConvolution8iNhwcDirect::Preferable(const ConvParam8i& p)
         {
+            if (p.activation == SimdConvolutionActivationGelu || p.activation == SimdConvolutionActivationGeluTanh)
+                return false;
             if (p.trans != SimdTrue || p.group != 1)
                 return false;
             return true;
@@ -672,6 +677,19 @@ namespace Simd
             else
                 return new Base::SynetConvolution8iGemmNN(param);
         }
+
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility)
+        {
+            InnerProductParam8i param(batch, input, output, transpose, srcT, dstT, activation, compatibility);
+            return Simd::SynetInnerProduct8i::Create(param, Neon::SynetConvolution8iInit);
+        }
+
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+        {
+            DeconvParam8i param(batch, conv, compatibility);
+            return Simd::SynetDeconvolution8i::Create(param, Neon::SynetConvolution8iInit, Neon::ConvolutionBiasAndActivation, Neon::SynetConvert32fTo8u);
+        }
     }
 #endif
 }
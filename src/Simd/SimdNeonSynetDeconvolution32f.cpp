@@ -223,6 +223,8 @@ namespace Simd
 
         bool SynetDeconvolution32fNhwcDirect2x2::Preferable(const DeconvParam32f & p)
         {
+            if (p.activation == SimdConvolutionActivationGelu || p.activation == SimdConvolutionActivationGeluTanh)
+                return false;
             return p.IsPad(0) && p.IsDilation(1) && p.IsKernel(2) && p.IsStride(2) && p.group == 1 && p.trans;
         }
 
@@ -233,7 +235,9 @@ namespace Simd
             DeconvParam32f param(batch, conv, compatibility);
             if (!param.Valid())
                 return NULL;
-            if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
+            if (Base::Bf16Soft(compatibility) && Base::SynetDeconvolution32fBf16::Preferable(param))
+                return new Base::SynetDeconvolution32fBf16(param, Neon::SynetConvolution32fInit, Neon::ConvolutionBiasAndActivation);
+            else if (SynetDeconvolution32fNhwcDirect2x2::Preferable(param))
                 return new SynetDeconvolution32fNhwcDirect2x2(param);
             else
                 return new SynetDeconvolution32fGemmNN(param);
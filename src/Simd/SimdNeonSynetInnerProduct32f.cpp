@@ -38,6 +38,7 @@ namespace Simd
             : Base::SynetInnerProduct32fGemm(p)
         {
             _biasAndActivation = Neon::ConvolutionBiasAndActivation;
+            _sparse = NULL;
             if (_param.transpose)
             {
                 _gemm = Neon::Gemm32fNT;
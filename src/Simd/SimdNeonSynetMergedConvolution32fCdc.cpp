@@ -1473,6 +1473,14 @@ namespace Simd
 
 		//---------------------------------------------------------------------
 
+		SIMD_INLINE bool HasGelu(const MergConvParam32f& p)
+		{
+			for (size_t i = 0; i < p.count; ++i)
+				if (p.conv[i].activation == SimdConvolutionActivationGelu || p.conv[i].activation == SimdConvolutionActivationGeluTanh)
+					return true;
+			return false;
+		}
+
 		void* SynetMergedConvolution32fInit(size_t batch, const SimdConvolutionParameters* convs, size_t count, SimdBool add, SimdSynetCompatibilityType compatibility)
 		{
 			MergConvParam32f param(batch, convs, count, add, compatibility);
@@ -1482,6 +1490,8 @@ namespace Simd
 			{
 				return new Base::SynetMergedConvolution32fBf16(param);
 			}
+			else if (HasGelu(param))
+				return new Base::SynetMergedConvolution32f(param);
 			else if (SynetMergedConvolution32fCdc::Preferable(param))
 				return new Neon::SynetMergedConvolution32fCdc(param);
 			else if (SynetMergedConvolution32fCd::Preferable(param))
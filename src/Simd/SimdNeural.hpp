@@ -85,6 +85,13 @@ namespace Simd
                 return dst(gen);
             }
 
+            SIMD_INLINE void Transpose(const float * src, size_t rows, size_t cols, float * dst)
+            {
+                for (size_t r = 0; r < rows; ++r)
+                    for (size_t c = 0; c < cols; ++c)
+                        dst[c * rows + r] = src[r * cols + c];
+            }
+
             SIMD_INLINE void CheckOverflow(const float * data, size_t size)
             {
                 for (size_t i = 0; i < size; ++i)
@@ -532,6 +539,29 @@ namespace Simd
                 }
             }
 
+            virtual void SetBatchSize(size_t size)
+            {
+                SetThreadNumber(size, true);
+            }
+
+            virtual void ForwardBatch(size_t size, size_t threadNumber)
+            {
+                Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        Forward(_prev->Dst(i), i, Train);
+                }, threadNumber);
+            }
+
+            virtual void BackwardBatch(const Vectors & delta, size_t size, size_t threadNumber)
+            {
+                Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        Backward(CurrDelta(delta, i), i);
+                }, threadNumber);
+            }
+
         protected:
             Layer(Layer::Type l, Function::Type f)
                 : _type(l)
@@ -563,6 +593,20 @@ namespace Simd
                 return _common[thread].prevDelta;
             }
 
+            SIMD_INLINE const Vector & CurrDelta(const Vectors & delta, size_t thread) const
+            {
+                return _next ? _next->Delta(thread) : delta[thread];
+            }
+
+            void ReleaseGradients()
+            {
+                for (size_t i = 1; i < _common.size(); ++i)
+                {
+                    Vector().swap(_common[i].dWeight);
+                    Vector().swap(_common[i].dBias);
+                }
+            }
+
             const Type _type;
             const Function _function;
 
@@ -579,6 +623,12 @@ namespace Simd
             };
             std::vector<Common> _common;
 
+            struct Batch
+            {
+                Vector src, dst, delta, buffer;
+            };
+            Batch _batch;
+
             friend class InputLayer;
             friend class ConvolutionalLayer;
             friend class PoolingLayer;
@@ -881,8 +931,126 @@ namespace Simd
                 }
             }
 
+            virtual void SetBatchSize(size_t size) override
+            {
+                SetThreadNumber(size, true);
+                if (!_partial)
+                    ReleaseGradients();
+            }
+
+            virtual void ForwardBatch(size_t size, size_t threadNumber) override
+            {
+                if (_partial)
+                {
+                    Layer::ForwardBatch(size, threadNumber);
+                    return;
+                }
+                size_t M = _dst.depth, N = _dst.Area(), K = _core.Area() * _src.depth, S = N * size;
+                _batch.src.resize(K * S);
+                _batch.dst.resize(M * S);
+                Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                        Im2Col(PaddedSrc(_prev->Dst(i), i), _batch.src.data() + i * N, S);
+                }, threadNumber);
+
+                const float alpha = 1.0f, beta = 0.0f;
+                ::SimdGemm32fNN(M, S, K, &alpha, _weight.data(), K, _batch.src.data(), S, &beta, _batch.dst.data(), S);
+
+                Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        Vector & sum = _common[i].sum;
+                        for (size_t dc = 0; dc < M; ++dc)
+                        {
+                            float * psum = _dst.Get(sum, 0, 0, dc);
+                            memcpy(psum, _batch.dst.data() + dc * S + i * N, N * sizeof(float));
+                            if (_bias.size())
+                                ::SimdNeuralAddValue(_bias.data() + dc, psum, N);
+                        }
+                        _function.function(sum.data(), sum.size(), _common[i].dst.data());
+                    }
+                }, threadNumber);
+            }
+
+            virtual void BackwardBatch(const Vectors & delta, size_t size, size_t threadNumber) override
+            {
+                if (_partial)
+                {
+                    Layer::BackwardBatch(delta, size, threadNumber);
+                    return;
+                }
+                size_t M = _dst.depth, N = _dst.Area(), K = _core.Area() * _src.depth, S = N * size;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const Vector & currDelta = CurrDelta(delta, i);
+                    for (size_t dc = 0; dc < M; ++dc)
+                        memcpy(_batch.dst.data() + dc * S + i * N, _dst.Get(currDelta, 0, 0, dc), N * sizeof(float));
+                }
+
+                const float alpha = 1.0f, beta = 0.0f;
+                ::SimdGemm32fNT(M, K, S, &alpha, _batch.dst.data(), S, _batch.src.data(), S, &alpha, _common[0].dWeight.data(), K);
+                if (_bias.size())
+                {
+                    for (size_t dc = 0; dc < M; ++dc)
+                    {
+                        const float * pdelta = _batch.dst.data() + dc * S;
+                        _common[0].dBias[dc] += std::accumulate(pdelta, pdelta + S, float(0));
+                    }
+                }
+
+                _batch.buffer.resize(K * M);
+                Detail::Transpose(_weight.data(), M, K, _batch.buffer.data());
+                _batch.delta.resize(K * S);
+                ::SimdGemm32fNN(K, S, M, &alpha, _batch.buffer.data(), M, _batch.dst.data(), S, &beta, _batch.delta.data(), S);
+
+                Parallel(0, size, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        const Vector & prevDst = _valid ? _prev->Dst(i) : _specific[i].paddedSrc;
+                        Vector & prevDelta = _valid ? _common[i].prevDelta : _specific[i].paddedDelta;
+                        Detail::SetZero(prevDelta);
+                        Col2Im(_batch.delta.data() + i * N, S, prevDelta);
+                        _prev->_function.derivative(prevDst.data(), prevDst.size(), prevDelta.data());
+                        UnpadDelta(prevDelta, i);
+                    }
+                }, threadNumber);
+            }
+
         private:
 
+            void Im2Col(const Vector & src, float * dst, size_t stride)
+            {
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                {
+                    for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                    {
+                        for (ptrdiff_t kx = 0; kx < _core.width; ++kx, dst += stride)
+                        {
+                            for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                                memcpy(dst + y * _dst.width, _padded.Get(src, kx, ky + y, sc), _dst.width * sizeof(float));
+                        }
+                    }
+                }
+            }
+
+            void Col2Im(const float * src, size_t stride, Vector & dst)
+            {
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                {
+                    for (ptrdiff_t ky = 0; ky < _core.height; ++ky)
+                    {
+                        for (ptrdiff_t kx = 0; kx < _core.width; ++kx, src += stride)
+                        {
+                            for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                                ::SimdNeuralAddVector(src + y * _dst.width, _dst.width, _padded.Get(dst, kx, ky + y, sc));
+                        }
+                    }
+                }
+            }
+
             const Vector & PaddedSrc(const Vector & src, size_t thread)
             {
                 if (_valid)
@@ -1279,6 +1447,61 @@ namespace Simd
                 return _dst.width;
             }
 
+            virtual void SetBatchSize(size_t size) override
+            {
+                SetThreadNumber(size, true);
+                ReleaseGradients();
+            }
+
+            virtual void ForwardBatch(size_t size, size_t threadNumber) override
+            {
+                assert(!_reordered);
+                size_t M = size, N = _dst.width, K = _src.width;
+                _batch.src.resize(M * K);
+                _batch.dst.resize(M * N);
+                for (size_t i = 0; i < size; ++i)
+                    memcpy(_batch.src.data() + i * K, _prev->Dst(i).data(), K * sizeof(float));
+
+                const float alpha = 1.0f, beta = 0.0f;
+                ::SimdGemm32fNN(M, N, K, &alpha, _batch.src.data(), K, _weight.data(), N, &beta, _batch.dst.data(), N);
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    Vector & sum = _common[i].sum;
+                    memcpy(sum.data(), _batch.dst.data() + i * N, N * sizeof(float));
+                    if (_bias.size())
+                        ::SimdNeuralAddVector(_bias.data(), N, sum.data());
+                    _function.function(sum.data(), sum.size(), _common[i].dst.data());
+                }
+            }
+
+            virtual void BackwardBatch(const Vectors & delta, size_t size, size_t threadNumber) override
+            {
+                size_t M = size, N = _dst.width, K = _src.width;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    memcpy(_batch.dst.data() + i * N, CurrDelta(delta, i).data(), N * sizeof(float));
+                    if (_bias.size())
+                        ::SimdNeuralAddVector(_batch.dst.data() + i * N, N, _common[0].dBias.data());
+                }
+
+                const float alpha = 1.0f, beta = 0.0f;
+                _batch.delta.resize(M * K);
+                ::SimdGemm32fNT(M, K, N, &alpha, _batch.dst.data(), N, _weight.data(), N, &beta, _batch.delta.data(), K);
+
+                _batch.buffer.resize(K * M);
+                Detail::Transpose(_batch.src.data(), M, K, _batch.buffer.data());
+                ::SimdGemm32fNN(K, N, M, &alpha, _batch.buffer.data(), M, _batch.dst.data(), N, &alpha, _common[0].dWeight.data(), N);
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const Vector & prevDst = _prev->Dst(i);
+                    Vector & prevDelta = _common[i].prevDelta;
+                    memcpy(prevDelta.data(), _batch.delta.data() + i * K, K * sizeof(float));
+                    _prev->_function.derivative(prevDst.data(), prevDst.size(), prevDelta.data());
+                }
+            }
+
         protected:
             bool _reordered;
             std::mutex _mutex;
@@ -1438,9 +1661,29 @@ namespace Simd
                 AdaptiveGradient,
             };
 
+            /*!
+                \enum PropagateType
+
+                Method of forward and backward propagation of training batch.
+            */
+            enum PropagateType
+            {
+                /*!
+                    Every thread propagates its own samples of the batch one by one.
+                */
+                PerSample,
+                /*!
+                    The whole batch is propagated layer by layer. Convolutional and fully connected layers use im2col and
+                    one matrix multiplication (::SimdGemm32fNN, ::SimdGemm32fNT) for all samples of the batch,
+                    other layers process samples of the batch in parallel threads.
+                */
+                MiniBatch,
+            };
+
             InitType initType; /*!< \brief Method to initialize weights. */
             LossType lossType; /*!< \brief Loss function type. */
             UpdateType updateType; /*!< \brief Weights' update type. */
+            PropagateType propagateType; /*!< \brief Propagation method of training batch. */
             mutable size_t threadNumber; /*!< \brief Number of threads used to train. Use -1 to auto detect thread number.  */
             size_t epochStart; /*!< \brief Start epoch. It is used to continue training process. */
             size_t epochFinish; /*!< \brief Finish epoch. Describes total epoch number. */
@@ -1456,6 +1699,7 @@ namespace Simd
                 : initType(Xavier)
                 , lossType(Mse)
                 , updateType(AdaptiveGradient)
+                , propagateType(PerSample)
                 , threadNumber(std::thread::hardware_concurrency())
                 , epochStart(0)
                 , epochFinish(100)
@@ -1618,7 +1862,12 @@ namespace Simd
                 options.threadNumber = std::max<size_t>(1, std::min<size_t>(options.threadNumber, std::thread::hardware_concurrency()));
 
                 for (size_t i = 0; i < _layers.size(); ++i)
-                    _layers[i]->SetThreadNumber(options.threadNumber, true);
+                {
+                    if (options.propagateType == TrainOptions::MiniBatch)
+                        _layers[i]->SetBatchSize(options.batchSize);
+                    else
+                        _layers[i]->SetThreadNumber(options.threadNumber, true);
+                }
 
                 if (options.epochStart == 0)
                     InitWeight(options);
@@ -1641,7 +1890,10 @@ namespace Simd
                 {
                     for (size_t i = 0; i < src.size(); i += options.batchSize)
                     {
-                        Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
+                        if (options.propagateType == TrainOptions::MiniBatch)
+                            PropagateBatch(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
+                        else
+                            Propagate(src, dst, index, i, std::min(i + options.batchSize, src.size()), options);
                         UpdateWeight(options);
                     }
                     logger();
@@ -1946,7 +2198,17 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
-                Vector delta(current.size());
+                Vector delta;
+                OutputDelta(current, control, options, delta);
+
+                _layers.back()->Backward(delta, thread);
+                for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
+                    _layers[i]->Backward(_layers[i + 1]->Delta(thread), thread);
+            }
+
+            void OutputDelta(const Vector & current, const Vector & control, const TrainOptions & options, Vector & delta)
+            {
+                delta.resize(current.size());
                 if (Cannonical(options))
                 {
                     for (size_t i = 0; i < current.size(); ++i)
@@ -1974,10 +2236,6 @@ namespace Simd
                         _layers.back()->_function.derivative(current.data(), current.size(), delta.data());
                     }
                 }
-
-                _layers.back()->Backward(delta, thread);
-                for (ptrdiff_t i = _layers.size() - 2; i >= 0; --i)
-                    _layers[i]->Backward(_layers[i + 1]->Delta(thread), thread);
             }
 
             void Propagate(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options)
@@ -1994,6 +2252,23 @@ namespace Simd
                 }, options.threadNumber);
             }
 
+            void PropagateBatch(const Vectors & src, const Vectors & dst, const Labels & index, size_t start, size_t finish, const TrainOptions & options)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                size_t size = finish - start;
+                for (size_t i = 0; i < size; ++i)
+                    _layers.front()->Forward(src[index[start + i]], i, Layer::Train);
+                for (size_t l = 1; l < _layers.size(); ++l)
+                    _layers[l]->ForwardBatch(size, options.threadNumber);
+
+                Vectors delta(size);
+                for (size_t i = 0; i < size; ++i)
+                    OutputDelta(_layers.back()->Dst(i), dst[index[start + i]], options, delta[i]);
+                for (size_t l = _layers.size() - 1; l > 0; --l)
+                    _layers[l]->BackwardBatch(delta, size, options.threadNumber);
+            }
+
             template<TrainOptions::InitType type> void InitWeight()
             {
                 for (size_t l = 0; l < _layers.size(); ++l)
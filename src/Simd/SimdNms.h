@@ -0,0 +1,100 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdNms_h__
+#define __SimdNms_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdExp.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void DecodeBox(const float* delta, const float* anchor, SimdBoxEncodingType encoding, const float* params, float* box)
+        {
+            float cx, cy;
+            float hw = anchor[2] * 0.5f, hh = anchor[3] * 0.5f;
+            if (encoding == SimdBoxEncodingSsd)
+            {
+                cx = anchor[0] + delta[0] * params[0] * anchor[2];
+                cy = anchor[1] + delta[1] * params[1] * anchor[3];
+                hw *= Exp(delta[2] * params[2]);
+                hh *= Exp(delta[3] * params[3]);
+            }
+            else
+            {
+                cx = anchor[0] + params[0] / (1.0f + Exp(-delta[0]));
+                cy = anchor[1] + params[1] / (1.0f + Exp(-delta[1]));
+                hw *= Exp(delta[2]);
+                hh *= Exp(delta[3]);
+            }
+            box[0] = cx - hw;
+            box[1] = cy - hh;
+            box[2] = cx + hw;
+            box[3] = cy + hh;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        /* Boxes in NMS are stored in SoA format: rows of left, top, right, bottom and area with given stride. */
+
+        typedef size_t(*NmsFilterPtr)(const float* scores, size_t count, float threshold, uint32_t* indices);
+        typedef bool(*NmsOverlapPtr)(const float* soa, size_t stride, size_t size, const float* box, float threshold);
+        typedef size_t(*NmsDecayPtr)(const float* soa, size_t stride, size_t size, const float* box, SimdNmsType type, float threshold, float gamma, float* scores);
+
+        SIMD_INLINE float NmsArea(const float* box)
+        {
+            return Simd::Max(box[2] - box[0], 0.0f) * Simd::Max(box[3] - box[1], 0.0f);
+        }
+
+        SIMD_INLINE float NmsIntersection(const float* soa, size_t stride, size_t i, const float* box)
+        {
+            float w = Simd::Max(Simd::Min(soa[2 * stride + i], box[2]) - Simd::Max(soa[0 * stride + i], box[0]), 0.0f);
+            float h = Simd::Max(Simd::Min(soa[3 * stride + i], box[3]) - Simd::Max(soa[1 * stride + i], box[1]), 0.0f);
+            return w * h;
+        }
+
+        SIMD_INLINE bool NmsBoxOverlap(const float* soa, size_t stride, size_t i, const float* box, float threshold)
+        {
+            float intersection = NmsIntersection(soa, stride, i, box);
+            return intersection > threshold * (soa[4 * stride + i] + box[4] - intersection);
+        }
+
+        SIMD_INLINE float NmsBoxDecay(const float* soa, size_t stride, size_t i, const float* box, SimdNmsType type, float threshold, float gamma)
+        {
+            float intersection = NmsIntersection(soa, stride, i, box);
+            float _union = soa[4 * stride + i] + box[4] - intersection;
+            float iou = _union > 0.0f ? intersection / _union : 0.0f;
+            if (type == SimdNmsSoftLinear)
+                return iou > threshold ? 1.0f - iou : 1.0f;
+            else
+                return Exp(iou * iou * gamma);
+        }
+
+        size_t DetectionNms(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores, NmsFilterPtr filter, NmsOverlapPtr overlap, NmsDecayPtr decay);
+    }
+}
+
+#endif
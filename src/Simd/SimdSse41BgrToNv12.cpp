@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_SHUFFLE_BGRA_TO_PLANAR = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+
+        template <bool align, size_t N> SIMD_INLINE void LoadPlanar(const uint8_t* bgr, __m128i& b, __m128i& g, __m128i& r)
+        {
+            if (N == 3)
+            {
+                __m128i _bgr[3] = { Load<align>((__m128i*)bgr + 0), Load<align>((__m128i*)bgr + 1), Load<align>((__m128i*)bgr + 2) };
+                b = BgrToBlue(_bgr);
+                g = BgrToGreen(_bgr);
+                r = BgrToRed(_bgr);
+            }
+            else
+            {
+                __m128i bgra0 = _mm_shuffle_epi8(Load<align>((__m128i*)bgr + 0), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m128i bgra1 = _mm_shuffle_epi8(Load<align>((__m128i*)bgr + 1), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m128i bgra2 = _mm_shuffle_epi8(Load<align>((__m128i*)bgr + 2), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m128i bgra3 = _mm_shuffle_epi8(Load<align>((__m128i*)bgr + 3), K8_SHUFFLE_BGRA_TO_PLANAR);
+                __m128i bbgg0 = _mm_unpacklo_epi32(bgra0, bgra1);
+                __m128i bbgg1 = _mm_unpacklo_epi32(bgra2, bgra3);
+                b = _mm_unpacklo_epi64(bbgg0, bbgg1);
+                g = _mm_unpackhi_epi64(bbgg0, bbgg1);
+                r = _mm_unpacklo_epi64(_mm_unpackhi_epi32(bgra0, bgra1), _mm_unpackhi_epi32(bgra2, bgra3));
+            }
+        }
+
+        SIMD_INLINE __m128i AveragePairs(__m128i a0, __m128i a1)
+        {
+            return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_maddubs_epi16(a0, K8_01), _mm_maddubs_epi16(a1, K8_01)), K16_0002), 2);
+        }
+
+        template <bool align, class T, size_t N> SIMD_INLINE void BgrToNv12(const uint8_t* bgr, size_t bgrStride, uint8_t* y, size_t yStride, uint8_t* uv)
+        {
+            __m128i b0, g0, r0, b1, g1, r1;
+            LoadPlanar<align, N>(bgr, b0, g0, r0);
+            Store<align>((__m128i*)y, BgrToY8<T>(b0, g0, r0));
+            LoadPlanar<align, N>(bgr + bgrStride, b1, g1, r1);
+            Store<align>((__m128i*)(y + yStride), BgrToY8<T>(b1, g1, r1));
+            __m128i b16 = AveragePairs(b0, b1);
+            __m128i g16 = AveragePairs(g0, g1);
+            __m128i r16 = AveragePairs(r0, r1);
+            __m128i u16 = BgrToU16<T>(b16, g16, r16);
+            __m128i v16 = BgrToV16<T>(b16, g16, r16);
+            Store<align>((__m128i*)uv, _mm_or_si128(u16, _mm_slli_epi16(v16, 8)));
+        }
+
+        template <bool align, class T, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride));
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < bodyWidth; col += A)
+                    BgrToNv12<align, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col);
+                if (tail)
+                {
+                    size_t col = width - A;
+                    BgrToNv12<false, T, N>(bgr + col * N, bgrStride, y + col, yStride, uv + col);
+                }
+                bgr += 2 * bgrStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template <bool align, size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: BgrToNv12<align, Base::Bt601, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: BgrToNv12<align, Base::Bt709, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: BgrToNv12<align, Base::Bt2020, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            case SimdYuvTrect871: BgrToNv12<align, Base::Trect871, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride))
+                BgrToNv12<true, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+            else
+                BgrToNv12<false, N>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgrToNv12(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<3>(bgr, bgrStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t* bgra, size_t bgraStride, size_t width, size_t height,
+            uint8_t* y, size_t yStride, uint8_t* uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            BgrToNv12<4>(bgra, bgraStride, width, height, y, yStride, uv, uvStride, yuvType);
+        }
+    }
+#endif
+}
@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template<SimdBoxEncodingType encoding> SIMD_INLINE void DecodeBox(const float* delta, const float* anchor, __m128 params, float* box)
+        {
+            __m128 a = _mm_loadu_ps(anchor);
+            __m128 size = _mm_shuffle_ps(a, a, 0xEE);
+            __m128 center, exp;
+            if (encoding == SimdBoxEncodingSsd)
+            {
+                __m128 t = _mm_mul_ps(_mm_loadu_ps(delta), params);
+                center = _mm_add_ps(a, _mm_mul_ps(t, size));
+                exp = Exponent(t);
+            }
+            else
+            {
+                exp = Exponent(_mm_mul_ps(_mm_loadu_ps(delta), _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f)));
+                center = _mm_add_ps(a, _mm_div_ps(params, _mm_add_ps(_mm_set1_ps(1.0f), exp)));
+            }
+            center = _mm_shuffle_ps(center, center, 0x44);
+            __m128 half = _mm_mul_ps(_mm_mul_ps(size, _mm_set1_ps(0.5f)), _mm_shuffle_ps(exp, exp, 0xEE));
+            _mm_storeu_ps(box, _mm_add_ps(center, _mm_mul_ps(half, _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f))));
+        }
+
+        template<SimdBoxEncodingType encoding> void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, const float* params, float* boxes)
+        {
+            __m128 _params = _mm_loadu_ps(params);
+            for (size_t i = 0; i < count; ++i)
+                DecodeBox<encoding>(deltas + i * 4, anchors + i * 4, _params, boxes + i * 4);
+        }
+
+        void DetectionDecodeBoxes32f(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes)
+        {
+            if (encoding == SimdBoxEncodingSsd)
+                DetectionDecodeBoxes32f<SimdBoxEncodingSsd>(deltas, anchors, count, params, boxes);
+            else
+                DetectionDecodeBoxes32f<SimdBoxEncodingYolo>(deltas, anchors, count, params, boxes);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t DetectionFilterScores32f(const float* scores, size_t count, float threshold, uint32_t* indices)
+        {
+            size_t count4 = AlignLo(count, 4), i = 0, size = 0;
+            __m128 _threshold = _mm_set1_ps(threshold);
+            for (; i < count4; i += 4)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(scores + i), _threshold));
+                if (mask)
+                {
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        indices[size] = uint32_t(i + j);
+                        size += (mask >> j) & 1;
+                    }
+                }
+            }
+            for (; i < count; ++i)
+            {
+                indices[size] = (uint32_t)i;
+                size += scores[i] > threshold ? 1 : 0;
+            }
+            return size;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct NmsBox
+        {
+            __m128 x0, y0, x1, y1, area;
+
+            SIMD_INLINE NmsBox(const float* box)
+            {
+                x0 = _mm_set1_ps(box[0]);
+                y0 = _mm_set1_ps(box[1]);
+                x1 = _mm_set1_ps(box[2]);
+                y1 = _mm_set1_ps(box[3]);
+                area = _mm_set1_ps(box[4]);
+            }
+
+            SIMD_INLINE __m128 Intersection(const float* soa, size_t stride, size_t i) const
+            {
+                __m128 w = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(soa + 2 * stride + i), x1), _mm_max_ps(_mm_loadu_ps(soa + 0 * stride + i), x0));
+                __m128 h = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(soa + 3 * stride + i), y1), _mm_max_ps(_mm_loadu_ps(soa + 1 * stride + i), y0));
+                return _mm_mul_ps(_mm_max_ps(w, _mm_setzero_ps()), _mm_max_ps(h, _mm_setzero_ps()));
+            }
+        };
+
+        static bool NmsOverlap(const float* soa, size_t stride, size_t size, const float* box, float threshold)
+        {
+            NmsBox _box(box);
+            __m128 _threshold = _mm_set1_ps(threshold);
+            size_t size4 = AlignLo(size, 4), i = 0;
+            for (; i < size4; i += 4)
+            {
+                __m128 intersection = _box.Intersection(soa, stride, i);
+                __m128 _union = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(soa + 4 * stride + i), _box.area), intersection);
+                if (_mm_movemask_ps(_mm_cmpgt_ps(intersection, _mm_mul_ps(_threshold, _union))))
+                    return true;
+            }
+            for (; i < size; ++i)
+                if (Base::NmsBoxOverlap(soa, stride, i, box, threshold))
+                    return true;
+            return false;
+        }
+
+        static size_t NmsDecay(const float* soa, size_t stride, size_t size, const float* box, SimdNmsType type, float threshold, float gamma, float* scores)
+        {
+            NmsBox _box(box);
+            __m128 _threshold = _mm_set1_ps(threshold), _gamma = _mm_set1_ps(gamma), _1 = _mm_set1_ps(1.0f);
+            __m128 maxScore = _mm_set1_ps(-FLT_MAX);
+            __m128i maxIndex = _mm_setzero_si128(), index = _mm_setr_epi32(0, 1, 2, 3);
+            size_t size4 = AlignLo(size, 4), i = 0;
+            for (; i < size4; i += 4)
+            {
+                __m128 intersection = _box.Intersection(soa, stride, i);
+                __m128 _union = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(soa + 4 * stride + i), _box.area), intersection);
+                __m128 iou = _mm_and_ps(_mm_div_ps(intersection, _union), _mm_cmpgt_ps(_union, _mm_setzero_ps()));
+                __m128 decay;
+                if (type == SimdNmsSoftLinear)
+                    decay = _mm_blendv_ps(_1, _mm_sub_ps(_1, iou), _mm_cmpgt_ps(iou, _threshold));
+                else
+                    decay = Exponent(_mm_mul_ps(_mm_mul_ps(iou, iou), _gamma));
+                __m128 score = _mm_mul_ps(_mm_loadu_ps(scores + i), decay);
+                _mm_storeu_ps(scores + i, score);
+                __m128 greater = _mm_cmpgt_ps(score, maxScore);
+                maxScore = _mm_blendv_ps(maxScore, score, greater);
+                maxIndex = _mm_blendv_epi8(maxIndex, index, _mm_castps_si128(greater));
+                index = _mm_add_epi32(index, _mm_set1_epi32(4));
+            }
+            float scoreBuf[4];
+            int32_t indexBuf[4];
+            _mm_storeu_ps(scoreBuf, maxScore);
+            _mm_storeu_si128((__m128i*)indexBuf, maxIndex);
+            size_t best = indexBuf[0];
+            float bestScore = scoreBuf[0];
+            for (size_t j = 1; j < 4; ++j)
+            {
+                if (scoreBuf[j] > bestScore || (scoreBuf[j] == bestScore && (size_t)indexBuf[j] < best))
+                    best = indexBuf[j], bestScore = scoreBuf[j];
+            }
+            for (; i < size; ++i)
+            {
+                scores[i] *= Base::NmsBoxDecay(soa, stride, i, box, type, threshold, gamma);
+                if (scores[i] > bestScore)
+                    best = i, bestScore = scores[i];
+            }
+            return best;
+        }
+
+        size_t DetectionNms32f(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+            float scoreThreshold, uint32_t* indices, float* dstScores)
+        {
+            return Base::DetectionNms(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, dstScores, DetectionFilterScores32f, NmsOverlap, NmsDecay);
+        }
+    }
+#endif
+}
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetAttention32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Sse41
+    {
+        SIMD_INLINE __m128 LoadAtt(const float* src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        SIMD_INLINE __m128 LoadAtt(const uint16_t* src)
+        {
+            return BFloat16ToFloat32(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        SIMD_INLINE float ValueAtt(const float* src)
+        {
+            return src[0];
+        }
+
+        SIMD_INLINE float ValueAtt(const uint16_t* src)
+        {
+            return Base::BFloat16ToFloat32(src[0]);
+        }
+
+        template<class T> float Score(const T* q, const T* k, size_t count, size_t depth, float scale, const float* mask, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), count4 = AlignLo(count, 4), j = 0;
+            __m128 _scale = _mm_set1_ps(scale), _max = _mm_set1_ps(-FLT_MAX);
+            for (; j < count4; j += 4)
+            {
+                const T* k0 = k + j * depth, * k1 = k0 + depth, * k2 = k1 + depth, * k3 = k2 + depth;
+                __m128 sums[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+                size_t d = 0;
+                for (; d < depthF; d += F)
+                {
+                    __m128 _q = LoadAtt(q + d);
+                    sums[0] = _mm_add_ps(sums[0], _mm_mul_ps(_q, LoadAtt(k0 + d)));
+                    sums[1] = _mm_add_ps(sums[1], _mm_mul_ps(_q, LoadAtt(k1 + d)));
+                    sums[2] = _mm_add_ps(sums[2], _mm_mul_ps(_q, LoadAtt(k2 + d)));
+                    sums[3] = _mm_add_ps(sums[3], _mm_mul_ps(_q, LoadAtt(k3 + d)));
+                }
+                __m128 sum = Extract4Sums(sums);
+                for (; d < depth; ++d)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(ValueAtt(q + d)),
+                        _mm_setr_ps(ValueAtt(k0 + d), ValueAtt(k1 + d), ValueAtt(k2 + d), ValueAtt(k3 + d))));
+                sum = _mm_mul_ps(sum, _scale);
+                if (mask)
+                    sum = _mm_add_ps(sum, _mm_loadu_ps(mask + j));
+                _mm_storeu_ps(dst + j, sum);
+                _max = _mm_max_ps(_max, sum);
+            }
+            _max = _mm_max_ps(_max, Shuffle32f<0x0E>(_max));
+            _max = _mm_max_ss(_max, Shuffle32f<0x01>(_max));
+            float max = _mm_cvtss_f32(_max);
+            for (; j < count; ++j)
+            {
+                const T* kj = k + j * depth;
+                __m128 _sum = _mm_setzero_ps();
+                size_t d = 0;
+                for (; d < depthF; d += F)
+                    _sum = _mm_add_ps(_sum, _mm_mul_ps(LoadAtt(q + d), LoadAtt(kj + d)));
+                float sum = ExtractSum(_sum);
+                for (; d < depth; ++d)
+                    sum += ValueAtt(q + d) * ValueAtt(kj + d);
+                dst[j] = sum * scale + (mask ? mask[j] : 0.0f);
+                max = Simd::Max(max, dst[j]);
+            }
+            return max;
+        }
+
+        static float Softmax(float* src, size_t count, float max)
+        {
+            Exp exp;
+            size_t countF = AlignLo(count, F), j = 0;
+            __m128 _max = _mm_set1_ps(max), _sum = _mm_setzero_ps();
+            for (; j < countF; j += F)
+            {
+                __m128 value = exp.Exponent(_mm_sub_ps(_mm_loadu_ps(src + j), _max));
+                _mm_storeu_ps(src + j, value);
+                _sum = _mm_add_ps(_sum, value);
+            }
+            float sum = ExtractSum(_sum);
+            for (; j < count; ++j)
+            {
+                src[j] = ::exp(src[j] - max);
+                sum += src[j];
+            }
+            return sum;
+        }
+
+        template<class T> void Accum(const T* p, const T* v, size_t count, size_t depth, float alpha, float* dst)
+        {
+            size_t depthF = AlignLo(depth, F), depthQF = AlignLo(depth, QF), d = 0;
+            __m128 _alpha = _mm_set1_ps(alpha);
+            for (; d < depthQF; d += QF)
+            {
+                __m128 sum0 = _mm_mul_ps(_mm_loadu_ps(dst + d + 0 * F), _alpha);
+                __m128 sum1 = _mm_mul_ps(_mm_loadu_ps(dst + d + 1 * F), _alpha);
+                __m128 sum2 = _mm_mul_ps(_mm_loadu_ps(dst + d + 2 * F), _alpha);
+                __m128 sum3 = _mm_mul_ps(_mm_loadu_ps(dst + d + 3 * F), _alpha);
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                {
+                    __m128 _p = _mm_set1_ps(ValueAtt(p + j));
+                    sum0 = _mm_add_ps(sum0, _mm_mul_ps(_p, LoadAtt(vj + 0 * F)));
+                    sum1 = _mm_add_ps(sum1, _mm_mul_ps(_p, LoadAtt(vj + 1 * F)));
+                    sum2 = _mm_add_ps(sum2, _mm_mul_ps(_p, LoadAtt(vj + 2 * F)));
+                    sum3 = _mm_add_ps(sum3, _mm_mul_ps(_p, LoadAtt(vj + 3 * F)));
+                }
+                _mm_storeu_ps(dst + d + 0 * F, sum0);
+                _mm_storeu_ps(dst + d + 1 * F, sum1);
+                _mm_storeu_ps(dst + d + 2 * F, sum2);
+                _mm_storeu_ps(dst + d + 3 * F, sum3);
+            }
+            for (; d < depthF; d += F)
+            {
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(dst + d), _alpha);
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(ValueAtt(p + j)), LoadAtt(vj)));
+                _mm_storeu_ps(dst + d, sum);
+            }
+            for (; d < depth; ++d)
+            {
+                float sum = dst[d] * alpha;
+                const T* vj = v + d;
+                for (size_t j = 0; j < count; ++j, vj += depth)
+                    sum += ValueAtt(p + j) * ValueAtt(vj);
+                dst[d] = sum;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetAttention32f::SynetAttention32f(const AttentionParam32f& p)
+            : Base::SynetAttention32f(p)
+        {
+            _score32f = Score<float>;
+            _score16b = Score<uint16_t>;
+            _softmax = Softmax;
+            _accum32f = Accum<float>;
+            _accum16b = Accum<uint16_t>;
+            _convert = Sse41::Float32ToBFloat16;
+            SetBlocks(F);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility)
+        {
+            AttentionParam32f param(batch, heads, seqQ, seqK, depth, scale, compatibility);
+            if (!param.Valid())
+                return NULL;
+            return new SynetAttention32f(param);
+        }
+    }
+#endif
+}
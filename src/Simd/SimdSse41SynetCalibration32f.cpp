@@ -0,0 +1,172 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetCalibration32f.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Sse41
+    {
+        SynetCalibration32f::SynetCalibration32f(const Base::Calibration32fParam& param)
+            : Base::SynetCalibration32f(param)
+        {
+        }
+
+        SIMD_INLINE float ReduceMin(__m128 value)
+        {
+            value = _mm_min_ps(value, _mm_movehl_ps(value, value));
+            return _mm_cvtss_f32(_mm_min_ss(value, _mm_shuffle_ps(value, value, 1)));
+        }
+
+        SIMD_INLINE float ReduceMax(__m128 value)
+        {
+            value = _mm_max_ps(value, _mm_movehl_ps(value, value));
+            return _mm_cvtss_f32(_mm_max_ss(value, _mm_shuffle_ps(value, value, 1)));
+        }
+
+        void SynetCalibration32f::Range(const float* src, size_t spatial, float* min, float* max)
+        {
+            size_t C = _param.channels;
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m128 _min = _mm_set1_ps(FLT_MAX), _max = _mm_set1_ps(-FLT_MAX);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        __m128 _src = _mm_loadu_ps(src + s);
+                        _min = _mm_min_ps(_min, _src);
+                        _max = _mm_max_ps(_max, _src);
+                    }
+                    for (; s < spatial; ++s)
+                    {
+                        __m128 _src = _mm_load_ss(src + s);
+                        _min = _mm_min_ss(_min, _src);
+                        _max = _mm_max_ss(_max, _src);
+                    }
+                    min[c] = ReduceMin(_min);
+                    max[c] = ReduceMax(_max);
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), c;
+                for (c = 0; c < C; ++c)
+                {
+                    min[c] = FLT_MAX;
+                    max[c] = -FLT_MAX;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m128 _src = _mm_loadu_ps(src + c);
+                        _mm_storeu_ps(min + c, _mm_min_ps(_mm_loadu_ps(min + c), _src));
+                        _mm_storeu_ps(max + c, _mm_max_ps(_mm_loadu_ps(max + c), _src));
+                    }
+                    for (; c < C; ++c)
+                    {
+                        min[c] = Simd::Min(min[c], src[c]);
+                        max[c] = Simd::Max(max[c], src[c]);
+                    }
+                    src += C;
+                }
+            }
+        }
+
+        SIMD_INLINE __m128i HistogramIndex(__m128 value, __m128 scale, __m128i bins, __m128i last)
+        {
+            __m128i index = _mm_min_epi32(_mm_cvttps_epi32(_mm_mul_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), value), scale)), last);
+            return _mm_add_epi32(index, _mm_and_si128(_mm_castps_si128(_mm_cmpge_ps(value, _mm_setzero_ps())), bins));
+        }
+
+        void SynetCalibration32f::Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram)
+        {
+            size_t C = _param.channels, bins = _param.bins;
+            __m128i _bins = _mm_set1_epi32((int)bins), _last = _mm_set1_epi32((int)bins - 1);
+            SIMD_ALIGNED(16) int32_t index[F];
+            if (_param.format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m128 _scale = _mm_set1_ps(scale[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                    {
+                        _mm_store_si128((__m128i*)index, HistogramIndex(_mm_loadu_ps(src + s), _scale, _bins, _last));
+                        histogram[index[0]]++;
+                        histogram[index[1]]++;
+                        histogram[index[2]]++;
+                        histogram[index[3]]++;
+                    }
+                    for (; s < spatial; ++s)
+                        histogram[Base::HistogramIndex(src[s], scale[c], (int)bins)]++;
+                    histogram += bins * 2;
+                    src += spatial;
+                }
+            }
+            else
+            {
+                size_t CF = AlignLo(C, F), c;
+                __m128i _step = _mm_set1_epi32(int(bins * 2 * F)), _start = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(int(bins * 2)));
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    __m128i _offset = _start;
+                    for (c = 0; c < CF; c += F)
+                    {
+                        __m128i _index = HistogramIndex(_mm_loadu_ps(src + c), _mm_loadu_ps(scale + c), _bins, _last);
+                        _mm_store_si128((__m128i*)index, _mm_add_epi32(_index, _offset));
+                        histogram[index[0]]++;
+                        histogram[index[1]]++;
+                        histogram[index[2]]++;
+                        histogram[index[3]]++;
+                        _offset = _mm_add_epi32(_offset, _step);
+                    }
+                    for (; c < C; ++c)
+                        histogram[c * bins * 2 + Base::HistogramIndex(src[c], scale[c], (int)bins)]++;
+                    src += C;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format)
+        {
+            Base::Calibration32fParam param(channels, bins ? bins : 2048, format);
+            if (!param.Valid())
+                return NULL;
+            return new Sse41::SynetCalibration32f(param);
+        }
+    }
+#endif
+}
@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdGemm.h"
 #include "Simd/SimdExp.h"
@@ -419,6 +420,84 @@ namespace Simd
                 else
                     SynetSwish32f(dst, count * size, &slope, dst);
             }
+            else if (activation == ::SimdConvolutionActivationGelu)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m128 value = _mm_add_ps(Load<false>(dst + i), Load<false>(bias + i));
+                                Store<false>(dst + i, Gelu(value));
+                            }
+                            for (; i < count; ++i)
+                                dst[i] = Base::SynetGelu32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m128 _bias = _mm_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m128 value = _mm_add_ps(Load<false>(dst + j), _bias);
+                                Store<false>(dst + j, Gelu(value));
+                            }
+                            for (; j < size; ++j)
+                                dst[j] = Base::SynetGelu32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGelu32f(dst, size * count, dst);
+            }
+            else if (activation == ::SimdConvolutionActivationGeluTanh)
+            {
+                if (bias)
+                {
+                    if (trans)
+                    {
+                        for (size_t j = 0; j < size; ++j)
+                        {
+                            size_t i = 0;
+                            for (; i < aligned; i += F)
+                            {
+                                __m128 value = _mm_add_ps(Load<false>(dst + i), Load<false>(bias + i));
+                                Store<false>(dst + i, GeluTanh(value));
+                            }
+                            for (; i < count; ++i)
+                                dst[i] = Base::SynetGeluTanh32f(dst[i] + bias[i]);
+                            dst += count;
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            __m128 _bias = _mm_set1_ps(bias[i]);
+                            size_t j = 0;
+                            for (; j < aligned; j += F)
+                            {
+                                __m128 value = _mm_add_ps(Load<false>(dst + j), _bias);
+                                Store<false>(dst + j, GeluTanh(value));
+                            }
+                            for (; j < size; ++j)
+                                dst[j] = Base::SynetGeluTanh32f(dst[j] + bias[i]);
+                            dst += size;
+                        }
+                    }
+                }
+                else
+                    SynetGeluTanh32f(dst, size * count, dst);
+            }
             else
             {
                 Base::ConvolutionBiasAndActivation(bias, count, size, activation, params, trans, dst);
@@ -427,6 +506,70 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<::SimdConvolutionActivationType type> void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            if (trans)
+            {
+                size_t countF = AlignLo(count, F);
+                for (size_t j = 0; j < size; ++j)
+                {
+                    size_t i = 0;
+                    for (; i < countF; i += F)
+                    {
+                        __m128 value = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(add + i));
+                        if (bias)
+                            value = _mm_add_ps(value, _mm_loadu_ps(bias + i));
+                        _mm_storeu_ps(dst + i, Activate<type>(value, params, i));
+                    }
+                    for (; i < count; ++i)
+                        dst[i] = Base::Activate<type>(dst[i] + add[i] + (bias ? bias[i] : 0.0f), params, i);
+                    add += count;
+                    dst += count;
+                }
+            }
+            else
+            {
+                const ::SimdConvolutionActivationType row = type == ::SimdConvolutionActivationPrelu ? ::SimdConvolutionActivationLeakyRelu : type;
+                size_t sizeF = AlignLo(size, F);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const float* ps = type == ::SimdConvolutionActivationPrelu ? params + i : params;
+                    float shift = bias ? bias[i] : 0.0f;
+                    __m128 _shift = _mm_set1_ps(shift);
+                    size_t j = 0;
+                    for (; j < sizeF; j += F)
+                        _mm_storeu_ps(dst + j, Activate<row>(_mm_add_ps(_mm_add_ps(_mm_loadu_ps(dst + j), _mm_loadu_ps(add + j)), _shift), ps, 0));
+                    for (; j < size; ++j)
+                        dst[j] = Base::Activate<type>(dst[j] + add[j] + shift, params, i);
+                    add += size;
+                    dst += size;
+                }
+            }
+        }
+
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst)
+        {
+            switch (activation)
+            {
+            case ::SimdConvolutionActivationIdentity: ConvolutionBiasAddActivation<::SimdConvolutionActivationIdentity>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationLeakyRelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationLeakyRelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationRestrictRange: ConvolutionBiasAddActivation<::SimdConvolutionActivationRestrictRange>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationPrelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationPrelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationElu: ConvolutionBiasAddActivation<::SimdConvolutionActivationElu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHswish: ConvolutionBiasAddActivation<::SimdConvolutionActivationHswish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationMish: ConvolutionBiasAddActivation<::SimdConvolutionActivationMish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationHardSigmoid: ConvolutionBiasAddActivation<::SimdConvolutionActivationHardSigmoid>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationSwish: ConvolutionBiasAddActivation<::SimdConvolutionActivationSwish>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGelu: ConvolutionBiasAddActivation<::SimdConvolutionActivationGelu>(bias, count, size, params, trans, add, dst); break;
+            case ::SimdConvolutionActivationGeluTanh: ConvolutionBiasAddActivation<::SimdConvolutionActivationGeluTanh>(bias, count, size, params, trans, add, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f& p)
             : Base::SynetConvolution32fGemmNN(p)
         {
@@ -444,6 +587,7 @@ namespace Simd
                 _nhwcReorderB = Sse41::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _biasAddActivation = Sse41::ConvolutionBiasAddActivation;
         }
 
         //---------------------------------------------------------------------
@@ -453,6 +597,7 @@ namespace Simd
         {
             _gemm.Init(InitGemmFuncs(Sse41::Gemm32fNT, "Sse41"));
             _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _biasAddActivation = Sse41::ConvolutionBiasAddActivation;
         }
 
         //---------------------------------------------------------------------
@@ -537,6 +682,7 @@ namespace Simd
                 _nhwcReorderB = Sse41::Gemm32fNNcbReorderB;
             }
             _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _biasAddActivation = Sse41::ConvolutionBiasAddActivation;
         }
 
         //---------------------------------------------------------------------
@@ -596,7 +742,9 @@ namespace Simd
                     for (size_t i = 0; i < _count; ++i)
                         dst[i] = DotProduct(src + i * _size, _weight + i * _size, _size);
                 }
-                if (_param.activation)
+                if (_add)
+                    ConvolutionBiasAddActivation(NULL, _count, 1, _param.activation, _params, ::SimdTrue, _add + b * _sizeD, dst);
+                else if (_param.activation)
                     ConvolutionBiasAndActivation(NULL, _count, 1, _param.activation, _params, ::SimdFalse, dst);
                 src += _sizeS;
                 dst += _sizeD;
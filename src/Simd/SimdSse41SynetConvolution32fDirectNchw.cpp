@@ -36,7 +36,10 @@ namespace Simd
         SynetConvolution32fDirectNchw::SynetConvolution32fDirectNchw(const ConvParam32f & p)
             : Base::SynetConvolution32fDirectNchw(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _biasAddActivation = Sse41::ConvolutionBiasAddActivation;
         }
 
         template <size_t size> SIMD_INLINE void LoadWeight(const float * src, __m128 * dst)
@@ -193,6 +196,16 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGelu>(__m128 value, const __m128* params)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGeluTanh>(__m128 value, const __m128* params)
+        {
+            return GeluTanh(value);
+        }
+
         template<int kernel, int stride, ::SimdConvolutionActivationType type> 
         void ConvolutionBiasActivation(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, 
             const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW)
@@ -342,39 +355,41 @@ namespace Simd
             case ::SimdConvolutionActivationMish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationMish>;
             case ::SimdConvolutionActivationHardSigmoid: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationHardSigmoid>;
             case ::SimdConvolutionActivationSwish: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationSwish>;
+            case ::SimdConvolutionActivationGelu: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGelu>;
+            case ::SimdConvolutionActivationGeluTanh: return ConvolutionBiasActivation<kernel, stride, ::SimdConvolutionActivationGeluTanh>;
             default:
                 assert(0);
                 return NULL;
             }
         }
 
-        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNchw::ConvolutionBiasActivationPtr SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             if (p.dstW < F)
-                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             switch (p.strideX)
             {
             case 1:
                 if (p.kernelX == 1)
-                    return Sse41::SetConvolutionBiasActivation<1, 1>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<1, 1>(activation);
                 if (p.kernelX == 2)
-                    return Sse41::SetConvolutionBiasActivation<2, 1>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<2, 1>(activation);
                 if (p.kernelX == 3)
-                    return Sse41::SetConvolutionBiasActivation<3, 1>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<3, 1>(activation);
                 break;
             case 2:
                 if (p.kernelX == 2)
-                    return Sse41::SetConvolutionBiasActivation<2, 2>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<2, 2>(activation);
                 if (p.kernelX == 3)
-                    return Sse41::SetConvolutionBiasActivation<3, 2>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<3, 2>(activation);
                 break;
             case 3:
                 if (p.kernelX == 3)
-                    return Sse41::SetConvolutionBiasActivation<3, 3>(p.activation);
+                    return Sse41::SetConvolutionBiasActivation<3, 3>(activation);
                 break;
             default:
-                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation();
+                return Base::SynetConvolution32fDirectNchw::SetConvolutionBiasActivation(activation);
             }
             return NULL;
         }
@@ -36,7 +36,10 @@ namespace Simd
         SynetConvolution32fDirectNhwc::SynetConvolution32fDirectNhwc(const ConvParam32f & p)
             : Base::SynetConvolution32fDirectNhwc(p)
         {
-            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            _convolutionBiasActivation = SetConvolutionBiasActivation(p.activation);
+            _convolutionBiasIdentity = SetConvolutionBiasActivation(::SimdConvolutionActivationIdentity);
+            _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _biasAddActivation = Sse41::ConvolutionBiasAddActivation;
         }
 
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
@@ -941,13 +944,13 @@ namespace Simd
             return NULL;
         }
 
-        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation()
+        SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(::SimdConvolutionActivationType activation)
         {
             const ConvParam32f & p = _param;
             SynetConvolution32fDirectNhwc::ConvolutionBiasActivationPtr func = NULL;
             if (p.dstC >= F && p.dstH >= p.padY + p.padH && p.dstW >= p.padX + p.padW)
             {
-                switch (p.activation)
+                switch (activation)
                 {
                 case ::SimdConvolutionActivationIdentity: func = GetConvolutionBiasActivation<::SimdConvolutionActivationIdentity>(p); break;
                 case ::SimdConvolutionActivationRelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationRelu>(p); break;
@@ -959,9 +962,11 @@ namespace Simd
                 case ::SimdConvolutionActivationMish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationMish>(p); break;
                 case ::SimdConvolutionActivationHardSigmoid: func = GetConvolutionBiasActivation<::SimdConvolutionActivationHardSigmoid>(p); break;
                 case ::SimdConvolutionActivationSwish: func = GetConvolutionBiasActivation<::SimdConvolutionActivationSwish>(p); break;
+                case ::SimdConvolutionActivationGelu: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGelu>(p); break;
+                case ::SimdConvolutionActivationGeluTanh: func = GetConvolutionBiasActivation<::SimdConvolutionActivationGeluTanh>(p); break;
                 }
             }
-            return func ? func : Base::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation();
+            return func ? func : Base::SynetConvolution32fDirectNhwc::SetConvolutionBiasActivation(activation);
         };
     }
 #endif
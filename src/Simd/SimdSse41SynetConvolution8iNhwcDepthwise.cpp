@@ -134,6 +134,7 @@ namespace Simd
                         Save<term, activation>(dst, d00, norm, bias, params, scale, shift, upper, ci);
                     }
                     dst += p.dstC * a.size;
+                    bias += a.biasStep;
                 }
             }
         }
@@ -269,6 +270,7 @@ namespace Simd
             __m128i d00, d01, d02, d03, d10, d11, d12, d13, w0, w00, s0, s1;
             __m128i upper = _mm_set1_epi32(a.upper);
             size_t srcC = p.srcC;
+            size_t dstC = p.dstC * a.size;
             size_t srcCF = AlignLo(srcC, F);
             size_t srcCA = AlignLo(srcC, A);
             size_t srcS = srcC * p.srcW;
@@ -311,10 +313,10 @@ namespace Simd
                 Save<term, activation>(dst, d01, norm, bias, params, scale, shift, upper, c + F * 1);
                 Save<term, activation>(dst, d02, norm, bias, params, scale, shift, upper, c + F * 2);
                 Save<term, activation>(dst, d03, norm, bias, params, scale, shift, upper, c + F * 3);
-                Save<term, activation>(dst + srcC, d10, norm, bias, params, scale, shift, upper, c + F * 0);
-                Save<term, activation>(dst + srcC, d11, norm, bias, params, scale, shift, upper, c + F * 1);
-                Save<term, activation>(dst + srcC, d12, norm, bias, params, scale, shift, upper, c + F * 2);
-                Save<term, activation>(dst + srcC, d13, norm, bias, params, scale, shift, upper, c + F * 3);
+                Save<term, activation>(dst + dstC, d10, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 0);
+                Save<term, activation>(dst + dstC, d11, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 1);
+                Save<term, activation>(dst + dstC, d12, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 2);
+                Save<term, activation>(dst + dstC, d13, norm, bias + a.biasStep, params, scale, shift, upper, c + F * 3);
             }
             for (; c < srcC; c += F)
             {
@@ -335,7 +337,7 @@ namespace Simd
                     }
                 }
                 Save<term, activation>(dst, d00, norm, bias, params, scale, shift, upper, ct);
-                Save<term, activation>(dst + srcC, d10, norm, bias, params, scale, shift, upper, ct);
+                Save<term, activation>(dst + dstC, d10, norm, bias + a.biasStep, params, scale, shift, upper, ct);
             }
         }
 
@@ -352,23 +354,23 @@ namespace Simd
             size_t dy = 0;
             for (; dy < p.padY; ++dy)
                 for (size_t dx = 0; dx < p.dstW; ++dx)
-                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
             for (; dy < dstH; ++dy)
             {
                 size_t dx = 0;
                 for (; dx < p.padX; ++dx)
-                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
                 size_t offset = ((dy * p.strideY - p.padY) * p.srcW + dx * p.strideX - p.padX) * p.srcC;
                 for (; dx < dstW2; dx += 2)
-                    ConvolutionNhwcDepthwise3x3Main2<term, activation>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, offset += srcX * 2;
+                    ConvolutionNhwcDepthwise3x3Main2<term, activation>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC * 2, bias += a.biasStep * 2, offset += srcX * 2;
                 for (; dx < dstW; dx += 1)
-                    ConvolutionNhwcDepthwise3x3Main1<term, activation>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, offset += srcX;
+                    ConvolutionNhwcDepthwise3x3Main1<term, activation>(src + offset, p, a, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep, offset += srcX;
                 for (; dx < p.dstW; ++dx)
-                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
             }
             for (; dy < p.dstH; ++dy)
                 for (size_t dx = 0; dx < p.dstW; ++dx)
-                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC;
+                    ConvolutionNhwcDepthwise3x3Edge<term, activation>(src, p, a, dy, dx, weight, norm, bias, params, scale, shift, dst), dst += dstC, bias += a.biasStep;
         }
 
         //---------------------------------------------------------------------
@@ -403,6 +405,8 @@ namespace Simd
             case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(p, d); break;
             case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(p, d); break;
             case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(p, d); break;
+            case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, d); break;
+            case SimdConvolutionActivationGeluTanh: Set<SimdConvolutionActivationGeluTanh>(p, d); break;
             default: assert(0);
             }
         }
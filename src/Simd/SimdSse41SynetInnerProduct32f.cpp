@@ -38,6 +38,7 @@ namespace Simd
             : Base::SynetInnerProduct32fGemm(p)
         {
             _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+            _sparse = NULL;
             if (_param.transpose)
             {
                 _gemm = Sse41::Gemm32fNT;
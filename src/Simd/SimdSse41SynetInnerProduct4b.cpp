@@ -0,0 +1,78 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetInnerProduct4b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdExtract.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE) 
+    namespace Sse41
+    {
+        static float Dot4b(const float* src, const uint8_t* weight, const float* scale, const float* shift, const float* sums, size_t input, size_t group)
+        {
+            const __m128i _0F = _mm_set1_epi8(0x0F);
+            __m128 total = _mm_setzero_ps();
+            float tail = 0.0f;
+            for (size_t g = 0, beg = 0; beg < input; g += 1, beg += group)
+            {
+                size_t end = Simd::Min(beg + group, input), endA = beg + AlignLo(end - beg, 16), i = beg;
+                __m128 d0 = _mm_setzero_ps(), d1 = _mm_setzero_ps();
+                for (; i < endA; i += 16)
+                {
+                    __m128i w = _mm_loadl_epi64((__m128i*)(weight + i / 2));
+                    __m128i u = _mm_unpacklo_epi8(_mm_and_si128(w, _0F), _mm_and_si128(_mm_srli_epi16(w, 4), _0F));
+                    d0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(u)), _mm_loadu_ps(src + i + 0)), d0);
+                    d1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(u, 4))), _mm_loadu_ps(src + i + 4)), d1);
+                    d0 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(u, 8))), _mm_loadu_ps(src + i + 8)), d0);
+                    d1 = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(u, 12))), _mm_loadu_ps(src + i + 12)), d1);
+                }
+                float dot = 0.0f;
+                for (; i < end; ++i)
+                    dot += float((weight[i / 2] >> ((i & 1) * 4)) & 0xF) * src[i];
+                total = _mm_add_ps(_mm_mul_ps(_mm_add_ps(d0, d1), _mm_set1_ps(scale[g])), total);
+                tail += dot * scale[g] + shift[g] * sums[g];
+            }
+            return ExtractSum(total) + tail;
+        }
+
+        SynetInnerProduct4b::SynetInnerProduct4b(const InnerProductParam4b& p)
+            : Base::SynetInnerProduct4b(p)
+        {
+            _dot = Dot4b;
+            _biasAndActivation = Sse41::ConvolutionBiasAndActivation;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation)
+        {
+            InnerProductParam4b param(batch, input, output, group, transpose, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetInnerProduct4b(param);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetConvolution32f.h"
 
 namespace Simd
 {
@@ -193,6 +194,258 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void LayerNormNchw(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(2 * spatial);
+                buf = _buf.data;
+            }
+            float* mean = buf, * norm = buf + spatial;
+            float k = 1.0f / channels;
+            size_t spatialF = AlignLo(spatial, F);
+            __m128 _k = _mm_set1_ps(k), _eps = _mm_set1_ps(eps), _1 = _mm_set1_ps(1.0f);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                {
+                    _mm_storeu_ps(mean + s, _mm_setzero_ps());
+                    _mm_storeu_ps(norm + s, _mm_setzero_ps());
+                }
+                for (; s < spatial; ++s)
+                    mean[s] = 0, norm[s] = 0;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm_storeu_ps(mean + s, _mm_add_ps(_mm_loadu_ps(mean + s), _mm_loadu_ps(ps + s)));
+                    for (; s < spatial; ++s)
+                        mean[s] += ps[s];
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm_storeu_ps(mean + s, _mm_mul_ps(_mm_loadu_ps(mean + s), _k));
+                for (; s < spatial; ++s)
+                    mean[s] *= k;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m128 _src = _mm_sub_ps(_mm_loadu_ps(ps + s), _mm_loadu_ps(mean + s));
+                        _mm_storeu_ps(norm + s, _mm_add_ps(_mm_mul_ps(_src, _src), _mm_loadu_ps(norm + s)));
+                    }
+                    for (; s < spatial; ++s)
+                        norm[s] += Simd::Square(ps[s] - mean[s]);
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm_storeu_ps(norm + s, _mm_div_ps(_1, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(norm + s), _k), _eps))));
+                for (; s < spatial; ++s)
+                    norm[s] = 1.0f / ::sqrt(norm[s] * k + eps);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m128 _scale = _mm_set1_ps(scale[c]), _shift = _mm_set1_ps(shift[c]);
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m128 _src = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + s), _mm_loadu_ps(mean + s)), _mm_loadu_ps(norm + s));
+                        _mm_storeu_ps(dst + s, _mm_add_ps(_mm_mul_ps(_src, _scale), _shift));
+                    }
+                    for (; s < spatial; ++s)
+                        dst[s] = (src[s] - mean[s]) * norm[s] * scale[c] + shift[c];
+                    dst += spatial;
+                    src += spatial;
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+            }
+        }
+
+        void LayerNormNhwc(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            float k = 1.0f / channels;
+            size_t channelsF = AlignLo(channels, F);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m128 _sum = _mm_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _sum = _mm_add_ps(_sum, _mm_loadu_ps(src + c));
+                float mean = ExtractSum(_sum);
+                for (; c < channels; ++c)
+                    mean += src[c];
+                mean *= k;
+                __m128 _mean = _mm_set1_ps(mean);
+                _sum = _mm_setzero_ps();
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m128 _src = _mm_sub_ps(_mm_loadu_ps(src + c), _mean);
+                    _sum = _mm_add_ps(_mm_mul_ps(_src, _src), _sum);
+                }
+                float norm = ExtractSum(_sum);
+                for (; c < channels; ++c)
+                    norm += Simd::Square(src[c] - mean);
+                norm = 1.0f / ::sqrt(norm * k + eps);
+                __m128 _norm = _mm_set1_ps(norm);
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m128 _src = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + c), _mean), _norm);
+                    _mm_storeu_ps(dst + c, _mm_add_ps(_mm_mul_ps(_src, _mm_loadu_ps(scale + c)), _mm_loadu_ps(shift + c)));
+                }
+                for (; c < channels; ++c)
+                    dst[c] = (src[c] - mean) * norm * scale[c] + shift[c];
+                ConvolutionBiasAndActivation(NULL, channels, 1, activation, params, SimdTrue, dst);
+                dst += channels;
+                src += channels;
+            }
+        }
+
+        void SynetLayerNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                LayerNormNchw(src, batch, channels, spatial, scale, shift, eps[0], activation, params, buf, dst);
+            else if (format == SimdTensorFormatNhwc)
+                LayerNormNhwc(src, batch, channels, spatial, scale, shift, eps[0], activation, params, dst);
+            else
+                assert(0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void GroupNormNchw(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* dst)
+        {
+            size_t gC = channels / groups, gS = gC * spatial;
+            size_t gSF = AlignLo(gS, F), spatialF = AlignLo(spatial, F);
+            float k = 1.0f / gS;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    __m128 _sum = _mm_setzero_ps();
+                    size_t i = 0;
+                    for (; i < gSF; i += F)
+                        _sum = _mm_add_ps(_sum, _mm_loadu_ps(src + i));
+                    float mean = ExtractSum(_sum);
+                    for (; i < gS; ++i)
+                        mean += src[i];
+                    mean *= k;
+                    __m128 _mean = _mm_set1_ps(mean);
+                    _sum = _mm_setzero_ps();
+                    for (i = 0; i < gSF; i += F)
+                    {
+                        __m128 _src = _mm_sub_ps(_mm_loadu_ps(src + i), _mean);
+                        _sum = _mm_add_ps(_mm_mul_ps(_src, _src), _sum);
+                    }
+                    float norm = ExtractSum(_sum);
+                    for (; i < gS; ++i)
+                        norm += Simd::Square(src[i] - mean);
+                    norm = 1.0f / ::sqrt(norm * k + eps);
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                    {
+                        float _scale = norm * scale[c], _shift = shift[c] - mean * _scale;
+                        __m128 __scale = _mm_set1_ps(_scale), __shift = _mm_set1_ps(_shift);
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _mm_storeu_ps(dst + s, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + s), __scale), __shift));
+                        for (; s < spatial; ++s)
+                            dst[s] = src[s] * _scale + _shift;
+                        dst += spatial;
+                        src += spatial;
+                    }
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdFalse, dst - channels * spatial);
+            }
+        }
+
+        void GroupNormNhwc(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, const float* scale, const float* shift,
+            float eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(3 * channels);
+                buf = _buf.data;
+            }
+            float* sum = buf, * _scale = buf + channels, * _shift = buf + 2 * channels;
+            size_t gC = channels / groups, channelsF = AlignLo(channels, F);
+            float k = 1.0f / (gC * spatial);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _mm_storeu_ps(sum + c, _mm_setzero_ps());
+                for (; c < channels; ++c)
+                    sum[c] = 0;
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    const float* ps = src + s * channels;
+                    for (c = 0; c < channelsF; c += F)
+                        _mm_storeu_ps(sum + c, _mm_add_ps(_mm_loadu_ps(sum + c), _mm_loadu_ps(ps + c)));
+                    for (; c < channels; ++c)
+                        sum[c] += ps[c];
+                }
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    float mean = 0;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        mean += sum[c];
+                    mean *= k;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        _shift[c] = mean, sum[c] = 0;
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    const float* ps = src + s * channels;
+                    for (c = 0; c < channelsF; c += F)
+                    {
+                        __m128 _src = _mm_sub_ps(_mm_loadu_ps(ps + c), _mm_loadu_ps(_shift + c));
+                        _mm_storeu_ps(sum + c, _mm_add_ps(_mm_mul_ps(_src, _src), _mm_loadu_ps(sum + c)));
+                    }
+                    for (; c < channels; ++c)
+                        sum[c] += Simd::Square(ps[c] - _shift[c]);
+                }
+                for (size_t g = 0; g < groups; ++g)
+                {
+                    float norm = 0;
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                        norm += sum[c];
+                    norm = 1.0f / ::sqrt(norm * k + eps);
+                    for (size_t c = g * gC, e = c + gC; c < e; ++c)
+                    {
+                        _scale[c] = norm * scale[c];
+                        _shift[c] = shift[c] - _shift[c] * _scale[c];
+                    }
+                }
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (c = 0; c < channelsF; c += F)
+                        _mm_storeu_ps(dst + c, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + c), _mm_loadu_ps(_scale + c)), _mm_loadu_ps(_shift + c)));
+                    for (; c < channels; ++c)
+                        dst[c] = src[c] * _scale[c] + _shift[c];
+                    dst += channels;
+                    src += channels;
+                }
+                ConvolutionBiasAndActivation(NULL, channels, spatial, activation, params, SimdTrue, dst - channels * spatial);
+            }
+        }
+
+        void SynetGroupNorm32f(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+            const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            assert(channels % groups == 0);
+            if (format == SimdTensorFormatNchw)
+                GroupNormNchw(src, batch, channels, spatial, groups, scale, shift, eps[0], activation, params, dst);
+            else if (format == SimdTensorFormatNhwc)
+                GroupNormNhwc(src, batch, channels, spatial, groups, scale, shift, eps[0], activation, params, buf, dst);
+            else
+                assert(0);
+        }
     }
 #endif
 }
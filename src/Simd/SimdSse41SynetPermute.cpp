@@ -55,6 +55,7 @@ namespace Simd
                     break;
                 case SimdTensorData16b:
                 case SimdTensorData16f:
+                case SimdTensorData16u:
                     _permute = Permute2<uint16_t>;
                     break;
                 default:
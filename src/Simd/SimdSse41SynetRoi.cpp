@@ -0,0 +1,114 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetRoi.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+#include <float.h>
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Sse41
+    {
+        static void RoiAlignNhwc(const float* src, size_t channels, const Base::RoiAlignSample* samples, size_t count, float* dst)
+        {
+            size_t channelsF = AlignLo(channels, F), channelsQF = AlignLo(channels, QF), c = 0;
+            for (; c < channelsQF; c += QF)
+            {
+                __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps(), sum2 = _mm_setzero_ps(), sum3 = _mm_setzero_ps();
+                for (size_t s = 0; s < count; ++s)
+                {
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        const float* ps = src + samples[s].offset[k] * channels + c;
+                        __m128 w = _mm_set1_ps(samples[s].weight[k]);
+                        sum0 = _mm_add_ps(sum0, _mm_mul_ps(w, _mm_loadu_ps(ps + 0 * F)));
+                        sum1 = _mm_add_ps(sum1, _mm_mul_ps(w, _mm_loadu_ps(ps + 1 * F)));
+                        sum2 = _mm_add_ps(sum2, _mm_mul_ps(w, _mm_loadu_ps(ps + 2 * F)));
+                        sum3 = _mm_add_ps(sum3, _mm_mul_ps(w, _mm_loadu_ps(ps + 3 * F)));
+                    }
+                }
+                _mm_storeu_ps(dst + c + 0 * F, sum0);
+                _mm_storeu_ps(dst + c + 1 * F, sum1);
+                _mm_storeu_ps(dst + c + 2 * F, sum2);
+                _mm_storeu_ps(dst + c + 3 * F, sum3);
+            }
+            for (; c < channelsF; c += F)
+            {
+                __m128 sum = _mm_setzero_ps();
+                for (size_t s = 0; s < count; ++s)
+                    for (size_t k = 0; k < 4; ++k)
+                        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(samples[s].weight[k]), _mm_loadu_ps(src + samples[s].offset[k] * channels + c)));
+                _mm_storeu_ps(dst + c, sum);
+            }
+            for (; c < channels; ++c)
+            {
+                float sum = 0.0f;
+                for (size_t s = 0; s < count; ++s)
+                    for (size_t k = 0; k < 4; ++k)
+                        sum += samples[s].weight[k] * src[samples[s].offset[k] * channels + c];
+                dst[c] = sum;
+            }
+        }
+
+        void SynetRoiAlign32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            Base::SynetRoiAlign32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, samplingRatio, aligned, dst, dstH, dstW, format, RoiAlignNhwc);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void RoiPoolingMaxNhwc(const float* src, size_t srcW, size_t channels, size_t y0, size_t y1, size_t x0, size_t x1, float* dst)
+        {
+            float init = y0 < y1 && x0 < x1 ? -FLT_MAX : 0.0f;
+            size_t channelsF = AlignLo(channels, F), c = 0;
+            for (; c < channelsF; c += F)
+            {
+                __m128 max = _mm_set1_ps(init);
+                for (size_t y = y0; y < y1; ++y)
+                    for (size_t x = x0; x < x1; ++x)
+                        max = _mm_max_ps(max, _mm_loadu_ps(src + (y * srcW + x) * channels + c));
+                _mm_storeu_ps(dst + c, max);
+            }
+            for (; c < channels; ++c)
+            {
+                float max = init;
+                for (size_t y = y0; y < y1; ++y)
+                    for (size_t x = x0; x < x1; ++x)
+                        max = Simd::Max(max, src[(y * srcW + x) * channels + c]);
+                dst[c] = max;
+            }
+        }
+
+        void SynetRoiPoolingMax32f(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+            float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format)
+        {
+            Base::SynetRoiPoolingMax32f(src, srcC, srcH, srcW, rois, roiCount, spatialScale, dst, dstH, dstW, format, RoiPoolingMaxNhwc);
+        }
+    }
+#endif
+}
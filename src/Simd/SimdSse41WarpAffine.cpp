@@ -530,6 +530,14 @@ namespace Simd
             else
                 return NULL;
         }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, Base::WarpAffineBatch::Identity(), flags, border, A);
+            if (!param.Valid() || !(param.IsNearest() || param.IsByteBilinear()))
+                return NULL;
+            return new Base::WarpAffineBatch(param, WarpAffineInit);
+        }
     }
 #endif
 }
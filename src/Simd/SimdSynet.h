@@ -255,6 +255,16 @@ namespace Simd
             return value / (1.0f + ::exp(-value * slope));
         }
 
+        SIMD_INLINE float SynetGelu32f(float value)
+        {
+            return 0.5f * value * (1.0f + ::erf(value * 0.70710678f));
+        }
+
+        SIMD_INLINE float SynetGeluTanh32f(float value)
+        {
+            return value / (1.0f + ::exp(-value * (1.5957691f + 0.0713548f * value * value)));
+        }
+
         SIMD_INLINE float SynetTanh32f(float value, float slope)
         {
             return ::tanh(value*slope);
@@ -310,6 +320,31 @@ namespace Simd
         {
             return int32_t(value) | (int32_t(value) << 8) | (int32_t(value) << 16) | (int32_t(value) << 24);
         }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void SynetSoftmaxArgMaxStore(size_t index, SimdTensorDataType type, void* dst, size_t offset)
+        {
+            switch (type)
+            {
+            case SimdTensorData8u: ((uint8_t*)dst)[offset] = (uint8_t)index; break;
+            case SimdTensorData16u: ((uint16_t*)dst)[offset] = (uint16_t)index; break;
+            case SimdTensorData32i: ((int32_t*)dst)[offset] = (int32_t)index; break;
+            default: assert(0);
+            }
+        }
+
+        SIMD_INLINE void SynetSoftmaxTopKInsert(float value, uint32_t index, size_t k, size_t& size, float* val, uint32_t* idx)
+        {
+            size_t pos = size < k ? size++ : k - 1;
+            for (; pos > 0 && val[pos - 1] < value; --pos)
+            {
+                val[pos] = val[pos - 1];
+                idx[pos] = idx[pos - 1];
+            }
+            val[pos] = value;
+            idx[pos] = index;
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -0,0 +1,225 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetAttention32f_h__
+#define __SimdSynetAttention32f_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    struct AttentionParam32f
+    {
+        size_t batch;
+        size_t heads;
+        size_t seqQ;
+        size_t seqK;
+        size_t depth;
+        float scale;
+        SimdSynetCompatibilityType compatibility;
+
+        AttentionParam32f(size_t b, size_t h, size_t q, size_t k, size_t d, float s, SimdSynetCompatibilityType c)
+        {
+            batch = b;
+            heads = h;
+            seqQ = q;
+            seqK = k;
+            depth = d;
+            scale = s;
+            compatibility = c;
+        }
+
+        bool Valid() const
+        {
+            return batch && heads && seqQ && seqK && depth;
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << heads << "x" << seqQ << "x" << seqK << "x" << depth;
+            return ss.str();
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * heads * seqQ * seqK * depth * 4;
+        }
+#endif
+    };
+
+    class SynetAttention32f : public Deletable
+    {
+    public:
+        SynetAttention32f(const AttentionParam32f & p)
+            : _param(p)
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+            , _perf(NULL)
+#endif
+        {
+        }
+
+        const AttentionParam32f & Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+        virtual size_t ExternalBufferSize() const = 0;
+
+        virtual size_t InternalBufferSize() const
+        {
+            return _buffer.size;
+        }
+
+        virtual void Forward(const float * q, const float * k, const float * v, const float * mask, float * buf, float * dst) = 0;
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const String& func);
+#endif
+
+    protected:
+        float * Buffer(float * buffer)
+        {
+            if (buffer)
+                return buffer;
+            else
+            {
+                _buffer.Resize(ExternalBufferSize());
+                return _buffer.data;
+            }
+        }
+
+        AttentionParam32f _param;
+        Array32f _buffer;
+        mutable String _info;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer * _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        class SynetAttention32f : public Simd::SynetAttention32f
+        {
+        public:
+            SynetAttention32f(const AttentionParam32f & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual void Forward(const float * q, const float * k, const float * v, const float * mask, float * buf, float * dst);
+
+        protected:
+            typedef float(*Score32fPtr)(const float * q, const float * k, size_t count, size_t depth, float scale, const float * mask, float * dst);
+            typedef float(*Score16bPtr)(const uint16_t * q, const uint16_t * k, size_t count, size_t depth, float scale, const float * mask, float * dst);
+            typedef float(*SoftmaxPtr)(float * src, size_t count, float max);
+            typedef void(*Accum32fPtr)(const float * p, const float * v, size_t count, size_t depth, float alpha, float * dst);
+            typedef void(*Accum16bPtr)(const uint16_t * p, const uint16_t * v, size_t count, size_t depth, float alpha, float * dst);
+            typedef void(*ConvertPtr)(const float * src, size_t size, uint16_t * dst);
+            typedef void(*ConvertVPtr)(const float * src, size_t count, size_t depth, uint16_t * dst);
+
+            bool _bf16;
+            size_t _threads, _blockQ, _blockK, _sizeT;
+            Score32fPtr _score32f;
+            Score16bPtr _score16b;
+            SoftmaxPtr _softmax;
+            Accum32fPtr _accum32f;
+            Accum16bPtr _accum16b;
+            ConvertPtr _convert;
+            ConvertVPtr _convertV;
+
+            void SetBlocks(size_t F);
+            void ForwardRows(const float * q, const float * k, const float * v, const float * mask, size_t rows, float * buf, float * dst) const;
+        };
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetAttention32f : public Base::SynetAttention32f
+        {
+        public:
+            SynetAttention32f(const AttentionParam32f & p);
+            virtual String Ext() const { return "Sse41"; }
+        };
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetAttention32f : public Sse41::SynetAttention32f
+        {
+        public:
+            SynetAttention32f(const AttentionParam32f & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetAttention32f : public Avx2::SynetAttention32f
+        {
+        public:
+            SynetAttention32f(const AttentionParam32f & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        class SynetAttention32f : public Avx512bw::SynetAttention32f
+        {
+        public:
+            SynetAttention32f(const AttentionParam32f & p);
+            virtual String Ext() const { return "Avx512bf16"; }
+        };
+
+        void * SynetAttention32fInit(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+    }
+#endif//SIMD_AVX512BF16_ENABLE
+}
+
+#endif//__SimdSynetAttention32f_h__
@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetCalibration32f_h__
+#define __SimdSynetCalibration32f_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+#include <math.h>
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct Calibration32fParam
+        {
+            size_t channels, bins;
+            SimdTensorFormatType format;
+
+            Calibration32fParam(size_t c, size_t b, SimdTensorFormatType f)
+                : channels(c), bins(b), format(f)
+            {
+            }
+
+            bool Valid() const
+            {
+                return channels > 0 && bins >= 256 && bins % 2 == 0 && (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+            }
+        };
+
+        SIMD_INLINE size_t HistogramIndex(float value, float scale, int bins)
+        {
+            int index = Simd::Min(int(::fabs(value) * scale), bins - 1);
+            return value >= 0.0f ? index + bins : index;
+        }
+
+        class SynetCalibration32f : public Deletable
+        {
+        public:
+            SynetCalibration32f(const Calibration32fParam& param);
+
+            void Update(const float* src, size_t batch, size_t spatial);
+
+            void GetStats(SimdSynetCalibrationType type, float param, float* min, float* max) const;
+
+        protected:
+            virtual void Range(const float* src, size_t spatial, float* min, float* max);
+            virtual void Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram);
+
+            void Expand(size_t channel, float range);
+            float Percentile(const uint32_t* histogram, size_t channel, float percent) const;
+            float Entropy(size_t channel, size_t levels) const;
+
+            Calibration32fParam _param;
+            Array32f _min, _max, _range, _scale, _buffer;
+            Array32u _histogram;
+        };
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetCalibration32f : public Base::SynetCalibration32f
+        {
+        public:
+            SynetCalibration32f(const Base::Calibration32fParam& param);
+
+        protected:
+            virtual void Range(const float* src, size_t spatial, float* min, float* max);
+            virtual void Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram);
+        };
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetCalibration32f : public Sse41::SynetCalibration32f
+        {
+        public:
+            SynetCalibration32f(const Base::Calibration32fParam& param);
+
+        protected:
+            virtual void Range(const float* src, size_t spatial, float* min, float* max);
+            virtual void Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram);
+        };
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetCalibration32f : public Avx2::SynetCalibration32f
+        {
+        public:
+            SynetCalibration32f(const Base::Calibration32fParam& param);
+
+        protected:
+            virtual void Range(const float* src, size_t spatial, float* min, float* max);
+            virtual void Histogram(const float* src, size_t spatial, const float* scale, uint32_t* histogram);
+        };
+
+        void* SynetCalibration32fInit(size_t channels, size_t bins, SimdTensorFormatType format);
+    }
+#endif
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetPack.h"
 
 #ifdef _N
 #undef _N
@@ -94,6 +95,12 @@ namespace Simd
         return (p.padX + p.srcW - (p.kernelX - 1) * p.dilationX - 1) / p.strideX + 1;
     }
 
+    SIMD_INLINE void CopyResidual(const float* add, size_t count, size_t channels, size_t stride, float* dst)
+    {
+        for (size_t i = 0; i < count; ++i, add += stride, dst += stride)
+            memcpy(dst, add, channels * sizeof(float));
+    }
+
     //---------------------------------------------------------------------------------------------
 
     struct ConvParam32f : public SimdConvolutionParameters
@@ -221,9 +228,14 @@ namespace Simd
             : _param(p)
             , _0(0.0f)
             , _1(1.0f)
+            , _weight(NULL)
+            , _bias(NULL)
+            , _params(NULL)
+            , _add(NULL)
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
+            , _biasAddActivation(0)
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
             , _perf(NULL)
 #endif
@@ -245,7 +257,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size;
+            return _buffer.size + OwnedSize(_nhwcWeight);
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -259,6 +271,32 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        void ForwardAdd(const float * src, float * buf, const float * add, float * dst);
+
+        size_t Export(void * data, size_t size);
+        bool Import(const void * data, size_t size, bool attach);
+
+        SynetPacked * CreatePacked();
+        bool SetPacked(const SynetPacked & packed);
+
+        virtual void Pack(SynetPack & pack);
+        virtual String PackKey() const;
+
+        typedef void* (*InitPtr)(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+
+        bool Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init);
+        void KeepParams(const float * weight, SimdBool internal, const float * bias, const float * params);
+
+        SIMD_INLINE SynetConvolution32f * Shaped()
+        {
+            return _shapes.Active(this);
+        }
+
+        SIMD_INLINE void ClearShapes()
+        {
+            _shapes.Clear();
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -284,17 +322,24 @@ namespace Simd
         typedef void(*NhwcReorderB)(size_t M, size_t N, size_t K, const float * B, float * pB, GemmKernelType type, bool compatibility);
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
+        typedef void(*BiasAddActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, const float * add, float * dst);
+
+        void PackBiasAndParams(SynetPack & pack);
 
         ConvParam32f _param;
         Array32f _buffer;
         float _0, _1;
-        const float * _weight, * _bias, * _params;
+        const float * _weight, * _bias, * _params, * _add;
         RuntimeGemm _gemm;
         RuntimeGemmCb _gemmCb;
         Array32f _nhwcWeight;
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        BiasAddActivation _biasAddActivation;
+        Array32f _pWeight, _pBias, _pParams;
+        SynetPacked::Blob _packed;
+        SynetShapes<SynetConvolution32f> _shapes;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -307,6 +352,8 @@ namespace Simd
     {
         void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, const float* add, float* dst);
+
         class SynetConvolution32fGemmNN : public SynetConvolution32f
         {
         public:
@@ -318,6 +365,8 @@ namespace Simd
             virtual void Forward(const float * src, float * buf, float * dst);
 
         protected:
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
             bool GemmRuntime() const;
@@ -361,6 +410,8 @@ namespace Simd
             typedef void(*SetInput)(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
             typedef void(*SetOutput)(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
             void SetBlock(size_t blockY, size_t blockX);
             void ForwardMerged(const float * src, float * bufS, float * bufD, float * dst);
             void ForwardSplitted(const float * src, float * bufS, float * bufD, float * dst);
@@ -392,11 +443,11 @@ namespace Simd
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, size_t srcC, size_t srcH, size_t srcW, const float * weight, const float * bias, const float * params, float * dst, size_t dstC, size_t dstH, size_t dstW);
         protected:
             void Pad(const float * src, float * dst) const;
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
 
             size_t _grW, _grS, _grD, _srcC, _srcH, _srcW, _dstC;
             int _pad;
-            ConvolutionBiasActivationPtr _convolutionBiasActivation;
+            ConvolutionBiasActivationPtr _convolutionBiasActivation, _convolutionBiasIdentity;
         };
 
         class SynetConvolution32fDirectNhwc : public SynetConvolution32f
@@ -411,10 +462,10 @@ namespace Simd
 
             typedef void(*ConvolutionBiasActivationPtr)(const float * src, const ConvParam32f & p, const float * weight, const float * bias, const float * params, float * dst);
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(); 
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
 
             size_t _batch, _sizeS, _sizeD;
-            ConvolutionBiasActivationPtr _convolutionBiasActivation;
+            ConvolutionBiasActivationPtr _convolutionBiasActivation, _convolutionBiasIdentity;
         };
 
         class SynetConvolution32fDepthwiseDotProduct : public SynetConvolution32f
@@ -455,19 +506,22 @@ namespace Simd
                 size_t stepW;
             };
 
-            typedef void(*OldConvolutionPtr)(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            typedef void(*OldConvolutionPtr)(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, const float* add, float* dst);
 
         protected:
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
+
             size_t _sizeS, _sizeD;
             Array32f _rWeight, _rBias, _rParams;
 
-            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst);
+            static void Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, const float* add, float* dst);
 
             struct RunArgs
             {
-                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; float* dst;
-                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, float* dst_)
-                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), dst(dst_)
+                const float* src; const ConvParam32f& p; const float* weight; const float* bias; const float* params; const float* add; float* dst;
+                SIMD_INLINE RunArgs(const float* src_, const ConvParam32f& p_, const float* weight_, const float* bias_, const float* params_, const float* add_, float* dst_)
+                    :src(src_), p(p_), weight(weight_), bias(bias_), params(params_), add(add_), dst(dst_)
                 {}
             };
 
@@ -482,7 +536,7 @@ namespace Simd
 
                 SIMD_INLINE void Run(const RunArgs& args)
                 {
-                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.dst);
+                    Forward(args.src, args.p, alg, args.weight, args.bias, args.params, args.add, args.dst);
                 }
 
 #ifdef SIMD_RUNTIME_STATISTIC
@@ -529,6 +583,7 @@ namespace Simd
             virtual void Forward(const float* src, float* buf, float* dst);
 
         protected:
+            virtual void Pack(SynetPack & pack);
             void ImgToCol(const float* src, uint16_t* dst);
             void ImgToRow(const float* src, uint16_t* dst);
             void GemmNN(size_t M, size_t N, size_t K, const uint16_t* A, size_t lda, const uint16_t* B, size_t ldb, float* C, size_t ldc);
@@ -563,13 +618,15 @@ namespace Simd
                 size_t srcC, int zero, const uint16_t* weight, const float* bias, const float* params, float* dst);
 
         protected:
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
             void SetAlgParam(size_t microD, size_t microHW, size_t microC, size_t L1, size_t L2, size_t L3);
             int PreferableMode(size_t microD, size_t microHW, size_t microC, size_t L1, size_t L2, size_t L3);
             void SetWeight(const float* weight);
             void SetBias(const float* bias);
             void SetParams(const float* params);
-            void ForwardConv(const float* src, uint16_t* buf, float* dst);
-            void ForwardGemm(const float* src, uint16_t* buf, float* dst);
+            void ForwardConv(const float* src, uint16_t* buf, const float* add, float* dst);
+            void ForwardGemm(const float* src, uint16_t* buf, const float* add, float* dst);
             size_t Offset(size_t yBeg, size_t cBeg, size_t cEnd);
 
             Array16u _weight;
@@ -589,6 +646,8 @@ namespace Simd
     {
         void ConvolutionBiasAndActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
 
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst);
+
         class SynetConvolution32fGemmNN : public Base::SynetConvolution32fGemmNN
         {
         public:
@@ -619,7 +678,7 @@ namespace Simd
             static bool Preferable(const ConvParam32f& p);
 
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDirectNhwc : public Base::SynetConvolution32fDirectNhwc
@@ -630,7 +689,7 @@ namespace Simd
 
             static bool Preferable(const ConvParam32f& p);
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDepthwiseDotProduct : public Base::SynetConvolution32fDepthwiseDotProduct
@@ -705,7 +764,7 @@ namespace Simd
             SynetConvolution32fDirectNchw(const ConvParam32f & p);
             virtual String Ext() const { return "Avx"; }
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDirectNhwc : public Sse41::SynetConvolution32fDirectNhwc
@@ -716,7 +775,7 @@ namespace Simd
         
             static bool Preferable(const ConvParam32f & p);
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDepthwiseDotProduct : public Sse41::SynetConvolution32fDepthwiseDotProduct
@@ -746,6 +805,8 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst);
+
         void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C);
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB);
         size_t NhwcBufferSize(size_t M, size_t N, size_t K);
@@ -781,7 +842,7 @@ namespace Simd
             SynetConvolution32fDirectNchw(const ConvParam32f & p);
             virtual String Ext() const { return "Avx2"; }
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDirectNhwc : public Avx::SynetConvolution32fDirectNhwc
@@ -790,7 +851,7 @@ namespace Simd
             SynetConvolution32fDirectNhwc(const ConvParam32f & p);
             virtual String Ext() const { return "Avx2"; }
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fNhwcDirect : public Avx::SynetConvolution32fNhwcDirect
@@ -826,6 +887,8 @@ namespace Simd
     {
         void ConvolutionBiasAndActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
 
+        void ConvolutionBiasAddActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, const float* add, float* dst);
+
         //-----------------------------------------------------------------------------------------
 
         class SynetConvolution32fGemmNN : public Avx2::SynetConvolution32fGemmNN
@@ -863,7 +926,7 @@ namespace Simd
             static bool Preferable(const ConvParam32f& p);
 
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDirectNhwc : public Avx2::SynetConvolution32fDirectNhwc
@@ -872,7 +935,7 @@ namespace Simd
             SynetConvolution32fDirectNhwc(const ConvParam32f& p);
             virtual String Ext() const { return "Avx512bw"; }
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fNhwcDirect : public Avx2::SynetConvolution32fNhwcDirect
@@ -992,7 +1055,7 @@ namespace Simd
             static bool Preferable(const ConvParam32f & p);
 
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDirectNhwc : public Base::SynetConvolution32fDirectNhwc
@@ -1003,7 +1066,7 @@ namespace Simd
 
             static bool Preferable(const ConvParam32f & p);
         protected:
-            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation();
+            virtual ConvolutionBiasActivationPtr SetConvolutionBiasActivation(::SimdConvolutionActivationType activation);
         };
 
         class SynetConvolution32fDepthwiseDotProduct : public Base::SynetConvolution32fDepthwiseDotProduct
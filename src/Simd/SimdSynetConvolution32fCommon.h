@@ -92,6 +92,16 @@ namespace Simd
             return SynetSwish32f(value, params[0]);
         }
 
+        template<> SIMD_INLINE float Activate<SimdConvolutionActivationGelu>(float value, const float* params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
+        template<> SIMD_INLINE float Activate<SimdConvolutionActivationGeluTanh>(float value, const float* params, size_t offset)
+        {
+            return SynetGeluTanh32f(value);
+        }
+
         template<SimdConvolutionActivationType type> void DepthwiseConvolution(const float* src, const SimdConvolutionParameters& p,
             size_t maC, size_t yBeg, size_t yEnd, const size_t bufH[2], const float* weight, const float* bias, const float* params, float* dst, int first)
         {
@@ -185,6 +195,16 @@ namespace Simd
             return Swish(value, _mm_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGelu>(__m128 value, const float* params, size_t offset)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGeluTanh>(__m128 value, const float* params, size_t offset)
+        {
+            return GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m128 Activate(__m128 value, const __m128 * params, size_t index);
@@ -239,6 +259,16 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGelu>(__m128 value, const __m128* params, size_t index)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGeluTanh>(__m128 value, const __m128* params, size_t index)
+        {
+            return GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -490,6 +520,16 @@ namespace Simd
             return Avx2::Swish(value, _mm256_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const float* params, size_t offset)
+        {
+            return Avx2::Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGeluTanh>(__m256 value, const float* params, size_t offset)
+        {
+            return Avx2::GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m256 Activate(__m256 value, const __m256 * params, size_t index);
@@ -544,6 +584,16 @@ namespace Simd
             return Avx2::Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const __m256* params, size_t index)
+        {
+            return Avx2::Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGeluTanh>(__m256 value, const __m256* params, size_t index)
+        {
+            return Avx2::GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -677,6 +727,16 @@ namespace Simd
             return Swish(value, _mm512_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const float* params, size_t offset, __mmask16 tail)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGeluTanh>(__m512 value, const float* params, size_t offset, __mmask16 tail)
+        {
+            return GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m512 Activate(__m512 value, const __m512 * params, size_t index);
@@ -731,6 +791,16 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const __m512* params, size_t index)
+        {
+            return Gelu(value);
+        }
+
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGeluTanh>(__m512 value, const __m512* params, size_t index)
+        {
+            return GeluTanh(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -26,6 +26,7 @@
 
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdSynetPack.h"
 
 #ifdef _N
 #undef _N
@@ -147,9 +148,11 @@ namespace Simd
 
         void Init(const float* min, const float* max, size_t size, SimdSynetCompatibilityType compatibility);
 
+        void Pack(SynetPack& pack);
+
         size_t Size() const
         {
-            return (zero.size) * sizeof(uint8_t) + (scale.size + shift.size + iScale.size + iShift.size) * sizeof(float);
+            return OwnedSize(zero) * sizeof(uint8_t) + (OwnedSize(scale) + OwnedSize(shift) + OwnedSize(iScale) + OwnedSize(iShift)) * sizeof(float);
         }
     };
 
@@ -169,6 +172,13 @@ namespace Simd
         virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
 
         virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
+        void ForwardAdd(const uint8_t* src, uint8_t* buf, const uint8_t* add, const float* addScale, const float* addShift, uint8_t* dst);
+
+        size_t Export(void* data, size_t size);
+        bool Import(const void* data, size_t size, bool attach);
+
+        SynetPacked* CreatePacked();
+        bool SetPacked(const SynetPacked& packed);
 
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer* Perf(const char* func);
@@ -181,7 +191,17 @@ namespace Simd
         }
 
     protected:
-        virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
+        virtual void Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst) = 0;
+        virtual void Pack(SynetPack& pack);
+        virtual String PackKey() const;
+        void AddResidual(const uint8_t* add, float* dst);
+        void Activate(float* dst, size_t batch);
+        float Activate(float value, size_t channel) const;
+
+        SIMD_INLINE float Residual(const uint8_t* add, size_t index, size_t channel) const
+        {
+            return _dst8u ? float(add[index]) * _addScale[channel] + _addShift[channel] : ((const float*)add)[index];
+        }
 
         typedef void(*Convert32fTo8u)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
@@ -195,8 +215,10 @@ namespace Simd
         CvtParam _srcCvt, _dstCvt;
         Array8i _weight;
         Array32f _norm, _bias, _params; 
+        const float* _addScale, * _addShift;
         bool _src8u, _dst8u;
         size_t _merge, _sizeS, _sizeD;
+        SynetPacked::Blob _packed;
     };
 
     namespace Base
@@ -210,7 +232,7 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
 
         protected:
-            virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual void Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst);
 
             bool _skipConv;
             size_t _ldW, _ldS, _ldD, _grW, _grS, _grD, _siC, _siK, _siS, _siD, _sizeB;
@@ -238,13 +260,17 @@ namespace Simd
                 const int8_t* weight, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, int32_t* buf, uint8_t* dst, int first);
 
         protected:
+            virtual void Pack(SynetPack& pack);
+            virtual String PackKey() const;
             void SetAlgParam(size_t F, size_t microD, size_t microHW, size_t L1, size_t L2, size_t L3);
             void ReorderWeight();
             bool PadEnable(size_t microHW);
             void PadInput(const uint8_t* src, uint8_t* dst);
 
-            virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-            void Forward8u(const uint8_t* src, const ConvParam8i & p, int32_t* buf, uint8_t* dst);
+            virtual void Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst);
+            void Forward8u(const uint8_t* src, const ConvParam8i & p, int32_t* buf, const uint8_t* add, uint8_t* dst);
+            void SetResidual(const uint8_t* add, size_t dc, size_t macroD, size_t yBeg, size_t yEnd, const float* norm, int32_t* buf);
+            void SetZeroNormResidual(const uint8_t* add, uint8_t* dst);
 
             AlgParam _alg;
             size_t _sizeP, _sizeB;
@@ -258,21 +284,23 @@ namespace Simd
             SynetConvolution8iNhwcDepthwise(const ConvParam8i& p);
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
 
             static bool Preferable(const ConvParam8i& p);
 
             struct AlgParam
             {
-                int32_t zero, size, upper;
+                int32_t zero, size, upper, biasStep;
             };
 
             typedef void(*ConvolutionPtr)(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, const int8_t* weight, 
                 const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst);
 
         protected:
-
-            virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+            virtual void Pack(SynetPack& pack);
+            virtual void Forward8u(const uint8_t* src, uint8_t* buf, const uint8_t* add, uint8_t* dst);
+            void SetResidual(const uint8_t* add, float* dst);
 
             AlgParam _alg;
             ConvolutionPtr _convolution;
@@ -28,6 +28,7 @@
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
 #include "Simd/SimdGemm.h"
+#include "Simd/SimdSynetPack.h"
 
 #ifdef _N
 #undef _N
@@ -35,6 +36,8 @@
 
 namespace Simd
 {
+    class SynetConvolution32f;
+
     struct DeconvParam32f : public SimdConvolutionParameters
     {
         SimdBool trans;
@@ -87,6 +90,11 @@ namespace Simd
             return IsKernel(1) && IsDilation(1) && IsStride(1) && IsPad(0);
         }
 
+        SIMD_INLINE size_t SizeW() const
+        {
+            return kernelY * kernelX * srcC * dstC / group;
+        }
+
 #ifdef SIMD_PERFORMANCE_STATISTIC
         String Info() const
         {
@@ -111,6 +119,9 @@ namespace Simd
             : _param(p)
             , _0(0.0f)
             , _1(1.0f)
+            , _weight(NULL)
+            , _bias(NULL)
+            , _params(NULL)
             , _nhwcRun(0)
             , _nhwcReorderB(0)
             , _biasAndActivation(0)
@@ -135,7 +146,7 @@ namespace Simd
 
         virtual size_t InternalBufferSize() const
         {
-            return _buffer.size + _nhwcWeight.size + _weightT.size;
+            return _buffer.size + OwnedSize(_nhwcWeight) + OwnedSize(_weightT);
         }
 
         virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
@@ -149,6 +160,30 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        size_t Export(void * data, size_t size);
+        bool Import(const void * data, size_t size, bool attach);
+
+        SynetPacked * CreatePacked();
+        bool SetPacked(const SynetPacked & packed);
+
+        virtual void Pack(SynetPack & pack);
+        virtual String PackKey() const;
+
+        typedef void* (*InitPtr)(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+
+        bool Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init);
+        void KeepParams(const float * weight, SimdBool internal, const float * bias, const float * params);
+
+        SIMD_INLINE SynetDeconvolution32f * Shaped()
+        {
+            return _shapes.Active(this);
+        }
+
+        SIMD_INLINE void ClearShapes()
+        {
+            _shapes.Clear();
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -175,6 +210,8 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        void PackBiasAndParams(SynetPack & pack);
+
         DeconvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -185,6 +222,9 @@ namespace Simd
         NhwcRun _nhwcRun;
         NhwcReorderB _nhwcReorderB;
         BiasAndActivation _biasAndActivation;
+        Array32f _pWeight, _pBias, _pParams;
+        SynetPacked::Blob _packed;
+        SynetShapes<SynetDeconvolution32f> _shapes;
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         Base::PerformanceMeasurer * _perf;
 #endif
@@ -202,6 +242,8 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
 
         protected:
             virtual void ColToImg(const float * src, float * dst);
@@ -220,6 +262,8 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
 
             static bool Preferable(const DeconvParam32f & p);
 
@@ -239,6 +283,31 @@ namespace Simd
             DeconvolutionPtr _deconvolution;
         };
 
+        class SynetDeconvolution32fBf16 : public SynetDeconvolution32f
+        {
+        public:
+            typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+            SynetDeconvolution32fBf16(const DeconvParam32f & p, ConvolutionInitPtr init, BiasAndActivation biasAndActivation);
+            virtual ~SynetDeconvolution32fBf16();
+            virtual String Ext() const;
+            virtual String Desc() const { return Ext() + "::Bf16"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
+
+            static bool Preferable(const DeconvParam32f & p);
+
+        protected:
+            SynetConvolution32f * _conv;
+            size_t _sizeB, _sizeD;
+        };
+
+        void SynetDeconvolutionRowToImg(const SimdConvolutionParameters & p, const float * src, float * dst);
+
         void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -328,6 +397,13 @@ namespace Simd
     }
 #endif
 
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))    
+    namespace AmxBf16
+    {
+        void * SynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
@@ -0,0 +1,191 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetDeconvolution8i_h__
+#define __SimdSynetDeconvolution8i_h__
+
+#include "Simd/SimdSynetConvolution8i.h"
+
+namespace Simd
+{
+    struct DeconvParam8i : public SimdConvolutionParameters
+    {
+        size_t batch;
+        SimdSynetCompatibilityType compatibility;
+
+        DeconvParam8i(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
+        {
+            *((SimdConvolutionParameters*)this) = *conv;
+            this->batch = batch;
+            this->compatibility = compatibility;
+        }
+
+        bool Valid() const
+        {
+            return
+                dstH == strideY * (srcH - 1) + dilationY * (kernelY - 1) + 1 - padY - padH && dstH > 0 &&
+                dstW == strideX * (srcW - 1) + dilationX * (kernelX - 1) + 1 - padX - padW && dstW > 0 &&
+                (srcT == SimdTensorData32f || srcT == SimdTensorData8u) && (dstT == SimdTensorData32f || dstT == SimdTensorData8u) &&
+                srcF == SimdTensorFormatNhwc && dstF == SimdTensorFormatNhwc && group == 1;
+        }
+
+        SimdConvolutionParameters Conv() const
+        {
+            SimdConvolutionParameters conv = *this;
+            conv.dstC = kernelY * kernelX * dstC;
+            conv.dstH = srcH;
+            conv.dstW = srcW;
+            conv.dstT = SimdTensorData32f;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.activation = SimdConvolutionActivationIdentity;
+            return conv;
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << srcC << "x" << srcH << "x" << srcW;
+            ss << "-" << dstC << "x" << kernelY << "x" << kernelX;
+            ss << "-" << strideX << "-" << Simd::Max(padX, padW);
+            ss << "-" << (srcT == SimdTensorData8u ? "u" : "f") << (dstT == SimdTensorData8u ? "u" : "f");
+            return ss.str();
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * kernelY * kernelX * srcC * srcH * srcW * dstC * 2;
+        }
+#endif
+    };
+
+    class SynetDeconvolution8i : public Deletable
+    {
+    public:
+        typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+        typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, float* dst);
+        typedef void(*Convert32fTo8uPtr)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, 
+            const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
+
+        SynetDeconvolution8i(const DeconvParam8i & p, SynetConvolution8i * conv, BiasAndActivationPtr biasAndActivation, Convert32fTo8uPtr convert32fTo8u);
+        virtual ~SynetDeconvolution8i();
+
+        const DeconvParam8i & Param() const { return _param; }
+
+        String Ext() const { return _conv->Ext(); }
+        String Desc() const { return _conv->Desc() + "-RowToImg"; }
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+        size_t ExternalBufferSize() const;
+        size_t InternalBufferSize() const;
+
+        void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+
+        void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const char* func);
+#endif
+
+        static void * Create(const DeconvParam8i & p, ConvolutionInitPtr init, BiasAndActivationPtr biasAndActivation, Convert32fTo8uPtr convert32fTo8u);
+
+    protected:
+        uint8_t* Buffer(uint8_t* buffer);
+
+        DeconvParam8i _param;
+        SynetConvolution8i * _conv;
+        size_t _sizeB, _sizeD, _sizeC;
+        Array8u _buffer;
+        Array32f _bias, _params;
+        CvtParam _dstCvt;
+        BiasAndActivationPtr _biasAndActivation;
+        Convert32fTo8uPtr _convert32fTo8u;
+        mutable String _info;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer * _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE    
+    namespace Avx512vnni
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AMXBF16_ENABLE    
+    namespace AmxBf16
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        void* SynetDeconvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+}
+
+#endif//__SimdSynetDeconvolution8i_h__
@@ -0,0 +1,744 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetGraph_hpp__
+#define __SimdSynetGraph_hpp__
+
+#include "Simd/SimdLib.h"
+#include "Simd/SimdAllocator.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <string>
+#include <sstream>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_graph
+
+        \short The SynetGraph class is a network-level runner of FP32 inference built from Synet contexts.
+
+        User describes a DAG of Synet operations (in topological order). Function SynetGraph::Compile fuses adjacent operations
+        where kernels support it (convolution + activation, convolution + residual addition,
+        convolution -> depthwise convolution -> convolution into merged convolution), converts input tensor to NHWC format,
+        plans one workspace for all intermediate tensors and context buffers (see ::SimdSynetWorkspaceInit)
+        and creates all contexts. Function SynetGraph::Forward runs images of the batch in parallel threads.
+
+        Limitations: the graph works only with FP32 tensors in NHWC format (NCHW input is permuted by the first step).
+        It has no INT8 operations and does not insert precision conversions: compatibility flags are just passed to the created contexts.
+        Synet contexts used by the graph are single-threaded, so threading is batch-level only: one image is processed by one thread,
+        and a graph compiled with batch size 1 runs in one thread whatever number of threads is passed to SynetGraph::Compile.
+
+        All weights are in NHWC layout: convolution weight has shape [kernelY, kernelX, srcC / group, dstC],
+        inner product weight has shape [output, input], where input is flattened NHWC tensor.
+
+        Using example (inverted residual block of MobileNetV2):
+        \code
+        #include "Simd/SimdSynetGraph.hpp"
+
+        void Run(const float * w0, const float * w1, const float * w2, const float * src, float * dst)
+        {
+            const float relu6[2] = { 0.0f, 6.0f };
+            Simd::SynetGraph graph;
+            Simd::SynetGraph::Id x = graph.Input(32, 56, 56);
+            Simd::SynetGraph::Id y = graph.Convolution(x, 192, 1, 1, 0, 1, w0, NULL, SimdConvolutionActivationRestrictRange, relu6);
+            y = graph.Convolution(y, 192, 3, 1, 1, 192, w1, NULL, SimdConvolutionActivationRestrictRange, relu6);
+            y = graph.Convolution(y, 32, 1, 1, 0, 1, w2, NULL);
+            graph.Output(graph.Add(y, x));
+            if (graph.Compile(1))
+                graph.Forward(src, dst);
+        }
+        \endcode
+    */
+    class SynetGraph
+    {
+    public:
+        typedef size_t Id; /*!< A tensor identifier type definition. */
+
+        /*!
+            Creates a new empty graph.
+        */
+        SynetGraph()
+            : _batch(0)
+            , _threads(1)
+            , _arenaSize(0)
+            , _inputFormat(SimdTensorFormatNhwc)
+        {
+        }
+
+        /*!
+            Releases all contexts of compiled graph.
+        */
+        ~SynetGraph()
+        {
+            Clear();
+        }
+
+        /*!
+            Adds input tensor to the graph. The graph must have only one input.
+
+            \param [in] channels - a number of channels of input tensor.
+            \param [in] height - a height of input tensor.
+            \param [in] width - a width of input tensor.
+            \param [in] format - a format of input tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+            \return an identifier of input tensor.
+        */
+        Id Input(size_t channels, size_t height, size_t width, SimdTensorFormatType format = SimdTensorFormatNhwc)
+        {
+            _inputFormat = format;
+            return AddTensor(channels, height, width);
+        }
+
+        /*!
+            Adds FP32 convolution to the graph.
+
+            \param [in] src - an identifier of input tensor.
+            \param [in] dstC - a number of output channels.
+            \param [in] kernel - a size of convolution kernel.
+            \param [in] stride - a stride of convolution.
+            \param [in] pad - a padding of convolution (the same for all sides).
+            \param [in] group - a number of convolution groups.
+            \param [in] weight - a pointer to convolution weight (it is copied to the graph).
+            \param [in] bias - a pointer to convolution bias. Can be NULL.
+            \param [in] activation - an activation function type.
+            \param [in] params - a pointer to 2 parameters of activation function. Can be NULL for ::SimdConvolutionActivationIdentity and ::SimdConvolutionActivationRelu.
+            \return an identifier of output tensor.
+        */
+        Id Convolution(Id src, size_t dstC, size_t kernel, size_t stride, size_t pad, size_t group, const float* weight, const float* bias,
+            SimdConvolutionActivationType activation = SimdConvolutionActivationIdentity, const float* params = NULL)
+        {
+            const Tensor & s = _tensors[src];
+            Node node(NodeConvolution, src);
+            SimdConvolutionParameters & c = node.convs[0];
+            c.srcC = s.c, c.srcH = s.h, c.srcW = s.w, c.srcT = SimdTensorData32f, c.srcF = SimdTensorFormatNhwc;
+            c.dstC = dstC, c.dstT = SimdTensorData32f, c.dstF = SimdTensorFormatNhwc;
+            c.kernelY = kernel, c.kernelX = kernel, c.dilationY = 1, c.dilationX = 1, c.strideY = stride, c.strideX = stride;
+            c.padY = pad, c.padX = pad, c.padH = pad, c.padW = pad, c.group = group, c.activation = activation;
+            c.dstH = (s.h + 2 * pad - kernel) / stride + 1;
+            c.dstW = (s.w + 2 * pad - kernel) / stride + 1;
+            node.weight[0].assign(weight, weight + kernel * kernel * s.c / group * dstC);
+            node.bias[0].assign(dstC, 0.0f);
+            if (bias)
+                node.bias[0].assign(bias, bias + dstC);
+            SetParams(node.params[0], activation, params);
+            node.dst = AddTensor(c.dstC, c.dstH, c.dstW);
+            _nodes.push_back(node);
+            return node.dst;
+        }
+
+        /*!
+            Adds activation function to the graph.
+
+            \param [in] src - an identifier of input tensor.
+            \param [in] type - an activation function type. It can be ::SimdConvolutionActivationRelu, ::SimdConvolutionActivationLeakyRelu,
+                ::SimdConvolutionActivationRestrictRange or ::SimdConvolutionActivationHswish.
+            \param [in] params - a pointer to 2 parameters of activation function. Can be NULL for ::SimdConvolutionActivationRelu.
+            \return an identifier of output tensor.
+        */
+        Id Activation(Id src, SimdConvolutionActivationType type, const float* params = NULL)
+        {
+            const Tensor& s = _tensors[src];
+            Node node(NodeActivation, src);
+            node.convs[0].activation = type;
+            SetParams(node.params[0], type, params);
+            node.dst = AddTensor(s.c, s.h, s.w);
+            _nodes.push_back(node);
+            return node.dst;
+        }
+
+        /*!
+            Adds elementwise sum of two tensors of the same shape to the graph.
+
+            \param [in] a - an identifier of the first input tensor.
+            \param [in] b - an identifier of the second input tensor.
+            \return an identifier of output tensor.
+        */
+        Id Add(Id a, Id b)
+        {
+            const Tensor& s = _tensors[a];
+            Node node(NodeAdd, a);
+            node.src.push_back(b);
+            node.dst = AddTensor(s.c, s.h, s.w);
+            _nodes.push_back(node);
+            return node.dst;
+        }
+
+        /*!
+            Adds global average pooling to the graph.
+
+            \param [in] src - an identifier of input tensor.
+            \return an identifier of output tensor (it has spatial size 1x1).
+        */
+        Id GlobalAveragePooling(Id src)
+        {
+            const Tensor& s = _tensors[src];
+            Node node(NodePooling, src);
+            node.dst = AddTensor(s.c, 1, 1);
+            _nodes.push_back(node);
+            return node.dst;
+        }
+
+        /*!
+            Adds FP32 inner product to the graph.
+
+            \param [in] src - an identifier of input tensor.
+            \param [in] output - a number of outputs.
+            \param [in] weight - a pointer to weight with shape [output, input] (it is copied to the graph).
+            \param [in] bias - a pointer to bias. Can be NULL.
+            \return an identifier of output tensor (it has spatial size 1x1).
+        */
+        Id InnerProduct(Id src, size_t output, const float* weight, const float* bias)
+        {
+            const Tensor& s = _tensors[src];
+            Node node(NodeInnerProduct, src);
+            node.output = output;
+            node.weight[0].assign(weight, weight + s.Size() * output);
+            node.bias[0].assign(output, 0.0f);
+            if (bias)
+                node.bias[0].assign(bias, bias + output);
+            node.dst = AddTensor(output, 1, 1);
+            _nodes.push_back(node);
+            return node.dst;
+        }
+
+        /*!
+            Marks tensor as output of the graph. Outputs are stored in output buffer in order of marking.
+
+            \param [in] id - an identifier of the tensor.
+        */
+        void Output(Id id)
+        {
+            _tensors[id].output = true;
+            _outputs.push_back(id);
+        }
+
+        /*!
+            Compiles the graph: fuses operations, creates Synet contexts and plans the workspace.
+
+            \param [in] batch - a batch size.
+            \param [in] threads - a number of threads used in SynetGraph::Forward. Images of the batch are distributed between threads, 
+                so the number of used threads does not exceed batch size.
+            \param [in] fuse - a flag to fuse adjacent operations.
+            \param [in] compatibility - a flags of calculation compatibility.
+            \return result of the compilation.
+        */
+        bool Compile(size_t batch, size_t threads = 1, bool fuse = true, SimdSynetCompatibilityType compatibility = SimdSynetCompatibilityDefault)
+        {
+            Clear();
+            if (_tensors.empty() || _outputs.empty() || batch == 0)
+                return false;
+            _batch = batch;
+            _threads = std::max<size_t>(threads, 1);
+            _steps = _nodes;
+            if (fuse)
+            {
+                FuseActivation();
+                FuseMerged(compatibility);
+                FuseAdd();
+                FuseActivation();
+            }
+            RemoveFused();
+            if (_inputFormat == SimdTensorFormatNchw)
+            {
+                Node node(NodePermute, 0);
+                node.dst = 0;
+                _steps.insert(_steps.begin(), node);
+            }
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (!CreateContext(_steps[i], compatibility))
+                    return false;
+            Plan();
+            return true;
+        }
+
+        /*!
+            Performs forward propagation of compiled graph.
+
+            \param [in] src - a pointer to input tensor. It has shape [batch, channels, height, width] or [batch, height, width, channels].
+            \param [out] dst - a pointer to output buffer. It has shape [batch, SynetGraph::OutputSize()].
+        */
+        void Forward(const float* src, float* dst)
+        {
+            size_t srcSize = InputSize(), dstSize = OutputSize();
+            Simd::Parallel(0, _batch, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t b = begin; b < end; ++b)
+                    Run(_arenas[thread].data(), src + b * srcSize, dst + b * dstSize);
+            }, _threads);
+        }
+
+        /*!
+            Gets size of input tensor of one image.
+
+            \return size of input tensor (in floats).
+        */
+        size_t InputSize() const
+        {
+            return _tensors.empty() ? 0 : _tensors[0].Size();
+        }
+
+        /*!
+            Gets total size of all output tensors of one image.
+
+            \return size of output (in floats).
+        */
+        size_t OutputSize() const
+        {
+            size_t size = 0;
+            for (size_t i = 0; i < _outputs.size(); ++i)
+                size += _tensors[_outputs[i]].Size();
+            return size;
+        }
+
+        /*!
+            Gets size of workspace (for one thread) of compiled graph.
+
+            \return size of workspace in bytes.
+        */
+        size_t WorkspaceSize() const
+        {
+            return _arenaSize;
+        }
+
+        /*!
+            Gets description of steps of compiled graph.
+
+            \return a string with description.
+        */
+        std::string Info() const
+        {
+            std::stringstream ss;
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                const Node& n = _steps[i];
+                ss << i << ": ";
+                switch (n.type)
+                {
+                case NodePermute: ss << "Permute NCHW -> NHWC"; break;
+                case NodeConvolution: ss << (n.src.size() > 1 ? "ConvolutionAdd " : "Convolution ") << SimdSynetConvolution32fInfo(n.context); break;
+                case NodeMerged: ss << (n.add ? "MergedConvolutionAdd " : "MergedConvolution ") << SimdSynetMergedConvolution32fInfo(n.context); break;
+                case NodeActivation: ss << "Activation"; break;
+                case NodeAdd: ss << "Add"; break;
+                case NodePooling: ss << "GlobalAveragePooling"; break;
+                case NodeInnerProduct: ss << "InnerProduct"; break;
+                }
+                const Tensor& d = _tensors[n.dst];
+                ss << " [" << d.c << "x" << d.h << "x" << d.w << "]" << std::endl;
+            }
+            ss << "Workspace: " << _arenaSize << " bytes." << std::endl;
+            return ss.str();
+        }
+
+    private:
+        typedef std::vector<float> Floats;
+        typedef std::vector<Id> Ids;
+        typedef std::vector<uint8_t, Simd::Allocator<uint8_t>> Buffer;
+
+        enum NodeType
+        {
+            NodePermute,
+            NodeConvolution,
+            NodeMerged,
+            NodeActivation,
+            NodeAdd,
+            NodePooling,
+            NodeInnerProduct,
+        };
+
+        struct Tensor
+        {
+            size_t c, h, w, buffer;
+            bool output, internal;
+
+            Tensor(size_t c_ = 0, size_t h_ = 0, size_t w_ = 0) : c(c_), h(h_), w(w_), buffer(0), output(false), internal(false) {}
+
+            size_t Size() const { return c * h * w; }
+        };
+        typedef std::vector<Tensor> Tensors;
+
+        struct Node
+        {
+            NodeType type;
+            Ids src;
+            Id dst;
+            SimdConvolutionParameters convs[3];
+            Floats weight[3], bias[3], params[3];
+            size_t output, count, buffer;
+            bool add, fused;
+            void* context;
+
+            Node(NodeType type_, Id src_) : type(type_), src(1, src_), dst(0), output(0), count(1), buffer(0), add(false), fused(false), context(NULL)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    convs[i] = SimdConvolutionParameters();
+                    convs[i].activation = SimdConvolutionActivationIdentity;
+                }
+            }
+        };
+        typedef std::vector<Node> Nodes;
+
+        Tensors _tensors;
+        Nodes _nodes, _steps;
+        Ids _outputs;
+        size_t _batch, _threads, _arenaSize;
+        SimdTensorFormatType _inputFormat;
+        std::vector<Buffer> _arenas;
+
+        SynetGraph(const SynetGraph&);
+        SynetGraph& operator=(const SynetGraph&);
+
+        Id AddTensor(size_t c, size_t h, size_t w)
+        {
+            _tensors.push_back(Tensor(c, h, w));
+            return _tensors.size() - 1;
+        }
+
+        static void SetParams(Floats& dst, SimdConvolutionActivationType type, const float* params)
+        {
+            dst.assign(2, 0.0f);
+            if (type == SimdConvolutionActivationRestrictRange)
+                dst[1] = 6.0f;
+            if (type == SimdConvolutionActivationHswish || type == SimdConvolutionActivationHardSigmoid)
+                dst[0] = 3.0f, dst[1] = 1.0f / 6.0f;
+            if (params)
+                dst.assign(params, params + 2);
+        }
+
+        void Clear()
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (_steps[i].context)
+                    SimdRelease(_steps[i].context);
+            _steps.clear();
+            _arenas.clear();
+            _arenaSize = 0;
+        }
+
+        size_t Uses(Id id) const
+        {
+            size_t uses = _tensors[id].output ? 1 : 0;
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (!_steps[i].fused)
+                    for (size_t j = 0; j < _steps[i].src.size(); ++j)
+                        uses += _steps[i].src[j] == id ? 1 : 0;
+            return uses;
+        }
+
+        size_t Consumer(Id id) const
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (!_steps[i].fused)
+                    for (size_t j = 0; j < _steps[i].src.size(); ++j)
+                        if (_steps[i].src[j] == id)
+                            return i;
+            return _steps.size();
+        }
+
+        size_t Next(size_t i, NodeType type) const
+        {
+            if (Uses(_steps[i].dst) != 1)
+                return _steps.size();
+            size_t c = Consumer(_steps[i].dst);
+            return c < _steps.size() && _steps[c].type == type ? c : _steps.size();
+        }
+
+        void FuseActivation()
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                Node& c = _steps[i];
+                if (c.fused || c.type != NodeConvolution || c.convs[0].activation != SimdConvolutionActivationIdentity)
+                    continue;
+                size_t a = Next(i, NodeActivation);
+                if (a == _steps.size())
+                    continue;
+                c.convs[0].activation = _steps[a].convs[0].activation;
+                c.params[0].swap(_steps[a].params[0]);
+                c.dst = _steps[a].dst;
+                MoveTo(i, a);
+            }
+        }
+
+        static bool IsDepthwise(const SimdConvolutionParameters& c)
+        {
+            return c.group == c.srcC && c.group == c.dstC;
+        }
+
+        static bool IsPointwise(const SimdConvolutionParameters& c)
+        {
+            return c.group == 1 && c.kernelY == 1 && c.strideY == 1 && c.padY == 0;
+        }
+
+        void FuseMerged(SimdSynetCompatibilityType compatibility)
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                if (_steps[i].fused || _steps[i].type != NodeConvolution)
+                    continue;
+                size_t idx[3] = { i, Next(i, NodeConvolution), _steps.size() }, count = 0;
+                if (idx[1] == _steps.size())
+                    continue;
+                const SimdConvolutionParameters& c0 = _steps[idx[0]].convs[0], & c1 = _steps[idx[1]].convs[0];
+                if (c0.group == 1 && IsDepthwise(c1))
+                {
+                    idx[2] = Next(idx[1], NodeConvolution);
+                    count = idx[2] < _steps.size() && IsPointwise(_steps[idx[2]].convs[0]) ? 3 : 2;
+                }
+                else if (IsDepthwise(c0) && IsPointwise(c1))
+                    count = 2;
+                else
+                    continue;
+                Node merged(NodeMerged, _steps[i].src[0]);
+                merged.count = count;
+                for (size_t c = 0; c < count; ++c)
+                    merged.convs[c] = _steps[idx[c]].convs[0];
+                size_t last = idx[count - 1];
+                merged.dst = _steps[last].dst;
+                size_t add = Next(last, NodeAdd);
+                if (count == 3 && add < _steps.size())
+                {
+                    const Ids& src = _steps[add].src;
+                    if ((src[0] == merged.src[0] || src[1] == merged.src[0]) && src[0] != src[1])
+                        merged.add = true;
+                }
+                void* context = SimdSynetMergedConvolution32fInit(1, merged.convs, count, merged.add ? SimdTrue : SimdFalse, compatibility);
+                if (context == NULL)
+                    continue;
+                SimdRelease(context);
+                if (merged.add)
+                {
+                    merged.dst = _steps[add].dst;
+                    last = add;
+                }
+                for (size_t c = 0; c < count; ++c)
+                {
+                    Node& n = _steps[idx[c]];
+                    merged.weight[c].swap(n.weight[0]);
+                    merged.bias[c].swap(n.bias[0]);
+                    merged.params[c].swap(n.params[0]);
+                    n.fused = true;
+                }
+                if (merged.add)
+                    _steps[add].fused = true;
+                _steps.insert(_steps.begin() + last + 1, merged);
+            }
+        }
+
+        void FuseAdd()
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                Node& c = _steps[i];
+                if (c.fused || c.type != NodeConvolution || c.src.size() != 1 || c.convs[0].activation != SimdConvolutionActivationIdentity)
+                    continue;
+                size_t a = Next(i, NodeAdd);
+                if (a == _steps.size())
+                    continue;
+                const Ids& src = _steps[a].src;
+                if (src[0] == src[1])
+                    continue;
+                c.src.push_back(src[0] == c.dst ? src[1] : src[0]);
+                c.dst = _steps[a].dst;
+                MoveTo(i, a);
+            }
+        }
+
+        void MoveTo(size_t src, size_t dst)
+        {
+            std::swap(_steps[dst], _steps[src]);
+            _steps[src].fused = true;
+        }
+
+        void RemoveFused()
+        {
+            Nodes steps;
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (!_steps[i].fused)
+                    steps.push_back(_steps[i]);
+            _steps.swap(steps);
+        }
+
+        bool CreateContext(Node& n, SimdSynetCompatibilityType compatibility)
+        {
+            switch (n.type)
+            {
+            case NodePermute:
+            {
+                const Tensor& t = _tensors[0];
+                size_t shape[3] = { t.c, t.h, t.w }, order[3] = { 1, 2, 0 };
+                n.context = SimdSynetPermuteInit(shape, order, 3, SimdTensorData32f);
+                return n.context != NULL;
+            }
+            case NodeConvolution:
+                n.context = SimdSynetConvolution32fInit(1, n.convs, compatibility);
+                if (n.context)
+                    SimdSynetConvolution32fSetParams(n.context, n.weight[0].data(), NULL, n.bias[0].data(), n.params[0].data());
+                return n.context != NULL;
+            case NodeMerged:
+                n.context = SimdSynetMergedConvolution32fInit(1, n.convs, n.count, n.add ? SimdTrue : SimdFalse, compatibility);
+                if (n.context)
+                {
+                    const float* weight[3], * bias[3], * params[3];
+                    for (size_t c = 0; c < n.count; ++c)
+                        weight[c] = n.weight[c].data(), bias[c] = n.bias[c].data(), params[c] = n.params[c].data();
+                    SimdSynetMergedConvolution32fSetParams(n.context, weight, NULL, bias, params);
+                }
+                return n.context != NULL;
+            case NodeActivation:
+                return n.convs[0].activation == SimdConvolutionActivationRelu || n.convs[0].activation == SimdConvolutionActivationLeakyRelu ||
+                    n.convs[0].activation == SimdConvolutionActivationRestrictRange || n.convs[0].activation == SimdConvolutionActivationHswish;
+            case NodeInnerProduct:
+                n.context = SimdSynetInnerProduct32fInit(1, _tensors[n.src[0]].Size(), n.output, SimdFalse, SimdConvolutionActivationIdentity);
+                if (n.context)
+                    SimdSynetInnerProduct32fSetParams(n.context, n.weight[0].data(), NULL, n.bias[0].data(), NULL);
+                return n.context != NULL;
+            default:
+                return true;
+            }
+        }
+
+        static SimdSynetContextType ContextType(NodeType type)
+        {
+            switch (type)
+            {
+            case NodePermute: return SimdSynetContextPermute;
+            case NodeConvolution: return SimdSynetContextConvolution32f;
+            case NodeMerged: return SimdSynetContextMergedConvolution32f;
+            default: return SimdSynetContextInnerProduct32f;
+            }
+        }
+
+        void Plan()
+        {
+            void* workspace = SimdSynetWorkspaceInit();
+            size_t end = _steps.size();
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (_steps[i].context)
+                    _steps[i].buffer = SimdSynetWorkspaceAddContext(workspace, ContextType(_steps[i].type), _steps[i].context, i);
+            Ids first(_tensors.size(), end), last(_tensors.size(), 0);
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                const Node& n = _steps[i];
+                first[n.dst] = std::min(first[n.dst], i);
+                last[n.dst] = std::max(last[n.dst], i);
+                for (size_t j = 0; j < n.src.size(); ++j)
+                    last[n.src[j]] = std::max(last[n.src[j]], i);
+            }
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                if (first[t] == end)
+                    continue;
+                if (_tensors[t].output)
+                    last[t] = end;
+                _tensors[t].buffer = SimdSynetWorkspaceAddBuffer(workspace, _tensors[t].Size() * sizeof(float), first[t], last[t]);
+            }
+            _arenaSize = SimdSynetWorkspaceSize(workspace);
+            for (size_t i = 0; i < _steps.size(); ++i)
+                if (_steps[i].context)
+                    _steps[i].buffer = SimdSynetWorkspaceOffset(workspace, _steps[i].buffer);
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                _tensors[t].internal = first[t] != end;
+                if (_tensors[t].internal)
+                    _tensors[t].buffer = SimdSynetWorkspaceOffset(workspace, _tensors[t].buffer);
+            }
+            SimdRelease(workspace);
+            _arenas.resize(std::min(_threads, _batch));
+            for (size_t i = 0; i < _arenas.size(); ++i)
+                _arenas[i].resize(_arenaSize);
+        }
+
+        const float* Tensor32f(uint8_t* arena, const float* src, Id id) const
+        {
+            return _tensors[id].internal ? (float*)(arena + _tensors[id].buffer) : src;
+        }
+
+        void Run(uint8_t* arena, const float* src, float* dst) const
+        {
+            for (size_t i = 0; i < _steps.size(); ++i)
+            {
+                const Node& n = _steps[i];
+                const float* s0 = Tensor32f(arena, src, n.src[0]);
+                float* d = (float*)Tensor32f(arena, src, n.dst);
+                float* buf = (float*)(arena + n.buffer);
+                size_t size = _tensors[n.dst].Size();
+                switch (n.type)
+                {
+                case NodePermute:
+                    SimdSynetPermuteForward(n.context, (uint8_t*)src, (uint8_t*)d);
+                    break;
+                case NodeConvolution:
+                    if (n.src.size() > 1)
+                        SimdSynetConvolution32fForwardAdd(n.context, s0, buf, Tensor32f(arena, src, n.src[1]), d);
+                    else
+                        SimdSynetConvolution32fForward(n.context, s0, buf, d);
+                    break;
+                case NodeMerged:
+                    SimdSynetMergedConvolution32fForward(n.context, s0, buf, d);
+                    break;
+                case NodeActivation:
+                    switch (n.convs[0].activation)
+                    {
+                    case SimdConvolutionActivationRelu:
+                    {
+                        float slope = 0.0f;
+                        SimdSynetRelu32f(s0, size, &slope, d);
+                        break;
+                    }
+                    case SimdConvolutionActivationLeakyRelu: SimdSynetRelu32f(s0, size, n.params[0].data(), d); break;
+                    case SimdConvolutionActivationRestrictRange: SimdSynetRestrictRange32f(s0, size, n.params[0].data() + 0, n.params[0].data() + 1, d); break;
+                    case SimdConvolutionActivationHswish: SimdSynetHswish32f(s0, size, n.params[0].data() + 0, n.params[0].data() + 1, d); break;
+                    default: break;
+                    }
+                    break;
+                case NodeAdd:
+                {
+                    const float* srcs[2] = { s0, Tensor32f(arena, src, n.src[1]) }, weight[2] = { 1.0f, 1.0f };
+                    SimdSynetEltwiseLayerForward(srcs, weight, 2, size, SimdSynetEltwiseOperationSum, d);
+                    break;
+                }
+                case NodePooling:
+                {
+                    const Tensor& t = _tensors[n.src[0]];
+                    SimdSynetPoolingAverage(s0, t.c, t.h, t.w, t.h, t.w, 1, 1, 0, 0, d, 1, 1, SimdTrue, SimdTensorFormatNhwc);
+                    break;
+                }
+                case NodeInnerProduct:
+                    SimdSynetInnerProduct32fForward(n.context, s0, d);
+                    break;
+                }
+            }
+            for (size_t i = 0; i < _outputs.size(); ++i)
+            {
+                const Tensor& t = _tensors[_outputs[i]];
+                const float* o = Tensor32f(arena, src, _outputs[i]);
+                for (size_t j = 0, size = t.Size(); j < size; ++j)
+                    dst[j] = o[j];
+                dst += t.Size();
+            }
+        }
+    };
+}
+
+#endif//__SimdSynetGraph_hpp__
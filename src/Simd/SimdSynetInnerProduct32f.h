@@ -50,7 +50,7 @@ namespace Simd
         bool Valid()
         {
             return 
-                activation == SimdConvolutionActivationIdentity;
+                activation >= SimdConvolutionActivationIdentity && activation <= SimdConvolutionActivationGeluTanh;
         }
 
 #ifdef SIMD_PERFORMANCE_STATISTIC
@@ -123,16 +123,19 @@ namespace Simd
             SynetInnerProduct32fGemm(const InnerProductParam32f & p);
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
-            virtual size_t InternalBufferSize() const { return _cbWeight.size; }
+            virtual size_t InternalBufferSize() const { return _cbWeight.size + _spValue.size + _spIndex.size / sizeof(float); }
             virtual void SetParams(const float* weight, SimdBool* internal, const float* bias, const float* params);
             virtual void Forward(const float * src, float * dst);
 
         protected:
+            bool SetSparse(const float* weight);
+
             typedef void(*GemmPtr)(size_t M, size_t N, size_t K, const float* alpha, const float* A, size_t lda, const float* B, size_t ldb, const float* beta, float* C, size_t ldc);
             typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, float* dst);
             typedef void(*ProdPtr)(const float* src, const float* weight, const float* bias, size_t count, size_t size, float* dst);
             typedef void(*CbPackPtr)(size_t M, size_t N, size_t K, const float* B, float* pB, GemmKernelType type, bool compatibility);
             typedef void(*CbRunPtr)(size_t M, size_t N, size_t K, const float* A, const float* B, float* C, GemmKernelType type, bool compatibility);
+            typedef void(*SparsePtr)(const float* src, size_t M, size_t N, size_t K, const float* value, const uint8_t* index, float* dst);
 
             float _0, _1;
             GemmPtr _gemm;
@@ -142,6 +145,10 @@ namespace Simd
             Array32f _cbWeight;
             CbPackPtr _cbPack;
             CbRunPtr _cbRun;
+            size_t _spF;
+            Array32f _spValue;
+            Array8u _spIndex;
+            SparsePtr _sparse;
         };
 
         class SynetInnerProduct32fProd : public SynetInnerProduct32f
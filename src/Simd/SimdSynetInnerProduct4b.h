@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetInnerProduct4b_h__
+#define __SimdSynetInnerProduct4b_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    struct InnerProductParam4b
+    {
+        size_t batch;
+        size_t input;
+        size_t output;
+        size_t group;
+        SimdBool transpose;
+        SimdConvolutionActivationType activation;
+
+        InnerProductParam4b(size_t b, size_t i, size_t o, size_t g, SimdBool t, SimdConvolutionActivationType a)
+        {
+            batch = b;
+            input = i;
+            output = o;
+            group = g;
+            transpose = t;
+            activation = a;
+        }
+
+        bool Valid() const
+        {
+            return batch && input && output && group && group % 32 == 0;
+        }
+
+        SIMD_INLINE size_t Groups() const
+        {
+            return DivHi(input, group);
+        }
+
+        SIMD_INLINE size_t RowSize() const
+        {
+            return DivHi(input, 2);
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << input << "x" << output << "-" << group;
+            return ss.str();
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * input * output * 2;
+        }
+#endif
+    };
+
+    class SynetInnerProduct4b : public Deletable
+    {
+    public:
+        SynetInnerProduct4b(const InnerProductParam4b & p);
+
+        const InnerProductParam4b & Param() const
+        {
+            return _param;
+        }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+        virtual size_t InternalBufferSize() const;
+
+        virtual void SetParams(const float * weight, const float * bias, const float * params);
+
+        virtual void Forward(const float * src, float * dst);
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const String& func);
+#endif
+
+    protected:
+        typedef float(*DotPtr)(const float* src, const uint8_t* weight, const float* scale, const float* shift, const float* sums, size_t input, size_t group);
+        typedef void(*BiasAndActivationPtr)(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, SimdBool trans, float* dst);
+
+        InnerProductParam4b _param;
+        mutable String _info;
+        size_t _threads;
+        Array8u _weight;
+        Array32f _scale, _shift, _bias, _params, _sums;
+        DotPtr _dot;
+        BiasAndActivationPtr _biasAndActivation;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer * _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        class SynetInnerProduct4b : public Simd::SynetInnerProduct4b
+        {
+        public:
+            SynetInnerProduct4b(const InnerProductParam4b & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const { return Ext() + "::4b"; }
+        };
+
+        void * SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetInnerProduct4b : public Base::SynetInnerProduct4b
+        {
+        public:
+            SynetInnerProduct4b(const InnerProductParam4b & p);
+            virtual String Ext() const { return "Sse41"; }
+        };
+
+        void * SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetInnerProduct4b : public Sse41::SynetInnerProduct4b
+        {
+        public:
+            SynetInnerProduct4b(const InnerProductParam4b & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void * SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetInnerProduct4b : public Avx2::SynetInnerProduct4b
+        {
+        public:
+            SynetInnerProduct4b(const InnerProductParam4b & p);
+            virtual String Ext() const { return "Avx512bw"; }
+        };
+
+        void * SynetInnerProduct4bInit(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
+
+#endif//__SimdSynetInnerProduct4b_h__
@@ -0,0 +1,200 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetInnerProduct8i_h__
+#define __SimdSynetInnerProduct8i_h__
+
+#include "Simd/SimdSynetConvolution8i.h"
+
+namespace Simd
+{
+    struct InnerProductParam8i
+    {
+        size_t batch;
+        size_t input;
+        size_t output;
+        SimdBool transpose;
+        SimdTensorDataType srcT;
+        SimdTensorDataType dstT;
+        SimdConvolutionActivationType activation;
+        SimdSynetCompatibilityType compatibility;
+
+        InnerProductParam8i(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, SimdConvolutionActivationType a, SimdSynetCompatibilityType c)
+        {
+            batch = b;
+            input = i;
+            output = o;
+            transpose = t;
+            srcT = sT;
+            dstT = dT;
+            activation = a;
+            compatibility = c;
+        }
+
+        bool Valid() const
+        {
+            return batch && input && output &&
+                (srcT == SimdTensorData32f || srcT == SimdTensorData8u) && (dstT == SimdTensorData32f || dstT == SimdTensorData8u);
+        }
+
+        SimdConvolutionParameters Conv() const
+        {
+            SimdConvolutionParameters conv;
+            conv.srcC = input;
+            conv.srcH = batch;
+            conv.srcW = 1;
+            conv.srcT = srcT;
+            conv.srcF = SimdTensorFormatNhwc;
+            conv.dstC = output;
+            conv.dstH = batch;
+            conv.dstW = 1;
+            conv.dstT = dstT;
+            conv.dstF = SimdTensorFormatNhwc;
+            conv.kernelY = 1;
+            conv.kernelX = 1;
+            conv.dilationY = 1;
+            conv.dilationX = 1;
+            conv.strideY = 1;
+            conv.strideX = 1;
+            conv.padY = 0;
+            conv.padX = 0;
+            conv.padH = 0;
+            conv.padW = 0;
+            conv.group = 1;
+            conv.activation = activation;
+            return conv;
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << input << "x" << output << "-" << transpose;
+            ss << "-" << (srcT == SimdTensorData8u ? "u" : "f") << (dstT == SimdTensorData8u ? "u" : "f");
+            return ss.str();
+        }
+
+        int64_t Flop() const
+        {
+            return int64_t(batch) * input * output * 2;
+        }
+#endif
+    };
+
+    class SynetInnerProduct8i : public Deletable
+    {
+    public:
+        typedef void* (*ConvolutionInitPtr)(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
+
+        SynetInnerProduct8i(const InnerProductParam8i & p, SynetConvolution8i * conv);
+        virtual ~SynetInnerProduct8i();
+
+        const InnerProductParam8i & Param() const { return _param; }
+
+        String Ext() const { return _conv->Ext(); }
+        String Desc() const { return _conv->Desc(); }
+
+        const char* Info() const
+        {
+            _info = Desc();
+            return _info.c_str();
+        }
+
+        size_t ExternalBufferSize() const { return _conv->ExternalBufferSize(); }
+        size_t InternalBufferSize() const { return _conv->InternalBufferSize(); }
+
+        void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+
+        void Forward(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer* Perf(const char* func);
+#endif
+
+        static void * Create(const InnerProductParam8i & p, ConvolutionInitPtr init);
+
+    protected:
+        InnerProductParam8i _param;
+        SynetConvolution8i * _conv;
+        mutable String _info;
+#if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
+        Base::PerformanceMeasurer * _perf;
+#endif
+    };
+
+    namespace Base
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT, 
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE    
+    namespace Avx512vnni
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_AMXBF16_ENABLE    
+    namespace AmxBf16
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        void* SynetInnerProduct8iInit(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+            SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+    }
+#endif
+}
+
+#endif//__SimdSynetInnerProduct8i_h__
@@ -28,6 +28,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdRuntime.h"
+#include "Simd/SimdSynetPack.h"
 
 #ifdef _N
 #undef _N
@@ -40,6 +41,7 @@ namespace Simd
         SimdBool add;
         size_t count;
         ConvParam32f conv[3];
+        SimdConvolutionParameters origin[3];
 
         MergConvParam32f(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add, SimdSynetCompatibilityType compatibility)
         {
@@ -47,7 +49,10 @@ namespace Simd
             this->add = add;
             this->count = count;
             for (size_t i = 0; i < count; ++i)
+            {
                 this->conv[i] = ConvParam32f(batch, convs + i, compatibility);
+                this->origin[i] = convs[i];
+            }
         }
 
         bool Valid()
@@ -162,6 +167,29 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        size_t Export(void * data, size_t size);
+        bool Import(const void * data, size_t size, bool attach);
+
+        SynetPacked * CreatePacked();
+        bool SetPacked(const SynetPacked & packed);
+
+        virtual void Pack(SynetPack & pack) = 0;
+        virtual String PackKey() const;
+
+        typedef void* (*InitPtr)(size_t batch, const SimdConvolutionParameters * convs, size_t count, SimdBool add, SimdSynetCompatibilityType compatibility);
+
+        bool Reshape(size_t batch, size_t srcH, size_t srcW, InitPtr init);
+
+        SIMD_INLINE SynetMergedConvolution32f * Shaped()
+        {
+            return _shapes.Active(this);
+        }
+
+        SIMD_INLINE void ClearShapes()
+        {
+            _shapes.Clear();
+        }
+
 #if defined(SIMD_PERFORMANCE_STATISTIC) && (defined(NDEBUG) || defined(SIMD_PERF_STAT_IN_DEBUG))
         virtual Base::PerformanceMeasurer* Perf(const char* func)
         {
@@ -184,6 +212,8 @@ namespace Simd
     protected:
         MergConvParam32f _param;
         Array32f _buffer;
+        SynetPacked::Blob _packed;
+        SynetShapes<SynetMergedConvolution32f> _shapes;
 
         float* Buffer(float* buffer)
         {
@@ -216,6 +246,8 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * const * weight, SimdBool * internal, const float * const * bias, const float * const * params);
             virtual void Forward(const float* src, float* buf, float* dst);
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
 
             typedef void(*ConvolutionPtr)(const float* src, const SimdConvolutionParameters& p, size_t maC, size_t yBeg, size_t yEnd,
                 const size_t * bufH, const float* weight, const float* bias, const float* params, float* dst, int first);
@@ -227,7 +259,7 @@ namespace Simd
 
             ConvolutionPtr _convolution[4];
             size_t _sizeS, _sizeD, _sizeB[2];
-            Array32f _rWeight[3], _rBias[3], _rParams[3];
+            Array32f _rWeight[3], _rBias[3], _rParams[3], _pWeight[3], _pBias[3], _pParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
 
             size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3];
@@ -292,6 +324,8 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float* const* weight, SimdBool* internal, const float* const* bias, const float* const* params);
             virtual void Forward(const float* src, float* buf, float* dst);
+            virtual void Pack(SynetPack & pack);
+            virtual String PackKey() const;
 
             struct AlgParam
             {
@@ -0,0 +1,335 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPack_h__
+#define __SimdSynetPack_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+#include "Simd/SimdCpu.h"
+
+#include <memory>
+#include <map>
+
+namespace Simd
+{
+    class SynetPack
+    {
+    public:
+        enum Mode
+        {
+            Measure,
+            Save,
+            Load,
+            Attach,
+        };
+
+        static const uint32_t Magic = 0x4B504D53;
+        static const uint32_t Version = 1;
+
+        SIMD_INLINE SynetPack(Mode mode, const void * data = NULL, size_t size = 0)
+            : _mode(mode)
+            , _data((uint8_t*)data)
+            , _size(size)
+            , _offset(0)
+            , _ok(true)
+        {
+        }
+
+        SIMD_INLINE bool Loading() const
+        {
+            return _mode == Load || _mode == Attach;
+        }
+
+        SIMD_INLINE bool Ok() const
+        {
+            return _ok;
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return _offset;
+        }
+
+        SIMD_INLINE bool Header(const String & desc, const String & key)
+        {
+            uint32_t magic = Magic, version = Version;
+            uint64_t total = _size;
+            String d = desc, k = key;
+            Value(magic);
+            Value(version);
+            Value(total);
+            Text(d);
+            Text(k);
+            if (Loading())
+                _ok = _ok && magic == Magic && version == Version && total <= _size && d == desc && k == key;
+            return _ok;
+        }
+
+        template<class T> SIMD_INLINE void Value(T & value)
+        {
+            if (_mode == Save)
+                memcpy(_data + _offset, &value, sizeof(T));
+            else if (Loading() && Check(sizeof(T)))
+                memcpy(&value, _data + _offset, sizeof(T));
+            _offset += sizeof(T);
+        }
+
+        template<class T> SIMD_INLINE void Item(Array<T> & array)
+        {
+            const T * ptr = array.data;
+            Item(ptr, array.size, array);
+        }
+
+        template<class T> SIMD_INLINE void Item(const T * & ptr, size_t size, Array<T> & own)
+        {
+            uint64_t count = ptr ? size : 0;
+            Value(count);
+            Align();
+            if (Loading() && !Check(count, size, sizeof(T)))
+                count = 0;
+            size_t bytes = size_t(count) * sizeof(T);
+            if (_mode == Save)
+                memcpy(_data + _offset, ptr, bytes);
+            else if (Loading() && _ok)
+            {
+                if (count == 0)
+                    own.Resize(0);
+                else if (_mode == Attach)
+                    own.Attach((T*)(_data + _offset), size_t(count));
+                else
+                    own.Assign((T*)(_data + _offset), size_t(count));
+                ptr = own.data;
+            }
+            _offset += bytes;
+        }
+
+    private:
+        Mode _mode;
+        uint8_t * _data;
+        size_t _size, _offset;
+        bool _ok;
+
+        SIMD_INLINE bool Check(size_t size)
+        {
+            if (_offset > _size || size > _size - _offset)
+                _ok = false;
+            return _ok;
+        }
+
+        SIMD_INLINE bool Check(uint64_t count, size_t size, size_t item)
+        {
+            if (_offset > _size || count > (_size - _offset) / item || (count != 0 && size != 0 && count != size))
+                _ok = false;
+            return _ok;
+        }
+
+        SIMD_INLINE void Align()
+        {
+            size_t offset = AlignHi(_offset, SIMD_ALIGN);
+            if (_mode == Save)
+                memset(_data + _offset, 0, offset - _offset);
+            _offset = offset;
+        }
+
+        SIMD_INLINE void Text(String & text)
+        {
+            uint32_t length = (uint32_t)text.size();
+            Value(length);
+            if (_mode == Save)
+                memcpy(_data + _offset, text.c_str(), length);
+            else if (Loading() && Check(length))
+                text.assign((char*)_data + _offset, length);
+            _offset += length;
+        }
+    };
+
+    //---------------------------------------------------------------------------------------------
+
+    class SynetPacked : public Deletable
+    {
+    public:
+        typedef std::shared_ptr<Array8u> Blob;
+
+        SynetPacked(size_t size)
+            : _blob(new Array8u(size))
+        {
+        }
+
+        SynetPacked(const Blob & blob)
+            : _blob(blob)
+        {
+        }
+
+        SIMD_INLINE const Blob & Data() const
+        {
+            return _blob;
+        }
+
+    private:
+        Blob _blob;
+    };
+
+    //---------------------------------------------------------------------------------------------
+
+    template<class T> class SynetShapes
+    {
+    public:
+        SynetShapes()
+            : _active(NULL)
+        {
+        }
+
+        ~SynetShapes()
+        {
+            Clear();
+        }
+
+        SIMD_INLINE T * Active(T * origin) const
+        {
+            return _active ? _active : origin;
+        }
+
+        SIMD_INLINE const SynetPacked::Blob & Shared() const
+        {
+            return _shared;
+        }
+
+        SIMD_INLINE void Share(const SynetPacked::Blob & shared)
+        {
+            _shared = shared;
+        }
+
+        SIMD_INLINE T * Get(const String & key) const
+        {
+            typename Plans::const_iterator it = _plans.find(key);
+            return it == _plans.end() ? NULL : it->second;
+        }
+
+        SIMD_INLINE void Add(const String & key, T * plan)
+        {
+            _plans[key] = plan;
+        }
+
+        SIMD_INLINE void Select(T * plan)
+        {
+            _active = plan;
+        }
+
+        // Non-owning pointers to parameters passed to SetParams: a caller keeps them alive while the context can be reshaped.
+        struct Params
+        {
+            const float * weight, * bias, * params;
+            bool internal;
+
+            Params(const float * w = NULL, bool i = false, const float * b = NULL, const float * p = NULL)
+                : weight(w), bias(b), params(p), internal(i)
+            {
+            }
+        };
+
+        SIMD_INLINE const Params & Kept() const
+        {
+            return _kept;
+        }
+
+        SIMD_INLINE void Keep(const Params & kept)
+        {
+            _kept = kept;
+        }
+
+        SIMD_INLINE void SetParams(T * plan) const
+        {
+            plan->SetParams(_kept.weight, NULL, _kept.bias, _kept.params);
+        }
+
+        void Clear()
+        {
+            for (typename Plans::iterator it = _plans.begin(); it != _plans.end(); ++it)
+                delete it->second;
+            _plans.clear();
+            _active = NULL;
+            _shared.reset();
+            _kept = Params();
+        }
+
+    private:
+        typedef std::map<String, T*> Plans;
+        Plans _plans;
+        T * _active;
+        SynetPacked::Blob _shared;
+        Params _kept;
+    };
+
+    SIMD_INLINE String ShapeKey(size_t batch, size_t srcH, size_t srcW)
+    {
+        std::stringstream ss;
+        ss << batch << "x" << srcH << "x" << srcW;
+        return ss.str();
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    template<class T> SIMD_INLINE size_t OwnedSize(const Array<T> & array)
+    {
+        return array.external ? 0 : array.size;
+    }
+
+    SIMD_INLINE String ConvolutionPackKey(const SimdConvolutionParameters & c, SimdSynetCompatibilityType compatibility)
+    {
+        std::stringstream ss;
+        ss << c.srcC << "-" << c.dstC << "-" << c.kernelY << "x" << c.kernelX << "-" << c.dilationY << "x" << c.dilationX << "-" << c.strideY << "x" << c.strideX;
+        ss << "-" << c.padY << "x" << c.padX << "x" << c.padH << "x" << c.padW << "-" << c.group << "-" << int(c.activation);
+        ss << "-" << int(c.srcT) << int(c.dstT) << int(c.srcF) << int(c.dstF) << "-" << int(compatibility);
+        ss << "-" << Base::AlgCacheL1() << "-" << Base::AlgCacheL2() << "-" << Base::AlgCacheL3();
+        return ss.str();
+    }
+
+    SIMD_INLINE size_t PackParamsSize(SimdConvolutionActivationType activation, size_t channels)
+    {
+        switch (activation)
+        {
+        case SimdConvolutionActivationIdentity:
+        case SimdConvolutionActivationRelu:
+        case SimdConvolutionActivationGelu:
+        case SimdConvolutionActivationGeluTanh:
+            return 0;
+        case SimdConvolutionActivationLeakyRelu:
+        case SimdConvolutionActivationElu:
+        case SimdConvolutionActivationMish:
+        case SimdConvolutionActivationSwish:
+            return 1;
+        case SimdConvolutionActivationRestrictRange:
+        case SimdConvolutionActivationHswish:
+        case SimdConvolutionActivationHardSigmoid:
+            return 2;
+        case SimdConvolutionActivationPrelu:
+            return channels;
+        default:
+            assert(0);
+            return 0;
+        }
+    }
+}
+
+#endif//__SimdSynetPack_h__
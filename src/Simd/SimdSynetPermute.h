@@ -78,6 +78,7 @@ namespace Simd
                 case SimdTensorData8u: return 1;
                 case SimdTensorData16b: return 2;
                 case SimdTensorData16f: return 2;
+                case SimdTensorData16u: return 2;
                 default: assert(0); return 0;
                 }
             }
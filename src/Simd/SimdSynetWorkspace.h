@@ -0,0 +1,64 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetWorkspace_h__
+#define __SimdSynetWorkspace_h__
+
+#include "Simd/SimdMemory.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        class SynetWorkspace : public Deletable
+        {
+        public:
+            SynetWorkspace();
+
+            size_t AddContext(SimdSynetContextType type, const void* context, size_t step);
+            size_t AddBuffer(size_t size, size_t first, size_t last);
+
+            size_t Size();
+            size_t Offset(size_t index);
+
+        private:
+            struct Buffer
+            {
+                size_t size, first, last, offset;
+            };
+            std::vector<Buffer> _buffers;
+            size_t _size;
+            bool _planned;
+
+            void Plan();
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetWorkspaceInit();
+    }
+}
+
+#endif//__SimdSynetWorkspace_h__
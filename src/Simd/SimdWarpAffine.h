@@ -29,6 +29,8 @@
 
 #include "Simd/SimdPoint.hpp"
 
+#include <vector>
+
 namespace Simd
 {
     struct WarpAffParam
@@ -88,6 +90,10 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, uint8_t * dst) = 0;
 
+        bool SetMatrix(const float* mat);
+
+        void SetThreads(size_t threads);
+
     protected:
         WarpAffParam _param;
         bool _first;
@@ -144,7 +150,31 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        typedef void* (*WarpAffineInitPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        class WarpAffineBatch : public Deletable
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, WarpAffineInitPtr init);
+
+            virtual ~WarpAffineBatch();
+
+            bool Run(const uint8_t* src, size_t count, const float* mats, uint8_t** dst);
+
+            static const float* Identity();
+
+        protected:
+            WarpAffParam _param;
+            size_t _threads;
+            std::vector<class WarpAffine*> _workers;
+            std::vector<std::pair<float, size_t>> _order;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -173,6 +203,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 
@@ -202,6 +234,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 
@@ -231,6 +265,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
     }
 #endif
 }
@@ -212,6 +212,49 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        /* Float coefficients of YUV to BGR conversion for 16-bit YUV samples. Output values are in range [0..1]. */
+        struct Yuv16ToBgr32fParam
+        {
+            float yA, uB, uG, vG, vR, bB, bG, bR;
+
+            Yuv16ToBgr32fParam(int shift, SimdYuvType yuvType)
+            {
+                switch (yuvType)
+                {
+                case SimdYuvBt601: Init<Bt601>(shift); break;
+                case SimdYuvBt709: Init<Bt709>(shift); break;
+                case SimdYuvBt2020: Init<Bt2020>(shift); break;
+                case SimdYuvTrect871: Init<Trect871>(shift); break;
+                default:
+                    assert(0);
+                }
+            }
+
+            template<class T> void Init(int shift)
+            {
+                float k = 1.0f / float(T::F_RANGE * 255);
+                float s = k / float(1 << shift);
+                yA = float(T::Y_2_A) * s;
+                uB = float(T::U_2_B) * s;
+                uG = float(T::U_2_G) * s;
+                vG = float(T::V_2_G) * s;
+                vR = float(T::V_2_R) * s;
+                bB = -float(T::Y_2_A * T::Y_LO + T::U_2_B * T::UV_Z) * k;
+                bG = -float(T::Y_2_A * T::Y_LO + (T::U_2_G + T::V_2_G) * T::UV_Z) * k;
+                bR = -float(T::Y_2_A * T::Y_LO + T::V_2_R * T::UV_Z) * k;
+            }
+        };
+
+        SIMD_INLINE void Yuv16ToBgr32f(int y, int u, int v, const Yuv16ToBgr32fParam& p, float* blue, float* green, float* red)
+        {
+            float _y = float(y) * p.yA;
+            *blue = Simd::RestrictRange(_y + p.bB + float(u) * p.uB, 0.0f, 1.0f);
+            *green = Simd::RestrictRange(_y + p.bG + float(u) * p.uG + float(v) * p.vG, 0.0f, 1.0f);
+            *red = Simd::RestrictRange(_y + p.bR + float(v) * p.vR, 0.0f, 1.0f);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<class T> SIMD_INLINE int BgrToY(int blue, int green, int red)
         {
             return RestrictRange(((T::B_2_Y * blue + T::G_2_Y * green + T::R_2_Y * red + T::B_ROUND) >> T::B_SHIFT) + T::Y_LO);
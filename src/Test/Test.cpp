@@ -83,6 +83,11 @@ namespace Test
     TEST_ADD_GROUP_A0(SquaredDifferenceKahanSum32f);
     TEST_ADD_GROUP_A0(CosineDistance32f);
 
+    TEST_ADD_GROUP_A0(DistancesTopK32f);
+    TEST_ADD_GROUP_A0(DistancesTopK8i);
+    TEST_ADD_GROUP_A0(DistancesMxNpInt8Quantized);
+    TEST_ADD_GROUP_A0(Int8Quantized);
+
     TEST_ADD_GROUP_A0(AddFeatureDifference);
 
     TEST_ADD_GROUP_A0(BgraToBgr);
@@ -115,6 +120,8 @@ namespace Test
     TEST_ADD_GROUP_A0(BgrToYuv420p);
     TEST_ADD_GROUP_A0(BgrToYuv422p);
     TEST_ADD_GROUP_A0(BgrToYuv444p);
+    TEST_ADD_GROUP_A0(BgraToNv12);
+    TEST_ADD_GROUP_A0(BgrToNv12);
     TEST_ADD_GROUP_A0(Uyvy422ToYuv420p);
     TEST_ADD_GROUP_A0(BgraToYuva420p);
     TEST_ADD_GROUP_A0(BgraToYuva420pV2);
@@ -171,6 +178,9 @@ namespace Test
     TEST_ADD_GROUP_A0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_A0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A0(DetectionDecodeBoxes32f);
+    TEST_ADD_GROUP_A0(DetectionFilterScores32f);
+    TEST_ADD_GROUP_A0(DetectionNms32f);
     TEST_ADD_GROUP_0S(Detection);
 
     TEST_ADD_GROUP_A0(AlphaBlending);
@@ -213,12 +223,14 @@ namespace Test
     TEST_ADD_GROUP_AS(CosineDistancesMxNp16f);
     TEST_ADD_GROUP_A0(VectorNormNa16f);
     TEST_ADD_GROUP_A0(VectorNormNp16f);
+    TEST_ADD_GROUP_A0(DistancesTopK16f);
 
     TEST_ADD_GROUP_A0(Float32ToUint8);
     TEST_ADD_GROUP_A0(Uint8ToFloat32);
 
     TEST_ADD_GROUP_A0(Gemm32fNN);
     TEST_ADD_GROUP_A0(Gemm32fNT);
+    TEST_ADD_GROUP_A0(Gemm8u8i);
 
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
@@ -295,6 +307,7 @@ namespace Test
     TEST_ADD_GROUP_A0(NeuralPooling1x1Max3x3);
     TEST_ADD_GROUP_A0(NeuralPooling2x2Max2x2);
     TEST_ADD_GROUP_A0(NeuralPooling2x2Max3x3);
+    TEST_ADD_GROUP_A0(NeuralTrainMiniBatch);
     TEST_ADD_GROUP_0S(NeuralPredict);
     TEST_ADD_GROUP_0S(NeuralTrain);
 
@@ -321,6 +334,7 @@ namespace Test
     TEST_ADD_GROUP_A0(ReduceGray3x3);
     TEST_ADD_GROUP_A0(ReduceGray4x4);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
+    TEST_ADD_GROUP_A0(PyramidBuild);
 
     TEST_ADD_GROUP_A0(Reorder16bit);
     TEST_ADD_GROUP_A0(Reorder32bit);
@@ -362,7 +376,10 @@ namespace Test
 #if defined(SIMD_SYNET_ENABLE)
     TEST_ADD_GROUP_A0(SynetAddBias);
     TEST_ADD_GROUP_A0(SynetAdd8i);
+    TEST_ADD_GROUP_A0(SynetAttention32fForward);
+    TEST_ADD_GROUP_A0(SynetCalibration32f);
     TEST_ADD_GROUP_A0(SynetEltwiseLayerForward);
+    TEST_ADD_GROUP_A0(SynetLogSoftmaxLayerForward);
     TEST_ADD_GROUP_A0(SynetLrnLayerCrossChannels);
     TEST_ADD_GROUP_A0(SynetShuffleLayerForward);
     TEST_ADD_GROUP_A0(SynetUnaryOperation32fLayerForward);
@@ -377,6 +394,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetSigmoid32f);
     TEST_ADD_GROUP_A0(SynetSoftplus32f);
     TEST_ADD_GROUP_A0(SynetSwish32f);
+    TEST_ADD_GROUP_A0(SynetGelu32f);
     TEST_ADD_GROUP_A0(SynetTanh32f);
 
     TEST_ADD_GROUP_A0(SynetConvert32fTo8u);
@@ -384,10 +402,20 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetSetInput);
 
     TEST_ADD_GROUP_A0(SynetConvolution8iForward);
+    TEST_ADD_GROUP_A0(SynetConvolution8iExport);
+    TEST_ADD_GROUP_A0(SynetConvolution8iPacked);
+    TEST_ADD_GROUP_A0(SynetConvolution8iForwardAdd);
 
     TEST_ADD_GROUP_A0(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A0(SynetConvolution32fExport);
+    TEST_ADD_GROUP_A0(SynetConvolution32fPacked);
+    TEST_ADD_GROUP_A0(SynetConvolution32fReshape);
+    TEST_ADD_GROUP_A0(SynetConvolution32fForwardAdd);
 
     TEST_ADD_GROUP_A0(SynetDeconvolution32fForward);
+    TEST_ADD_GROUP_A0(SynetDeconvolution32fReshape);
+
+    TEST_ADD_GROUP_A0(SynetDeconvolution8iForward);
 
     TEST_ADD_GROUP_A0(SynetFusedLayerForward0);
     TEST_ADD_GROUP_A0(SynetFusedLayerForward1);
@@ -397,26 +425,40 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetFusedLayerForward8);
     TEST_ADD_GROUP_A0(SynetFusedLayerForward9);
 
+    TEST_ADD_GROUP_A0(SynetGraph);
+
     TEST_ADD_GROUP_A0(SynetInnerProduct32fForward);
+    TEST_ADD_GROUP_A0(SynetInnerProduct8iForward);
+    TEST_ADD_GROUP_A0(SynetInnerProduct4bForward);
     TEST_ADD_GROUP_A0(SynetInnerProductLayerForward);
     TEST_ADD_GROUP_A0(SynetInnerProduct8i);
 
     TEST_ADD_GROUP_A0(SynetMergedConvolution8iForward);
 
     TEST_ADD_GROUP_A0(SynetMergedConvolution32fForward);
+    TEST_ADD_GROUP_A0(SynetMergedConvolution32fExport);
+    TEST_ADD_GROUP_A0(SynetMergedConvolution32fReshape);
 
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForward);
+    TEST_ADD_GROUP_A0(SynetLayerNorm32f);
+    TEST_ADD_GROUP_A0(SynetGroupNorm32f);
 
     TEST_ADD_GROUP_A0(SynetPermute);
 
     TEST_ADD_GROUP_A0(SynetPoolingAverage);
     TEST_ADD_GROUP_A0(SynetPoolingMax32f);
     TEST_ADD_GROUP_A0(SynetPoolingMax8u);
+    TEST_ADD_GROUP_A0(SynetRoiAlign32f);
+    TEST_ADD_GROUP_A0(SynetRoiPoolingMax32f);
 
     TEST_ADD_GROUP_A0(SynetScaleLayerForward);
     TEST_ADD_GROUP_A0(SynetScale8iForward);
 
+    TEST_ADD_GROUP_A0(SynetSoftmaxArgMax32f);
     TEST_ADD_GROUP_A0(SynetSoftmaxLayerForward);
+    TEST_ADD_GROUP_A0(SynetSoftmaxTopK32f);
+
+    TEST_ADD_GROUP_A0(SynetWorkspace);
 #endif
 
     TEST_ADD_GROUP_A0(TextureBoostedSaturatedGradient);
@@ -426,9 +468,15 @@ namespace Test
 
     TEST_ADD_GROUP_A0(TransformImage);
 
+    TEST_ADD_GROUP_A0(Nv12ToBgr);
+    TEST_ADD_GROUP_A0(Nv12ToBgra);
+    TEST_ADD_GROUP_A0(Nv12ToRgb);
+    TEST_ADD_GROUP_A0(Nv12ToRgba);
+
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
     TEST_ADD_GROUP_A0(WarpAffine);
+    TEST_ADD_GROUP_A0(WarpAffineBatch);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
 #endif
@@ -485,6 +533,16 @@ namespace Test
     TEST_ADD_GROUP_A0(Yuv420pToBgra);
     TEST_ADD_GROUP_A0(Yuv420pToBgraV2);
 
+    TEST_ADD_GROUP_A0(Yuv420p16ToBgr);
+    TEST_ADD_GROUP_A0(Yuv420p16ToBgra);
+    TEST_ADD_GROUP_A0(Yuv420p16ToBgrPlanar32f);
+    TEST_ADD_GROUP_A0(Yuv444p16ToBgr);
+    TEST_ADD_GROUP_A0(Yuv444p16ToBgra);
+    TEST_ADD_GROUP_A0(Yuv444p16ToBgrPlanar32f);
+    TEST_ADD_GROUP_A0(P010ToBgr);
+    TEST_ADD_GROUP_A0(P010ToBgra);
+    TEST_ADD_GROUP_A0(P010ToBgrPlanar32f);
+
     class Task
     {
         Group * _groups;
@@ -691,4 +691,113 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* y, size_t yStride,
+                uint8_t* uv, size_t uvStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& src, View& y, View& uv, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, y.data, y.stride, uv.data, uv.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(function) FuncNv12(function, #function)
+
+    bool AnyToNv12AutoTest(int width, int height, View::Format srcType, SimdYuvType yuvType, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / 2;
+        const int uvHeight = height / 2;
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv1(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(uvWidth));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv2(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(uvWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, uv1, yuvType));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, uv2, yuvType));
+
+        result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+        result = result && Compare(uv1, uv2, 0, true, 64, 0, "uv");
+
+        return result;
+    }
+
+    bool AnyToNv12AutoTest(View::Format srcType, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        result = result && AnyToNv12AutoTest(W, H, srcType, SimdYuvBt601, f1, f2);
+        result = result && AnyToNv12AutoTest(W + O * 2, H - O * 2, srcType, SimdYuvBt709, f1, f2);
+
+        return result;
+    }
+
+    bool BgraToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNv12AutoTest(View::Bgra32, FUNC_NV12(Simd::Base::BgraToNv12), FUNC_NV12(SimdBgraToNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToNv12AutoTest(View::Bgra32, FUNC_NV12(Simd::Sse41::BgraToNv12), FUNC_NV12(SimdBgraToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToNv12AutoTest(View::Bgra32, FUNC_NV12(Simd::Avx2::BgraToNv12), FUNC_NV12(SimdBgraToNv12));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNv12AutoTest(View::Bgra32, FUNC_NV12(Simd::Avx512bw::BgraToNv12), FUNC_NV12(SimdBgraToNv12));
+#endif
+
+        return result;
+    }
+
+    bool BgrToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToNv12AutoTest(View::Bgr24, FUNC_NV12(Simd::Base::BgrToNv12), FUNC_NV12(SimdBgrToNv12));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToNv12AutoTest(View::Bgr24, FUNC_NV12(Simd::Sse41::BgrToNv12), FUNC_NV12(SimdBgrToNv12));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToNv12AutoTest(View::Bgr24, FUNC_NV12(Simd::Avx2::BgrToNv12), FUNC_NV12(SimdBgrToNv12));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && AnyToNv12AutoTest(View::Bgr24, FUNC_NV12(Simd::Avx512bw::BgrToNv12), FUNC_NV12(SimdBgrToNv12));
+#endif
+
+        return result;
+    }
 }
@@ -25,6 +25,7 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
+#include "Test/TestTensor.h"
 
 #include "Simd/SimdDrawing.hpp"
 
@@ -425,6 +426,309 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDB
+        {
+            typedef void(*FuncPtr)(const float* deltas, const float* anchors, size_t count, SimdBoxEncodingType encoding, const float* params, float* boxes);
+
+            FuncPtr func;
+            String description;
+
+            FuncDB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t count, SimdBoxEncodingType encoding)
+            {
+                description = description + "[" + ToString(count) + (encoding == SimdBoxEncodingSsd ? "-ssd" : "-yolo") + "]";
+            }
+
+            void Call(const Tensor32f& deltas, const Tensor32f& anchors, size_t count, SimdBoxEncodingType encoding, const float* params, Tensor32f& boxes) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(deltas.Data(), anchors.Data(), count, encoding, params, boxes.Data());
+            }
+        };
+    }
+
+#define FUNC_DB(function) FuncDB(function, #function)
+
+    bool DetectionDecodeBoxes32fAutoTest(size_t count, SimdBoxEncodingType encoding, FuncDB f1, FuncDB f2)
+    {
+        bool result = true;
+
+        f1.Update(count, encoding);
+        f2.Update(count, encoding);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        Tensor32f deltas({ count, 4 }), anchors({ count, 4 }), boxes1({ count, 4 }), boxes2({ count, 4 });
+        FillRandom(deltas, -2.0f, 2.0f);
+        FillRandom(anchors, 4.0f, 64.0f);
+        const float ssd[4] = { 0.1f, 0.1f, 0.2f, 0.2f }, yolo[4] = { 8.0f, 8.0f, 0.0f, 0.0f };
+        const float* params = encoding == SimdBoxEncodingSsd ? ssd : yolo;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(deltas, anchors, count, encoding, params, boxes1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(deltas, anchors, count, encoding, params, boxes2));
+
+        result = result && Compare(boxes1, boxes2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool DetectionDecodeBoxes32fAutoTest(const FuncDB& f1, const FuncDB& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionDecodeBoxes32fAutoTest(10000, SimdBoxEncodingSsd, f1, f2);
+        result = result && DetectionDecodeBoxes32fAutoTest(10001, SimdBoxEncodingYolo, f1, f2);
+        result = result && DetectionDecodeBoxes32fAutoTest(7, SimdBoxEncodingSsd, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionDecodeBoxes32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionDecodeBoxes32fAutoTest(FUNC_DB(Simd::Base::DetectionDecodeBoxes32f), FUNC_DB(SimdDetectionDecodeBoxes32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DetectionDecodeBoxes32fAutoTest(FUNC_DB(Simd::Sse41::DetectionDecodeBoxes32f), FUNC_DB(SimdDetectionDecodeBoxes32f));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionDecodeBoxes32fAutoTest(FUNC_DB(Simd::Avx2::DetectionDecodeBoxes32f), FUNC_DB(SimdDetectionDecodeBoxes32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionDecodeBoxes32fAutoTest(FUNC_DB(Simd::Avx512bw::DetectionDecodeBoxes32f), FUNC_DB(SimdDetectionDecodeBoxes32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncFS
+        {
+            typedef size_t(*FuncPtr)(const float* scores, size_t count, float threshold, uint32_t* indices);
+
+            FuncPtr func;
+            String description;
+
+            FuncFS(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t count, float threshold)
+            {
+                description = description + "[" + ToString(count) + "-" + ToString(threshold, 2, false) + "]";
+            }
+
+            void Call(const Tensor32f& scores, float threshold, Tensor32i& indices, size_t& size) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                size = func(scores.Data(), scores.Size(), threshold, (uint32_t*)indices.Data());
+            }
+        };
+    }
+
+#define FUNC_FS(function) FuncFS(function, #function)
+
+    bool DetectionFilterScores32fAutoTest(size_t count, float threshold, FuncFS f1, FuncFS f2)
+    {
+        bool result = true;
+
+        f1.Update(count, threshold);
+        f2.Update(count, threshold);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        Tensor32f scores({ count });
+        FillRandom(scores, 0.0f, 1.0f);
+        Tensor32i indices1({ count }), indices2({ count });
+        size_t size1 = 0, size2 = 0;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(scores, threshold, indices1, size1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(scores, threshold, indices2, size2));
+
+        if (size1 != size2)
+        {
+            TEST_LOG_SS(Error, "Different number of selected scores: " << size1 << " != " << size2 << " !");
+            return false;
+        }
+        indices1.Reshape({ size1 });
+        indices2.Reshape({ size2 });
+        result = result && Compare(indices1, indices2, 0, true, 32);
+
+        return result;
+    }
+
+    bool DetectionFilterScores32fAutoTest(const FuncFS& f1, const FuncFS& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionFilterScores32fAutoTest(100000, 0.9f, f1, f2);
+        result = result && DetectionFilterScores32fAutoTest(99999, 0.1f, f1, f2);
+        result = result && DetectionFilterScores32fAutoTest(17, 0.5f, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionFilterScores32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Base::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Sse41::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Avx2::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionFilterScores32fAutoTest(FUNC_FS(Simd::Avx512bw::DetectionFilterScores32f), FUNC_FS(SimdDetectionFilterScores32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNms
+        {
+            typedef size_t(*FuncPtr)(const float* boxes, const float* scores, size_t count, SimdNmsType type, float iouThreshold, float sigma,
+                float scoreThreshold, uint32_t* indices, float* dstScores);
+
+            FuncPtr func;
+            String description;
+
+            FuncNms(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t count, SimdNmsType type)
+            {
+                const char* types[3] = { "greedy", "linear", "gaussian" };
+                description = description + "[" + ToString(count) + "-" + types[type] + "]";
+            }
+
+            void Call(const Tensor32f& boxes, const Tensor32f& scores, SimdNmsType type, float iouThreshold, float sigma, float scoreThreshold,
+                Tensor32i& indices, Tensor32f& dstScores, size_t& size) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                size = func(boxes.Data(), scores.Data(), scores.Size(), type, iouThreshold, sigma, scoreThreshold, (uint32_t*)indices.Data(), dstScores.Data());
+            }
+        };
+    }
+
+#define FUNC_NMS(function) FuncNms(function, #function)
+
+    bool DetectionNms32fAutoTest(size_t count, size_t objects, SimdNmsType type, FuncNms f1, FuncNms f2)
+    {
+        bool result = true;
+
+        f1.Update(count, type);
+        f2.Update(count, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        Tensor32f centers({ objects, 4 }), jitters({ count, 4 }), boxes({ count, 4 }), scores({ count });
+        FillRandom(centers, 0.0f, 1000.0f);
+        FillRandom(jitters, -4.0f, 4.0f);
+        FillRandom(scores, 0.0f, 1.0f);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* c = centers.Data() + (i % objects) * 4;
+            const float* j = jitters.Data() + i * 4;
+            float* b = boxes.Data() + i * 4;
+            float w = 10.0f + c[2] * 0.05f, h = 10.0f + c[3] * 0.05f;
+            b[0] = c[0] + j[0];
+            b[1] = c[1] + j[1];
+            b[2] = c[0] + w + j[2];
+            b[3] = c[1] + h + j[3];
+        }
+        const float iouThreshold = 0.5f, sigma = 0.5f, scoreThreshold = type == SimdNmsGreedy ? 0.05f : 0.001f;
+
+        Tensor32i indices1({ count }), indices2({ count });
+        Tensor32f dstScores1({ count }), dstScores2({ count });
+        size_t size1 = 0, size2 = 0;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, scores, type, iouThreshold, sigma, scoreThreshold, indices1, dstScores1, size1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, scores, type, iouThreshold, sigma, scoreThreshold, indices2, dstScores2, size2));
+
+        if (size1 != size2)
+        {
+            TEST_LOG_SS(Error, "Different number of kept boxes: " << size1 << " != " << size2 << " !");
+            return false;
+        }
+        indices1.Reshape({ size1 });
+        indices2.Reshape({ size2 });
+        dstScores1.Reshape({ size1 });
+        dstScores2.Reshape({ size2 });
+        if (type == SimdNmsGreedy)
+            result = result && Compare(indices1, indices2, 0, true, 32, "indices");
+        result = result && Compare(dstScores1, dstScores2, EPS, true, 32, DifferenceBoth, "scores");
+
+        return result;
+    }
+
+    bool DetectionNms32fAutoTest(const FuncNms& f1, const FuncNms& f2)
+    {
+        bool result = true;
+
+        result = result && DetectionNms32fAutoTest(20000, 500, SimdNmsGreedy, f1, f2);
+        result = result && DetectionNms32fAutoTest(2001, 100, SimdNmsSoftLinear, f1, f2);
+        result = result && DetectionNms32fAutoTest(1999, 100, SimdNmsSoftGaussian, f1, f2);
+        result = result && DetectionNms32fAutoTest(9, 3, SimdNmsGreedy, f1, f2);
+
+        return result;
+    }
+
+    bool DetectionNms32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Base::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Sse41::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Avx2::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DetectionNms32fAutoTest(FUNC_NMS(Simd::Avx512bw::DetectionNms32f), FUNC_NMS(SimdDetectionNms32f));
+#endif
+
+        return result;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,374 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncTK
+        {
+            typedef void(*Func32fPtr)(size_t M, size_t N, size_t K, const float* A, const float* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+            typedef void(*Func16fPtr)(size_t M, size_t N, size_t K, const uint16_t* A, const uint16_t* B, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+            typedef void(*Func8iPtr)(size_t M, size_t N, size_t K, const float* A, const int8_t* B, const float* scales, SimdDistanceType type, size_t top, uint32_t* indices, float* distances);
+
+            Func32fPtr func32f;
+            Func16fPtr func16f;
+            Func8iPtr func8i;
+            String desc;
+
+            FuncTK(const Func32fPtr& f, const String& d) : func32f(f), func16f(NULL), func8i(NULL), desc(d) {}
+            FuncTK(const Func16fPtr& f, const String& d) : func32f(NULL), func16f(f), func8i(NULL), desc(d) {}
+            FuncTK(const Func8iPtr& f, const String& d) : func32f(NULL), func16f(NULL), func8i(f), desc(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdDistanceType type, size_t top)
+            {
+                const char* types[3] = { "cos", "l2", "ip" };
+                desc = desc + "[" + ToString(M) + "-" + ToString(N) + "-" + ToString(K) + "-" + types[type] + "-" + ToString(top) + "]";
+            }
+
+            void Call(size_t M, size_t N, size_t K, const Tensor32f& A32f, const Tensor32f& B32f, const Tensor16u& A16f, const Tensor16u& B16f,
+                const Tensor8u& B8i, const Tensor32f& scales, SimdDistanceType type, size_t top, Tensor32i& indices, Tensor32f& distances) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                if (func32f)
+                    func32f(M, N, K, A32f.Data(), B32f.Data(), type, top, (uint32_t*)indices.Data(), distances.Data());
+                if (func16f)
+                    func16f(M, N, K, A16f.Data(), B16f.Data(), type, top, (uint32_t*)indices.Data(), distances.Data());
+                if (func8i)
+                    func8i(M, N, K, A32f.Data(), (const int8_t*)B8i.Data(), scales.Data(), type, top, (uint32_t*)indices.Data(), distances.Data());
+            }
+        };
+    }
+
+#define FUNC_TK(function) FuncTK(function, #function)
+
+    bool DistancesTopKAutoTest(size_t M, size_t N, size_t K, SimdDistanceType type, size_t top, float eps, FuncTK f1, FuncTK f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, type, top);
+        f2.Update(M, N, K, type, top);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Tensor32f A32f({ M, K }), B32f({ N, K }), scales({ N });
+        FillRandom(A32f, -1.0f, 1.0f);
+        FillRandom(B32f, -1.0f, 1.0f);
+
+        Tensor16u A16f({ M, K }), B16f({ N, K });
+        ::SimdFloat32ToFloat16(A32f.Data(), A32f.Size(), A16f.Data());
+        ::SimdFloat32ToFloat16(B32f.Data(), B32f.Size(), B16f.Data());
+
+        Tensor8u B8i({ N, K });
+        for (size_t j = 0; j < N; ++j)
+        {
+            const float* b = B32f.Data() + j * K;
+            float max = 0.0f;
+            for (size_t k = 0; k < K; ++k)
+                max = std::max(max, std::abs(b[k]));
+            scales.Data()[j] = max / 127.0f;
+            for (size_t k = 0; k < K; ++k)
+                B8i.Data()[j * K + k] = (uint8_t)(int8_t)Simd::Round(b[k] * 127.0f / max);
+        }
+
+        Tensor32i indices1({ M, top }), indices2({ M, top });
+        Tensor32f distances1({ M, top }), distances2({ M, top });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A32f, B32f, A16f, B16f, B8i, scales, type, top, indices1, distances1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A32f, B32f, A16f, B16f, B8i, scales, type, top, indices2, distances2));
+
+        result = result && Compare(distances1, distances2, eps, true, 32, DifferenceBoth, "distances");
+
+        for (size_t i = 0; i < M && result; ++i)
+        {
+            for (size_t t = 0; t < top && result; ++t)
+            {
+                uint32_t index = (uint32_t)indices2.Data()[i * top + t];
+                if (t < N ? index >= N : index != 0xFFFFFFFF)
+                {
+                    TEST_LOG_SS(Error, "Wrong index " << index << " at [" << i << ", " << t << "]!");
+                    result = false;
+                }
+                for (size_t p = 0; p < t && result && t < N; ++p)
+                {
+                    if (indices2.Data()[i * top + p] == indices2.Data()[i * top + t])
+                    {
+                        TEST_LOG_SS(Error, "Duplicated index " << index << " at [" << i << ", " << t << "]!");
+                        result = false;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool DistancesTopKAutoTest(float eps, const FuncTK& f1, const FuncTK& f2)
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(1, 10000, 512, SimdDistanceCosine, 10, eps, f1, f2);
+        result = result && DistancesTopKAutoTest(7, 5003, 127, SimdDistanceCosine, 5, eps, f1, f2);
+        result = result && DistancesTopKAutoTest(16, 4096, 256, SimdDistanceSquaredL2, 16, eps, f1, f2);
+        result = result && DistancesTopKAutoTest(5, 2021, 129, SimdDistanceInnerProduct, 7, eps, f1, f2);
+        result = result && DistancesTopKAutoTest(3, 3, 35, SimdDistanceCosine, 5, eps, f1, f2);
+
+        return result;
+    }
+
+    bool DistancesTopK32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Base::DistancesTopK32f), FUNC_TK(SimdDistancesTopK32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Sse41::DistancesTopK32f), FUNC_TK(SimdDistancesTopK32f));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx2::DistancesTopK32f), FUNC_TK(SimdDistancesTopK32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx512bw::DistancesTopK32f), FUNC_TK(SimdDistancesTopK32f));
+#endif
+
+        return result;
+    }
+
+    bool DistancesTopK16fAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Base::DistancesTopK16f), FUNC_TK(SimdDistancesTopK16f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Sse41::DistancesTopK16f), FUNC_TK(SimdDistancesTopK16f));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx2::DistancesTopK16f), FUNC_TK(SimdDistancesTopK16f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx512bw::DistancesTopK16f), FUNC_TK(SimdDistancesTopK16f));
+#endif
+
+        return result;
+    }
+
+    bool DistancesTopK8iAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Base::DistancesTopK8i), FUNC_TK(SimdDistancesTopK8i));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Sse41::DistancesTopK8i), FUNC_TK(SimdDistancesTopK8i));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx2::DistancesTopK8i), FUNC_TK(SimdDistancesTopK8i));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DistancesTopKAutoTest(EPS, FUNC_TK(Simd::Avx512bw::DistancesTopK8i), FUNC_TK(SimdDistancesTopK8i));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDQ
+        {
+            typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const uint8_t* A, const uint8_t* B, SimdDistanceType type, float* distances);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDQ(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdDistanceType type, SimdBool symmetric)
+            {
+                const char* types[3] = { "cos", "l2", "ip" };
+                desc = desc + "[" + ToString(M) + "-" + ToString(N) + "-" + ToString(K) + "-" + types[type] + (symmetric ? "-s" : "-a") + "]";
+            }
+
+            void Call(size_t M, size_t N, size_t K, const Tensor8u& A, const Tensor8u& B, SimdDistanceType type, Tensor32f& distances) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(M, N, K, A.Data(), B.Data(), type, distances.Data());
+            }
+        };
+    }
+
+#define FUNC_DQ(function) FuncDQ(function, #function)
+
+    bool DistancesMxNpInt8QuantizedAutoTest(size_t M, size_t N, size_t K, SimdDistanceType type, SimdBool symmetric, float eps, FuncDQ f1, FuncDQ f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, type, symmetric);
+        f2.Update(M, N, K, type, symmetric);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Tensor32f A32f({ M, K }), B32f({ N, K });
+        FillRandom(A32f, -1.0f, 1.0f);
+        FillRandom(B32f, -1.0f, 1.0f);
+
+        const size_t S = K + 8;
+        Tensor8u A({ M, S }), B({ N, S });
+        for (size_t i = 0; i < M; ++i)
+            ::SimdFloat32ToInt8Quantized(A32f.Data() + i * K, K, symmetric, A.Data() + i * S);
+        for (size_t j = 0; j < N; ++j)
+            ::SimdFloat32ToInt8Quantized(B32f.Data() + j * K, K, symmetric, B.Data() + j * S);
+
+        Tensor32f distances1({ M, N }), distances2({ M, N });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A, B, type, distances1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A, B, type, distances2));
+
+        result = result && Compare(distances1, distances2, eps, true, 32, DifferenceBoth);
+
+        float error = 0, range = 0;
+        for (size_t i = 0; i < M; ++i)
+        {
+            for (size_t j = 0; j < N; ++j)
+            {
+                const float* a = A32f.Data() + i * K, * b = B32f.Data() + j * K;
+                float ab = 0, aa = 0, bb = 0;
+                for (size_t k = 0; k < K; ++k)
+                {
+                    ab += a[k] * b[k];
+                    aa += a[k] * a[k];
+                    bb += b[k] * b[k];
+                }
+                float d = type == SimdDistanceCosine ? 1.0f - ab / ::sqrt(aa * bb) : (type == SimdDistanceSquaredL2 ? aa + bb - 2.0f * ab : -ab);
+                error = std::max(error, std::abs(d - distances2.Data()[i * N + j]));
+                range = std::max(range, std::abs(d));
+            }
+        }
+        TEST_LOG_SS(Info, "Maximal difference from FP32 distances is " << std::setprecision(6) << error << " (range of distances is " << range << ").");
+
+        return result;
+    }
+
+    bool DistancesMxNpInt8QuantizedAutoTest(float eps, const FuncDQ& f1, const FuncDQ& f2)
+    {
+        bool result = true;
+
+        result = result && DistancesMxNpInt8QuantizedAutoTest(128, 1024, 512, SimdDistanceCosine, SimdTrue, eps, f1, f2);
+        result = result && DistancesMxNpInt8QuantizedAutoTest(127, 129, 513, SimdDistanceCosine, SimdFalse, eps, f1, f2);
+        result = result && DistancesMxNpInt8QuantizedAutoTest(64, 255, 256, SimdDistanceSquaredL2, SimdFalse, eps, f1, f2);
+        result = result && DistancesMxNpInt8QuantizedAutoTest(33, 100, 127, SimdDistanceInnerProduct, SimdTrue, eps, f1, f2);
+        result = result && DistancesMxNpInt8QuantizedAutoTest(1, 1, 35, SimdDistanceCosine, SimdTrue, eps, f1, f2);
+
+        return result;
+    }
+
+    bool DistancesMxNpInt8QuantizedAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistancesMxNpInt8QuantizedAutoTest(EPS, FUNC_DQ(Simd::Base::DistancesMxNpInt8Quantized), FUNC_DQ(SimdDistancesMxNpInt8Quantized));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && DistancesMxNpInt8QuantizedAutoTest(EPS, FUNC_DQ(Simd::Sse41::DistancesMxNpInt8Quantized), FUNC_DQ(SimdDistancesMxNpInt8Quantized));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistancesMxNpInt8QuantizedAutoTest(EPS, FUNC_DQ(Simd::Avx2::DistancesMxNpInt8Quantized), FUNC_DQ(SimdDistancesMxNpInt8Quantized));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DistancesMxNpInt8QuantizedAutoTest(EPS, FUNC_DQ(Simd::Avx512bw::DistancesMxNpInt8Quantized), FUNC_DQ(SimdDistancesMxNpInt8Quantized));
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && DistancesMxNpInt8QuantizedAutoTest(EPS, FUNC_DQ(Simd::Avx512vnni::DistancesMxNpInt8Quantized), FUNC_DQ(SimdDistancesMxNpInt8Quantized));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Int8QuantizedAutoTest(size_t size, SimdBool symmetric)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdFloat32ToInt8Quantized & SimdInt8QuantizedToFloat32 [" << size << (symmetric ? "-s" : "-a") << "].");
+
+        Tensor32f src({ size }), dst({ size });
+        FillRandom(src, -2.0f, 3.0f);
+        Tensor8u quantized({ size + 8 });
+
+        ::SimdFloat32ToInt8Quantized(src.Data(), size, symmetric, quantized.Data());
+        ::SimdInt8QuantizedToFloat32(quantized.Data(), size, dst.Data());
+
+        float scale = ((float*)quantized.Data())[0];
+        result = result && Compare(src, dst, scale * 0.5001f, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool Int8QuantizedAutoTest()
+    {
+        bool result = true;
+
+        result = result && Int8QuantizedAutoTest(512, SimdTrue);
+        result = result && Int8QuantizedAutoTest(513, SimdFalse);
+
+        return result;
+    }
+}
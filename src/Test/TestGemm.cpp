@@ -291,4 +291,122 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncGemm8u8i
+        {
+            typedef void(*FuncPtr)(size_t M, size_t N, size_t K, const uint8_t* A, size_t lda, SimdBool transA, const int8_t* B, size_t ldb, SimdBool transB,
+                const uint8_t* aZero, const float* aScale, const float* bScale, const float* bias, void* C, size_t ldc, SimdTensorDataType cType);
+
+            FuncPtr func;
+            String description;
+
+            FuncGemm8u8i(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(size_t M, size_t N, size_t K, const Tensor8u& A, SimdBool transA, const Tensor8i& B, SimdBool transB, const Tensor8u& aZero,
+                const Tensor32f& aScale, const Tensor32f& bScale, const Tensor32f& bias, void* C, size_t ldc, SimdTensorDataType cType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(M, N, K, A.Data(), A.Axis(1), transA, B.Data(), B.Axis(1), transB, aZero.Data(), aScale.Data(), bScale.Data(), bias.Data(), C, ldc, cType);
+            }
+
+            void Update(size_t M, size_t N, size_t K, SimdBool transA, SimdBool transB, SimdTensorDataType cType)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << M << "-" << N << "-" << K << "-" << (transA ? "T" : "N") << (transB ? "T" : "N") << "-" << (cType == SimdTensorData32f ? "32f" : "32i") << "]";
+                description = ss.str();
+            }
+        };
+    }
+
+#define FUNC_GEMM8U8I(function) FuncGemm8u8i(function, #function)
+
+    bool Gemm8u8iAutoTest(size_t M, size_t N, size_t K, SimdBool transA, SimdBool transB, SimdTensorDataType cType, FuncGemm8u8i f1, FuncGemm8u8i f2)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, transA, transB, cType);
+        f2.Update(M, N, K, transA, transB, cType);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        Tensor8u A({ transA ? K : M, transA ? M : K });
+        Tensor8i B({ transB ? N : K, transB ? K : N });
+        Tensor8u aZero({ M });
+        Tensor32f aScale({ M }), bScale({ N }), bias({ N });
+        FillRandom(A.Data(), A.Size(), 0, 255);
+        FillRandom(B, -128, 127);
+        FillRandom(aZero.Data(), aZero.Size(), 0, 255);
+        FillRandom(aScale.Data(), aScale.Size(), 0.0f, 0.001f);
+        FillRandom(bScale.Data(), bScale.Size(), 0.0f, 0.001f);
+        FillRandom(bias.Data(), bias.Size(), -1.0f, 1.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        if (cType == SimdTensorData32f)
+        {
+            Tensor32f C1({ M, N }), C2({ M, N });
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A, transA, B, transB, aZero, aScale, bScale, bias, C1.Data(), N, cType));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A, transA, B, transB, aZero, aScale, bScale, bias, C2.Data(), N, cType));
+            result = result && Compare(C1, C2, EPS, true, 32, DifferenceBoth);
+        }
+        else
+        {
+            Tensor32i C1({ M, N }), C2({ M, N });
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(M, N, K, A, transA, B, transB, aZero, aScale, bScale, bias, C1.Data(), N, cType));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(M, N, K, A, transA, B, transB, aZero, aScale, bScale, bias, C2.Data(), N, cType));
+            result = result && Compare(C1, C2, 0, true, 32);
+        }
+
+        return result;
+    }
+
+    bool Gemm8u8iAutoTest(const FuncGemm8u8i& f1, const FuncGemm8u8i& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, n = SimdFalse;
+        SimdTensorDataType f32 = SimdTensorData32f, i32 = SimdTensorData32i;
+
+        result = result && Gemm8u8iAutoTest(1, 1000, 1024, n, t, f32, f1, f2);
+        result = result && Gemm8u8iAutoTest(7, 255, 333, n, n, i32, f1, f2);
+        result = result && Gemm8u8iAutoTest(64, 512, 512, n, t, f32, f1, f2);
+        result = result && Gemm8u8iAutoTest(127, 129, 257, t, n, i32, f1, f2);
+        result = result && Gemm8u8iAutoTest(256, 256, 1024, n, n, f32, f1, f2);
+
+        return result;
+    }
+
+    bool Gemm8u8iAutoTest()
+    {
+        bool result = true;
+
+        result = result && Gemm8u8iAutoTest(FUNC_GEMM8U8I(Simd::Base::Gemm8u8i), FUNC_GEMM8U8I(SimdGemm8u8i));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Gemm8u8iAutoTest(FUNC_GEMM8U8I(Simd::Avx2::Gemm8u8i), FUNC_GEMM8U8I(SimdGemm8u8i));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Gemm8u8iAutoTest(FUNC_GEMM8U8I(Simd::Avx512bw::Gemm8u8i), FUNC_GEMM8U8I(SimdGemm8u8i));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && Gemm8u8iAutoTest(FUNC_GEMM8U8I(Simd::Avx512vnni::Gemm8u8i), FUNC_GEMM8U8I(SimdGemm8u8i));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && Gemm8u8iAutoTest(FUNC_GEMM8U8I(Simd::AmxBf16::Gemm8u8i), FUNC_GEMM8U8I(SimdGemm8u8i));
+#endif
+
+        return result;
+    }
 }
@@ -24,6 +24,7 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestRandom.h"
+#include "Test/TestString.h"
 
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
 #define SIMD_CHECK_PERFORMANCE() TEST_PERFORMANCE_TEST_(SIMD_FUNCTION)
@@ -1485,5 +1486,175 @@ namespace Test
 
         return true;
     }
+
+    bool CreateMiniBatchNetwork(Network & net)
+    {
+        using namespace Simd::Neural;
+        net.Clear();
+        TEST_ADD_LAYER(net, (new ConvolutionalLayer(Function::Relu, Size(16, 16), 1, 8, Size(5, 5))));
+        TEST_ADD_LAYER(net, (new MaxPoolingLayer(Function::Relu, Size(12, 12), 8, Size(2, 2), Size(2, 2))));
+        TEST_ADD_LAYER(net, (new ConvolutionalLayer(Function::Relu, Size(6, 6), 8, 16, Size(3, 3), false)));
+        TEST_ADD_LAYER(net, (new FullyConnectedLayer(Function::Relu, 6 * 6 * 16, 64)));
+        TEST_ADD_LAYER(net, (new FullyConnectedLayer(Function::Sigmoid, 64, 10)));
+        return true;
+    }
+
+    bool NeuralTrainMiniBatchCompare(const Network & net1, const Network & net2, float eps, const String & desc)
+    {
+        size_t size1 = 0, size2 = 0;
+        net1.Save(NULL, &size1, true);
+        net2.Save(NULL, &size2, true);
+        if (size1 != size2)
+        {
+            TEST_LOG_SS(Error, desc << ": sizes of networks are different: " << size1 << " != " << size2 << " !");
+            return false;
+        }
+        std::vector<uint8_t> data1(size1), data2(size2);
+        net1.Save(data1.data(), &size1, true);
+        net2.Save(data2.data(), &size2, true);
+        const float * weight1 = (float*)data1.data(), * weight2 = (float*)data2.data();
+        for (size_t i = 0, n = size1 / sizeof(float); i < n; ++i)
+        {
+            if (::fabs(weight1[i] - weight2[i]) > eps)
+            {
+                TEST_LOG_SS(Error, desc << ": weight " << i << " is different: " << weight1[i] << " != " << weight2[i] << " !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    struct LossLogger
+    {
+        void operator() ()
+        {
+            _loss->push_back(Check(*_network, *_sample, 0.5f, true).first);
+        }
+
+        LossLogger(Network * network, const TrainSample * sample, std::vector<float> * loss)
+            : _network(network)
+            , _sample(sample)
+            , _loss(loss)
+        {
+            _loss->push_back(Check(*_network, *_sample, 0.5f, true).first);
+        }
+
+    private:
+        Network * _network;
+        const TrainSample * _sample;
+        std::vector<float> * _loss;
+    };
+
+    bool NeuralTrainMiniBatchLoss(const std::vector<float> & loss, float initial, float decay, const String & desc)
+    {
+        for (size_t i = 1; i < loss.size(); ++i)
+        {
+            if (loss[i] >= loss[i - 1])
+            {
+                TEST_LOG_SS(Error, desc << ": loss does not go down at epoch " << i << ": " << loss[i] << " >= " << loss[i - 1] << " !");
+                return false;
+            }
+        }
+        if (loss.back() > initial * decay)
+        {
+            TEST_LOG_SS(Error, desc << ": final loss " << loss.back() << " exceeds " << decay << " of initial loss " << initial << " !");
+            return false;
+        }
+        return true;
+    }
+
+    bool NeuralTrainMiniBatchAutoTest(size_t batchSize, size_t threadNumber)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Neural::Network train with mini-batch of " << batchSize << " samples in " << threadNumber << " threads.");
+
+        Network net0, net1, net2;
+        if (!CreateMiniBatchNetwork(net0) || !CreateMiniBatchNetwork(net1) || !CreateMiniBatchNetwork(net2))
+            return false;
+
+        TrainSample sample;
+        sample.Resize(256);
+        for (size_t i = 0; i < sample.src.size(); ++i)
+        {
+            sample.src[i].resize(net0.InputIndex().Volume());
+            FillRandom(sample.src[i].data(), sample.src[i].size(), 0.0f, 0.5f);
+            sample.lbl[i] = i % 10;
+            for (size_t x = 0, y = sample.lbl[i] + 3, w = net0.InputIndex().width; x < w; ++x)
+                sample.src[i][y * w + x] = 1.0f;
+        }
+        net0.Convert(sample.lbl, sample.dst);
+
+        TrainOptions options;
+        options.shuffle = false;
+        options.threadNumber = 1;
+        options.batchSize = batchSize;
+        options.epochFinish = 0;
+        Logger logger;
+        net0.Train(sample.src, sample.dst, options, logger);
+
+        size_t size = 0;
+        net0.Save(NULL, &size, true);
+        std::vector<uint8_t> data(size);
+        net0.Save(data.data(), &size, true);
+        net1.Load(data.data(), size, true);
+        net2.Load(data.data(), size, true);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        options.threadNumber = threadNumber;
+        options.epochStart = 1;
+        options.epochFinish = 2;
+        {
+            TEST_PERFORMANCE_TEST("SimdNeuralTrain[PerSample-" + ToString(batchSize) + "-" + ToString(threadNumber) + "]");
+            net1.Train(sample.src, sample.dst, options, logger);
+        }
+        options.propagateType = TrainOptions::MiniBatch;
+        options.threadNumber = threadNumber;
+        {
+            TEST_PERFORMANCE_TEST("SimdNeuralTrain[MiniBatch-" + ToString(batchSize) + "-" + ToString(threadNumber) + "]");
+            net2.Train(sample.src, sample.dst, options, logger);
+        }
+        result = result && NeuralTrainMiniBatchCompare(net1, net2, EPS, "Per-sample and mini-batch training");
+
+        // Per-sample propagation sums products in direct loops and accumulates weight gradients sample by sample (and then thread by thread), 
+        // mini-batch propagation gets the same sums from blocked GEMM. So the weights differ by rounding errors. Further epochs amplify them 
+        // (rare switches of ReLU and max pooling, adaptive gradient), so longer training is compared with a reference of the same summation order
+        // (mini-batch propagation does not depend on the number of threads), and both methods have to reduce loss on every epoch to the same value.
+        const size_t epochFinish = 12;
+        std::vector<float> loss0, loss1, loss2;
+        options.epochStart = 2;
+        options.epochFinish = epochFinish;
+        options.threadNumber = threadNumber;
+        net2.Train(sample.src, sample.dst, options, LossLogger(&net2, &sample, &loss2));
+        options.propagateType = TrainOptions::PerSample;
+        net1.Train(sample.src, sample.dst, options, LossLogger(&net1, &sample, &loss1));
+        options.propagateType = TrainOptions::MiniBatch;
+        options.epochStart = 1;
+        options.threadNumber = 1;
+        net0.Train(sample.src, sample.dst, options, LossLogger(&net0, &sample, &loss0));
+        result = result && NeuralTrainMiniBatchCompare(net2, net0, 0.0f, "Mini-batch training in " + ToString(threadNumber) + " threads and in 1 thread");
+        result = result && NeuralTrainMiniBatchLoss(loss0, loss0.front(), 0.2f, "Mini-batch training");
+        result = result && NeuralTrainMiniBatchLoss(loss1, loss0.front(), 0.2f, "Per-sample training");
+        if (result && ::fabs(loss1.back() - loss2.back()) > 0.001f * loss2.back())
+        {
+            TEST_LOG_SS(Error, "Losses of per-sample and mini-batch training are different: " << loss1.back() << " != " << loss2.back() << " !");
+            result = false;
+        }
+        TEST_LOG_SS(Info, "Loss of mini-batch training: " << loss0.front() << " -> " << loss0.back() << ", of per-sample training: " << loss1.front() << " -> " << loss1.back() << ".");
+
+        return result;
+    }
+
+    bool NeuralTrainMiniBatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && NeuralTrainMiniBatchAutoTest(32, 1);
+        result = result && NeuralTrainMiniBatchAutoTest(13, 1);
+        result = result && NeuralTrainMiniBatchAutoTest(32, 4);
+
+        return result;
+    }
 }
 
@@ -0,0 +1,203 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncNv12A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncNv12A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(function) FuncNv12(function, #function)
+#define FUNC_NV12A(function) FuncNv12A(function, #function)
+
+    template<class Func> bool Nv12ToAnyAutoTest(int width, int height, View::Format dstType, SimdYuvType yuvType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / 2;
+        const int uvHeight = height / 2;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(uv);
+        uint8_t alpha = Random(256);
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    template<class Func> bool Nv12ToAnyAutoTest(View::Format dstType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(W, H, dstType, SimdYuvBt601, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W + O * 2, H - O * 2, dstType, SimdYuvBt709, f1, f2);
+        result = result && Nv12ToAnyAutoTest(W - O * 2, H + O * 2, dstType, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_NV12(Simd::Base::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_NV12(Simd::Sse41::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_NV12(Simd::Avx2::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgr24, FUNC_NV12(Simd::Avx512bw::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_NV12A(Simd::Base::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_NV12A(Simd::Sse41::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_NV12A(Simd::Avx2::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Bgra32, FUNC_NV12A(Simd::Avx512bw::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Rgb24, FUNC_NV12(Simd::Base::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Rgb24, FUNC_NV12(Simd::Sse41::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Rgb24, FUNC_NV12(Simd::Avx2::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Rgb24, FUNC_NV12(Simd::Avx512bw::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToAnyAutoTest(View::Rgba32, FUNC_NV12A(Simd::Base::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DA)
+            result = result && Nv12ToAnyAutoTest(View::Rgba32, FUNC_NV12A(Simd::Sse41::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && Nv12ToAnyAutoTest(View::Rgba32, FUNC_NV12A(Simd::Avx2::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToAnyAutoTest(View::Rgba32, FUNC_NV12A(Simd::Avx512bw::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+        return result;
+    }
+}
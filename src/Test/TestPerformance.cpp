@@ -419,11 +419,11 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        size_t size = 0, rels = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
             if (enable[i])
-                size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+                size++, rels += i > 1 ? 1 : 0;
+        TablePtr table(new Table(1 + size * (align ? 2 : 1) + (enable[1] ? rels * 2 : 0), 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -504,7 +504,7 @@ namespace Test
             for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
                 report << it->second->Statistic() << std::endl;
         }
-        else
+        else if (!_map.empty())
         {
             report << GenerateTable(align)->GenerateText();
         }
@@ -523,7 +523,8 @@ namespace Test
 
         file << TestInfo(_map.size()) << std::endl << std::endl;
 
-        file << GenerateTable(align)->GenerateText();
+        if (!_map.empty())
+            file << GenerateTable(align)->GenerateText();
 
         file.close();
 
@@ -547,7 +548,8 @@ namespace Test
 
         html.WriteValue("h4", Html::Attr(), TestInfo(_map.size()), true);
 
-        html.WriteText(GenerateTable(align)->GenerateHtml(html.Indent()), false, false);
+        if (!_map.empty())
+            html.WriteText(GenerateTable(align)->GenerateHtml(html.Indent()), false, false);
 
         html.WriteEnd("body", true, true);
         html.WriteEnd("html", true, true);
@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdLib.hpp"
+
 namespace Test
 {
     namespace
@@ -370,4 +372,83 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+
+        String PyramidDesc(const String & name, const Pyramid & pyramid, ::SimdReduceType reduceType)
+        {
+            std::stringstream ss;
+            ss << name << "[" << pyramid[0].width << "x" << pyramid[0].height << "x" << pyramid.Size() << "-" << (reduceType + 2) << "x" << (reduceType + 2) << "]";
+            return ss.str();
+        }
+
+        void PyramidBuild(Pyramid & pyramid, ::SimdReduceType reduceType)
+        {
+            TEST_PERFORMANCE_TEST(PyramidDesc("SimdBuild(sequential)", pyramid, reduceType));
+            Simd::Build(pyramid, reduceType);
+        }
+
+        void PyramidBuildChanged(Pyramid & pyramid, const std::vector<Rect> & changed, ::SimdReduceType reduceType, size_t threadNumber)
+        {
+            TEST_PERFORMANCE_TEST(PyramidDesc("SimdBuild(changed)", pyramid, reduceType));
+            Simd::Build(pyramid, changed, reduceType, true, threadNumber);
+        }
+    }
+
+    bool PyramidBuildAutoTest(int width, int height, size_t levelCount, ::SimdReduceType reduceType, size_t threadNumber)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test incremental Simd::Build(Pyramid) for SimdReduce" << (reduceType + 2) << "x" << (reduceType + 2) 
+            << " [" << width << ", " << height << "] in " << threadNumber << " threads.");
+
+        Pyramid p1(width, height, levelCount), p2(width, height, levelCount);
+        FillRandom(p1[0]);
+        Simd::Copy(p1[0], p2[0]);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        Simd::Build(p1, reduceType);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(PyramidBuild(p2, reduceType));
+
+        std::vector<Rect> changed;
+        for (int i = 0; i < 5; ++i)
+        {
+            ptrdiff_t w = 1 + Random(width / 8), h = 1 + Random(height / 8);
+            ptrdiff_t x = Random(int(width - w + 1)), y = Random(int(height - h + 1));
+            changed.push_back(Rect(x, y, x + w, y + h));
+            FillRandom(p1[0].Region(changed.back()).Ref());
+            Simd::Copy(p1[0].Region(changed.back()), p2[0].Region(changed.back()).Ref());
+        }
+        changed.push_back(Rect(width - 3, height - 3, width + 5, height + 5));
+        FillRandom(p1[0].Region(changed.back()).Ref());
+        Simd::Copy(p1[0].Region(changed.back()), p2[0].Region(changed.back()).Ref());
+
+        Simd::Build(p1, reduceType);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(PyramidBuildChanged(p2, changed, reduceType, threadNumber));
+
+        for (size_t level = 1; level < levelCount && result; ++level)
+            result = result && Compare(p1[level], p2[level], 0, true, 64, 0, "level " + ToString(level));
+
+        return result;
+    }
+
+    bool PyramidBuildAutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdReduce2x2; type <= SimdReduce5x5; ++type)
+        {
+            result = result && PyramidBuildAutoTest(W, H, 4, (::SimdReduceType)type, 1);
+            result = result && PyramidBuildAutoTest(W + O, H - O, 5, (::SimdReduceType)type, 4);
+        }
+
+        return result;
+    }
 }
@@ -805,6 +805,84 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncGL
+        {
+            typedef void(*FuncPtr)(const float* src, size_t size, float* dst);
+
+            FuncPtr func;
+            String description;
+
+            FuncGL(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& src, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)src.data, src.width, (float*)dst.data);
+            }
+        };
+    }
+#define FUNC_GL(function) FuncGL(function, #function)
+
+    bool SynetGelu32fAutoTest(int size, const FuncGL& f1, const FuncGL& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << "].");
+
+        View src(size, 1, View::Float, NULL, TEST_ALIGN(size));
+        const float lo = -10.0f, hi = 10.0f;
+        FillRandom32f(src, lo, hi);
+
+        View dst1(size, 1, View::Float, NULL, TEST_ALIGN(size));
+        View dst2(size, 1, View::Float, NULL, TEST_ALIGN(size));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = Compare(dst1, dst2, EPS, true, 32, false);
+
+        return result;
+    }
+
+    bool SynetGelu32fAutoTest(const FuncGL& f1, const FuncGL& f2)
+    {
+        bool result = true;
+
+        result = result && SynetGelu32fAutoTest(W * H, f1, f2);
+        result = result && SynetGelu32fAutoTest(W * H + O, f1, f2);
+
+        return result;
+    }
+
+    bool SynetGelu32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGelu32fAutoTest(FUNC_GL(Simd::Base::SynetGelu32f), FUNC_GL(SimdSynetGelu32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_GL(Simd::Sse41::SynetGelu32f), FUNC_GL(SimdSynetGelu32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_GL(Simd::Avx2::SynetGelu32f), FUNC_GL(SimdSynetGelu32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetGelu32fAutoTest(FUNC_GL(Simd::Avx512bw::SynetGelu32f), FUNC_GL(SimdSynetGelu32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncSP
@@ -0,0 +1,204 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetAttention32f.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncAtt32f
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t heads, size_t seqQ, size_t seqK, size_t depth, float scale, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String desc;
+
+            FuncAtt32f(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t h, size_t q, size_t k, size_t d, bool m, SimdSynetCompatibilityType c)
+            {
+                desc = desc + "[" + ToString(b) + "x" + ToString(h) + "x" + ToString(q) + "x" + ToString(k) + "x" + ToString(d) + 
+                    (m ? "-m" : "") + (Simd::Base::Bf16Soft(c) ? "-b" : "-f") + "]";
+            }
+
+            void Call(void* context, const Tensor32f& q, const Tensor32f& k, const Tensor32f& v, const float * mask, Tensor32f& buf, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetAttention32fForward(context, q.Data(), k.Data(), v.Data(), mask, buf.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_ATT32F(function) \
+    FuncAtt32f(function, std::string(#function))
+
+    bool SynetAttention32fForwardAutoTest(float eps, size_t b, size_t h, size_t q, size_t k, size_t d, bool m, SimdSynetCompatibilityType c, FuncAtt32f f1, FuncAtt32f f2)
+    {
+        bool result = true;
+
+        f1.Update(b, h, q, k, d, m, c);
+        f2.Update(b, h, q, k, d, m, c);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f query({ b, h, q, d });
+        FillRandom(query.Data(), query.Size(), -1.0, 1.0f);
+
+        Tensor32f key({ b, h, k, d });
+        FillRandom(key.Data(), key.Size(), -1.0, 1.0f);
+
+        Tensor32f value({ b, h, k, d });
+        FillRandom(value.Data(), value.Size(), -1.0, 1.0f);
+
+        Tensor32f mask({ q, k });
+        for (size_t i = 0; i < q; ++i)
+            for (size_t j = 0; j < k; ++j)
+                mask.Data()[i * k + j] = j * q > i * k ? -10000.0f : 0.0f;
+
+        float scale = 1.0f / ::sqrt(float(d));
+
+        void* context1 = f1.func(b, h, q, k, d, scale, c);
+        void* context2 = f2.func(b, h, q, k, d, scale, c);
+
+        Tensor32f buf1({ ::SimdSynetAttention32fExternalBufferSize(context1) });
+        Tensor32f buf2({ ::SimdSynetAttention32fExternalBufferSize(context2) });
+
+        Tensor32f dst1({ b, h, q, d });
+        Tensor32f dst2({ b, h, q, d });
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, query, key, value, m ? mask.Data() : NULL, buf1, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, query, key, value, m ? mask.Data() : NULL, buf2, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetAttention32fBf16AutoTest(float eps, size_t b, size_t h, size_t q, size_t k, size_t d, bool m, FuncAtt32f f)
+    {
+        bool result = true;
+
+        f.Update(b, h, q, k, d, m, SimdSynetCompatibility16bfSoft);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " against FP32 reference.");
+
+        Tensor32f query({ b, h, q, d }), key({ b, h, k, d }), value({ b, h, k, d }), mask({ q, k });
+        FillRandom(query.Data(), query.Size(), -1.0, 1.0f);
+        FillRandom(key.Data(), key.Size(), -1.0, 1.0f);
+        FillRandom(value.Data(), value.Size(), -1.0, 1.0f);
+        for (size_t i = 0; i < q; ++i)
+            for (size_t j = 0; j < k; ++j)
+                mask.Data()[i * k + j] = j * q > i * k ? -10000.0f : 0.0f;
+
+        float scale = 1.0f / ::sqrt(float(d));
+
+        void* context1 = f.func(b, h, q, k, d, scale, SimdSynetCompatibility16bfSoft);
+        void* context2 = Simd::Base::SynetAttention32fInit(b, h, q, k, d, scale, SimdSynetCompatibilityDefault);
+
+        Tensor32f dst1({ b, h, q, d }), dst2({ b, h, q, d });
+
+        ::SimdSynetAttention32fForward(context1, query.Data(), key.Data(), value.Data(), m ? mask.Data() : NULL, NULL, dst1.Data());
+        ::SimdSynetAttention32fForward(context2, query.Data(), key.Data(), value.Data(), m ? mask.Data() : NULL, NULL, dst2.Data());
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceAbsolute, "bf16 vs fp32");
+
+        return result;
+    }
+
+    bool SynetAttention32fForwardAutoTest(float eps, const FuncAtt32f& f1, const FuncAtt32f& f2)
+    {
+        bool result = true;
+
+        SimdSynetCompatibilityType f32 = SimdSynetCompatibilityDefault, b16 = SimdSynetCompatibility16bfSoft;
+
+#if defined(NDEBUG)
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 8, 197, 197, 64, false, f32, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 8, 197, 197, 64, false, b16, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 2, 12, 128, 128, 64, true, f32, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 2, 12, 128, 128, 64, true, b16, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 4, 1, 1000, 80, true, f32, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 2, 77, 257, 40, true, f32, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 2, 77, 257, 40, false, b16, f1, f2);
+#else
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 2, 17, 33, 20, true, f32, f1, f2);
+        result = result && SynetAttention32fForwardAutoTest(eps, 1, 2, 17, 33, 20, false, b16, f1, f2);
+#endif
+
+        //BF16 keeps 8 significant bits of queries, keys, values and attention weights, so the outputs 
+        //(weighted means of values in [-1, 1]) are compared with FP32 reference at absolute tolerance 0.01.
+        const float bf16 = 0.01f;
+        result = result && SynetAttention32fBf16AutoTest(bf16, 1, 4, 65, 129, 64, true, f1);
+        result = result && SynetAttention32fBf16AutoTest(bf16, 1, 2, 17, 33, 20, false, f1);
+
+        return result;
+    }
+
+    bool SynetAttention32fForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetAttention32fForwardAutoTest(EPS, FUNC_ATT32F(Simd::Base::SynetAttention32fInit), FUNC_ATT32F(SimdSynetAttention32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetAttention32fForwardAutoTest(EPS, FUNC_ATT32F(Simd::Sse41::SynetAttention32fInit), FUNC_ATT32F(SimdSynetAttention32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetAttention32fForwardAutoTest(EPS, FUNC_ATT32F(Simd::Avx2::SynetAttention32fInit), FUNC_ATT32F(SimdSynetAttention32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetAttention32fForwardAutoTest(EPS, FUNC_ATT32F(Simd::Avx512bw::SynetAttention32fInit), FUNC_ATT32F(SimdSynetAttention32fInit));
+#endif
+
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetAttention32fForwardAutoTest(EPS, FUNC_ATT32F(Simd::Avx512bf16::SynetAttention32fInit), FUNC_ATT32F(SimdSynetAttention32fInit));
+#endif
+
+        return result;
+    }
+#endif
+}
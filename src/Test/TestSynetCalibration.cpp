@@ -0,0 +1,176 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetCalibration32f.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncCal32f
+        {
+            typedef void* (*FuncPtr)(size_t channels, size_t bins, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncCal32f(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t c, size_t s, size_t h, SimdTensorFormatType f)
+            {
+                desc = desc + "[" + ToString(b) + "x" + ToString(c) + "x" + ToString(s) + "-" + ToString(h) + "-" + ToString(f) + "]";
+            }
+
+            void Call(void* context, const Tensor32f& src, size_t batch, size_t spatial) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetCalibration32fUpdate(context, src.Data(), batch, spatial);
+            }
+        };
+    }
+
+#define FUNC_CAL32F(function) \
+    FuncCal32f(function, std::string(#function))
+
+    bool SynetCalibration32fAutoTest(float eps, size_t b, size_t c, size_t s, size_t h, SimdTensorFormatType f, FuncCal32f f1, FuncCal32f f2)
+    {
+        bool result = true;
+
+        f1.Update(b, c, s, h, f);
+        f2.Update(b, c, s, h, f);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        void* context1 = f1.func(c, h, f);
+        void* context2 = f2.func(c, h, f);
+
+        Tensor32f src(f == SimdTensorFormatNchw ? Shp(b, c, s) : Shp(b, s, c));
+        Tensor32f min0(Shp(c)), max0(Shp(c));
+        for (size_t i = 0; i < c; ++i)
+        {
+            min0.Data()[i] = FLT_MAX;
+            max0.Data()[i] = -FLT_MAX;
+        }
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            float range = float(k + 1) * 2.0f;
+            FillRandom(src.Data(), src.Size(), -range, range);
+            for (size_t n = 0; n < b; ++n)
+            {
+                for (size_t i = 0; i < c; ++i)
+                {
+                    for (size_t j = 0; j < s; ++j)
+                    {
+                        float& value = f == SimdTensorFormatNchw ? src.Data()[(n * c + i) * s + j] : src.Data()[(n * s + j) * c + i];
+                        if (i % 3 == 0)
+                            value = Simd::Max(value, 0.0f);
+                        value *= float(i % 7 + 1) / 7.0f;
+                        min0.Data()[i] = Simd::Min(min0.Data()[i], value);
+                        max0.Data()[i] = Simd::Max(max0.Data()[i], value);
+                    }
+                }
+            }
+
+            TEST_ALIGN(SIMD_ALIGN);
+
+            f1.Call(context1, src, b, s);
+
+            f2.Call(context2, src, b, s);
+        }
+
+        Tensor32f min1(Shp(c)), max1(Shp(c)), min2(Shp(c)), max2(Shp(c));
+
+        ::SimdSynetCalibration32fGetStats(context1, SimdSynetCalibrationMinMax, 0.0f, min1.Data(), max1.Data());
+        result = result && Compare(min0, min1, eps, true, 64, DifferenceBoth, "min");
+        result = result && Compare(max0, max1, eps, true, 64, DifferenceBoth, "max");
+
+        const SimdSynetCalibrationType types[3] = { SimdSynetCalibrationMinMax, SimdSynetCalibrationPercentile, SimdSynetCalibrationEntropy };
+        const float params[3] = { 0.0f, 99.9f, 128.0f };
+        for (size_t t = 0; t < 3 && result; ++t)
+        {
+            ::SimdSynetCalibration32fGetStats(context1, types[t], params[t], min1.Data(), max1.Data());
+            ::SimdSynetCalibration32fGetStats(context2, types[t], params[t], min2.Data(), max2.Data());
+            result = result && Compare(min1, min2, eps, true, 64, DifferenceBoth, "min" + ToString(t));
+            result = result && Compare(max1, max2, eps, true, 64, DifferenceBoth, "max" + ToString(t));
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetCalibration32fAutoTest(float eps, const FuncCal32f& f1, const FuncCal32f& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+
+#if defined(NDEBUG)
+        result = result && SynetCalibration32fAutoTest(eps, 2, 64, 56 * 56, 2048, nchw, f1, f2);
+        result = result && SynetCalibration32fAutoTest(eps, 2, 64, 56 * 56, 2048, nhwc, f1, f2);
+        result = result && SynetCalibration32fAutoTest(eps, 1, 35, 17 * 19, 1024, nchw, f1, f2);
+        result = result && SynetCalibration32fAutoTest(eps, 1, 35, 17 * 19, 1024, nhwc, f1, f2);
+#else
+        result = result && SynetCalibration32fAutoTest(eps, 1, 19, 9 * 11, 256, nchw, f1, f2);
+        result = result && SynetCalibration32fAutoTest(eps, 1, 19, 9 * 11, 256, nhwc, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetCalibration32fAutoTest()
+    {
+        const float EPS = 0.000001f;
+        bool result = true;
+
+        result = result && SynetCalibration32fAutoTest(EPS, FUNC_CAL32F(Simd::Base::SynetCalibration32fInit), FUNC_CAL32F(SimdSynetCalibration32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetCalibration32fAutoTest(EPS, FUNC_CAL32F(Simd::Sse41::SynetCalibration32fInit), FUNC_CAL32F(SimdSynetCalibration32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetCalibration32fAutoTest(EPS, FUNC_CAL32F(Simd::Avx2::SynetCalibration32fInit), FUNC_CAL32F(SimdSynetCalibration32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetCalibration32fAutoTest(EPS, FUNC_CAL32F(Simd::Avx512bw::SynetCalibration32fInit), FUNC_CAL32F(SimdSynetCalibration32fInit));
+#endif
+
+        return result;
+    }
+#endif
+}
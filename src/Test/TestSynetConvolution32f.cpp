@@ -661,5 +661,477 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fExportAutoTest(const Param & p, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " export/import.");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f dst0({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        Tensor32f dst1(dst0.Shape()), dst2(dst0.Shape());
+
+        void * context0 = f.func(p.batch, &p.conv, comp);
+        void * context1 = f.func(p.batch, &p.conv, comp);
+        void * context2 = f.func(p.batch, &p.conv, comp);
+
+        ::SimdSynetConvolution32fSetParams(context0, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fForward(context0, src.Data(), NULL, dst0.Data());
+
+        size_t size = ::SimdSynetConvolution32fExport(context0, NULL, 0);
+        Tensor8u blob({ size });
+        if (::SimdSynetConvolution32fExport(context0, blob.Data(), blob.Size()) != size)
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution32fExport returns wrong size!");
+            result = false;
+        }
+        ::SimdRelease(context0);
+
+        Fill(weight, 0.0f);
+        Fill(bias, 0.0f);
+        Fill(params, 0.0f);
+
+        if (::SimdSynetConvolution32fImport(context1, blob.Data(), size - 1, SimdFalse))
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution32fImport accepts truncated blob!");
+            result = false;
+        }
+        if (!::SimdSynetConvolution32fImport(context1, blob.Data(), size, SimdFalse) || 
+            !::SimdSynetConvolution32fImport(context2, blob.Data(), size, SimdTrue))
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution32fImport can't import blob!");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+
+            result = result && Compare(dst0, dst1, 0.0f, true, 64, DifferenceAbsolute, "copy");
+            result = result && Compare(dst0, dst2, 0.0f, true, 64, DifferenceAbsolute, "attach");
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fExportAutoTest(const FuncC & f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), fp32, f);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), fp32, f);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aRr, t1), fp32, f);
+        result = result && SynetConvolution32fExportAutoTest(Param(2, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aRr, t1), fp32, f);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t1), bf16, f);
+        result = result && SynetConvolution32fExportAutoTest(Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t0), bf16, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Base::SynetConvolution32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Sse41::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Avx2::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Avx512bf16::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::AmxBf16::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fExportAutoTest(FUNC_C(Simd::Neon::SynetConvolution32fInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fPackedAutoTest(const Param & p1, const Param & p2, bool required, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p2, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " shared packed weights from [" << p1.batch << "x" << p1.conv.srcH << "x" << p1.conv.srcW << "].");
+
+        Tensor32f weight(p1.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ p1.conv.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ p1.conv.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f src(p2.SrcShape()), dst1(p2.DstShape()), dst2(p2.DstShape());
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        void * context0 = f.func(p1.batch, &p1.conv, comp);
+        ::SimdSynetConvolution32fSetParams(context0, weight.Data(), NULL, bias.Data(), params.Data());
+        void * packed = ::SimdSynetConvolution32fPackedInit(context0);
+        ::SimdRelease(context0);
+
+        void * context1 = f.func(p2.batch, &p2.conv, comp);
+        void * context2 = f.func(p2.batch, &p2.conv, comp);
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        SimdBool shared = ::SimdSynetConvolution32fSetPacked(context2, packed);
+        ::SimdRelease(packed);
+
+        if (shared)
+        {
+            ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+
+            result = result && Compare(dst1, dst2, 0.0f, true, 64, DifferenceAbsolute);
+        }
+        else if (required)
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution32fSetPacked can't attach packed weights!");
+            result = false;
+        }
+        else
+            TEST_LOG_SS(Info, "Packed weights have incompatible layout.");
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fPackedAutoTest(const FuncC & f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetConvolution32fPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), true, fp32, f);
+        result = result && SynetConvolution32fPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), Param(3, 35, 25, 30, 63, _3, _1, _1, _1, _1, 1, aPr, t1), false, fp32, f);
+        result = result && SynetConvolution32fPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), Param(2, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), false, fp32, f);
+        result = result && SynetConvolution32fPackedAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aRr, t1), Param(2, 64, 24, 20, 64, _3, _1, _2, _1, _1, 64, aRr, t1), false, fp32, f);
+        result = result && SynetConvolution32fPackedAutoTest(Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t1), Param(2, 32, 27, 15, 48, _3, _1, _2, _1, _1, 1, aPr, t1), false, bf16, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fPackedAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Base::SynetConvolution32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Sse41::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Avx2::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Avx512bf16::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::AmxBf16::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fPackedAutoTest(FUNC_C(Simd::Neon::SynetConvolution32fInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fReshapeAutoTest(const Param & p1, const Param & p2, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p2, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " reshape from [" << p1.batch << "x" << p1.conv.srcH << "x" << p1.conv.srcW << "].");
+
+        Tensor32f weight(p1.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ p1.conv.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ p1.conv.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f src1(p1.SrcShape()), dst11(p1.DstShape()), dst12(p1.DstShape());
+        FillRandom(src1.Data(), src1.Size(), -1.0, 1.0f);
+        Tensor32f src2(p2.SrcShape()), dst21(p2.DstShape()), dst22(p2.DstShape());
+        FillRandom(src2.Data(), src2.Size(), -1.0, 1.0f);
+
+        void * context0 = f.func(p1.batch, &p1.conv, comp);
+        void * context1 = f.func(p1.batch, &p1.conv, comp);
+        void * context2 = f.func(p2.batch, &p2.conv, comp);
+        ::SimdSynetConvolution32fSetParams(context0, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        if (::SimdSynetConvolution32fReshape(context0, p2.batch, p2.conv.srcH, p2.conv.srcW))
+        {
+            ::SimdSynetConvolution32fForward(context0, src2.Data(), NULL, dst21.Data());
+            ::SimdSynetConvolution32fForward(context2, src2.Data(), NULL, dst22.Data());
+            result = result && Compare(dst21, dst22, 0.0f, true, 64, DifferenceAbsolute, "reshaped");
+
+            if (!::SimdSynetConvolution32fReshape(context0, p1.batch, p1.conv.srcH, p1.conv.srcW))
+            {
+                TEST_LOG_SS(Error, "SimdSynetConvolution32fReshape can't restore original shape!");
+                result = false;
+            }
+            ::SimdSynetConvolution32fForward(context0, src1.Data(), NULL, dst11.Data());
+            ::SimdSynetConvolution32fForward(context1, src1.Data(), NULL, dst12.Data());
+            result = result && Compare(dst11, dst12, 0.0f, true, 64, DifferenceAbsolute, "restored");
+
+            if (!::SimdSynetConvolution32fReshape(context0, p2.batch, p2.conv.srcH, p2.conv.srcW))
+            {
+                TEST_LOG_SS(Error, "SimdSynetConvolution32fReshape can't reuse cached shape!");
+                result = false;
+            }
+            ::SimdSynetConvolution32fForward(context0, src2.Data(), NULL, dst21.Data());
+            result = result && Compare(dst21, dst22, 0.0f, true, 64, DifferenceAbsolute, "cached");
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution32fReshape can't reshape context!");
+            result = false;
+        }
+
+        ::SimdRelease(context0);
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fReshapeAutoTest(const FuncC & f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetConvolution32fReshapeAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), Param(3, 35, 25, 30, 63, _3, _1, _1, _1, _1, 1, aPr, t1), fp32, f);
+        result = result && SynetConvolution32fReshapeAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), Param(2, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), fp32, f);
+        result = result && SynetConvolution32fReshapeAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aRr, t1), Param(2, 64, 24, 20, 64, _3, _1, _2, _1, _1, 64, aRr, t1), fp32, f);
+        result = result && SynetConvolution32fReshapeAutoTest(Param(1, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aRe, t1), Param(1, 64, 32, 24, 48, _1, _1, _1, _0, _0, 1, aRe, t1), fp32, f);
+        result = result && SynetConvolution32fReshapeAutoTest(Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t1), Param(2, 32, 27, 15, 48, _3, _1, _2, _1, _1, 1, aPr, t1), bf16, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fReshapeAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fReshapeAutoTest(FUNC_C(SimdSynetConvolution32fInit));
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution32fForwardAddAutoTest(float eps, const Param & p, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " forward with residual addition.");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src({ p.batch, p.trans ? c.srcH : c.srcC, p.trans ? c.srcW : c.srcH, p.trans ? c.srcC : c.srcW });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ p.trans ? c.kernelY : c.dstC, p.trans ? c.kernelX : c.srcC / c.group,
+            p.trans ? c.srcC / c.group : c.kernelY, p.trans ? c.dstC : c.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f add({ p.batch, p.trans ? c.dstH : c.dstC, p.trans ? c.dstW : c.dstH, p.trans ? c.dstC : c.dstW });
+        FillRandom(add.Data(), add.Size(), -1.0, 1.0f);
+        Tensor32f dst1(add.Shape()), dst2(add.Shape());
+
+        Param i = p;
+        i.conv.activation = SimdConvolutionActivationIdentity;
+        void * context1 = f.func(p.batch, &i.conv, comp);
+        void * context2 = f.func(p.batch, &p.conv, comp);
+
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        ::SimdSynetConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+        for (size_t j = 0; j < dst1.Size(); ++j)
+            dst1.Data()[j] += add.Data()[j];
+        for (size_t b = 0, size = dst1.Size() / p.batch; b < p.batch; ++b)
+            Simd::Base::ConvolutionBiasAndActivation(NULL, c.dstC, c.dstH * c.dstW, c.activation, params.Data(), p.trans, dst1.Data() + b * size);
+
+        ::SimdSynetConvolution32fForwardAdd(context2, src.Data(), NULL, add.Data(), dst2.Data());
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardAddAutoTest(const FuncC & f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _7(7, 7);
+        const float e = EPS;
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu,
+            aGe = SimdConvolutionActivationGelu, aGt = SimdConvolutionActivationGeluTanh;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t0), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aRr, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(2, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aRe, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 64, 24, 24, 64, _3, _1, _1, _1, _1, 1, aRe, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 16, 18, 18, 16, _3, _1, _1, _1, _1, 1, aRe, t0), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 128, 7, 7, 128, _7, _1, _1, _0, _0, 128, aRr, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t1), bf16, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 64, 24, 24, 64, _3, _1, _1, _1, _1, 1, aGe, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aGe, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 16, 18, 18, 16, _3, _1, _1, _1, _1, 1, aGe, t0), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aGt, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aGt, t1), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 16, 18, 18, 16, _3, _1, _1, _1, _1, 1, aGt, t0), fp32, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aGe, t1), bf16, f);
+        result = result && SynetConvolution32fForwardAddAutoTest(e, Param(1, 32, 17, 19, 48, _3, _1, _2, _1, _1, 1, aPr, t0), bf16, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fForwardAddAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Sse41::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Avx::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Avx2::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Avx512bf16::SynetConvolution32fInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::AmxBf16::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fForwardAddAutoTest(FUNC_C(Simd::Neon::SynetConvolution32fInit));
+#endif
+
+        return result;
+    }
 #endif
 }
@@ -49,7 +49,7 @@ namespace Test
 
             void Update(const Param & p, SimdSynetCompatibilityType c)
             {
-                const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw" };
+                const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge", "-gt" };
                 std::stringstream extra;
                 extra << (p.conv.srcT == SimdTensorData32f ? "-f" : "-u");
                 extra << (p.conv.dstT == SimdTensorData32f ? "f" : "u");
@@ -182,7 +182,8 @@ namespace Test
         const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, 
             aLr = SimdConvolutionActivationLeakyRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu, 
             aEl = SimdConvolutionActivationElu, aHs = SimdConvolutionActivationHswish, aMi = SimdConvolutionActivationMish,
-            aHi = SimdConvolutionActivationHardSigmoid, aSw = SimdConvolutionActivationSwish;
+            aHi = SimdConvolutionActivationHardSigmoid, aSw = SimdConvolutionActivationSwish, aGe = SimdConvolutionActivationGelu,
+            aGt = SimdConvolutionActivationGeluTanh;
         //SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)((SimdCpuInfo(SimdCpuInfoAvx512vnni) ? SimdSynetCompatibilityFmaUse : SimdSynetCompatibility8iOverflow)  | SimdSynetCompatibilityFmaAvoid);
 
 #ifdef NDEBUG
@@ -239,6 +240,10 @@ namespace Test
         //result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 8, 32, 64, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
         //result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 63, 8, 32, 64, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
         result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 386, 50, 70, 76, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _1, _1, _1, _0, _0, 1, aGe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _1, _1, _1, 1, aGt, t1, u8, f32), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _1, _1, _1, 64, aGe, t1, u8, u8), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _2, _1, _1, 64, aGt, t1, f32, u8), 0, c, f1, f2);
 
         //result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 80, 100, 100, 80, _1, _1, _1, _0, _0, 1, aSw, t1, u8, u8), 0, c, f1, f2);
         //result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 8, 32, 64, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
@@ -249,6 +254,10 @@ namespace Test
 #else
         //result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 2000, 30, 30, 64, _1, _1, _1, _0, _0, 1, aRe, t1, f32, u8), 0, c, f1, f2);
         result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 386, 50, 70, 76, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _1, _1, _1, _0, _0, 1, aGe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _1, _1, _1, 1, aGt, t1, u8, f32), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _1, _1, _1, 64, aGe, t1, u8, u8), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _2, _1, _1, 64, aGt, t1, f32, u8), 0, c, f1, f2);
 #endif
 
         return result;
@@ -308,5 +317,428 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iExportAutoTest(Param p, int neg, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " export/import.");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Tensor32f src32f(p.SrcShape(), p.conv.srcF), dst32f0(p.DstShape(), p.conv.dstF), dst32f1(p.DstShape(), p.conv.dstF), dst32f2(p.DstShape(), p.conv.dstF), buf32f;
+        Tensor8u src8u(p.SrcShape(), p.conv.srcF), dst8u0(p.DstShape(), p.conv.dstF), dst8u1(p.DstShape(), p.conv.dstF), dst8u2(p.DstShape(), p.conv.dstF);
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), p.conv.srcC, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u);
+        FillDstStat(p, neg, comp, weight, bias, params, src32f, buf32f, dst32f0, dstMin.Data(), dstMax.Data(), NULL, NULL);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t * src = p.conv.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst0 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f0.Data() : dst8u0.Data();
+        uint8_t* dst1 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        void * context0 = f.func(p.batch, &p.conv, comp);
+        void * context1 = f.func(p.batch, &p.conv, comp);
+        void * context2 = f.func(p.batch, &p.conv, comp);
+
+        ::SimdSynetConvolution8iSetParams(context0, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iForward(context0, src, NULL, dst0);
+
+        size_t size = ::SimdSynetConvolution8iExport(context0, NULL, 0);
+        Tensor8u blob({ size });
+        if (::SimdSynetConvolution8iExport(context0, blob.Data(), blob.Size()) != size)
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution8iExport returns wrong size!");
+            result = false;
+        }
+        ::SimdRelease(context0);
+
+        if (::SimdSynetConvolution8iImport(context1, blob.Data(), size - 1, SimdFalse))
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution8iImport accepts truncated blob!");
+            result = false;
+        }
+        if (!::SimdSynetConvolution8iImport(context1, blob.Data(), size, SimdFalse) ||
+            !::SimdSynetConvolution8iImport(context2, blob.Data(), size, SimdTrue))
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution8iImport can't import blob!");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetConvolution8iForward(context1, src, NULL, dst1);
+            ::SimdSynetConvolution8iForward(context2, src, NULL, dst2);
+
+            if (p.conv.dstT == SimdTensorData32f)
+            {
+                result = result && Compare(dst32f0, dst32f1, 0.0f, true, 64, DifferenceAbsolute, "copy");
+                result = result && Compare(dst32f0, dst32f2, 0.0f, true, 64, DifferenceAbsolute, "attach");
+            }
+            else
+            {
+                result = result && Compare(dst8u0, dst8u1, 0, true, 64, "copy");
+                result = result && Compare(dst8u0, dst8u2, 0, true, 64, "attach");
+            }
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iExportAutoTest(const FuncC& f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaUse);
+
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), 0, c, f);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aRe, t1, u8, f32), 1, c, f);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aPr, t1, u8, u8), 1, c, f);
+        result = result && SynetConvolution8iExportAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aRe, t0, f32, f32), 0, c, f);
+
+        return result;
+    }
+
+    bool SynetConvolution8iExportAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Sse41::SynetConvolution8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Avx2::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Avx512vnni::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::AmxBf16::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution8iExportAutoTest(FUNC_C(Simd::Neon::SynetConvolution8iInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iPackedAutoTest(Param p1, Param p2, int neg, bool required, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        f.Update(p2, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.desc << " shared packed weights from [" << p1.batch << "x" << p1.conv.srcH << "x" << p1.conv.srcW << "].");
+
+        const SimdConvolutionParameters & c = p1.conv;
+
+        Tensor32f weight(p1.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC }), min2({ c.srcC }), max2({ c.srcC });
+        Tensor32f src32f0(p1.SrcShape(), c.srcF), dst32f0(p1.DstShape(), c.dstF), buf32f;
+        Tensor32f src32f(p2.SrcShape(), c.srcF), dst32f1(p2.DstShape(), c.dstF), dst32f2(p2.DstShape(), c.dstF);
+        Tensor8u src8u0(p1.SrcShape(), c.srcF), src8u(p2.SrcShape(), c.srcF), dst8u1(p2.DstShape(), c.dstF), dst8u2(p2.DstShape(), c.dstF);
+
+        FillRandom(src32f0, srcMin.Data(), srcMax.Data(), c.srcC, neg);
+        SetSrc32fTo8u(src32f0, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u0);
+        FillDstStat(p1, neg, comp, weight, bias, params, src32f0, buf32f, dst32f0, dstMin.Data(), dstMax.Data(), NULL, NULL);
+        FillRandom(src32f, min2.Data(), max2.Data(), c.srcC, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t * src = c.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst1 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = c.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        void * context0 = f.func(p1.batch, &p1.conv, comp);
+        ::SimdSynetConvolution8iSetParams(context0, weight.Data(), bias.Data(), params.Data(), stats);
+        void * packed = ::SimdSynetConvolution8iPackedInit(context0);
+        ::SimdRelease(context0);
+
+        void * context1 = f.func(p2.batch, &p2.conv, comp);
+        void * context2 = f.func(p2.batch, &p2.conv, comp);
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        SimdBool shared = ::SimdSynetConvolution8iSetPacked(context2, packed);
+        ::SimdRelease(packed);
+
+        if (shared)
+        {
+            ::SimdSynetConvolution8iForward(context1, src, NULL, dst1);
+            ::SimdSynetConvolution8iForward(context2, src, NULL, dst2);
+
+            if (c.dstT == SimdTensorData32f)
+                result = result && Compare(dst32f1, dst32f2, 0.0f, true, 64, DifferenceAbsolute);
+            else
+                result = result && Compare(dst8u1, dst8u2, 0, true, 64);
+        }
+        else if (required)
+        {
+            TEST_LOG_SS(Error, "SimdSynetConvolution8iSetPacked can't attach packed weights!");
+            result = false;
+        }
+        else
+            TEST_LOG_SS(Info, "Packed weights have incompatible layout.");
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iPackedAutoTest(const FuncC& f)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaUse);
+
+        result = result && SynetConvolution8iPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), 0, true, c, f);
+        result = result && SynetConvolution8iPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), Param(3, 35, 25, 30, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), 0, false, c, f);
+        result = result && SynetConvolution8iPackedAutoTest(Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aPr, t1, u8, u8), Param(2, 64, 24, 20, 64, _3, _1, _2, _1, _1, 64, aPr, t1, u8, u8), 1, false, c, f);
+        result = result && SynetConvolution8iPackedAutoTest(Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aRe, t0, f32, f32), Param(2, 35, 17, 21, 63, _3, _1, _1, _1, _1, 1, aRe, t0, f32, f32), 0, false, c, f);
+
+        return result;
+    }
+
+    bool SynetConvolution8iPackedAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Sse41::SynetConvolution8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Avx2::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Avx512vnni::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::AmxBf16::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution8iPackedAutoTest(FUNC_C(Simd::Neon::SynetConvolution8iInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetConvolution8iForwardAddAutoTest(float eps, Param p, int neg, int zero, SimdSynetCompatibilityType comp, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p, comp);
+        f2.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "] forward with residual addition" << (zero ? " and zero weight channel" : "") << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        if (zero)
+        {
+            size_t size = weight.Size() / c.dstC;
+            for (size_t i = 0; i < weight.Size(); ++i)
+                if ((c.srcF == SimdTensorFormatNhwc ? i % c.dstC : i / size) == 1)
+                    weight.Data()[i] = 0.0f;
+        }
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Tensor32f src32f(p.SrcShape(), p.conv.srcF), add32f(p.DstShape(), p.conv.dstF), dst32f0(p.DstShape(), p.conv.dstF), dst32f1(p.DstShape(), p.conv.dstF), dst32f2(p.DstShape(), p.conv.dstF), buf32f;
+        Tensor8u src8u(p.SrcShape(), p.conv.srcF), add8u(p.DstShape(), p.conv.dstF), dst8u0(p.DstShape(), p.conv.dstF), dst8u1(p.DstShape(), p.conv.dstF), dst8u2(p.DstShape(), p.conv.dstF);
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), p.conv.srcC, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u);
+        FillDstStat(p, neg, comp, weight, bias, params, src32f, buf32f, dst32f0, dstMin.Data(), dstMax.Data(), NULL, NULL);
+        FillRandom(add32f.Data(), add32f.Size(), -1.0, 1.0f);
+        FillRandom(add8u);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t * src = p.conv.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        const uint8_t* add = p.conv.dstT == SimdTensorData32f ? (uint8_t*)add32f.Data() : add8u.Data();
+        uint8_t* dst0 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f0.Data() : dst8u0.Data();
+        uint8_t* dst1 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        void * context1 = f1.func(p.batch, &p.conv, comp);
+        void * context2 = f2.func(p.batch, &p.conv, comp);
+
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        ::SimdSynetConvolution8iForward(context1, src, NULL, dst0);
+        ::SimdSynetConvolution8iForwardAdd(context1, src, NULL, add, NULL, NULL, dst1);
+        ::SimdSynetConvolution8iForwardAdd(context2, src, NULL, add, NULL, NULL, dst2);
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+#if defined(SIMD_X64_ENABLE) || defined(SIMD_X86_ENABLE)
+        int differenceMax = (Simd::Base::FmaAvoid(comp) ? 0 : 1);
+#else
+        int differenceMax = 1;
+#endif
+
+        if (p.conv.dstT == SimdTensorData32f)
+        {
+            if (p.conv.activation == SimdConvolutionActivationIdentity)
+            {
+                for (size_t i = 0; i < dst32f0.Size(); ++i)
+                    dst32f0.Data()[i] += add32f.Data()[i];
+                result = result && Compare(dst32f0, dst32f1, eps, true, 64, DifferenceBoth, "reference");
+            }
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        }
+        else
+            result = result && Compare(dst8u1, dst8u2, differenceMax, true, 64);
+
+        return result;
+    }
+
+    bool SynetConvolution8iForwardAddAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const float e = EPS;
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaUse);
+
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), 0, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aId, t1, u8, f32), 1, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 256, 16, 16, 48, _1, _1, _1, _0, _0, 1, aRe, t1, u8, u8), 1, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _2, _1, _1, 64, aPr, t1, u8, u8), 1, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _1, _1, _1, 64, aId, t1, u8, f32), 1, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aId, t0, f32, f32), 0, 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 48, _1, _1, _1, _0, _0, 1, aId, t1, u8, f32), 1, 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 35, 15, 20, 63, _3, _1, _1, _1, _1, 1, aPr, t1, f32, u8), 0, 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _1, _1, _1, 64, aRe, t1, u8, u8), 1, 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAddAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _1, _1, _1, 64, aId, t1, u8, f32), 1, 1, c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iForwardAddAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Base::SynetConvolution8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Sse41::SynetConvolution8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Avx2::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Avx512bw::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Avx512vnni::SynetConvolution8iInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::AmxBf16::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution8iForwardAddAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit), FUNC_C(Simd::Neon::SynetConvolution8iInit));
+#endif 
+
+        return result;
+    }
 #endif
 }
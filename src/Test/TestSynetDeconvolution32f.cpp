@@ -28,6 +28,7 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdSynetDeconvolution32f.h"
+#include "Simd/SimdSynet.h"
 
 namespace Test
 {
@@ -45,14 +46,14 @@ namespace Test
 
             FuncD(const FuncPtr & f, const String & d) : func(f), description(d) {}
 
-            void Update(const Param & p)
+            void Update(const Param & p, SimdSynetCompatibilityType c)
             {
-                description = description + p.Decription();
+                description = description + p.Decription(Simd::Base::Bf16Soft(c) ? "-bf16" : "-fp32");
             }
 
-            void Call(const Param & p, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
+            void Call(const Param & p, SimdSynetCompatibilityType c, const Tensor32f & weight, const Tensor32f & bias, const Tensor32f & params, const Tensor32f & src, Tensor32f & buf, Tensor32f & dst) const
             {
-                void * context = func(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+                void * context = func(p.batch, &p.conv, c);
                 buf.Extend({ ::SimdSynetDeconvolution32fExternalBufferSize(context) });
                 ::SimdSynetDeconvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
                 {
@@ -67,13 +68,12 @@ namespace Test
 #define FUNC_D(function) \
     FuncD(function, std::string(#function))
 
-    bool SynetDeconvolution32fForwardAutoTest(float eps, const Param & p, FuncD f1, FuncD f2)
+    bool SynetDeconvolution32fForwardAutoTest(float eps, const Param & p, SimdSynetCompatibilityType comp1, FuncD f1, SimdSynetCompatibilityType comp2, FuncD f2)
     {
         bool result = true;
 
-
-        f1.Update(p);
-        f2.Update(p);
+        f1.Update(p, comp1);
+        f2.Update(p, comp2);
 
         TEST_LOG_SS(Info, "Test [" << f1.description << " & " << f2.description << "].");
 
@@ -118,16 +118,23 @@ namespace Test
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, weight, bias, params, src, buf, dst1));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, comp1, weight, bias, params, src, buf, dst1));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, weight, bias, params, src, buf, dst2));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, comp2, weight, bias, params, src, buf, dst2));
 
         result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
 
         return result;
     }
 
-    bool SynetDeconvolution32fForwardAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, const FuncD & f1, const FuncD & f2)
+    bool SynetDeconvolution32fForwardAutoTest(float eps, const Param & p, SimdSynetCompatibilityType comp, FuncD f1, FuncD f2)
+    {
+        if (Simd::Base::Bf16Soft(comp))
+            return SynetDeconvolution32fForwardAutoTest(eps, p, comp, f1, SimdSynetCompatibilityDefault, FUNC_D(Simd::Base::SynetDeconvolution32fInit));
+        return SynetDeconvolution32fForwardAutoTest(eps, p, comp, f1, comp, f2);
+    }
+
+    bool SynetDeconvolution32fForwardAutoTest(float eps, ::SimdConvolutionActivationType a, ::SimdBool t, SimdSynetCompatibilityType c, const FuncD & f1, const FuncD & f2)
     {
         bool result = true;
 
@@ -135,16 +142,16 @@ namespace Test
 
 #ifdef NDEBUG
 #if 0
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 11, 20, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 44, 80, 24, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 32, 44, 80, 30, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 11, 20, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 24, 44, 80, 24, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 32, 44, 80, 30, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
 #if 1
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 512, 44, 80, 512, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
 #else
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 256, 22, 40, 256, _2, _1, _2, _0, _0, 1, a, t), f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, Param(1, 256, 22, 40, 256, _2, _1, _2, _0, _0, 1, a, t), c, f1, f2);
 #endif
         return result;
     }
@@ -153,16 +160,23 @@ namespace Test
     {
         bool result = true;
 
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationIdentity, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationLeakyRelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationElu, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHswish, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationMish, ::SimdTrue, f1, f2);
-        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHardSigmoid, ::SimdTrue, f1, f2);
-        result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationSwish, ::SimdTrue, f1, f2);
+        SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault;
+        SimdSynetCompatibilityType bf16 = SimdSynetCompatibility16bfSoft;
+
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationIdentity, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationLeakyRelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationRestrictRange, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationPrelu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationElu, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHswish, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationMish, ::SimdTrue, fp32, f1, f2);
+        //result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationHardSigmoid, ::SimdTrue, fp32, f1, f2);
+        result = result && SynetDeconvolution32fForwardAutoTest(eps, ::SimdConvolutionActivationSwish, ::SimdTrue, fp32, f1, f2);
+        //BF16 mode rounds source and weights to 8 significant bits, so it is compared with FP32 Base reference.
+        //Rounding errors grow as square root of input channels: for 512 channels they reach 4% of output values of order 1,
+        //so tolerance is 6% (an error is reported only if both absolute and relative differences exceed it).
+        result = result && SynetDeconvolution32fForwardAutoTest(0.06f, ::SimdConvolutionActivationSwish, ::SimdTrue, bf16, f1, f2);
 
         return result;
     }
@@ -193,6 +207,11 @@ namespace Test
             result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Avx512bw::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
 #endif
 
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::AmxBf16::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
+#endif
+
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable)
             result = result && SynetDeconvolution32fForwardAutoTest(EPS, FUNC_D(Simd::Neon::SynetDeconvolution32fInit), FUNC_D(SimdSynetDeconvolution32fInit));
@@ -200,5 +219,86 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetDeconvolution32fReshapeAutoTest(const Param & p1, const Param & p2, SimdSynetCompatibilityType comp, FuncD f)
+    {
+        bool result = true;
+
+        f.Update(p2, comp);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " reshape from [" << p1.batch << "x" << p1.conv.srcH << "x" << p1.conv.srcW << "].");
+
+        const SimdConvolutionParameters & c1 = p1.conv, & c2 = p2.conv;
+        Tensor32f weight({ c1.srcC, p1.trans ? c1.kernelY : c1.dstC / c1.group, p1.trans ? c1.kernelX : c1.kernelY, p1.trans ? c1.dstC / c1.group : c1.kernelX });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c1.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c1.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+        params.Data()[0] = 0.1f;
+        params.Data()[1] = 1.1f;
+
+        Tensor32f src1({ p1.batch, p1.trans ? c1.srcH : c1.srcC, p1.trans ? c1.srcW : c1.srcH, p1.trans ? c1.srcC : c1.srcW });
+        FillRandom(src1.Data(), src1.Size(), -1.0, 1.0f);
+        Tensor32f dst11({ p1.batch, p1.trans ? c1.dstH : c1.dstC, p1.trans ? c1.dstW : c1.dstH, p1.trans ? c1.dstC : c1.dstW }), dst12(dst11.Shape());
+        Tensor32f src2({ p2.batch, p2.trans ? c2.srcH : c2.srcC, p2.trans ? c2.srcW : c2.srcH, p2.trans ? c2.srcC : c2.srcW });
+        FillRandom(src2.Data(), src2.Size(), -1.0, 1.0f);
+        Tensor32f dst21({ p2.batch, p2.trans ? c2.dstH : c2.dstC, p2.trans ? c2.dstW : c2.dstH, p2.trans ? c2.dstC : c2.dstW }), dst22(dst21.Shape());
+
+        void * context0 = f.func(p1.batch, &c1, comp);
+        void * context1 = f.func(p1.batch, &c1, comp);
+        void * context2 = f.func(p2.batch, &c2, comp);
+        ::SimdSynetDeconvolution32fSetParams(context0, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetDeconvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetDeconvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        if (::SimdSynetDeconvolution32fReshape(context0, p2.batch, c2.srcH, c2.srcW))
+        {
+            ::SimdSynetDeconvolution32fForward(context0, src2.Data(), NULL, dst21.Data());
+            ::SimdSynetDeconvolution32fForward(context2, src2.Data(), NULL, dst22.Data());
+            result = result && Compare(dst21, dst22, 0.0f, true, 64, DifferenceAbsolute, "reshaped");
+
+            if (!::SimdSynetDeconvolution32fReshape(context0, p1.batch, c1.srcH, c1.srcW))
+            {
+                TEST_LOG_SS(Error, "SimdSynetDeconvolution32fReshape can't restore original shape!");
+                result = false;
+            }
+            ::SimdSynetDeconvolution32fForward(context0, src1.Data(), NULL, dst11.Data());
+            ::SimdSynetDeconvolution32fForward(context1, src1.Data(), NULL, dst12.Data());
+            result = result && Compare(dst11, dst12, 0.0f, true, 64, DifferenceAbsolute, "restored");
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "SimdSynetDeconvolution32fReshape can't reshape context!");
+            result = false;
+        }
+
+        ::SimdRelease(context0);
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetDeconvolution32fReshapeAutoTest()
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+        const FuncD f = FUNC_D(SimdSynetDeconvolution32fInit);
+
+        result = result && SynetDeconvolution32fReshapeAutoTest(Param(1, 24, 11, 20, 24, _2, _1, _2, _0, _0, 1, aPr, SimdTrue), Param(2, 24, 22, 40, 24, _2, _1, _2, _0, _0, 1, aPr, SimdTrue), fp32, f);
+        result = result && SynetDeconvolution32fReshapeAutoTest(Param(1, 32, 12, 14, 16, _3, _1, _2, _1, _1, 1, aRe, SimdTrue), Param(1, 32, 20, 18, 16, _3, _1, _2, _1, _1, 1, aRe, SimdTrue), fp32, f);
+        result = result && SynetDeconvolution32fReshapeAutoTest(Param(1, 16, 10, 12, 24, _2, _1, _2, _0, _0, 1, aRe, SimdFalse), Param(2, 16, 10, 12, 24, _2, _1, _2, _0, _0, 1, aRe, SimdFalse), fp32, f);
+        result = result && SynetDeconvolution32fReshapeAutoTest(Param(1, 64, 11, 20, 64, _2, _1, _2, _0, _0, 1, aPr, SimdTrue), Param(1, 64, 22, 16, 64, _2, _1, _2, _0, _0, 1, aPr, SimdTrue), bf16, f);
+
+        return result;
+    }
 #endif
 }
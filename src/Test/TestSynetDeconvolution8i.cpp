@@ -0,0 +1,239 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynetDeconvolution8i.h"
+#include "Simd/SimdSynet.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<true> Param;
+
+        struct FuncD
+        {
+            typedef void*(*FuncPtr)(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String desc;
+
+            FuncD(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(const Param & p, SimdSynetCompatibilityType c)
+            {
+                const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge", "-gt" };
+                std::stringstream extra;
+                extra << (p.conv.srcT == SimdTensorData32f ? "-f" : "-u");
+                extra << (p.conv.dstT == SimdTensorData32f ? "f" : "u");
+                extra << afs[p.conv.activation];
+                extra << (Simd::Base::Overflow(c) ? "-o" : Simd::Base::Narrowed(c) ? "-n" : "-p");
+                desc = desc + p.Decription(extra.str());
+            }
+
+            void Call(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetDeconvolution8iForward(context, src, buf, dst);
+            }
+        };
+    }
+
+#define FUNC_D(function) \
+    FuncD(function, std::string(#function))
+
+    static void FillDeconvDstStat(Param p, int neg, SimdSynetCompatibilityType comp, const Tensor32f& weight, const Tensor32f & bias, const Tensor32f& params,
+        const Tensor32f & src, Tensor32f& buf, Tensor32f & dst, float* dstMin, float* dstMax)
+    {
+        p.conv.srcT = SimdTensorData32f;
+        p.conv.dstT = SimdTensorData32f;
+        void * context = SimdSynetDeconvolution32fInit(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+        buf.Extend({ SimdSynetDeconvolution32fExternalBufferSize(context) });
+        SimdSynetDeconvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), params.Data());
+        SimdSynetDeconvolution32fForward(context, src.Data(), buf.Data(), dst.Data());
+        SimdRelease(context);
+        SetDstStat(p.conv.dstC, neg, comp, dst, dstMin, dstMax, NULL, NULL);
+    }
+
+    bool SynetDeconvolution8iForwardAutoTest(float eps, Param p, int neg, SimdSynetCompatibilityType comp, FuncD f1, FuncD f2)
+    {
+        bool result = true;
+
+        f1.Update(p, comp);
+        f2.Update(p, comp);
+
+        TEST_LOG_SS(Info, "Test [" << f1.desc << " & " << f2.desc << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        if (p.conv.activation == ::SimdConvolutionActivationHswish)
+        {
+            params.Data()[0] = 3.0f;
+            params.Data()[1] = 1.0f / 6.0f;
+        }
+        else if (p.conv.activation == ::SimdConvolutionActivationMish)
+            params.Data()[0] = 20.0f;
+        else if (p.conv.activation == ::SimdConvolutionActivationHardSigmoid)
+        {
+            params.Data()[0] = 1.0f / 6.0f;
+            params.Data()[1] = 0.5f;
+        }
+        else
+        {
+            params.Data()[0] = 0.1f;
+            params.Data()[1] = 1.1f;
+        }
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Tensor32f src32f(p.SrcShape(), p.conv.srcF), dst32f1(p.DstShape(), p.conv.dstF), dst32f2(p.DstShape(), p.conv.dstF), buf32f;
+        Tensor8u src8u(p.SrcShape(), p.conv.srcF), dst8u1(p.DstShape(), p.conv.dstF), dst8u2(p.DstShape(), p.conv.dstF), buf8u;
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), p.conv.srcC, neg);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), c.srcC, neg, comp, NULL, NULL, src8u);
+        FillDeconvDstStat(p, neg, comp, weight, bias, params, src32f, buf32f, dst32f1, dstMin.Data(), dstMax.Data());
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t * src = p.conv.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst1 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32f2, 1.1f);
+
+        Fill(dst8u1, uint8_t(1));
+        Fill(dst8u2, uint8_t(2));
+
+        void * context1 = f1.func(p.batch, &p.conv, comp);
+        void * context2 = f2.func(p.batch, &p.conv, comp);
+
+        buf8u.Extend({ ::SimdSynetDeconvolution8iExternalBufferSize(context1) });
+        buf8u.Extend({ ::SimdSynetDeconvolution8iExternalBufferSize(context2) });
+
+        ::SimdSynetDeconvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetDeconvolution8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf8u.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf8u.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (p.conv.dstT == SimdTensorData32f)
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst8u1, dst8u2, 1, true, 64);
+
+        return result;
+    }
+
+    bool SynetDeconvolution8iForwardAutoTest(const FuncD& f1, const FuncD& f2, SimdSynetCompatibilityType c)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _4(4, 4);
+        const float e = EPS;
+        const SimdBool t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+
+#ifdef NDEBUG
+        result = result && SynetDeconvolution8iForwardAutoTest(e, Param(1, 256, 22, 40, 128, _2, _1, _2, _0, _0, 1, aRe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetDeconvolution8iForwardAutoTest(e, Param(1, 128, 22, 40, 64, _4, _1, _2, _1, _1, 1, aPr, t1, f32, f32), 1, c, f1, f2);
+        result = result && SynetDeconvolution8iForwardAutoTest(e, Param(1, 64, 20, 20, 32, _3, _1, _2, _1, _0, 1, aId, t1, u8, f32), 1, c, f1, f2);
+#else
+        result = result && SynetDeconvolution8iForwardAutoTest(e, Param(1, 64, 11, 20, 32, _2, _1, _2, _0, _0, 1, aRe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetDeconvolution8iForwardAutoTest(e, Param(1, 32, 11, 20, 16, _4, _1, _2, _1, _1, 1, aPr, t1, f32, f32), 1, c, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetDeconvolution8iForwardAutoTest(const FuncD& f1, const FuncD& f2)
+    {
+        bool result = true;
+
+        SimdSynetCompatibilityType n = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaUse);
+
+        result = result && SynetDeconvolution8iForwardAutoTest(f1, f2, n);
+
+        return result;
+    }
+
+    bool SynetDeconvolution8iForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Base::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Sse41::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Avx2::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Avx512bw::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Avx512vnni::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::AmxBf16::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetDeconvolution8iForwardAutoTest(FUNC_D(Simd::Neon::SynetDeconvolution8iInit), FUNC_D(SimdSynetDeconvolution8iInit));
+#endif 
+
+        return result;
+    }
+#endif
+}
@@ -0,0 +1,147 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynetGraph.hpp"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct Weights
+        {
+            const float* Get(size_t size, size_t fanIn)
+            {
+                if (_index == _tensors.size())
+                {
+                    float range = ::sqrt(3.0f / float(fanIn));
+                    _tensors.push_back(Tensor32f(Shp(size)));
+                    FillRandom(_tensors.back().Data(), size, -range, range);
+                }
+                return _tensors[_index++].Data();
+            }
+
+            void Reset()
+            {
+                _index = 0;
+            }
+
+        private:
+            std::vector<Tensor32f> _tensors;
+            size_t _index = 0;
+        };
+
+        void Forward(Simd::SynetGraph& graph, const String& desc, const Tensor32f& src, Tensor32f& dst)
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            graph.Forward(src.Data(), dst.Data());
+        }
+
+        typedef Simd::SynetGraph::Id Id;
+
+        Id ConvBnRelu6(Simd::SynetGraph& graph, Weights& weights, Id src, size_t srcC, size_t dstC, size_t kernel, size_t stride, size_t group, bool relu6)
+        {
+            const float params[2] = { 0.0f, 6.0f };
+            size_t fanIn = kernel * kernel * srcC / group;
+            Id dst = graph.Convolution(src, dstC, kernel, stride, kernel / 2, group, weights.Get(fanIn * dstC, fanIn), weights.Get(dstC, fanIn));
+            return relu6 ? graph.Activation(dst, SimdConvolutionActivationRestrictRange, params) : dst;
+        }
+
+        void BuildMobileNetV2(Simd::SynetGraph& graph, Weights& weights, size_t size)
+        {
+            static const size_t blocks[7][4] = { { 1, 16, 1, 1 }, { 6, 24, 2, 2 }, { 6, 32, 3, 2 }, { 6, 64, 4, 2 }, { 6, 96, 3, 1 }, { 6, 160, 3, 2 }, { 6, 320, 1, 1 } };
+            weights.Reset();
+            Id x = graph.Input(3, size, size, SimdTensorFormatNchw);
+            x = ConvBnRelu6(graph, weights, x, 3, 32, 3, 2, 1, true);
+            size_t channels = 32;
+            for (size_t b = 0; b < 7; ++b)
+            {
+                for (size_t i = 0; i < blocks[b][2]; ++i)
+                {
+                    size_t hidden = channels * blocks[b][0], stride = i ? 1 : blocks[b][3];
+                    Id y = x;
+                    if (blocks[b][0] != 1)
+                        y = ConvBnRelu6(graph, weights, y, channels, hidden, 1, 1, 1, true);
+                    y = ConvBnRelu6(graph, weights, y, hidden, hidden, 3, stride, hidden, true);
+                    y = ConvBnRelu6(graph, weights, y, hidden, blocks[b][1], 1, 1, 1, false);
+                    x = (stride == 1 && channels == blocks[b][1]) ? graph.Add(y, x) : y;
+                    channels = blocks[b][1];
+                }
+            }
+            x = ConvBnRelu6(graph, weights, x, channels, 1280, 1, 1, 1, true);
+            x = graph.GlobalAveragePooling(x);
+            x = graph.InnerProduct(x, 1000, weights.Get(1280 * 1000, 1280), weights.Get(1000, 1280));
+            graph.Output(x);
+        }
+    }
+
+    bool SynetGraphMobileNetV2AutoTest(size_t batch, size_t size, size_t threads)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetGraph MobileNetV2 [" << batch << "x3x" << size << "x" << size << "] in " << threads << " threads.");
+
+        Weights weights;
+        Simd::SynetGraph plain, fused;
+        BuildMobileNetV2(plain, weights, size);
+        BuildMobileNetV2(fused, weights, size);
+        if (!plain.Compile(batch, 1, false) || !fused.Compile(batch, threads, true))
+        {
+            TEST_LOG_SS(Error, "Can't compile SynetGraph!");
+            return false;
+        }
+
+        Tensor32f src(Shp(batch, 3, size, size)), dst1(Shp(batch, plain.OutputSize())), dst2(Shp(batch, fused.OutputSize()));
+        FillRandom(src.Data(), src.Size(), 0.0f, 1.0f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        std::stringstream desc1, desc2;
+        desc1 << "SimdSynetGraph[MobileNetV2-" << batch << "x" << size << "-plain]";
+        desc2 << "SimdSynetGraph[MobileNetV2-" << batch << "x" << size << "-fused-" << threads << "]";
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(Forward(plain, desc1.str(), src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(Forward(fused, desc2.str(), src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS * 10, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetGraphAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGraphMobileNetV2AutoTest(1, 224, 1);
+        result = result && SynetGraphMobileNetV2AutoTest(4, 224, 4);
+
+        return result;
+    }
+#endif
+}
@@ -26,9 +26,12 @@
 #include "Test/TestTensor.h"
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
+#include "Test/TestUtils.h"
 
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
+#include "Simd/SimdSynetInnerProduct4b.h"
+#include "Simd/SimdSynetInnerProduct8i.h"
 
 namespace Test
 {
@@ -46,7 +49,7 @@ namespace Test
 
             void Update(size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a)
             {
-                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "]";
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "-" + ToString((int)a) + "]";
             }
 
             void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
@@ -60,12 +63,17 @@ namespace Test
 #define FUNC_IP32F(function) \
     FuncIP32F(function, std::string(#function))
 
-    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, FuncIP32F f1, FuncIP32F f2)
+    bool SynetInnerProduct32fForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdConvolutionActivationType a, FuncIP32F f1, FuncIP32F f2, bool sparse = false)
     {
         bool result = true;
 
         f1.Update(b, i, o, t, a);
         f2.Update(b, i, o, t, a);
+        if (sparse)
+        {
+            f1.desc = f1.desc + "-s";
+            f2.desc = f2.desc + "-s";
+        }
 
         TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
 
@@ -74,6 +82,19 @@ namespace Test
 
         Tensor32f weight({ t ? o : i, t ? i : o });
         FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        if (sparse)
+        {
+            static const size_t zeros[6][2] = { {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3} };
+            for (size_t y = 0; y < o; ++y)
+            {
+                for (size_t x = 0; x < i; x += 4)
+                {
+                    const size_t * z = zeros[Random(6)];
+                    for (size_t n = 0; n < 2 && x + z[n] < i; ++n)
+                        weight.Data()[t ? y * i + x + z[n] : (x + z[n]) * o + y] = 0.0f;
+                }
+            }
+        }
 
         Tensor32f bias({ o });
         FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
@@ -127,7 +148,7 @@ namespace Test
         bool result = true;
 
         SimdBool t = SimdTrue, f = SimdFalse;
-        SimdConvolutionActivationType a = SimdConvolutionActivationIdentity;
+        SimdConvolutionActivationType a = SimdConvolutionActivationIdentity, aGe = SimdConvolutionActivationGelu, aGt = SimdConvolutionActivationGeluTanh;
 
 #if defined(NDEBUG)
 #if 0
@@ -169,8 +190,22 @@ namespace Test
         result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, f, a, f1, f2);
         result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, f, a, f1, f2);
 #endif
+#if 1
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 4096, 1000, t, a, f1, f2, true);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 3, 1024, 4096, f, a, f1, f2, true);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 1024, 254, t, a, f1, f2, true);
+#endif
+#if 1
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 768, 3072, t, aGe, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 768, 3072, f, aGe, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 10, 768, 3072, t, aGt, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 3, 1024, 254, f, aGt, f1, f2, true);
+#endif
 #else
         result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, a, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 2, 256, 100, t, a, f1, f2, true);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 2, 192, 96, f, aGe, f1, f2);
+        result = result && SynetInnerProduct32fForwardAutoTest(eps, 1, 192, 96, t, aGt, f1, f2);
         //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 1024, 4096, t, a, f1, f2);
         //result = result && SynetInnerProduct32fForwardAutoTest(eps, 100, 4096, 1024, t, a, f1, f2);
 #endif
@@ -215,6 +250,324 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncIP8IC
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, SimdBool transpose, SimdTensorDataType srcT, SimdTensorDataType dstT,
+                SimdConvolutionActivationType activation, SimdSynetCompatibilityType compatibility);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIP8IC(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, SimdConvolutionActivationType a)
+            {
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString((int)t) + "-" + 
+                    (sT == SimdTensorData32f ? "f" : "u") + (dT == SimdTensorData32f ? "f" : "u") + "-" + ToString((int)a) + "]";
+            }
+
+            void Call(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct8iForward(context, src, buf, dst);
+            }
+        };
+    }
+
+#define FUNC_IP8IC(function) \
+    FuncIP8IC(function, std::string(#function))
+
+    bool SynetInnerProduct8iForwardAutoTest(float eps, size_t b, size_t i, size_t o, SimdBool t, SimdTensorDataType sT, SimdTensorDataType dT, 
+        SimdConvolutionActivationType a, SimdSynetCompatibilityType c, FuncIP8IC f1, FuncIP8IC f2)
+    {
+        bool result = true;
+
+        f1.Update(b, i, o, t, sT, dT, a);
+        f2.Update(b, i, o, t, sT, dT, a);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f weight({ t ? o : i, t ? i : o });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ o });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ o });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f srcMin({ i }), srcMax({ i }), dstMin({ o }), dstMax({ o });
+        Tensor32f src32f({ 1, b, 1, i }, SimdTensorFormatNhwc), dst32f({ 1, b, 1, o }, SimdTensorFormatNhwc);
+        Tensor32f dst32f1({ 1, b, 1, o }, SimdTensorFormatNhwc), dst32f2({ 1, b, 1, o }, SimdTensorFormatNhwc);
+        Tensor8u src8u({ 1, b, 1, i }, SimdTensorFormatNhwc), dst8u1({ 1, b, 1, o }, SimdTensorFormatNhwc), dst8u2({ 1, b, 1, o }, SimdTensorFormatNhwc), buf8u;
+
+        FillRandom(src32f, srcMin.Data(), srcMax.Data(), i, 0);
+        SetSrc32fTo8u(src32f, srcMin.Data(), srcMax.Data(), i, 0, c, NULL, NULL, src8u);
+        for (size_t m = 0; m < b; ++m)
+        {
+            for (size_t n = 0; n < o; ++n)
+            {
+                float sum = bias.Data()[n];
+                for (size_t k = 0; k < i; ++k)
+                    sum += src32f.Data()[m * i + k] * weight.Data()[t ? n * i + k : k * o + n];
+                dst32f.Data()[m * o + n] = a == SimdConvolutionActivationRelu ? std::max(sum, 0.0f) : sum;
+            }
+        }
+        SetDstStat(o, a == SimdConvolutionActivationRelu ? 0 : 1, c, dst32f, dstMin.Data(), dstMax.Data(), NULL, NULL);
+
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+        const uint8_t* src = sT == SimdTensorData32f ? (uint8_t*)src32f.Data() : src8u.Data();
+        uint8_t* dst1 = dT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : dst8u1.Data();
+        uint8_t* dst2 = dT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : dst8u2.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32f2, 1.1f);
+
+        Fill(dst8u1, uint8_t(1));
+        Fill(dst8u2, uint8_t(2));
+
+        void* context1 = f1.func(b, i, o, t, sT, dT, a, c);
+        void* context2 = f2.func(b, i, o, t, sT, dT, a, c);
+
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context1) });
+        buf8u.Extend({ ::SimdSynetInnerProduct8iExternalBufferSize(context2) });
+
+        ::SimdSynetInnerProduct8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetInnerProduct8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf8u.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf8u.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        if (dT == SimdTensorData32f)
+            result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst8u1, dst8u2, 1, true, 64);
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest(float eps, const FuncIP8IC& f1, const FuncIP8IC& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+        SimdSynetCompatibilityType c = SimdSynetCompatibility8iNarrowed;
+
+#if defined(NDEBUG)
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 1, 1024, 1000, t, f32, f32, aId, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 10, 256, 1024, t, f32, u8, aRe, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 10, 1024, 256, f, u8, f32, aRe, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 64, 768, 3072, t, f32, f32, aId, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 7, 333, 111, f, f32, f32, aRe, c, f1, f2);
+#else
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 2, 48, 24, t, f32, f32, aId, c, f1, f2);
+        result = result && SynetInnerProduct8iForwardAutoTest(eps, 3, 33, 17, f, u8, u8, aRe, c, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetInnerProduct8iForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Base::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Sse41::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx2::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx512bw::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#if defined(SIMD_AVX512VNNI_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Avx512vnni::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::AmxBf16::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetInnerProduct8iForwardAutoTest(EPS, FUNC_IP8IC(Simd::Neon::SynetInnerProduct8iInit), FUNC_IP8IC(SimdSynetInnerProduct8iInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIP4B
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t input, size_t output, size_t group, SimdBool transpose, SimdConvolutionActivationType activation);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIP4B(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t i, size_t o, size_t g, SimdBool t, SimdConvolutionActivationType a)
+            {
+                desc = desc + "[" + ToString(b) + "-" + ToString(i) + "-" + ToString(o) + "-" + ToString(g) + "-" + ToString((int)t) + "-" + ToString((int)a) + "]";
+            }
+
+            void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetInnerProduct4bForward(context, src.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_IP4B(function) \
+    FuncIP4B(function, std::string(#function))
+
+    bool SynetInnerProduct4bForwardAutoTest(float eps, size_t b, size_t i, size_t o, size_t g, SimdBool t, SimdConvolutionActivationType a, FuncIP4B f1, FuncIP4B f2)
+    {
+        bool result = true;
+
+        f1.Update(b, i, o, g, t, a);
+        f2.Update(b, i, o, g, t, a);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ b, i });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight({ t ? o : i, t ? i : o });
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ o });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1({ b, o }), dst2({ b, o }), ref({ b, o }), err({ b, o });
+        Fill(dst1, 0.1f);
+        Fill(dst2, 1.1f);
+
+        for (size_t m = 0; m < b; ++m)
+        {
+            for (size_t n = 0; n < o; ++n)
+            {
+                float sum = bias.Data()[n], bound = 0.0f;
+                for (size_t beg = 0; beg < i; beg += g)
+                {
+                    size_t end = std::min(beg + g, i);
+                    float min = FLT_MAX, max = -FLT_MAX, abs = 0.0f;
+                    for (size_t k = beg; k < end; ++k)
+                    {
+                        float w = weight.Data()[t ? n * i + k : k * o + n], s = src.Data()[m * i + k];
+                        min = std::min(min, w);
+                        max = std::max(max, w);
+                        sum += s * w;
+                        abs += ::fabs(s);
+                    }
+                    bound += abs * (max - min) / 30.0f;
+                }
+                ref.Data()[m * o + n] = a == SimdConvolutionActivationRelu ? std::max(sum, 0.0f) : sum;
+                err.Data()[m * o + n] = bound;
+            }
+        }
+
+        void* context1 = f1.func(b, i, o, g, t, a);
+        void* context2 = f2.func(b, i, o, g, t, a);
+
+        ::SimdSynetInnerProduct4bSetParams(context1, weight.Data(), bias.Data(), NULL);
+        ::SimdSynetInnerProduct4bSetParams(context2, weight.Data(), bias.Data(), NULL);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        for (size_t j = 0; j < ref.Size() && result; ++j)
+        {
+            if (::fabs(dst1.Data()[j] - ref.Data()[j]) > err.Data()[j] + eps)
+            {
+                TEST_LOG_SS(Error, "Error at " << j << ": " << dst1.Data()[j] << " != " << ref.Data()[j] << " (bound " << err.Data()[j] << ")!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool SynetInnerProduct4bForwardAutoTest(float eps, const FuncIP4B& f1, const FuncIP4B& f2)
+    {
+        bool result = true;
+
+        SimdBool t = SimdTrue, f = SimdFalse;
+        SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu;
+
+#if defined(NDEBUG)
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 1, 4096, 4096, 128, t, aId, f1, f2);
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 1, 1024, 1000, 64, f, aRe, f1, f2);
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 4, 768, 3072, 32, t, aId, f1, f2);
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 3, 333, 111, 64, t, aRe, f1, f2);
+#else
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 2, 96, 24, 32, t, aId, f1, f2);
+        result = result && SynetInnerProduct4bForwardAutoTest(eps, 3, 77, 17, 64, f, aRe, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetInnerProduct4bForwardAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetInnerProduct4bForwardAutoTest(EPS, FUNC_IP4B(Simd::Base::SynetInnerProduct4bInit), FUNC_IP4B(SimdSynetInnerProduct4bInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetInnerProduct4bForwardAutoTest(EPS, FUNC_IP4B(Simd::Sse41::SynetInnerProduct4bInit), FUNC_IP4B(SimdSynetInnerProduct4bInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetInnerProduct4bForwardAutoTest(EPS, FUNC_IP4B(Simd::Avx2::SynetInnerProduct4bInit), FUNC_IP4B(SimdSynetInnerProduct4bInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetInnerProduct4bForwardAutoTest(EPS, FUNC_IP4B(Simd::Avx512bw::SynetInnerProduct4bInit), FUNC_IP4B(SimdSynetInnerProduct4bInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncIPLF
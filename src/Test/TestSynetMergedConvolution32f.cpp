@@ -384,5 +384,235 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetMergedConvolution32fExportAutoTest(const Param & p, SimdSynetCompatibilityType c, FuncMC f)
+    {
+        bool result = true;
+
+        f.Update(p, c);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " export/import.");
+
+        Tensor32f src(Shp(p.batch, p.conv[0].srcH, p.conv[0].srcW, p.conv[0].srcC));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight[3], bias[3], params[3];
+        for (size_t i = 0; i < p.count; ++i)
+        {
+            weight[i].Reshape(Shp(p.conv[i].kernelY, p.conv[i].kernelX, p.conv[i].srcC / p.conv[i].group, p.conv[i].dstC));
+            FillRandom(weight[i].Data(), weight[i].Size(), -1.0, 1.0f);
+            p.weight[i] = weight[i].Data();
+
+            bias[i].Reshape(Shp(p.conv[i].dstC));
+            FillRandom(bias[i].Data(), bias[i].Size(), -1.0, 1.0f);
+            p.bias[i] = bias[i].Data();
+
+            params[i].Reshape(Shp(Simd::Max<size_t>(2, p.conv[i].dstC)));
+            FillRandom(params[i].Data(), params[i].Size(), -1.0, 1.0f);
+            params[i].Data()[0] = 0.0f + 0.1f * float(i);
+            params[i].Data()[1] = 1.0f + 0.1f * float(i);
+            p.params[i] = params[i].Data();
+        }
+
+        const SimdConvolutionParameters & end = p.conv[p.count - 1];
+        Tensor32f dst0(Shp(p.batch, end.dstH, end.dstW, end.dstC), SimdTensorFormatNhwc, 1.1f);
+        Tensor32f dst1(dst0.Shape(), SimdTensorFormatNhwc, 1.1f), dst2(dst0.Shape(), SimdTensorFormatNhwc, 1.1f);
+
+        void* context0 = f.func(p.batch, p.conv, p.count, p.add, c);
+        void* context1 = f.func(p.batch, p.conv, p.count, p.add, c);
+        void* context2 = f.func(p.batch, p.conv, p.count, p.add, c);
+
+        ::SimdSynetMergedConvolution32fSetParams(context0, p.weight, NULL, p.bias, p.params);
+        ::SimdSynetMergedConvolution32fForward(context0, src.Data(), NULL, dst0.Data());
+
+        size_t size = ::SimdSynetMergedConvolution32fExport(context0, NULL, 0);
+        Tensor8u blob({ size });
+        if (::SimdSynetMergedConvolution32fExport(context0, blob.Data(), blob.Size()) != size)
+        {
+            TEST_LOG_SS(Error, "SimdSynetMergedConvolution32fExport returns wrong size!");
+            result = false;
+        }
+        ::SimdRelease(context0);
+
+        for (size_t i = 0; i < p.count; ++i)
+        {
+            Fill(weight[i], 0.0f);
+            Fill(bias[i], 0.0f);
+            Fill(params[i], 0.0f);
+        }
+
+        if (::SimdSynetMergedConvolution32fImport(context1, blob.Data(), size - 1, SimdFalse))
+        {
+            TEST_LOG_SS(Error, "SimdSynetMergedConvolution32fImport accepts truncated blob!");
+            result = false;
+        }
+        if (!::SimdSynetMergedConvolution32fImport(context1, blob.Data(), size, SimdFalse) ||
+            !::SimdSynetMergedConvolution32fImport(context2, blob.Data(), size, SimdTrue))
+        {
+            TEST_LOG_SS(Error, "SimdSynetMergedConvolution32fImport can't import blob!");
+            result = false;
+        }
+
+        if (result)
+        {
+            ::SimdSynetMergedConvolution32fForward(context1, src.Data(), NULL, dst1.Data());
+            ::SimdSynetMergedConvolution32fForward(context2, src.Data(), NULL, dst2.Data());
+
+            result = result && Compare(dst0, dst1, 0.0f, true, 64, DifferenceAbsolute, "copy");
+            result = result && Compare(dst0, dst2, 0.0f, true, 64, DifferenceAbsolute, "attach");
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetMergedConvolution32fExportAutoTest(const FuncMC & f)
+    {
+        bool result = true;
+        const SimdBool t = SimdTrue, f0 = SimdFalse;
+        const ::SimdConvolutionActivationType a0 = ::SimdConvolutionActivationRestrictRange, a1 = ::SimdConvolutionActivationPrelu, a2 = ::SimdConvolutionActivationIdentity;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(Shp(1, 24, 32, 33), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), t), fp32, f);
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(Shp(1, 32, 24, 24), Cnv(a0, 1, 1, 192), Cnv(a1, 3, 2), Cnv(a2, 1, 1, 64), f0), fp32, f);
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(Shp(1, 64, 20, 20), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 96)), fp32, f);
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(Shp(1, 32, 20, 20), Cnv(a0, 1, 1, 48), Cnv(a1, 3, 1)), fp32, f);
+        result = result && SynetMergedConvolution32fExportAutoTest(Param(Shp(1, 24, 32, 33), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), f0), bf16, f);
+
+        return result;
+    }
+
+    bool SynetMergedConvolution32fExportAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Base::SynetMergedConvolution32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Sse41::SynetMergedConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Avx2::SynetMergedConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Avx512bw::SynetMergedConvolution32fInit));
+#endif
+
+#if defined(SIMD_AVX512BF16_ENABLE) && !defined(SIMD_AMX_EMULATE)
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Avx512bf16::SynetMergedConvolution32fInit));
+#endif
+
+#if defined(SIMD_AMXBF16_ENABLE) || (defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_AMX_EMULATE))
+        if (Simd::AmxBf16::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::AmxBf16::SynetMergedConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetMergedConvolution32fExportAutoTest(FUNC_MC(Simd::Neon::SynetMergedConvolution32fInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool SynetMergedConvolution32fReshapeAutoTest(const Param & p1, const Param & p2, SimdSynetCompatibilityType c, FuncMC f)
+    {
+        bool result = true;
+
+        f.Update(p2, c);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " reshape from [" << p1.batch << "x" << p1.conv[0].srcH << "x" << p1.conv[0].srcW << "].");
+
+        Tensor32f weight[3], bias[3], params[3];
+        for (size_t i = 0; i < p1.count; ++i)
+        {
+            weight[i].Reshape(Shp(p1.conv[i].kernelY, p1.conv[i].kernelX, p1.conv[i].srcC / p1.conv[i].group, p1.conv[i].dstC));
+            FillRandom(weight[i].Data(), weight[i].Size(), -1.0, 1.0f);
+            p1.weight[i] = weight[i].Data();
+
+            bias[i].Reshape(Shp(p1.conv[i].dstC));
+            FillRandom(bias[i].Data(), bias[i].Size(), -1.0, 1.0f);
+            p1.bias[i] = bias[i].Data();
+
+            params[i].Reshape(Shp(Simd::Max<size_t>(2, p1.conv[i].dstC)));
+            FillRandom(params[i].Data(), params[i].Size(), -1.0, 1.0f);
+            params[i].Data()[0] = 0.0f + 0.1f * float(i);
+            params[i].Data()[1] = 1.0f + 0.1f * float(i);
+            p1.params[i] = params[i].Data();
+        }
+
+        const SimdConvolutionParameters & end1 = p1.conv[p1.count - 1], & end2 = p2.conv[p2.count - 1];
+        Tensor32f src1(Shp(p1.batch, p1.conv[0].srcH, p1.conv[0].srcW, p1.conv[0].srcC));
+        FillRandom(src1.Data(), src1.Size(), -1.0, 1.0f);
+        Tensor32f dst11(Shp(p1.batch, end1.dstH, end1.dstW, end1.dstC), SimdTensorFormatNhwc, 1.1f);
+        Tensor32f dst12(Shp(p1.batch, end1.dstH, end1.dstW, end1.dstC), SimdTensorFormatNhwc, 1.1f);
+        Tensor32f src2(Shp(p2.batch, p2.conv[0].srcH, p2.conv[0].srcW, p2.conv[0].srcC));
+        FillRandom(src2.Data(), src2.Size(), -1.0, 1.0f);
+        Tensor32f dst21(Shp(p2.batch, end2.dstH, end2.dstW, end2.dstC), SimdTensorFormatNhwc, 1.1f);
+        Tensor32f dst22(Shp(p2.batch, end2.dstH, end2.dstW, end2.dstC), SimdTensorFormatNhwc, 1.1f);
+
+        void* context0 = f.func(p1.batch, p1.conv, p1.count, p1.add, c);
+        void* context1 = f.func(p1.batch, p1.conv, p1.count, p1.add, c);
+        void* context2 = f.func(p2.batch, p2.conv, p2.count, p2.add, c);
+        ::SimdSynetMergedConvolution32fSetParams(context0, p1.weight, NULL, p1.bias, p1.params);
+        ::SimdSynetMergedConvolution32fSetParams(context1, p1.weight, NULL, p1.bias, p1.params);
+        ::SimdSynetMergedConvolution32fSetParams(context2, p1.weight, NULL, p1.bias, p1.params);
+
+        if (::SimdSynetMergedConvolution32fReshape(context0, p2.batch, p2.conv[0].srcH, p2.conv[0].srcW))
+        {
+            ::SimdSynetMergedConvolution32fForward(context0, src2.Data(), NULL, dst21.Data());
+            ::SimdSynetMergedConvolution32fForward(context2, src2.Data(), NULL, dst22.Data());
+            result = result && Compare(dst21, dst22, 0.0f, true, 64, DifferenceAbsolute, "reshaped");
+
+            if (!::SimdSynetMergedConvolution32fReshape(context0, p1.batch, p1.conv[0].srcH, p1.conv[0].srcW))
+            {
+                TEST_LOG_SS(Error, "SimdSynetMergedConvolution32fReshape can't restore original shape!");
+                result = false;
+            }
+            ::SimdSynetMergedConvolution32fForward(context0, src1.Data(), NULL, dst11.Data());
+            ::SimdSynetMergedConvolution32fForward(context1, src1.Data(), NULL, dst12.Data());
+            result = result && Compare(dst11, dst12, 0.0f, true, 64, DifferenceAbsolute, "restored");
+        }
+        else
+            TEST_LOG_SS(Info, "New shape requires incompatible weight layout.");
+
+        ::SimdRelease(context0);
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetMergedConvolution32fReshapeAutoTest()
+    {
+        bool result = true;
+        const SimdBool t = SimdTrue, f = SimdFalse;
+        const ::SimdConvolutionActivationType a0 = ::SimdConvolutionActivationRestrictRange, a1 = ::SimdConvolutionActivationPrelu, a2 = ::SimdConvolutionActivationIdentity;
+        const SimdSynetCompatibilityType fp32 = SimdSynetCompatibilityDefault, bf16 = SimdSynetCompatibility16bfSoft;
+        const FuncMC mc = FUNC_MC(SimdSynetMergedConvolution32fInit);
+
+        result = result && SynetMergedConvolution32fReshapeAutoTest(Param(Shp(1, 24, 32, 33), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), t),
+            Param(Shp(2, 24, 48, 41), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), t), fp32, mc);
+        result = result && SynetMergedConvolution32fReshapeAutoTest(Param(Shp(1, 32, 24, 24), Cnv(a0, 1, 1, 192), Cnv(a1, 3, 2), Cnv(a2, 1, 1, 64), f),
+            Param(Shp(1, 32, 40, 32), Cnv(a0, 1, 1, 192), Cnv(a1, 3, 2), Cnv(a2, 1, 1, 64), f), fp32, mc);
+        result = result && SynetMergedConvolution32fReshapeAutoTest(Param(Shp(1, 64, 20, 20), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 96)),
+            Param(Shp(3, 64, 12, 28), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 96)), fp32, mc);
+        result = result && SynetMergedConvolution32fReshapeAutoTest(Param(Shp(1, 24, 32, 33), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), f),
+            Param(Shp(2, 24, 16, 25), Cnv(a0, 1, 1, 144), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 24), f), bf16, mc);
+
+        return result;
+    }
 #endif
 }
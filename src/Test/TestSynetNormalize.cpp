@@ -138,5 +138,223 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSLN
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+                const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSLN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdConvolutionActivationType activation)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-"
+                    + ToString(format) + "-" + ToString(activation) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, const Tensor32f& scale,
+                const Tensor32f& shift, float eps, SimdConvolutionActivationType activation, const float* params, Tensor32f& buf, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), batch, channels, spatial, format, scale.Data(), shift.Data(), &eps, activation, params, buf.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_SLN(function) FuncSLN(function, #function)
+
+    bool SynetLayerNorm32fAutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format,
+        SimdConvolutionActivationType activation, int extBuf, FuncSLN f1, FuncSLN f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, format, activation);
+        f2.Update(batch, channels, spatial, format, activation);
+
+        const float eps = 0.00001f, params[2] = { 0.1f, 2.0f };
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << "].");
+
+        Tensor32f src(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f scale(ToShape(channels)), shift(ToShape(channels));
+        Tensor32f buf;
+        if (extBuf)
+            buf.Reshape(ToShape(2 * spatial));
+        Tensor32f dst1(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f dst2(ToShape(batch, channels, 1, spatial, format));
+
+        FillRandom(src.Data(), src.Size(), -10.0, 10.0);
+        FillRandom(scale.Data(), scale.Size(), -2.0, 2.0);
+        FillRandom(shift.Data(), shift.Size(), -2.0, 2.0);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, batch, channels, spatial, format, scale, shift, eps, activation, params, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, batch, channels, spatial, format, scale, shift, eps, activation, params, buf, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetLayerNorm32fAutoTest(const FuncSLN& f1, const FuncSLN& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRr = SimdConvolutionActivationRestrictRange, 
+            aGe = SimdConvolutionActivationGelu, aGt = SimdConvolutionActivationGeluTanh;
+
+        result = result && SynetLayerNorm32fAutoTest(1, 768, 197, formats[1], aId, 0, f1, f2);
+
+        for (int f = 0; f < 2; f++)
+        {
+            result = result && SynetLayerNorm32fAutoTest(1, C, W, formats[f], aId, 1, f1, f2);
+            result = result && SynetLayerNorm32fAutoTest(8, C, W, formats[f], aGe, 1, f1, f2);
+            result = result && SynetLayerNorm32fAutoTest(3, C + O, W, formats[f], aGt, 0, f1, f2);
+            result = result && SynetLayerNorm32fAutoTest(7, C - O, W + O, formats[f], aRr, 0, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetLayerNorm32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetLayerNorm32fAutoTest(FUNC_SLN(Simd::Base::SynetLayerNorm32f), FUNC_SLN(SimdSynetLayerNorm32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetLayerNorm32fAutoTest(FUNC_SLN(Simd::Sse41::SynetLayerNorm32f), FUNC_SLN(SimdSynetLayerNorm32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetLayerNorm32fAutoTest(FUNC_SLN(Simd::Avx2::SynetLayerNorm32f), FUNC_SLN(SimdSynetLayerNorm32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetLayerNorm32fAutoTest(FUNC_SLN(Simd::Avx512bw::SynetLayerNorm32f), FUNC_SLN(SimdSynetLayerNorm32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSGN
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+                const float* scale, const float* shift, const float* eps, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSGN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format, SimdConvolutionActivationType activation)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-"
+                    + ToString(groups) + "-" + ToString(format) + "-" + ToString(activation) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format, const Tensor32f& scale,
+                const Tensor32f& shift, float eps, SimdConvolutionActivationType activation, const float* params, Tensor32f& buf, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), batch, channels, spatial, groups, format, scale.Data(), shift.Data(), &eps, activation, params, buf.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_SGN(function) FuncSGN(function, #function)
+
+    bool SynetGroupNorm32fAutoTest(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorFormatType format,
+        SimdConvolutionActivationType activation, int extBuf, FuncSGN f1, FuncSGN f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, groups, format, activation);
+        f2.Update(batch, channels, spatial, groups, format, activation);
+
+        const float eps = 0.00001f, params[2] = { 0.1f, 2.0f };
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << "].");
+
+        Tensor32f src(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f scale(ToShape(channels)), shift(ToShape(channels));
+        Tensor32f buf;
+        if (extBuf)
+            buf.Reshape(ToShape(3 * channels));
+        Tensor32f dst1(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f dst2(ToShape(batch, channels, 1, spatial, format));
+
+        FillRandom(src.Data(), src.Size(), -10.0, 10.0);
+        FillRandom(scale.Data(), scale.Size(), -2.0, 2.0);
+        FillRandom(shift.Data(), shift.Size(), -2.0, 2.0);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, batch, channels, spatial, groups, format, scale, shift, eps, activation, params, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, batch, channels, spatial, groups, format, scale, shift, eps, activation, params, buf, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetGroupNorm32fAutoTest(const FuncSGN& f1, const FuncSGN& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRr = SimdConvolutionActivationRestrictRange,
+            aGe = SimdConvolutionActivationGelu, aGt = SimdConvolutionActivationGeluTanh;
+
+        for (int f = 0; f < 2; f++)
+        {
+            result = result && SynetGroupNorm32fAutoTest(1, 64, W, 32, formats[f], aId, 1, f1, f2);
+            result = result && SynetGroupNorm32fAutoTest(2, 60, W + O, 60, formats[f], aGe, 0, f1, f2);
+            result = result && SynetGroupNorm32fAutoTest(1, 64, W - O, 8, formats[f], aGt, 1, f1, f2);
+            result = result && SynetGroupNorm32fAutoTest(3, C - O, W - O, 1, formats[f], aRr, 1, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetGroupNorm32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGroupNorm32fAutoTest(FUNC_SGN(Simd::Base::SynetGroupNorm32f), FUNC_SGN(SimdSynetGroupNorm32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetGroupNorm32fAutoTest(FUNC_SGN(Simd::Sse41::SynetGroupNorm32f), FUNC_SGN(SimdSynetGroupNorm32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetGroupNorm32fAutoTest(FUNC_SGN(Simd::Avx2::SynetGroupNorm32f), FUNC_SGN(SimdSynetGroupNorm32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetGroupNorm32fAutoTest(FUNC_SGN(Simd::Avx512bw::SynetGroupNorm32f), FUNC_SGN(SimdSynetGroupNorm32f));
+#endif 
+
+        return result;
+    }
 #endif
 }
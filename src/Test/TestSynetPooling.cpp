@@ -426,5 +426,247 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct ParamR
+        {
+            size_t srcC, srcH, srcW, roiCount, dstH, dstW, samplingRatio;
+            float spatialScale;
+            SimdBool aligned;
+            SimdTensorFormatType format;
+
+            ParamR(size_t c, size_t h, size_t w, size_t n, size_t dh, size_t dw, float ss, size_t sr, SimdBool a, SimdTensorFormatType f)
+                : srcC(c), srcH(h), srcW(w), roiCount(n), dstH(dh), dstW(dw), samplingRatio(sr), spatialScale(ss), aligned(a), format(f)
+            {
+            }
+        };
+
+        struct FuncRA
+        {
+            typedef void(*FuncPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+                size_t samplingRatio, SimdBool aligned, float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRA(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const ParamR& p)
+            {
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << p.srcC << "x" << p.srcH << "x" << p.srcW << "-" << p.roiCount << "x" << p.dstH << "x" << p.dstW;
+                ss << "-" << p.samplingRatio << "-" << (p.aligned ? "a" : "u") << "-" << (p.format == SimdTensorFormatNhwc ? "1" : "0") << "]";
+                desc = ss.str();
+            }
+
+            void Call(const ParamR& p, const Tensor32f& src, const Tensor32f& rois, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), p.srcC, p.srcH, p.srcW, rois.Data(), p.roiCount, p.spatialScale, p.samplingRatio, p.aligned, dst.Data(), p.dstH, p.dstW, p.format);
+            }
+        };
+    }
+
+#define FUNC_RA(function) FuncRA(function, #function)
+
+    static void FillRois(const ParamR& p, Tensor32f& rois)
+    {
+        float imgH = float(p.srcH) / p.spatialScale, imgW = float(p.srcW) / p.spatialScale;
+        FillRandom(rois.Data(), rois.Size(), 0.0f, 1.0f);
+        for (size_t i = 0; i < p.roiCount; ++i)
+        {
+            float* roi = rois.Data() + i * 4;
+            float x0 = roi[0] * imgW * 1.1f - imgW * 0.05f, y0 = roi[1] * imgH * 1.1f - imgH * 0.05f;
+            roi[0] = x0;
+            roi[1] = y0;
+            roi[2] = x0 + roi[2] * imgW * 0.5f;
+            roi[3] = y0 + roi[3] * imgH * 0.5f;
+        }
+    }
+
+    bool SynetRoiAlign32fAutoTest(const ParamR& p, FuncRA f1, FuncRA f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src(ToShape(p.srcC, p.srcH, p.srcW, p.format));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f rois({ p.roiCount, 4 });
+        FillRois(p, rois);
+
+        Tensor32f dst1(ToShape(p.roiCount, p.srcC, p.dstH, p.dstW, p.format));
+        Tensor32f dst2(ToShape(p.roiCount, p.srcC, p.dstH, p.dstW, p.format));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, src, rois, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, src, rois, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest(::SimdTensorFormatType f, const FuncRA& f1, const FuncRA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(ParamR(256, 38, 50, 100, 7, 7, 1.0f / 16.0f, 2, SimdTrue, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(67, 25, 33, 37, 14, 14, 1.0f / 8.0f, 0, SimdFalse, f), f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(ParamR(3, 17, 19, 5, 3, 5, 0.5f, 1, SimdTrue, f), f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest(const FuncRA& f1, const FuncRA& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetRoiAlign32fAutoTest(::SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiAlign32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Base::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Sse41::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Avx2::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetRoiAlign32fAutoTest(FUNC_RA(Simd::Avx512bw::SynetRoiAlign32f), FUNC_RA(SimdSynetRoiAlign32f));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRPM
+        {
+            typedef void(*FuncPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, const float* rois, size_t roiCount, float spatialScale,
+                float* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncRPM(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(const ParamR& p)
+            {
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << p.srcC << "x" << p.srcH << "x" << p.srcW << "-" << p.roiCount << "x" << p.dstH << "x" << p.dstW;
+                ss << "-" << (p.format == SimdTensorFormatNhwc ? "1" : "0") << "]";
+                desc = ss.str();
+            }
+
+            void Call(const ParamR& p, const Tensor32f& src, const Tensor32f& rois, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), p.srcC, p.srcH, p.srcW, rois.Data(), p.roiCount, p.spatialScale, dst.Data(), p.dstH, p.dstW, p.format);
+            }
+        };
+    }
+
+#define FUNC_RPM(function) FuncRPM(function, #function)
+
+    bool SynetRoiPoolingMax32fAutoTest(const ParamR& p, FuncRPM f1, FuncRPM f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src(ToShape(p.srcC, p.srcH, p.srcW, p.format));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f rois({ p.roiCount, 4 });
+        FillRois(p, rois);
+
+        Tensor32f dst1(ToShape(p.roiCount, p.srcC, p.dstH, p.dstW, p.format));
+        Tensor32f dst2(ToShape(p.roiCount, p.srcC, p.dstH, p.dstW, p.format));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(p, src, rois, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(p, src, rois, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetRoiPoolingMax32fAutoTest(::SimdTensorFormatType f, const FuncRPM& f1, const FuncRPM& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiPoolingMax32fAutoTest(ParamR(256, 38, 50, 100, 7, 7, 1.0f / 16.0f, 0, SimdFalse, f), f1, f2);
+        result = result && SynetRoiPoolingMax32fAutoTest(ParamR(67, 25, 33, 37, 14, 14, 1.0f / 8.0f, 0, SimdFalse, f), f1, f2);
+        result = result && SynetRoiPoolingMax32fAutoTest(ParamR(3, 17, 19, 5, 3, 5, 0.5f, 0, SimdFalse, f), f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiPoolingMax32fAutoTest(const FuncRPM& f1, const FuncRPM& f2)
+    {
+        bool result = true;
+
+        result = result && SynetRoiPoolingMax32fAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetRoiPoolingMax32fAutoTest(::SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetRoiPoolingMax32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetRoiPoolingMax32fAutoTest(FUNC_RPM(Simd::Base::SynetRoiPoolingMax32f), FUNC_RPM(SimdSynetRoiPoolingMax32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetRoiPoolingMax32fAutoTest(FUNC_RPM(Simd::Sse41::SynetRoiPoolingMax32f), FUNC_RPM(SimdSynetRoiPoolingMax32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetRoiPoolingMax32fAutoTest(FUNC_RPM(Simd::Avx2::SynetRoiPoolingMax32f), FUNC_RPM(SimdSynetRoiPoolingMax32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetRoiPoolingMax32fAutoTest(FUNC_RPM(Simd::Avx512bw::SynetRoiPoolingMax32f), FUNC_RPM(SimdSynetRoiPoolingMax32f));
+#endif 
+
+        return result;
+    }
 #endif
 }
@@ -126,5 +126,259 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool SynetLogSoftmaxLayerForwardAutoTest(size_t outer, size_t count, size_t inner, FuncSM f1, FuncSM f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner);
+        f2.Update(outer, count, inner);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -99.0, 99.0f);
+
+        Tensor32f dst1({ outer, count, inner }, SimdTensorFormatNchw, 0.1f);
+        Tensor32f dst2({ outer, count, inner }, SimdTensorFormatNchw, 0.2f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetLogSoftmaxLayerForwardAutoTest(const FuncSM& f1, const FuncSM& f2)
+    {
+        bool result = true;
+
+        result = result && SynetLogSoftmaxLayerForwardAutoTest(50, 10, 100, f1, f2);
+        result = result && SynetLogSoftmaxLayerForwardAutoTest(749, 49, 1, f1, f2);
+        result = result && SynetLogSoftmaxLayerForwardAutoTest(64, 1000, 1, f1, f2);
+        result = result && SynetLogSoftmaxLayerForwardAutoTest(2, 21, 127 * 65, f1, f2);
+
+        return result;
+    }
+
+    bool SynetLogSoftmaxLayerForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetLogSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Base::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetLogSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Sse41::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetLogSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Avx2::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetLogSoftmaxLayerForwardAutoTest(FUNC_SM(Simd::Avx512bw::SynetLogSoftmaxLayerForward), FUNC_SM(SimdSynetLogSoftmaxLayerForward));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncAM
+        {
+            typedef void(*FuncPtr)(const float* src, size_t outer, size_t count, size_t inner, SimdTensorDataType indexType, void* index, float* prob);
+
+            FuncPtr func;
+            String desc;
+
+            FuncAM(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, SimdTensorDataType type, bool prob)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "-" + ToString(type) + (prob ? "-p" : "") + "]";
+            }
+
+            void Call(const Tensor32f& src, SimdTensorDataType type, Tensor<uint32_t>& index, Tensor32f* prob) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), type, index.Data(), prob ? prob->Data() : NULL);
+            }
+        };
+    }
+
+#define FUNC_AM(function) FuncAM(function, #function)
+
+    bool SynetSoftmaxArgMax32fAutoTest(size_t outer, size_t count, size_t inner, SimdTensorDataType type, bool prob, FuncAM f1, FuncAM f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, type, prob);
+        f2.Update(outer, count, inner, type, prob);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -9.0, 9.0f);
+        for (size_t i = 0; i < src.Size(); i += 7)
+            src.Data()[i] = 9.0f;
+
+        Tensor<uint32_t> index1({ outer, inner }), index2({ outer, inner });
+        Tensor32f prob1({ outer, inner }, SimdTensorFormatNchw, 0.1f);
+        Tensor32f prob2({ outer, inner }, SimdTensorFormatNchw, 0.2f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, index1, prob ? &prob1 : NULL));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, index2, prob ? &prob2 : NULL));
+
+        result = result && Compare(index1, index2, 0, true, 64, "index");
+        if (prob)
+            result = result && Compare(prob1, prob2, EPS, true, 64, DifferenceAbsolute, "prob");
+
+        return result;
+    }
+
+    bool SynetSoftmaxArgMax32fAutoTest(const FuncAM& f1, const FuncAM& f2)
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxArgMax32fAutoTest(2, 21, 127 * 65, SimdTensorData8u, false, f1, f2);
+        result = result && SynetSoftmaxArgMax32fAutoTest(2, 21, 127 * 65, SimdTensorData8u, true, f1, f2);
+        result = result && SynetSoftmaxArgMax32fAutoTest(2 * 63 * 65, 21, 1, SimdTensorData16u, true, f1, f2);
+        result = result && SynetSoftmaxArgMax32fAutoTest(64, 1000, 1, SimdTensorData32i, true, f1, f2);
+        result = result && SynetSoftmaxArgMax32fAutoTest(50, 10, 100, SimdTensorData16u, false, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmaxArgMax32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxArgMax32fAutoTest(FUNC_AM(Simd::Base::SynetSoftmaxArgMax32f), FUNC_AM(SimdSynetSoftmaxArgMax32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSoftmaxArgMax32fAutoTest(FUNC_AM(Simd::Sse41::SynetSoftmaxArgMax32f), FUNC_AM(SimdSynetSoftmaxArgMax32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSoftmaxArgMax32fAutoTest(FUNC_AM(Simd::Avx2::SynetSoftmaxArgMax32f), FUNC_AM(SimdSynetSoftmaxArgMax32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSoftmaxArgMax32fAutoTest(FUNC_AM(Simd::Avx512bw::SynetSoftmaxArgMax32f), FUNC_AM(SimdSynetSoftmaxArgMax32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncTK
+        {
+            typedef void(*FuncPtr)(const float* src, size_t outer, size_t count, size_t inner, size_t k, uint32_t* index, float* prob);
+
+            FuncPtr func;
+            String desc;
+
+            FuncTK(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, size_t k)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "-" + ToString(k) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t k, Tensor<uint32_t>& index, Tensor32f& prob) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), k, index.Data(), prob.Data());
+            }
+        };
+    }
+
+#define FUNC_TK(function) FuncTK(function, #function)
+
+    bool SynetSoftmaxTopK32fAutoTest(size_t outer, size_t count, size_t inner, size_t k, FuncTK f1, FuncTK f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, k);
+        f2.Update(outer, count, inner, k);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -9.0, 9.0f);
+        for (size_t i = 0; i < src.Size(); i += 11)
+            src.Data()[i] = 9.0f;
+
+        Tensor<uint32_t> index1({ outer, inner, k }), index2({ outer, inner, k });
+        Tensor32f prob1({ outer, inner, k }, SimdTensorFormatNchw, 0.1f);
+        Tensor32f prob2({ outer, inner, k }, SimdTensorFormatNchw, 0.2f);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, k, index1, prob1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, k, index2, prob2));
+
+        result = result && Compare(index1, index2, 0, true, 64, "index");
+        result = result && Compare(prob1, prob2, EPS, true, 64, DifferenceAbsolute, "prob");
+
+        return result;
+    }
+
+    bool SynetSoftmaxTopK32fAutoTest(const FuncTK& f1, const FuncTK& f2)
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxTopK32fAutoTest(64, 1000, 1, 5, f1, f2);
+        result = result && SynetSoftmaxTopK32fAutoTest(64, 1001, 1, 1, f1, f2);
+        result = result && SynetSoftmaxTopK32fAutoTest(749, 49, 1, 49, f1, f2);
+        result = result && SynetSoftmaxTopK32fAutoTest(2, 21, 33 * 17, 3, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmaxTopK32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSoftmaxTopK32fAutoTest(FUNC_TK(Simd::Base::SynetSoftmaxTopK32f), FUNC_TK(SimdSynetSoftmaxTopK32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSoftmaxTopK32fAutoTest(FUNC_TK(Simd::Sse41::SynetSoftmaxTopK32f), FUNC_TK(SimdSynetSoftmaxTopK32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSoftmaxTopK32fAutoTest(FUNC_TK(Simd::Avx2::SynetSoftmaxTopK32f), FUNC_TK(SimdSynetSoftmaxTopK32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSoftmaxTopK32fAutoTest(FUNC_TK(Simd::Avx512bw::SynetSoftmaxTopK32f), FUNC_TK(SimdSynetSoftmaxTopK32f));
+#endif
+
+        return result;
+    }
 #endif
 }
@@ -0,0 +1,198 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynetWorkspace.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+        typedef std::vector<Param> Params;
+    }
+
+    bool SynetWorkspacePlanAutoTest(const Shape & sizes, const Shape & firsts, const Shape & lasts)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetWorkspace plan for " << sizes.size() << " buffers.");
+
+        void * workspace = ::SimdSynetWorkspaceInit();
+        Shape indices(sizes.size());
+        for (size_t i = 0; i < sizes.size(); ++i)
+            indices[i] = ::SimdSynetWorkspaceAddBuffer(workspace, sizes[i], firsts[i], lasts[i]);
+        size_t size = ::SimdSynetWorkspaceSize(workspace), total = 0;
+        for (size_t i = 0; i < sizes.size() && result; ++i)
+        {
+            size_t oi = ::SimdSynetWorkspaceOffset(workspace, indices[i]);
+            total += Simd::AlignHi(sizes[i], SIMD_ALIGN);
+            if (oi % SIMD_ALIGN || oi + sizes[i] > size)
+            {
+                TEST_LOG_SS(Error, "Buffer " << i << " has wrong offset " << oi << " (arena size " << size << ")!");
+                result = false;
+            }
+            for (size_t j = 0; j < i && result; ++j)
+            {
+                size_t oj = ::SimdSynetWorkspaceOffset(workspace, indices[j]);
+                bool alive = firsts[i] <= lasts[j] && firsts[j] <= lasts[i];
+                bool overlap = oi < oj + sizes[j] && oj < oi + sizes[i];
+                if (alive && overlap && sizes[i] && sizes[j])
+                {
+                    TEST_LOG_SS(Error, "Buffers " << j << " and " << i << " are alive together and overlap in memory!");
+                    result = false;
+                }
+            }
+        }
+        if (result && size > total)
+        {
+            TEST_LOG_SS(Error, "Arena size " << size << " exceeds total size of buffers " << total << "!");
+            result = false;
+        }
+        ::SimdRelease(workspace);
+
+        return result;
+    }
+
+    bool SynetWorkspaceChainAutoTest(const Params & params)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetWorkspace for chain of " << params.size() << " FP32 convolutions.");
+
+        size_t n = params.size();
+        std::vector<Tensor32f> weight(n), bias(n), param(n), dst1(n), dst2(n);
+        std::vector<void*> context(n);
+        Tensor32f src(params[0].SrcShape());
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        void* workspace = ::SimdSynetWorkspaceInit();
+        Shape buffer(n), tensor(n + 1);
+        tensor[0] = ::SimdSynetWorkspaceAddBuffer(workspace, src.Size() * sizeof(float), 0, 0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            const Param& p = params[i];
+            weight[i].Reshape(p.WeightShape());
+            FillRandom(weight[i].Data(), weight[i].Size(), -1.0, 1.0f);
+            bias[i].Reshape(Shp(p.conv.dstC));
+            FillRandom(bias[i].Data(), bias[i].Size(), -1.0, 1.0f);
+            param[i].Reshape(Shp(p.conv.dstC));
+            FillRandom(param[i].Data(), param[i].Size(), 0.0f, 2.0f);
+            dst1[i].Reshape(p.DstShape());
+            dst2[i].Reshape(p.DstShape());
+
+            context[i] = ::SimdSynetConvolution32fInit(p.batch, &p.conv, SimdSynetCompatibilityDefault);
+            ::SimdSynetConvolution32fSetParams(context[i], weight[i].Data(), NULL, bias[i].Data(), param[i].Data());
+            buffer[i] = ::SimdSynetWorkspaceAddContext(workspace, SimdSynetContextConvolution32f, context[i], i);
+            tensor[i + 1] = ::SimdSynetWorkspaceAddBuffer(workspace, dst1[i].Size() * sizeof(float), i, i + 1);
+        }
+
+        for (size_t i = 0; i < n; ++i)
+            ::SimdSynetConvolution32fForward(context[i], i ? dst1[i - 1].Data() : src.Data(), NULL, dst1[i].Data());
+
+        Tensor8u arena(Shp(::SimdSynetWorkspaceSize(workspace)));
+        memset(arena.Data(), -1, arena.Size());
+        float* input = (float*)(arena.Data() + ::SimdSynetWorkspaceOffset(workspace, tensor[0]));
+        memcpy(input, src.Data(), src.Size() * sizeof(float));
+        for (size_t i = 0; i < n; ++i)
+        {
+            float* tmp = (float*)(arena.Data() + ::SimdSynetWorkspaceOffset(workspace, buffer[i]));
+            float* output = (float*)(arena.Data() + ::SimdSynetWorkspaceOffset(workspace, tensor[i + 1]));
+            ::SimdSynetConvolution32fForward(context[i], input, tmp, output);
+            memcpy(dst2[i].Data(), output, dst2[i].Size() * sizeof(float));
+            input = output;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            result = result && Compare(dst1[i], dst2[i], 0.0f, true, 64, DifferenceAbsolute);
+            ::SimdRelease(context[i]);
+        }
+        ::SimdRelease(workspace);
+
+        return result;
+    }
+
+    bool SynetWorkspaceContextAutoTest(SimdSynetContextType type, void * context, size_t expected, const String & desc)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetWorkspace for " << desc << " context.");
+
+        void* workspace = ::SimdSynetWorkspaceInit();
+        size_t index = ::SimdSynetWorkspaceAddContext(workspace, type, context, 0);
+        size_t size = ::SimdSynetWorkspaceSize(workspace);
+        if (expected == 0 || size != Simd::AlignHi(expected, SIMD_ALIGN) || ::SimdSynetWorkspaceOffset(workspace, index) != 0)
+        {
+            TEST_LOG_SS(Error, "Workspace size " << size << " doesn't match external buffer size " << expected << " of " << desc << " context!");
+            result = false;
+        }
+        ::SimdRelease(workspace);
+        ::SimdRelease(context);
+
+        return result;
+    }
+
+    bool SynetWorkspaceAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetWorkspacePlanAutoTest(Shape({ 100, 200, 300, 400 }), Shape({ 0, 1, 2, 3 }), Shape({ 0, 1, 2, 3 }));
+        result = result && SynetWorkspacePlanAutoTest(Shape({ 1000, 64, 3000, 129, 0, 777, 2048 }), Shape({ 0, 0, 1, 2, 2, 3, 4 }), Shape({ 1, 4, 2, 3, 5, 5, 4 }));
+        result = result && SynetWorkspacePlanAutoTest(Shape({ 512, 512, 512 }), Shape({ 0, 0, 0 }), Shape({ 9, 9, 9 }));
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aId = SimdConvolutionActivationIdentity;
+
+        Params chain1;
+        chain1.push_back(Param(1, 16, 32, 32, 32, _3, _1, _1, _1, _1, 1, aRe, t0));
+        chain1.push_back(Param(1, 32, 32, 32, 32, _3, _1, _2, _1, _1, 32, aRe, t0));
+        chain1.push_back(Param(1, 32, 16, 16, 64, _1, _1, _1, _0, _0, 1, aId, t0));
+        result = result && SynetWorkspaceChainAutoTest(chain1);
+
+        Params chain2;
+        chain2.push_back(Param(1, 16, 32, 32, 32, _3, _1, _1, _1, _1, 1, aRe, t1));
+        chain2.push_back(Param(1, 32, 32, 32, 32, _3, _1, _2, _1, _1, 32, aRe, t1));
+        chain2.push_back(Param(1, 32, 16, 16, 64, _1, _1, _1, _0, _0, 1, aId, t1));
+        chain2.push_back(Param(1, 64, 16, 16, 16, _3, _1, _1, _1, _1, 1, aRe, t1));
+        result = result && SynetWorkspaceChainAutoTest(chain2);
+
+        void* attention = ::SimdSynetAttention32fInit(2, 4, 64, 96, 32, 0.125f, SimdSynetCompatibilityDefault);
+        result = result && SynetWorkspaceContextAutoTest(SimdSynetContextAttention32f, attention, 
+            ::SimdSynetAttention32fExternalBufferSize(attention) * sizeof(float), "FP32 attention");
+
+        void* innerProduct = ::SimdSynetInnerProduct8iInit(4, 256, 128, SimdTrue, SimdTensorData32f, SimdTensorData32f, aRe, SimdSynetCompatibilityDefault);
+        result = result && SynetWorkspaceContextAutoTest(SimdSynetContextInnerProduct8i, innerProduct, 
+            ::SimdSynetInnerProduct8iExternalBufferSize(innerProduct), "INT8 inner product");
+
+        return result;
+    }
+#endif
+}
@@ -542,6 +542,7 @@ namespace Test
         case SimdTensorData8u: return "8u";
         case SimdTensorData16b: return "16b";
         case SimdTensorData16f: return "16f";
+        case SimdTensorData16u: return "16u";
         default: assert(0); return "Assert";
         }
     }
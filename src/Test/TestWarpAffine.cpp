@@ -253,6 +253,186 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncWAB
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+            mutable SimdBool valid;
+
+            FuncWAB(const FuncPtr & f, const String & d) : func(f), description(d), valid(SimdFalse) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, size_t count, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t");
+                ss << ":" << srcW << "x" << srcH << "->" << count << "x" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, Views & dst, size_t channels, const float* mats, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            {
+                void * context = func(src.width, src.height, src.stride, dst[0].width, dst[0].height, dst[0].stride, channels, flags, border);
+                if (context)
+                {
+                    std::vector<uint8_t*> ptrs(dst.size());
+                    for (size_t i = 0; i < dst.size(); ++i)
+                    {
+                        if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                            Simd::Copy(buf, dst[i]);
+                        ptrs[i] = dst[i].data;
+                    }
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        valid = SimdWarpAffineBatchRun(context, src.data, ptrs.size(), mats, ptrs.data());
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WAB(function) \
+    FuncWAB(function, std::string(#function))
+
+    bool WarpAffineBatchAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, size_t count, size_t degenerate, SimdWarpAffineFlags flags, FuncWAB f1, FuncWAB f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, count, flags);
+        f2.Update(srcW, srcH, dstW, dstH, channels, count, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format = View::None;
+        switch (channels)
+        {
+        case 1: format = View::Gray8; break;
+        case 2: format = View::Uv16; break;
+        case 3: format = View::Bgr24; break;
+        case 4: format = View::Bgra32; break;
+        default:
+            assert(0);
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        ::srand(0);
+        FillPicture(src);
+
+        Buffer32f mats(count * 6);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float angle = float(Random()) * 2.0f - 1.0f, scale = 0.5f + float(Random());
+            float cx = float(Random() * srcW), cy = float(Random() * srcH);
+            float c = ::cos(angle) * scale, s = ::sin(angle) * scale;
+            float* m = mats.data() + i * 6;
+            m[0] = c, m[1] = -s, m[2] = float(dstW / 2) - c * cx + s * cy;
+            m[3] = s, m[4] = c, m[5] = float(dstH / 2) - s * cx - c * cy;
+            if (degenerate && i % degenerate == degenerate - 1)
+                m[0] = 0, m[1] = 0, m[3] = 0, m[4] = 0;
+        }
+
+        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(buf, 0x33);
+        Views dst1(count), dst2(count), dst3(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst1[i].Recreate(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            dst2[i].Recreate(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            dst3[i].Recreate(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            Simd::Fill(dst1[i], 0x11);
+            Simd::Fill(dst2[i], 0x99);
+            Simd::Copy(buf, dst3[i]);
+        }
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mats.data(), flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mats.data(), flags, border, buf));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            void* context = SimdWarpAffineInit(srcW, srcH, src.stride, dstW, dstH, dst3[i].stride, channels, mats.data() + i * 6, flags, border);
+            if (context)
+            {
+                SimdWarpAffineRun(context, src.data, dst3[i].data);
+                SimdRelease(context);
+            }
+            else if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
+                SimdFillPixel(dst3[i].data, dst3[i].stride, dstW, dstH, border, channels);
+        }
+
+        if (f1.valid != f2.valid || (f1.valid == SimdTrue) != (degenerate == 0))
+        {
+            TEST_LOG_SS(Error, "Wrong status of batched warp affine: " << f1.valid << " and " << f2.valid << " !");
+            result = false;
+        }
+
+#if !((defined(WIN32) && defined(SIMD_X86_ENABLE) && defined(_DEBUG)) || (defined(__clang__) && !defined(NDEBUG)))
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            result = result && Compare(dst1[i], dst2[i], 0, true, 64, 0, "dst1 & dst2");
+            result = result && Compare(dst2[i], dst3[i], 0, true, 64, 0, "dst2 & dst3");
+        }
+#endif
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const FuncWAB & f1, const FuncWAB & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            for (size_t b = 0; b < border.size(); ++b)
+            {
+                SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | border[b]);
+                for (size_t c = 1; c <= 4; ++c)
+                    result = result && WarpAffineBatchAutoTest(W, H, 112 + O, 112 - O, c, 64, 0, flags, f1, f2);
+                result = result && WarpAffineBatchAutoTest(W, H, 112 + O, 112 - O, 3, 16, 5, flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Base::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Sse41::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx2::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx512bw::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+        return result;
+    }
 }
 
 //-------------------------------------------------------------------------------------------------
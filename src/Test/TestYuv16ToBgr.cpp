@@ -0,0 +1,452 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncYuv16
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, int bitDepth, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuv16(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& u, const View& v, int bitDepth, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncYuv16A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, int bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuv16A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& u, const View& v, int bitDepth, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+
+        struct FuncYuv16F
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, int bitDepth, float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncYuv16F(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& u, const View& v, int bitDepth, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, 
+                    dst.Row<float>(0), dst.Row<float>(y.height), dst.Row<float>(2 * y.height), dst.stride / sizeof(float), yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV16(function) FuncYuv16(function, #function)
+#define FUNC_YUV16A(function) FuncYuv16A(function, #function)
+#define FUNC_YUV16F(function) FuncYuv16F(function, #function)
+
+    template<class Func> bool Yuv16ToAnyAutoTest(int width, int height, int dx, int dy, int bitDepth, View::Format dstType, SimdYuvType yuvType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] " << bitDepth << "-bit.");
+
+        const int uvWidth = width / dx;
+        const int uvHeight = height / dy;
+        const uint16_t hi = uint16_t((1 << bitDepth) - 1);
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y, 0, hi);
+        View u(uvWidth, uvHeight, View::Int16, NULL, TEST_ALIGN(uvWidth));
+        FillRandom16u(u, 0, hi);
+        View v(uvWidth, uvHeight, View::Int16, NULL, TEST_ALIGN(uvWidth));
+        FillRandom16u(v, 0, hi);
+        uint8_t alpha = Random(256);
+
+        const int dstHeight = dstType == View::Float ? height * 3 : height;
+        View dst1(width, dstHeight, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, dstHeight, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, bitDepth, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, bitDepth, dst2, alpha, yuvType));
+
+        if (dstType == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    template<class Func> bool Yuv16ToAnyAutoTest(int dx, int dy, View::Format dstType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(W, H, dx, dy, 10, dstType, SimdYuvBt601, f1, f2);
+        result = result && Yuv16ToAnyAutoTest(W + O * 2, H - O * 2, dx, dy, 12, dstType, SimdYuvBt709, f1, f2);
+        result = result && Yuv16ToAnyAutoTest(W - O * 2, H + O * 2, dx, dy, 16, dstType, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgr24, FUNC_YUV16(Simd::Base::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgr24, FUNC_YUV16(Simd::Sse41::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgr24, FUNC_YUV16(Simd::Avx2::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgr24, FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgra32, FUNC_YUV16A(Simd::Base::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgra32, FUNC_YUV16A(Simd::Sse41::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgra32, FUNC_YUV16A(Simd::Avx2::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Bgra32, FUNC_YUV16A(Simd::Avx512bw::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrPlanar32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(2, 2, View::Float, FUNC_YUV16F(Simd::Base::Yuv420p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv420p16ToBgrPlanar32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DF)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Float, FUNC_YUV16F(Simd::Sse41::Yuv420p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv420p16ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Float, FUNC_YUV16F(Simd::Avx2::Yuv420p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv420p16ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(2, 2, View::Float, FUNC_YUV16F(Simd::Avx512bw::Yuv420p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv420p16ToBgrPlanar32f));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444p16ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgr24, FUNC_YUV16(Simd::Base::Yuv444p16ToBgr), FUNC_YUV16(SimdYuv444p16ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgr24, FUNC_YUV16(Simd::Sse41::Yuv444p16ToBgr), FUNC_YUV16(SimdYuv444p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgr24, FUNC_YUV16(Simd::Avx2::Yuv444p16ToBgr), FUNC_YUV16(SimdYuv444p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgr24, FUNC_YUV16(Simd::Avx512bw::Yuv444p16ToBgr), FUNC_YUV16(SimdYuv444p16ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgra32, FUNC_YUV16A(Simd::Base::Yuv444p16ToBgra), FUNC_YUV16A(SimdYuv444p16ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgra32, FUNC_YUV16A(Simd::Sse41::Yuv444p16ToBgra), FUNC_YUV16A(SimdYuv444p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgra32, FUNC_YUV16A(Simd::Avx2::Yuv444p16ToBgra), FUNC_YUV16A(SimdYuv444p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Bgra32, FUNC_YUV16A(Simd::Avx512bw::Yuv444p16ToBgra), FUNC_YUV16A(SimdYuv444p16ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv444p16ToBgrPlanar32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv16ToAnyAutoTest(1, 1, View::Float, FUNC_YUV16F(Simd::Base::Yuv444p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv444p16ToBgrPlanar32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DF)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Float, FUNC_YUV16F(Simd::Sse41::Yuv444p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv444p16ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Float, FUNC_YUV16F(Simd::Avx2::Yuv444p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv444p16ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv16ToAnyAutoTest(1, 1, View::Float, FUNC_YUV16F(Simd::Avx512bw::Yuv444p16ToBgrPlanar32f), FUNC_YUV16F(SimdYuv444p16ToBgrPlanar32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP010
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncP010(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncP010A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncP010A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+
+        struct FuncP010F
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                float* blue, float* green, float* red, size_t dstStride, SimdYuvType yuvType);
+
+            FuncPtr func;
+            String description;
+
+            FuncP010F(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, 
+                    dst.Row<float>(0), dst.Row<float>(y.height), dst.Row<float>(2 * y.height), dst.stride / sizeof(float), yuvType);
+            }
+        };
+    }
+
+#define FUNC_P010(function) FuncP010(function, #function)
+#define FUNC_P010A(function) FuncP010A(function, #function)
+#define FUNC_P010F(function) FuncP010F(function, #function)
+
+    template<class Func> bool P010ToAnyAutoTest(int width, int height, View::Format dstType, SimdYuvType yuvType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / 2;
+        const int uvHeight = height / 2;
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y);
+        View uv(uvWidth * 2, uvHeight, View::Int16, NULL, TEST_ALIGN(uvWidth));
+        FillRandom16u(uv);
+        uint8_t alpha = Random(256);
+
+        const int dstHeight = dstType == View::Float ? height * 3 : height;
+        View dst1(width, dstHeight, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, dstHeight, dstType, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        if (dstType == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    template<class Func> bool P010ToAnyAutoTest(View::Format dstType, const Func& f1, const Func& f2)
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(W, H, dstType, SimdYuvBt601, f1, f2);
+        result = result && P010ToAnyAutoTest(W + O * 2, H - O * 2, dstType, SimdYuvBt709, f1, f2);
+        result = result && P010ToAnyAutoTest(W - O * 2, H + O * 2, dstType, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    bool P010ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(View::Bgr24, FUNC_P010(Simd::Base::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && P010ToAnyAutoTest(View::Bgr24, FUNC_P010(Simd::Sse41::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && P010ToAnyAutoTest(View::Bgr24, FUNC_P010(Simd::Avx2::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToAnyAutoTest(View::Bgr24, FUNC_P010(Simd::Avx512bw::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool P010ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(View::Bgra32, FUNC_P010A(Simd::Base::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && P010ToAnyAutoTest(View::Bgra32, FUNC_P010A(Simd::Sse41::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && P010ToAnyAutoTest(View::Bgra32, FUNC_P010A(Simd::Avx2::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToAnyAutoTest(View::Bgra32, FUNC_P010A(Simd::Avx512bw::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool P010ToBgrPlanar32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToAnyAutoTest(View::Float, FUNC_P010F(Simd::Base::P010ToBgrPlanar32f), FUNC_P010F(SimdP010ToBgrPlanar32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::DF)
+            result = result && P010ToAnyAutoTest(View::Float, FUNC_P010F(Simd::Sse41::P010ToBgrPlanar32f), FUNC_P010F(SimdP010ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && P010ToAnyAutoTest(View::Float, FUNC_P010F(Simd::Avx2::P010ToBgrPlanar32f), FUNC_P010F(SimdP010ToBgrPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToAnyAutoTest(View::Float, FUNC_P010F(Simd::Avx512bw::P010ToBgrPlanar32f), FUNC_P010F(SimdP010ToBgrPlanar32f));
+#endif 
+
+        return result;
+    }
+}